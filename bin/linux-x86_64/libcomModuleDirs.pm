@@ -0,0 +1,7 @@
+# This is a generated file, do not edit!
+
+use lib qw(
+    /root/repo/lib/perl
+);
+
+1;
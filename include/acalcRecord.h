@@ -0,0 +1,405 @@
+/* acalcRecord.h generated from acalcRecord.dbd */
+
+#ifndef INC_acalcRecord_H
+#define INC_acalcRecord_H
+
+#include "epicsTypes.h"
+#include "link.h"
+#include "epicsMutex.h"
+#include "ellLib.h"
+#include "epicsTime.h"
+#include "postfix.h"
+
+typedef struct acalcRecord {
+    char                name[61];   /* Record Name */
+    char                desc[41];   /* Descriptor */
+    char                asg[29];    /* Access Security Group */
+    epicsEnum16         scan;       /* Scan Mechanism */
+    epicsEnum16         pini;       /* Process at iocInit */
+    epicsInt16          phas;       /* Scan Phase */
+    char                evnt[40];   /* Event Name */
+    epicsInt16          tse;        /* Time Stamp Event */
+    DBLINK              tsel;       /* Time Stamp Link */
+    epicsEnum16         dtyp;       /* Device Type */
+    epicsInt16          disv;       /* Disable Value */
+    epicsInt16          disa;       /* Disable */
+    DBLINK              sdis;       /* Scanning Disable */
+    epicsMutexId        mlok;       /* Monitor lock */
+    ELLLIST             mlis;       /* Monitor List */
+    ELLLIST             bklnk;      /* Backwards link tracking */
+    epicsUInt8          disp;       /* Disable putField */
+    epicsUInt8          proc;       /* Force Processing */
+    epicsEnum16         stat;       /* Alarm Status */
+    epicsEnum16         sevr;       /* Alarm Severity */
+    epicsEnum16         nsta;       /* New Alarm Status */
+    epicsEnum16         nsev;       /* New Alarm Severity */
+    epicsEnum16         acks;       /* Alarm Ack Severity */
+    epicsEnum16         ackt;       /* Alarm Ack Transient */
+    epicsEnum16         diss;       /* Disable Alarm Sevrty */
+    epicsUInt8          lcnt;       /* Lock Count */
+    epicsUInt8          pact;       /* Record active */
+    epicsUInt8          putf;       /* dbPutField process */
+    epicsUInt8          rpro;       /* Reprocess  */
+    struct asgMember    *asp;       /* Access Security Pvt */
+    struct processNotify *ppn;      /* pprocessNotify */
+    struct processNotifyRecord *ppnr; /* pprocessNotifyRecord */
+    struct scan_element *spvt;      /* Scan Private */
+    struct typed_rset   *rset;      /* Address of RSET */
+    struct dset         *dset;      /* DSET address */
+    void                *dpvt;      /* Device Private */
+    struct dbRecordType *rdes;      /* Address of dbRecordType */
+    struct lockRecord   *lset;      /* Lock Set */
+    epicsEnum16         prio;       /* Scheduling Priority */
+    epicsUInt8          tpro;       /* Trace Processing */
+    char                bkpt;       /* Break Point */
+    epicsUInt8          udf;        /* Undefined */
+    epicsEnum16         udfs;       /* Undefined Alarm Sevrty */
+    epicsTimeStamp      time;       /* Time */
+    DBLINK              flnk;       /* Forward Process Link */
+    double *val;                    /* Result */
+    char                calc[80];   /* Calculation */
+    DBLINK              inpa;       /* Input A */
+    DBLINK              inpb;       /* Input B */
+    DBLINK              inpc;       /* Input C */
+    DBLINK              inpd;       /* Input D */
+    DBLINK              inpe;       /* Input E */
+    DBLINK              inpf;       /* Input F */
+    DBLINK              inpg;       /* Input G */
+    DBLINK              inph;       /* Input H */
+    DBLINK              inpi;       /* Input I */
+    DBLINK              inpj;       /* Input J */
+    DBLINK              inpk;       /* Input K */
+    DBLINK              inpl;       /* Input L */
+    char                egu[16];    /* Engineering Units */
+    epicsInt16          prec;       /* Display Precision */
+    epicsFloat64        hopr;       /* High Operating Rng */
+    epicsFloat64        lopr;       /* Low Operating Range */
+    epicsUInt32         nelm;       /* Number of Elements */
+    epicsUInt32         nord;       /* Number elements read */
+    double *a;                      /* Input value A */
+    double *b;                      /* Input value B */
+    double *c;                      /* Input value C */
+    double *d;                      /* Input value D */
+    double *e;                      /* Input value E */
+    double *f;                      /* Input value F */
+    double *g;                      /* Input value G */
+    double *h;                      /* Input value H */
+    double *i;                      /* Input value I */
+    double *j;                      /* Input value J */
+    double *k;                      /* Input value K */
+    double *l;                      /* Input value L */
+    epicsUInt32         na;         /* Num. elements in A */
+    epicsUInt32         nb;         /* Num. elements in B */
+    epicsUInt32         nc;         /* Num. elements in C */
+    epicsUInt32         nd;         /* Num. elements in D */
+    epicsUInt32         ne;         /* Num. elements in E */
+    epicsUInt32         nf;         /* Num. elements in F */
+    epicsUInt32         ng;         /* Num. elements in G */
+    epicsUInt32         nh;         /* Num. elements in H */
+    epicsUInt32         ni;         /* Num. elements in I */
+    epicsUInt32         nj;         /* Num. elements in J */
+    epicsUInt32         nk;         /* Num. elements in K */
+    epicsUInt32         nl;         /* Num. elements in L */
+    char	rpcl[INFIX_TO_POSTFIX_SIZE(80)]; /* Reverse Polish Calc */
+    calcCompiled	*cmpl;             /* Compiled Calc */
+} acalcRecord;
+
+typedef enum {
+	acalcRecordNAME = 0,
+	acalcRecordDESC = 1,
+	acalcRecordASG = 2,
+	acalcRecordSCAN = 3,
+	acalcRecordPINI = 4,
+	acalcRecordPHAS = 5,
+	acalcRecordEVNT = 6,
+	acalcRecordTSE = 7,
+	acalcRecordTSEL = 8,
+	acalcRecordDTYP = 9,
+	acalcRecordDISV = 10,
+	acalcRecordDISA = 11,
+	acalcRecordSDIS = 12,
+	acalcRecordMLOK = 13,
+	acalcRecordMLIS = 14,
+	acalcRecordBKLNK = 15,
+	acalcRecordDISP = 16,
+	acalcRecordPROC = 17,
+	acalcRecordSTAT = 18,
+	acalcRecordSEVR = 19,
+	acalcRecordNSTA = 20,
+	acalcRecordNSEV = 21,
+	acalcRecordACKS = 22,
+	acalcRecordACKT = 23,
+	acalcRecordDISS = 24,
+	acalcRecordLCNT = 25,
+	acalcRecordPACT = 26,
+	acalcRecordPUTF = 27,
+	acalcRecordRPRO = 28,
+	acalcRecordASP = 29,
+	acalcRecordPPN = 30,
+	acalcRecordPPNR = 31,
+	acalcRecordSPVT = 32,
+	acalcRecordRSET = 33,
+	acalcRecordDSET = 34,
+	acalcRecordDPVT = 35,
+	acalcRecordRDES = 36,
+	acalcRecordLSET = 37,
+	acalcRecordPRIO = 38,
+	acalcRecordTPRO = 39,
+	acalcRecordBKPT = 40,
+	acalcRecordUDF = 41,
+	acalcRecordUDFS = 42,
+	acalcRecordTIME = 43,
+	acalcRecordFLNK = 44,
+	acalcRecordVAL = 45,
+	acalcRecordCALC = 46,
+	acalcRecordINPA = 47,
+	acalcRecordINPB = 48,
+	acalcRecordINPC = 49,
+	acalcRecordINPD = 50,
+	acalcRecordINPE = 51,
+	acalcRecordINPF = 52,
+	acalcRecordINPG = 53,
+	acalcRecordINPH = 54,
+	acalcRecordINPI = 55,
+	acalcRecordINPJ = 56,
+	acalcRecordINPK = 57,
+	acalcRecordINPL = 58,
+	acalcRecordEGU = 59,
+	acalcRecordPREC = 60,
+	acalcRecordHOPR = 61,
+	acalcRecordLOPR = 62,
+	acalcRecordNELM = 63,
+	acalcRecordNORD = 64,
+	acalcRecordA = 65,
+	acalcRecordB = 66,
+	acalcRecordC = 67,
+	acalcRecordD = 68,
+	acalcRecordE = 69,
+	acalcRecordF = 70,
+	acalcRecordG = 71,
+	acalcRecordH = 72,
+	acalcRecordI = 73,
+	acalcRecordJ = 74,
+	acalcRecordK = 75,
+	acalcRecordL = 76,
+	acalcRecordNA = 77,
+	acalcRecordNB = 78,
+	acalcRecordNC = 79,
+	acalcRecordND = 80,
+	acalcRecordNE = 81,
+	acalcRecordNF = 82,
+	acalcRecordNG = 83,
+	acalcRecordNH = 84,
+	acalcRecordNI = 85,
+	acalcRecordNJ = 86,
+	acalcRecordNK = 87,
+	acalcRecordNL = 88,
+	acalcRecordRPCL = 89,
+	acalcRecordCMPL = 90
+} acalcFieldIndex;
+
+#ifdef GEN_SIZE_OFFSET
+
+#include <epicsAssert.h>
+#include <epicsExport.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+static int acalcRecordSizeOffset(dbRecordType *prt)
+{
+    acalcRecord *prec = 0;
+
+    assert(prt->no_fields == 91);
+    prt->papFldDes[acalcRecordNAME]->size = sizeof(prec->name);
+    prt->papFldDes[acalcRecordDESC]->size = sizeof(prec->desc);
+    prt->papFldDes[acalcRecordASG]->size = sizeof(prec->asg);
+    prt->papFldDes[acalcRecordSCAN]->size = sizeof(prec->scan);
+    prt->papFldDes[acalcRecordPINI]->size = sizeof(prec->pini);
+    prt->papFldDes[acalcRecordPHAS]->size = sizeof(prec->phas);
+    prt->papFldDes[acalcRecordEVNT]->size = sizeof(prec->evnt);
+    prt->papFldDes[acalcRecordTSE]->size = sizeof(prec->tse);
+    prt->papFldDes[acalcRecordTSEL]->size = sizeof(prec->tsel);
+    prt->papFldDes[acalcRecordDTYP]->size = sizeof(prec->dtyp);
+    prt->papFldDes[acalcRecordDISV]->size = sizeof(prec->disv);
+    prt->papFldDes[acalcRecordDISA]->size = sizeof(prec->disa);
+    prt->papFldDes[acalcRecordSDIS]->size = sizeof(prec->sdis);
+    prt->papFldDes[acalcRecordMLOK]->size = sizeof(prec->mlok);
+    prt->papFldDes[acalcRecordMLIS]->size = sizeof(prec->mlis);
+    prt->papFldDes[acalcRecordBKLNK]->size = sizeof(prec->bklnk);
+    prt->papFldDes[acalcRecordDISP]->size = sizeof(prec->disp);
+    prt->papFldDes[acalcRecordPROC]->size = sizeof(prec->proc);
+    prt->papFldDes[acalcRecordSTAT]->size = sizeof(prec->stat);
+    prt->papFldDes[acalcRecordSEVR]->size = sizeof(prec->sevr);
+    prt->papFldDes[acalcRecordNSTA]->size = sizeof(prec->nsta);
+    prt->papFldDes[acalcRecordNSEV]->size = sizeof(prec->nsev);
+    prt->papFldDes[acalcRecordACKS]->size = sizeof(prec->acks);
+    prt->papFldDes[acalcRecordACKT]->size = sizeof(prec->ackt);
+    prt->papFldDes[acalcRecordDISS]->size = sizeof(prec->diss);
+    prt->papFldDes[acalcRecordLCNT]->size = sizeof(prec->lcnt);
+    prt->papFldDes[acalcRecordPACT]->size = sizeof(prec->pact);
+    prt->papFldDes[acalcRecordPUTF]->size = sizeof(prec->putf);
+    prt->papFldDes[acalcRecordRPRO]->size = sizeof(prec->rpro);
+    prt->papFldDes[acalcRecordASP]->size = sizeof(prec->asp);
+    prt->papFldDes[acalcRecordPPN]->size = sizeof(prec->ppn);
+    prt->papFldDes[acalcRecordPPNR]->size = sizeof(prec->ppnr);
+    prt->papFldDes[acalcRecordSPVT]->size = sizeof(prec->spvt);
+    prt->papFldDes[acalcRecordRSET]->size = sizeof(prec->rset);
+    prt->papFldDes[acalcRecordDSET]->size = sizeof(prec->dset);
+    prt->papFldDes[acalcRecordDPVT]->size = sizeof(prec->dpvt);
+    prt->papFldDes[acalcRecordRDES]->size = sizeof(prec->rdes);
+    prt->papFldDes[acalcRecordLSET]->size = sizeof(prec->lset);
+    prt->papFldDes[acalcRecordPRIO]->size = sizeof(prec->prio);
+    prt->papFldDes[acalcRecordTPRO]->size = sizeof(prec->tpro);
+    prt->papFldDes[acalcRecordBKPT]->size = sizeof(prec->bkpt);
+    prt->papFldDes[acalcRecordUDF]->size = sizeof(prec->udf);
+    prt->papFldDes[acalcRecordUDFS]->size = sizeof(prec->udfs);
+    prt->papFldDes[acalcRecordTIME]->size = sizeof(prec->time);
+    prt->papFldDes[acalcRecordFLNK]->size = sizeof(prec->flnk);
+    prt->papFldDes[acalcRecordVAL]->size = sizeof(prec->val);
+    prt->papFldDes[acalcRecordCALC]->size = sizeof(prec->calc);
+    prt->papFldDes[acalcRecordINPA]->size = sizeof(prec->inpa);
+    prt->papFldDes[acalcRecordINPB]->size = sizeof(prec->inpb);
+    prt->papFldDes[acalcRecordINPC]->size = sizeof(prec->inpc);
+    prt->papFldDes[acalcRecordINPD]->size = sizeof(prec->inpd);
+    prt->papFldDes[acalcRecordINPE]->size = sizeof(prec->inpe);
+    prt->papFldDes[acalcRecordINPF]->size = sizeof(prec->inpf);
+    prt->papFldDes[acalcRecordINPG]->size = sizeof(prec->inpg);
+    prt->papFldDes[acalcRecordINPH]->size = sizeof(prec->inph);
+    prt->papFldDes[acalcRecordINPI]->size = sizeof(prec->inpi);
+    prt->papFldDes[acalcRecordINPJ]->size = sizeof(prec->inpj);
+    prt->papFldDes[acalcRecordINPK]->size = sizeof(prec->inpk);
+    prt->papFldDes[acalcRecordINPL]->size = sizeof(prec->inpl);
+    prt->papFldDes[acalcRecordEGU]->size = sizeof(prec->egu);
+    prt->papFldDes[acalcRecordPREC]->size = sizeof(prec->prec);
+    prt->papFldDes[acalcRecordHOPR]->size = sizeof(prec->hopr);
+    prt->papFldDes[acalcRecordLOPR]->size = sizeof(prec->lopr);
+    prt->papFldDes[acalcRecordNELM]->size = sizeof(prec->nelm);
+    prt->papFldDes[acalcRecordNORD]->size = sizeof(prec->nord);
+    prt->papFldDes[acalcRecordA]->size = sizeof(prec->a);
+    prt->papFldDes[acalcRecordB]->size = sizeof(prec->b);
+    prt->papFldDes[acalcRecordC]->size = sizeof(prec->c);
+    prt->papFldDes[acalcRecordD]->size = sizeof(prec->d);
+    prt->papFldDes[acalcRecordE]->size = sizeof(prec->e);
+    prt->papFldDes[acalcRecordF]->size = sizeof(prec->f);
+    prt->papFldDes[acalcRecordG]->size = sizeof(prec->g);
+    prt->papFldDes[acalcRecordH]->size = sizeof(prec->h);
+    prt->papFldDes[acalcRecordI]->size = sizeof(prec->i);
+    prt->papFldDes[acalcRecordJ]->size = sizeof(prec->j);
+    prt->papFldDes[acalcRecordK]->size = sizeof(prec->k);
+    prt->papFldDes[acalcRecordL]->size = sizeof(prec->l);
+    prt->papFldDes[acalcRecordNA]->size = sizeof(prec->na);
+    prt->papFldDes[acalcRecordNB]->size = sizeof(prec->nb);
+    prt->papFldDes[acalcRecordNC]->size = sizeof(prec->nc);
+    prt->papFldDes[acalcRecordND]->size = sizeof(prec->nd);
+    prt->papFldDes[acalcRecordNE]->size = sizeof(prec->ne);
+    prt->papFldDes[acalcRecordNF]->size = sizeof(prec->nf);
+    prt->papFldDes[acalcRecordNG]->size = sizeof(prec->ng);
+    prt->papFldDes[acalcRecordNH]->size = sizeof(prec->nh);
+    prt->papFldDes[acalcRecordNI]->size = sizeof(prec->ni);
+    prt->papFldDes[acalcRecordNJ]->size = sizeof(prec->nj);
+    prt->papFldDes[acalcRecordNK]->size = sizeof(prec->nk);
+    prt->papFldDes[acalcRecordNL]->size = sizeof(prec->nl);
+    prt->papFldDes[acalcRecordRPCL]->size = sizeof(prec->rpcl);
+    prt->papFldDes[acalcRecordCMPL]->size = sizeof(prec->cmpl);
+    prt->papFldDes[acalcRecordNAME]->offset = (unsigned short)((char *)&prec->name - (char *)prec);
+    prt->papFldDes[acalcRecordDESC]->offset = (unsigned short)((char *)&prec->desc - (char *)prec);
+    prt->papFldDes[acalcRecordASG]->offset = (unsigned short)((char *)&prec->asg - (char *)prec);
+    prt->papFldDes[acalcRecordSCAN]->offset = (unsigned short)((char *)&prec->scan - (char *)prec);
+    prt->papFldDes[acalcRecordPINI]->offset = (unsigned short)((char *)&prec->pini - (char *)prec);
+    prt->papFldDes[acalcRecordPHAS]->offset = (unsigned short)((char *)&prec->phas - (char *)prec);
+    prt->papFldDes[acalcRecordEVNT]->offset = (unsigned short)((char *)&prec->evnt - (char *)prec);
+    prt->papFldDes[acalcRecordTSE]->offset = (unsigned short)((char *)&prec->tse - (char *)prec);
+    prt->papFldDes[acalcRecordTSEL]->offset = (unsigned short)((char *)&prec->tsel - (char *)prec);
+    prt->papFldDes[acalcRecordDTYP]->offset = (unsigned short)((char *)&prec->dtyp - (char *)prec);
+    prt->papFldDes[acalcRecordDISV]->offset = (unsigned short)((char *)&prec->disv - (char *)prec);
+    prt->papFldDes[acalcRecordDISA]->offset = (unsigned short)((char *)&prec->disa - (char *)prec);
+    prt->papFldDes[acalcRecordSDIS]->offset = (unsigned short)((char *)&prec->sdis - (char *)prec);
+    prt->papFldDes[acalcRecordMLOK]->offset = (unsigned short)((char *)&prec->mlok - (char *)prec);
+    prt->papFldDes[acalcRecordMLIS]->offset = (unsigned short)((char *)&prec->mlis - (char *)prec);
+    prt->papFldDes[acalcRecordBKLNK]->offset = (unsigned short)((char *)&prec->bklnk - (char *)prec);
+    prt->papFldDes[acalcRecordDISP]->offset = (unsigned short)((char *)&prec->disp - (char *)prec);
+    prt->papFldDes[acalcRecordPROC]->offset = (unsigned short)((char *)&prec->proc - (char *)prec);
+    prt->papFldDes[acalcRecordSTAT]->offset = (unsigned short)((char *)&prec->stat - (char *)prec);
+    prt->papFldDes[acalcRecordSEVR]->offset = (unsigned short)((char *)&prec->sevr - (char *)prec);
+    prt->papFldDes[acalcRecordNSTA]->offset = (unsigned short)((char *)&prec->nsta - (char *)prec);
+    prt->papFldDes[acalcRecordNSEV]->offset = (unsigned short)((char *)&prec->nsev - (char *)prec);
+    prt->papFldDes[acalcRecordACKS]->offset = (unsigned short)((char *)&prec->acks - (char *)prec);
+    prt->papFldDes[acalcRecordACKT]->offset = (unsigned short)((char *)&prec->ackt - (char *)prec);
+    prt->papFldDes[acalcRecordDISS]->offset = (unsigned short)((char *)&prec->diss - (char *)prec);
+    prt->papFldDes[acalcRecordLCNT]->offset = (unsigned short)((char *)&prec->lcnt - (char *)prec);
+    prt->papFldDes[acalcRecordPACT]->offset = (unsigned short)((char *)&prec->pact - (char *)prec);
+    prt->papFldDes[acalcRecordPUTF]->offset = (unsigned short)((char *)&prec->putf - (char *)prec);
+    prt->papFldDes[acalcRecordRPRO]->offset = (unsigned short)((char *)&prec->rpro - (char *)prec);
+    prt->papFldDes[acalcRecordASP]->offset = (unsigned short)((char *)&prec->asp - (char *)prec);
+    prt->papFldDes[acalcRecordPPN]->offset = (unsigned short)((char *)&prec->ppn - (char *)prec);
+    prt->papFldDes[acalcRecordPPNR]->offset = (unsigned short)((char *)&prec->ppnr - (char *)prec);
+    prt->papFldDes[acalcRecordSPVT]->offset = (unsigned short)((char *)&prec->spvt - (char *)prec);
+    prt->papFldDes[acalcRecordRSET]->offset = (unsigned short)((char *)&prec->rset - (char *)prec);
+    prt->papFldDes[acalcRecordDSET]->offset = (unsigned short)((char *)&prec->dset - (char *)prec);
+    prt->papFldDes[acalcRecordDPVT]->offset = (unsigned short)((char *)&prec->dpvt - (char *)prec);
+    prt->papFldDes[acalcRecordRDES]->offset = (unsigned short)((char *)&prec->rdes - (char *)prec);
+    prt->papFldDes[acalcRecordLSET]->offset = (unsigned short)((char *)&prec->lset - (char *)prec);
+    prt->papFldDes[acalcRecordPRIO]->offset = (unsigned short)((char *)&prec->prio - (char *)prec);
+    prt->papFldDes[acalcRecordTPRO]->offset = (unsigned short)((char *)&prec->tpro - (char *)prec);
+    prt->papFldDes[acalcRecordBKPT]->offset = (unsigned short)((char *)&prec->bkpt - (char *)prec);
+    prt->papFldDes[acalcRecordUDF]->offset = (unsigned short)((char *)&prec->udf - (char *)prec);
+    prt->papFldDes[acalcRecordUDFS]->offset = (unsigned short)((char *)&prec->udfs - (char *)prec);
+    prt->papFldDes[acalcRecordTIME]->offset = (unsigned short)((char *)&prec->time - (char *)prec);
+    prt->papFldDes[acalcRecordFLNK]->offset = (unsigned short)((char *)&prec->flnk - (char *)prec);
+    prt->papFldDes[acalcRecordVAL]->offset = (unsigned short)((char *)&prec->val - (char *)prec);
+    prt->papFldDes[acalcRecordCALC]->offset = (unsigned short)((char *)&prec->calc - (char *)prec);
+    prt->papFldDes[acalcRecordINPA]->offset = (unsigned short)((char *)&prec->inpa - (char *)prec);
+    prt->papFldDes[acalcRecordINPB]->offset = (unsigned short)((char *)&prec->inpb - (char *)prec);
+    prt->papFldDes[acalcRecordINPC]->offset = (unsigned short)((char *)&prec->inpc - (char *)prec);
+    prt->papFldDes[acalcRecordINPD]->offset = (unsigned short)((char *)&prec->inpd - (char *)prec);
+    prt->papFldDes[acalcRecordINPE]->offset = (unsigned short)((char *)&prec->inpe - (char *)prec);
+    prt->papFldDes[acalcRecordINPF]->offset = (unsigned short)((char *)&prec->inpf - (char *)prec);
+    prt->papFldDes[acalcRecordINPG]->offset = (unsigned short)((char *)&prec->inpg - (char *)prec);
+    prt->papFldDes[acalcRecordINPH]->offset = (unsigned short)((char *)&prec->inph - (char *)prec);
+    prt->papFldDes[acalcRecordINPI]->offset = (unsigned short)((char *)&prec->inpi - (char *)prec);
+    prt->papFldDes[acalcRecordINPJ]->offset = (unsigned short)((char *)&prec->inpj - (char *)prec);
+    prt->papFldDes[acalcRecordINPK]->offset = (unsigned short)((char *)&prec->inpk - (char *)prec);
+    prt->papFldDes[acalcRecordINPL]->offset = (unsigned short)((char *)&prec->inpl - (char *)prec);
+    prt->papFldDes[acalcRecordEGU]->offset = (unsigned short)((char *)&prec->egu - (char *)prec);
+    prt->papFldDes[acalcRecordPREC]->offset = (unsigned short)((char *)&prec->prec - (char *)prec);
+    prt->papFldDes[acalcRecordHOPR]->offset = (unsigned short)((char *)&prec->hopr - (char *)prec);
+    prt->papFldDes[acalcRecordLOPR]->offset = (unsigned short)((char *)&prec->lopr - (char *)prec);
+    prt->papFldDes[acalcRecordNELM]->offset = (unsigned short)((char *)&prec->nelm - (char *)prec);
+    prt->papFldDes[acalcRecordNORD]->offset = (unsigned short)((char *)&prec->nord - (char *)prec);
+    prt->papFldDes[acalcRecordA]->offset = (unsigned short)((char *)&prec->a - (char *)prec);
+    prt->papFldDes[acalcRecordB]->offset = (unsigned short)((char *)&prec->b - (char *)prec);
+    prt->papFldDes[acalcRecordC]->offset = (unsigned short)((char *)&prec->c - (char *)prec);
+    prt->papFldDes[acalcRecordD]->offset = (unsigned short)((char *)&prec->d - (char *)prec);
+    prt->papFldDes[acalcRecordE]->offset = (unsigned short)((char *)&prec->e - (char *)prec);
+    prt->papFldDes[acalcRecordF]->offset = (unsigned short)((char *)&prec->f - (char *)prec);
+    prt->papFldDes[acalcRecordG]->offset = (unsigned short)((char *)&prec->g - (char *)prec);
+    prt->papFldDes[acalcRecordH]->offset = (unsigned short)((char *)&prec->h - (char *)prec);
+    prt->papFldDes[acalcRecordI]->offset = (unsigned short)((char *)&prec->i - (char *)prec);
+    prt->papFldDes[acalcRecordJ]->offset = (unsigned short)((char *)&prec->j - (char *)prec);
+    prt->papFldDes[acalcRecordK]->offset = (unsigned short)((char *)&prec->k - (char *)prec);
+    prt->papFldDes[acalcRecordL]->offset = (unsigned short)((char *)&prec->l - (char *)prec);
+    prt->papFldDes[acalcRecordNA]->offset = (unsigned short)((char *)&prec->na - (char *)prec);
+    prt->papFldDes[acalcRecordNB]->offset = (unsigned short)((char *)&prec->nb - (char *)prec);
+    prt->papFldDes[acalcRecordNC]->offset = (unsigned short)((char *)&prec->nc - (char *)prec);
+    prt->papFldDes[acalcRecordND]->offset = (unsigned short)((char *)&prec->nd - (char *)prec);
+    prt->papFldDes[acalcRecordNE]->offset = (unsigned short)((char *)&prec->ne - (char *)prec);
+    prt->papFldDes[acalcRecordNF]->offset = (unsigned short)((char *)&prec->nf - (char *)prec);
+    prt->papFldDes[acalcRecordNG]->offset = (unsigned short)((char *)&prec->ng - (char *)prec);
+    prt->papFldDes[acalcRecordNH]->offset = (unsigned short)((char *)&prec->nh - (char *)prec);
+    prt->papFldDes[acalcRecordNI]->offset = (unsigned short)((char *)&prec->ni - (char *)prec);
+    prt->papFldDes[acalcRecordNJ]->offset = (unsigned short)((char *)&prec->nj - (char *)prec);
+    prt->papFldDes[acalcRecordNK]->offset = (unsigned short)((char *)&prec->nk - (char *)prec);
+    prt->papFldDes[acalcRecordNL]->offset = (unsigned short)((char *)&prec->nl - (char *)prec);
+    prt->papFldDes[acalcRecordRPCL]->offset = (unsigned short)((char *)&prec->rpcl - (char *)prec);
+    prt->papFldDes[acalcRecordCMPL]->offset = (unsigned short)((char *)&prec->cmpl - (char *)prec);
+    prt->rec_size = sizeof(*prec);
+    return 0;
+}
+epicsExportRegistrar(acalcRecordSizeOffset);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* GEN_SIZE_OFFSET */
+
+#endif /* INC_acalcRecord_H */
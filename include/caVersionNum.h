@@ -0,0 +1,7 @@
+#ifndef CAVERSION_H
+#  error include caVersion.h, not this header
+#endif
+#define EPICS_CA_MAJOR_VERSION 4
+#define EPICS_CA_MINOR_VERSION 13
+#define EPICS_CA_MAINTENANCE_VERSION 5
+#define EPICS_CA_DEVELOPMENT_FLAG 1
@@ -0,0 +1,99 @@
+/*************************************************************************\
+* Copyright (c) 2002 The University of Chicago, as Operator of Argonne
+*     National Laboratory.
+* Copyright (c) 2002 The Regents of the University of California, as
+*     Operator of Los Alamos National Laboratory.
+* EPICS BASE Versions 3.13.7
+* and higher are distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution. 
+\*************************************************************************/
+/* dbLock.h */
+/*	Author: Marty Kraimer	Date: 12MAR96	*/
+
+#ifndef INCdbLockh
+#define INCdbLockh
+
+#include <stddef.h>
+
+#include "ellLib.h"
+#include "shareLib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct dbCommon;
+struct dbBase;
+typedef struct dbLocker dbLocker;
+
+epicsShareFunc void dbScanLock(struct dbCommon *precord);
+epicsShareFunc void dbScanUnlock(struct dbCommon *precord);
+
+epicsShareFunc dbLocker *dbLockerAlloc(struct dbCommon * const *precs,
+                                       size_t nrecs,
+                                       unsigned int flags);
+
+epicsShareFunc void dbLockerFree(dbLocker *);
+
+epicsShareFunc void dbScanLockMany(dbLocker*);
+epicsShareFunc void dbScanUnlockMany(dbLocker*);
+
+/* Lock-free reads of a record's fields.
+ *
+ * dbScanSnapshotBegin() returns 0 if the lockSet is currently held,
+ * in which case the caller must fall back to dbScanLock().
+ * Otherwise the caller may copy fields it knows to be safe to read
+ * from a torn record (ie. plain scalars, no pointers to follow), then
+ * calls dbScanSnapshotEnd(), which returns 1 if no other thread
+ * locked the lockSet in between and the copy is consistent.
+ * dbScanSnapshotEnd() must always be called after a successful
+ * dbScanSnapshotBegin().
+ */
+typedef struct dbScanSnapshot {
+    struct dbCommon *precord;
+    void *plockSet;
+    size_t seq;
+} dbScanSnapshot;
+
+epicsShareExtern int dbLockSnapshotGets;
+
+/* Attempts before a reader gives up and takes the lock */
+#define DBSCAN_SNAPSHOT_TRIES 2
+
+epicsShareFunc int dbScanSnapshotBegin(struct dbCommon *precord,
+                                       dbScanSnapshot *psnap);
+epicsShareFunc int dbScanSnapshotEnd(dbScanSnapshot *psnap);
+
+epicsShareFunc unsigned long dbLockGetLockId(
+    struct dbCommon *precord);
+
+epicsShareFunc void dbLockInitRecords(struct dbBase *pdbbase);
+epicsShareFunc void dbLockCleanupRecords(struct dbBase *pdbbase);
+
+
+/* Lock Set Report */
+epicsShareFunc long dblsr(char *recordname,int level);
+/* If recordname NULL then all records*/
+/* level = (0,1,2) (lock set state, + recordname, +DB links) */
+
+epicsShareFunc long dbLockShowLocked(int level);
+
+/* Lock Set Analysis: size distribution, then the nsets largest sets
+ * with their lock contention and how they would split if their NPP
+ * links were CA links.  level>0 also lists those NPP links.
+ */
+epicsShareFunc long dblsa(int nsets, int level);
+epicsShareFunc void dbLockStatsReset(void);
+
+/*KLUDGE to support field TPRO*/
+epicsShareFunc int * dbLockSetAddrTrace(struct dbCommon *precord);
+
+/* debugging */
+epicsShareFunc unsigned long dbLockGetRefs(struct dbCommon*);
+epicsShareFunc unsigned long dbLockCountSets(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*INCdbLockh*/
@@ -0,0 +1,20 @@
+/*************************************************************************\
+* Copyright (c) 2002 The University of Chicago, as Operator of Argonne
+*     National Laboratory.
+* Copyright (c) 2002 The Regents of the University of California, as
+*     Operator of Los Alamos National Laboratory.
+* EPICS BASE Versions 3.13.7
+* and higher are distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution. 
+\*************************************************************************/
+/*
+ * unixFileName.h
+ * Author: Jeff Hill
+ */
+#ifndef unixFileNameH
+#define unixFileNameH
+
+#define OSI_PATH_LIST_SEPARATOR ":"
+#define OSI_PATH_SEPARATOR "/"
+
+#endif /* unixFileNameH */
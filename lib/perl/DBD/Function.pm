@@ -0,0 +1,9 @@
+package DBD::Function;
+use DBD::Base;
+@ISA = qw(DBD::Base);
+
+sub init {
+    return shift->SUPER::init(shift, "function");
+}
+
+1;
@@ -43,6 +43,7 @@
 #   define CA_V411(MINOR) ((MINOR)>=11u)  /* sequence numbers in UDP version command */
 #   define CA_V412(MINOR) ((MINOR)>=12u)  /* TCP-based search requests */
 #   define CA_V413(MINOR) ((MINOR)>=13u)  /* Allow zero length in requests. */
+#   define CA_V414(MINOR) ((MINOR)>=14u)  /* shared memory transport on same host */
 
 /*
  * These port numbers are only used if the CA repeater and 
@@ -109,8 +110,10 @@ typedef ca_uint32_t     caResId;
 #define CA_PROTO_SIGNAL         25u /* knock the server out of select */
 #define CA_PROTO_CREATE_CH_FAIL 26u /* unable to create chan resource in server */
 #define CA_PROTO_SERVER_DISCONN 27u /* server deletes PV (or channel) */
+#define CA_PROTO_SHM_REQUEST    28u /* CA V4.14 offer/accept shared memory */
+#define CA_PROTO_SHM_SWITCH     29u /* CA V4.14 stream continues in shared memory */
 
-#define CA_PROTO_LAST_CMMD CA_PROTO_SERVER_DISCONN
+#define CA_PROTO_LAST_CMMD CA_PROTO_SHM_SWITCH
 
 /*
  * for use with search and not_found (if search fails and
@@ -0,0 +1,762 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *
+ *  CA search cache
+ *
+ *  PURPOSE:
+ *  Every CA client resolves its channels with UDP searches that are
+ *  broadcast to all of the servers on the subnet. When many clients on
+ *  one host start up (or when one client connects to a large number of
+ *  PVs) the same names are searched for again and again by each of them.
+ *
+ *  This program answers CA search requests from its clients with PV name
+ *  to server address mappings learned from earlier search replies. Names
+ *  that are not in the cache are searched for upstream on behalf of all
+ *  of the clients that asked for them, and repeated upstream searches for
+ *  a name back off exponentially. Server beacons, received through the CA
+ *  repeater, are used to flush the names of a server when it restarts or
+ *  when its beacons stop. Any other name is flushed when its time to live
+ *  expires.
+ *
+ *  Clients use the cache by listing its address (and port) in
+ *  EPICS_CA_ADDR_LIST with EPICS_CA_AUTO_ADDR_LIST=NO. The cache itself
+ *  searches the destinations from EPICS_CA_ADDR_LIST and
+ *  EPICS_CA_AUTO_ADDR_LIST at EPICS_CA_SERVER_PORT.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "envDefs.h"
+#include "errlog.h"
+#include "osiWireFormat.h"
+
+#include "caSearchCache.h"
+
+static const double housekeepingPeriod = 1.0; // sec
+static const double statisticsPeriod = 60.0; // sec
+static const double repeaterRegistrationPeriod = 60.0; // sec
+static const double minUpstreamRetryDelay = 0.05; // sec
+static const double maxUpstreamRetryDelay = 30.0; // sec
+static const double waiterTimeout = 60.0; // sec
+
+void * bheFreeStoreMgr::allocate ( size_t size )
+{
+    return freeList.allocate ( size );
+}
+
+void bheFreeStoreMgr::release ( void * pCadaver )
+{
+    freeList.release ( pCadaver );
+}
+
+searchRequest::~searchRequest ()
+{
+    while ( searchWaiter * pWaiter = this->waiters.get () ) {
+        delete pWaiter;
+    }
+}
+
+void searchCacheSocket::callBack ()
+{
+    char buf [MAX_UDP_RECV];
+    osiSockAddr addr;
+    osiSocklen_t addrSize = ( osiSocklen_t ) sizeof ( addr );
+
+    int status = recvfrom ( this->getFD (), buf, sizeof ( buf ), 0,
+                            & addr.sa, & addrSize );
+    if ( status < 0 ) {
+        int errnoCpy = SOCKERRNO;
+        // Avoid spurious ECONNREFUSED bug in linux
+        if ( errnoCpy != SOCK_ECONNREFUSED &&
+                errnoCpy != SOCK_ECONNRESET &&
+                    errnoCpy != SOCK_EWOULDBLOCK &&
+                        errnoCpy != SOCK_EINTR ) {
+            char sockErrBuf[64];
+            epicsSocketConvertErrnoToString (
+                sockErrBuf, sizeof ( sockErrBuf ) );
+            errlogPrintf ( "caSearchCache: unexpected UDP recv err: %s\n",
+                sockErrBuf );
+        }
+        return;
+    }
+    if ( addr.sa.sa_family != AF_INET ) {
+        return;
+    }
+    ( this->cache.*this->pRecv ) ( addr, buf, static_cast < unsigned > ( status ) );
+}
+
+searchCache::searchCache ( SOCKET clientSockIn, SOCKET serverSockIn,
+        unsigned short port, double timeToLiveIn, unsigned interestIn ) :
+    clientReg ( clientSockIn, *this, & searchCache::clientRecv ),
+    serverReg ( serverSockIn, *this, & searchCache::serverRecv ),
+    programBeginTime ( epicsTime::getCurrent () ),
+    lastStatisticsTime ( programBeginTime ),
+    timer ( fileDescriptorManager.createTimer () ),
+    timeToLive ( timeToLiveIn ),
+    connTMO ( CA_CONN_VERIFY_PERIOD ),
+    clientSock ( clientSockIn ),
+    serverSock ( serverSockIn ),
+    interest ( interestIn ),
+    registrationAttempts ( 0u ),
+    replyBytes ( 0u ),
+    searchBytes ( 0u ),
+    replySeqNo ( 0u ),
+    sequenceNumber ( 0u ),
+    nRequests ( 0u ),
+    nHits ( 0u ),
+    nMisses ( 0u ),
+    nSearchFrames ( 0u ),
+    nFlushed ( 0u ),
+    nExpired ( 0u ),
+    serverPort ( 0u ),
+    repeaterPort ( 0u ),
+    replySeqNoIsValid ( false ),
+    repeaterConfirmed ( false )
+{
+    memset ( & this->replyAddr, 0, sizeof ( this->replyAddr ) );
+
+    if ( envGetDoubleConfigParam ( & EPICS_CA_CONN_TMO, & this->connTMO ) ) {
+        this->connTMO = CA_CONN_VERIFY_PERIOD;
+        errlogPrintf ( "EPICS \"%s\" double fetch failed\n", EPICS_CA_CONN_TMO.name );
+        errlogPrintf ( "Defaulting \"%s\" = %f\n", EPICS_CA_CONN_TMO.name, this->connTMO );
+    }
+
+    this->serverPort =
+        envGetInetPortConfigParam ( &EPICS_CA_SERVER_PORT,
+                                    static_cast <unsigned short> (CA_SERVER_PORT) );
+    this->repeaterPort =
+        envGetInetPortConfigParam ( &EPICS_CA_REPEATER_PORT,
+                                    static_cast <unsigned short> (CA_REPEATER_PORT) );
+
+    /*
+     * never search ourselves when the cache port is
+     * in the address list of this process
+     */
+    ELLLIST tmpList = ELLLIST_INIT;
+    ellInit ( & this->destList );
+    configureChannelAccessAddressList ( & tmpList, serverSockIn, this->serverPort );
+    while ( osiSockAddrNode * pNode =
+            reinterpret_cast < osiSockAddrNode * > ( ellGet ( & tmpList ) ) ) {
+        if ( ntohs ( pNode->addr.ia.sin_port ) == port ) {
+            free ( pNode );
+        }
+        else {
+            ellAdd ( & this->destList, & pNode->node );
+        }
+    }
+    if ( ellCount ( & this->destList ) == 0 ) {
+        errlogPrintf ( "caSearchCache: empty EPICS_CA_ADDR_LIST, no servers will be searched\n" );
+    }
+
+    caStartRepeaterIfNotInstalled ( this->repeaterPort );
+
+    this->timer.start ( *this, 0.0 );
+}
+
+searchCache::~searchCache ()
+{
+    this->timer.destroy ();
+    ellFree ( & this->destList );
+}
+
+/*
+ * requests from the clients
+ */
+void searchCache::clientRecv ( const osiSockAddr & addr,
+    const char * pBuf, unsigned byteCount )
+{
+    epicsTime currentTime = epicsTime::getCurrent ();
+    ca_uint32_t seqNo = 0u;
+    bool seqNoIsValid = false;
+
+    while ( byteCount >= sizeof ( caHdr ) ) {
+        const caHdr * pCurMsg = reinterpret_cast < const caHdr * > ( pBuf );
+        AlignedWireRef < const epicsUInt16 > pstSize ( pCurMsg->m_postsize );
+        unsigned msgSize = pstSize + sizeof ( *pCurMsg );
+        if ( msgSize > byteCount ) {
+            break;
+        }
+
+        epicsUInt16 cmmd = AlignedWireRef < const epicsUInt16 > ( pCurMsg->m_cmmd );
+        epicsUInt16 count = AlignedWireRef < const epicsUInt16 > ( pCurMsg->m_count );
+        if ( cmmd == CA_PROTO_VERSION ) {
+            epicsUInt16 dataType =
+                AlignedWireRef < const epicsUInt16 > ( pCurMsg->m_dataType );
+            if ( CA_V411 ( count ) && ( dataType & sequenceNoIsValid ) ) {
+                seqNo = AlignedWireRef < const epicsUInt32 > ( pCurMsg->m_cid );
+                seqNoIsValid = true;
+            }
+        }
+        else if ( cmmd == CA_PROTO_SEARCH && pstSize > 1u ) {
+            /*
+             * the server address can only be handed to clients
+             * that take it from the search reply (V4.8 and later)
+             */
+            if ( CA_V48 ( count ) ) {
+                char name [MAX_UDP_SEND];
+                const char * pName = reinterpret_cast < const char * > ( pCurMsg + 1 );
+                unsigned nameLength = pstSize;
+                if ( nameLength >= sizeof ( name ) ) {
+                    nameLength = sizeof ( name ) - 1u;
+                }
+                memcpy ( name, pName, nameLength );
+                name[nameLength] = '\0';
+                this->searchRequestAction ( addr, name,
+                    AlignedWireRef < const epicsUInt32 > ( pCurMsg->m_available ),
+                    seqNo, seqNoIsValid, currentTime );
+            }
+        }
+
+        pBuf += msgSize;
+        byteCount -= msgSize;
+    }
+
+    this->flushReplies ();
+    this->flushSearches ();
+}
+
+void searchCache::searchRequestAction ( const osiSockAddr & addr,
+    const char * pName, ca_uint32_t cid, ca_uint32_t seqNo,
+    bool seqNoIsValid, const epicsTime & currentTime )
+{
+    this->nRequests++;
+
+    stringId id ( pName, stringId::refString );
+    pvEntry * pEntry = this->nameTable.lookup ( id );
+    if ( pEntry && pEntry->pServer ) {
+        this->nHits++;
+        this->pushReply ( addr, cid, seqNo, seqNoIsValid, *pEntry->pServer );
+        return;
+    }
+
+    this->nMisses++;
+    if ( ! pEntry ) {
+        pEntry = new pvEntry ( pName );
+        pEntry->pRequest = new searchRequest ( *pEntry );
+        this->nameTable.add ( *pEntry );
+        this->requestTable.idAssignAdd ( *pEntry->pRequest );
+        this->pendingList.add ( *pEntry );
+    }
+    searchRequest & req = *pEntry->pRequest;
+
+    tsDLIter < searchWaiter > pWaiter = req.waiters.firstIter ();
+    while ( pWaiter.valid () ) {
+        if ( pWaiter->cid == cid &&
+                pWaiter->addr.ia.sin_addr.s_addr == addr.ia.sin_addr.s_addr &&
+                    pWaiter->addr.ia.sin_port == addr.ia.sin_port ) {
+            break;
+        }
+        pWaiter++;
+    }
+    searchWaiter * pW = pWaiter.pointer ();
+    if ( ! pW ) {
+        pW = new searchWaiter ( addr, cid );
+        req.waiters.add ( *pW );
+    }
+    pW->seqNo = seqNo;
+    pW->seqNoIsValid = seqNoIsValid;
+    pW->lastRequestTime = currentTime;
+
+    /*
+     * the clients searching for a name drive its upstream
+     * searches, but no faster than the retry delay which
+     * doubles each time that the name is not found
+     */
+    if ( currentTime - req.lastSearchTime >= req.retryDelay ) {
+        this->pushSearch ( *pEntry );
+        req.lastSearchTime = currentTime;
+        if ( req.retryDelay < minUpstreamRetryDelay ) {
+            req.retryDelay = minUpstreamRetryDelay;
+        }
+        else if ( req.retryDelay < maxUpstreamRetryDelay / 2.0 ) {
+            req.retryDelay *= 2.0;
+        }
+        else {
+            req.retryDelay = maxUpstreamRetryDelay;
+        }
+    }
+}
+
+/*
+ * replies from the servers and beacons from the repeater
+ */
+void searchCache::serverRecv ( const osiSockAddr & addr,
+    const char * pBuf, unsigned byteCount )
+{
+    epicsTime currentTime = epicsTime::getCurrent ();
+
+    while ( byteCount >= sizeof ( caHdr ) ) {
+        const caHdr * pCurMsg = reinterpret_cast < const caHdr * > ( pBuf );
+        caHdr msg;
+        msg.m_cmmd = AlignedWireRef < const epicsUInt16 > ( pCurMsg->m_cmmd );
+        msg.m_postsize = AlignedWireRef < const epicsUInt16 > ( pCurMsg->m_postsize );
+        msg.m_dataType = AlignedWireRef < const epicsUInt16 > ( pCurMsg->m_dataType );
+        msg.m_count = AlignedWireRef < const epicsUInt16 > ( pCurMsg->m_count );
+        msg.m_cid = AlignedWireRef < const epicsUInt32 > ( pCurMsg->m_cid );
+        msg.m_available = AlignedWireRef < const epicsUInt32 > ( pCurMsg->m_available );
+
+        unsigned msgSize = msg.m_postsize + sizeof ( *pCurMsg );
+        if ( msgSize > byteCount ) {
+            char buf[64];
+            sockAddrToDottedIP ( &addr.sa, buf, sizeof ( buf ) );
+            errlogPrintf ( "caSearchCache: Undecipherable UDP msg from %s ignored\n",
+                buf );
+            break;
+        }
+
+        if ( msg.m_cmmd == CA_PROTO_SEARCH ) {
+            this->searchReplyAction ( msg,
+                reinterpret_cast < const ca_uint8_t * > ( pCurMsg + 1 ),
+                addr, currentTime );
+        }
+        else if ( msg.m_cmmd == CA_PROTO_RSRV_IS_UP ) {
+            this->beaconAction ( msg, currentTime );
+        }
+        else if ( msg.m_cmmd == REPEATER_CONFIRM ) {
+            if ( ! this->repeaterConfirmed && this->interest > 1 ) {
+                printf ( "caSearchCache: registered with the CA repeater\n" );
+            }
+            this->repeaterConfirmed = true;
+        }
+
+        pBuf += msgSize;
+        byteCount -= msgSize;
+    }
+
+    this->flushReplies ();
+}
+
+void searchCache::searchReplyAction ( const caHdr & msg,
+    const ca_uint8_t * pPayload, const osiSockAddr & addr,
+    const epicsTime & currentTime )
+{
+    /*
+     * Starting with CA V4.1 the minor version number
+     * is appended to the end of each UDP search reply.
+     */
+    unsigned minorVersion = CA_UKN_MINOR_VERSION;
+    if ( msg.m_postsize >= sizeof ( ca_uint16_t ) ) {
+        minorVersion = ( pPayload[0] << 8u ) | pPayload[1];
+    }
+
+    /*
+     * the server address is only known to clients that
+     * see the reply of an older server from the source
+     * address, so those servers are not cached
+     */
+    if ( ! CA_V48 ( minorVersion ) ) {
+        return;
+    }
+
+    chronIntId id ( msg.m_available );
+    searchRequest * pReq = this->requestTable.remove ( id );
+    if ( ! pReq ) {
+        // a duplicate or a reply to a request that has timed out
+        return;
+    }
+    pvEntry & entry = pReq->pv;
+
+    struct sockaddr_in ina;
+    memset ( & ina, 0, sizeof ( ina ) );
+    ina.sin_family = AF_INET;
+    if ( msg.m_cid != INADDR_BROADCAST ) {
+        ina.sin_addr.s_addr = htonl ( msg.m_cid );
+    }
+    else {
+        ina.sin_addr = addr.ia.sin_addr;
+    }
+    ina.sin_port = htons ( msg.m_dataType );
+
+    cachedServer * pServer = this->serverTable.lookup ( ina );
+    if ( ! pServer ) {
+        pServer = new cachedServer ( ina, minorVersion );
+        this->serverTable.add ( *pServer );
+    }
+    pServer->minorVersion = minorVersion;
+
+    this->pendingList.remove ( entry );
+    entry.pRequest = 0;
+    entry.pServer = pServer;
+    entry.resolveTime = currentTime;
+    pServer->pvList.add ( entry );
+
+    if ( this->interest > 2 ) {
+        char buf[64];
+        ipAddrToDottedIP ( & ina, buf, sizeof ( buf ) );
+        printf ( "%s at %s\n", entry.resourceName (), buf );
+    }
+
+    while ( searchWaiter * pWaiter = pReq->waiters.get () ) {
+        this->pushReply ( pWaiter->addr, pWaiter->cid,
+            pWaiter->seqNo, pWaiter->seqNoIsValid, *pServer );
+        delete pWaiter;
+    }
+    delete pReq;
+}
+
+void searchCache::beaconAction ( const caHdr & msg,
+    const epicsTime & currentTime )
+{
+    /*
+     * the repeater has inserted the source address if
+     * the server did not supply it
+     */
+    struct sockaddr_in ina;
+    memset ( & ina, 0, sizeof ( ina ) );
+    ina.sin_family = AF_INET;
+    ina.sin_addr.s_addr = htonl ( msg.m_available );
+    if ( msg.m_count != 0 ) {
+        ina.sin_port = htons ( msg.m_count );
+    }
+    else {
+        /*
+         * old servers dont supply this and the
+         * default port must be assumed
+         */
+        ina.sin_port = htons ( this->serverPort );
+    }
+
+    epicsGuard < epicsMutex > guard ( this->mutex );
+    bool anomaly = false;
+    bhe * pBHE = this->beaconTable.lookup ( ina );
+    if ( pBHE ) {
+        anomaly = pBHE->updatePeriod ( guard, this->programBeginTime,
+            currentTime, msg.m_cid, msg.m_dataType );
+    }
+    else {
+        /*
+         * This is the first beacon seen from this server.
+         * Wait until 2nd beacon is seen before deciding
+         * if it is a new server (or just the first
+         * time that we have seen a server's beacon
+         * shortly after the program started up)
+         */
+        pBHE = new ( this->bheFreeList )
+            bhe ( this->mutex, currentTime, msg.m_cid, ina );
+        if ( this->beaconTable.add ( *pBHE ) < 0 ) {
+            pBHE->~bhe ();
+            this->bheFreeList.release ( pBHE );
+        }
+    }
+
+    if ( anomaly ) {
+        cachedServer * pServer = this->serverTable.lookup ( ina );
+        if ( pServer ) {
+            this->flushServer ( *pServer, "beacon anomaly" );
+        }
+        /*
+         * a new server may have the names that are being
+         * searched for so search for them without delay
+         */
+        this->resetRetryDelays ();
+    }
+}
+
+void searchCache::pushReply ( const osiSockAddr & addr, ca_uint32_t cid,
+    ca_uint32_t seqNo, bool seqNoIsValid, const cachedServer & server )
+{
+    if ( this->replyBytes ) {
+        if ( addr.ia.sin_addr.s_addr != this->replyAddr.ia.sin_addr.s_addr ||
+                addr.ia.sin_port != this->replyAddr.ia.sin_port ||
+                    seqNoIsValid != this->replySeqNoIsValid ||
+                        seqNo != this->replySeqNo ||
+                            this->replyBytes + sizeof ( caHdr ) + 8u >
+                                sizeof ( this->replyBuf ) ) {
+            this->flushReplies ();
+        }
+    }
+
+    /*
+     * as with a server each reply datagram begins with a
+     * version message that returns the client's sequence number
+     */
+    if ( this->replyBytes == 0u ) {
+        this->replyAddr = addr;
+        this->replySeqNo = seqNo;
+        this->replySeqNoIsValid = seqNoIsValid;
+        caHdr * pVersion = reinterpret_cast < caHdr * > ( this->replyBuf );
+        AlignedWireRef < epicsUInt16 > ( pVersion->m_cmmd ) = CA_PROTO_VERSION;
+        AlignedWireRef < epicsUInt16 > ( pVersion->m_postsize ) = 0u;
+        AlignedWireRef < epicsUInt16 > ( pVersion->m_dataType ) =
+            seqNoIsValid ? sequenceNoIsValid : 0u;
+        AlignedWireRef < epicsUInt16 > ( pVersion->m_count ) = CA_MINOR_PROTOCOL_REVISION;
+        AlignedWireRef < epicsUInt32 > ( pVersion->m_cid ) = seqNo;
+        AlignedWireRef < epicsUInt32 > ( pVersion->m_available ) = 0u;
+        this->replyBytes = sizeof ( caHdr );
+    }
+
+    /*
+     * the server's address goes in the cid field and its
+     * port in the data type field, the minor version number
+     * of the server is appended to the reply
+     */
+    caHdr * pMsg = reinterpret_cast < caHdr * > ( & this->replyBuf[this->replyBytes] );
+    AlignedWireRef < epicsUInt16 > ( pMsg->m_cmmd ) = CA_PROTO_SEARCH;
+    AlignedWireRef < epicsUInt16 > ( pMsg->m_postsize ) = 8u;
+    AlignedWireRef < epicsUInt16 > ( pMsg->m_dataType ) = ntohs ( server.addr.sin_port );
+    AlignedWireRef < epicsUInt16 > ( pMsg->m_count ) = 0u;
+    AlignedWireRef < epicsUInt32 > ( pMsg->m_cid ) = ntohl ( server.addr.sin_addr.s_addr );
+    AlignedWireRef < epicsUInt32 > ( pMsg->m_available ) = cid;
+    ca_uint8_t * pPayload = reinterpret_cast < ca_uint8_t * > ( pMsg + 1 );
+    memset ( pPayload, 0, 8u );
+    pPayload[0] = static_cast < ca_uint8_t > ( server.minorVersion >> 8u );
+    pPayload[1] = static_cast < ca_uint8_t > ( server.minorVersion );
+    this->replyBytes += sizeof ( caHdr ) + 8u;
+}
+
+void searchCache::flushReplies ()
+{
+    if ( this->replyBytes == 0u ) {
+        return;
+    }
+    int status = sendto ( this->clientSock, this->replyBuf, this->replyBytes, 0,
+                          & this->replyAddr.sa, sizeof ( this->replyAddr.sa ) );
+    if ( status < 0 ) {
+        char sockErrBuf[64];
+        epicsSocketConvertErrnoToString ( sockErrBuf, sizeof ( sockErrBuf ) );
+        char buf[64];
+        sockAddrToDottedIP ( & this->replyAddr.sa, buf, sizeof ( buf ) );
+        errlogPrintf ( "caSearchCache: UDP send to %s failed with \"%s\"\n",
+            buf, sockErrBuf );
+    }
+    this->replyBytes = 0u;
+}
+
+void searchCache::pushSearch ( const pvEntry & entry )
+{
+    const char * pName = entry.resourceName ();
+    unsigned nameLength = static_cast < unsigned > ( strlen ( pName ) + 1u );
+    unsigned postSize = CA_MESSAGE_ALIGN ( nameLength );
+    if ( postSize + sizeof ( caHdr ) > sizeof ( this->searchBuf ) - sizeof ( caHdr ) ) {
+        return;
+    }
+    if ( this->searchBytes + sizeof ( caHdr ) + postSize > sizeof ( this->searchBuf ) ) {
+        this->flushSearches ();
+    }
+
+    if ( this->searchBytes == 0u ) {
+        caHdr * pVersion = reinterpret_cast < caHdr * > ( this->searchBuf );
+        AlignedWireRef < epicsUInt16 > ( pVersion->m_cmmd ) = CA_PROTO_VERSION;
+        AlignedWireRef < epicsUInt16 > ( pVersion->m_postsize ) = 0u;
+        AlignedWireRef < epicsUInt16 > ( pVersion->m_dataType ) = sequenceNoIsValid;
+        AlignedWireRef < epicsUInt16 > ( pVersion->m_count ) = CA_MINOR_PROTOCOL_REVISION;
+        AlignedWireRef < epicsUInt32 > ( pVersion->m_cid ) = ++this->sequenceNumber;
+        AlignedWireRef < epicsUInt32 > ( pVersion->m_available ) = 0u;
+        this->searchBytes = sizeof ( caHdr );
+    }
+
+    ca_uint32_t id = entry.pRequest->getId ();
+    caHdr * pMsg = reinterpret_cast < caHdr * > ( & this->searchBuf[this->searchBytes] );
+    AlignedWireRef < epicsUInt16 > ( pMsg->m_cmmd ) = CA_PROTO_SEARCH;
+    AlignedWireRef < epicsUInt16 > ( pMsg->m_postsize ) =
+        static_cast < epicsUInt16 > ( postSize );
+    AlignedWireRef < epicsUInt16 > ( pMsg->m_dataType ) = DONTREPLY;
+    AlignedWireRef < epicsUInt16 > ( pMsg->m_count ) = CA_MINOR_PROTOCOL_REVISION;
+    AlignedWireRef < epicsUInt32 > ( pMsg->m_cid ) = id;
+    AlignedWireRef < epicsUInt32 > ( pMsg->m_available ) = id;
+    char * pPayload = reinterpret_cast < char * > ( pMsg + 1 );
+    memcpy ( pPayload, pName, nameLength );
+    memset ( pPayload + nameLength, 0, postSize - nameLength );
+    this->searchBytes += sizeof ( caHdr ) + postSize;
+}
+
+void searchCache::flushSearches ()
+{
+    if ( this->searchBytes == 0u ) {
+        return;
+    }
+    this->nSearchFrames++;
+    osiSockAddrNode * pNode =
+        reinterpret_cast < osiSockAddrNode * > ( ellFirst ( & this->destList ) );
+    while ( pNode ) {
+        int status = sendto ( this->serverSock, this->searchBuf,
+            this->searchBytes, 0, & pNode->addr.sa, sizeof ( pNode->addr.sa ) );
+        if ( status < 0 ) {
+            int errnoCpy = SOCKERRNO;
+            if ( errnoCpy != SOCK_EINTR && errnoCpy != SOCK_ECONNREFUSED &&
+                    errnoCpy != SOCK_EWOULDBLOCK ) {
+                char sockErrBuf[64];
+                epicsSocketConvertErrnoToString ( sockErrBuf, sizeof ( sockErrBuf ) );
+                char buf[64];
+                sockAddrToDottedIP ( & pNode->addr.sa, buf, sizeof ( buf ) );
+                errlogPrintf ( "caSearchCache: UDP send to %s failed with \"%s\"\n",
+                    buf, sockErrBuf );
+            }
+        }
+        pNode = reinterpret_cast < osiSockAddrNode * > ( ellNext ( & pNode->node ) );
+    }
+    this->searchBytes = 0u;
+}
+
+void searchCache::destroyEntry ( pvEntry & entry )
+{
+    this->nameTable.remove ( entry );
+    if ( entry.pRequest ) {
+        this->requestTable.remove ( *entry.pRequest );
+        this->pendingList.remove ( entry );
+        delete entry.pRequest;
+    }
+    else if ( entry.pServer ) {
+        entry.pServer->pvList.remove ( entry );
+    }
+    delete & entry;
+}
+
+void searchCache::flushServer ( cachedServer & server, const char * pReason )
+{
+    if ( this->interest > 0 ) {
+        char buf[64];
+        ipAddrToDottedIP ( & server.addr, buf, sizeof ( buf ) );
+        printf ( "caSearchCache: flushed %u names of %s (%s)\n",
+            server.pvList.count (), buf, pReason );
+    }
+    this->nFlushed += server.pvList.count ();
+    while ( pvEntry * pEntry = server.pvList.first () ) {
+        this->destroyEntry ( *pEntry );
+    }
+    this->serverTable.remove ( server );
+    delete & server;
+}
+
+void searchCache::resetRetryDelays ()
+{
+    tsDLIter < pvEntry > pEntry = this->pendingList.firstIter ();
+    while ( pEntry.valid () ) {
+        pEntry->pRequest->retryDelay = 0.0;
+        pEntry++;
+    }
+}
+
+//
+// the names of each server are on its list in the
+// order that they were resolved
+//
+void searchCache::expireEntries ( const epicsTime & currentTime )
+{
+    resTableIter < cachedServer, inetAddrID > pServer =
+        this->serverTable.firstIter ();
+    while ( pServer.valid () ) {
+        tsDLList < pvEntry > & list = pServer->pvList;
+        while ( pvEntry * pEntry = list.first () ) {
+            if ( currentTime - pEntry->resolveTime < this->timeToLive ) {
+                break;
+            }
+            this->nExpired++;
+            this->destroyEntry ( *pEntry );
+        }
+        pServer++;
+    }
+}
+
+//
+// clients that stopped searching are forgotten, and so are the
+// names that no client is searching for
+//
+void searchCache::expireRequests ( const epicsTime & currentTime )
+{
+    tsDLIter < pvEntry > pEntry = this->pendingList.firstIter ();
+    while ( pEntry.valid () ) {
+        pvEntry & entry = *pEntry;
+        pEntry++;
+        tsDLList < searchWaiter > & waiters = entry.pRequest->waiters;
+        tsDLIter < searchWaiter > pWaiter = waiters.firstIter ();
+        while ( pWaiter.valid () ) {
+            searchWaiter & waiter = *pWaiter;
+            pWaiter++;
+            if ( currentTime - waiter.lastRequestTime > waiterTimeout ) {
+                waiters.remove ( waiter );
+                delete & waiter;
+            }
+        }
+        if ( waiters.count () == 0u ) {
+            this->destroyEntry ( entry );
+        }
+    }
+}
+
+//
+// the names of a server are flushed if its beacons stop
+//
+void searchCache::expireBeacons ( const epicsTime & currentTime )
+{
+    epicsGuard < epicsMutex > guard ( this->mutex );
+    tsSLList < bhe > list;
+    this->beaconTable.removeAll ( list );
+    while ( bhe * pBHE = list.get () ) {
+        double period = pBHE->period ( guard );
+        double limit = this->connTMO;
+        if ( period * 3.25 > limit ) {
+            limit = period * 3.25;
+        }
+        if ( currentTime - pBHE->updateTime ( guard ) > limit ) {
+            cachedServer * pServer = this->serverTable.lookup ( *pBHE );
+            if ( pServer ) {
+                this->flushServer ( *pServer, "beacons stopped" );
+            }
+            pBHE->~bhe ();
+            this->bheFreeList.release ( pBHE );
+        }
+        else {
+            this->beaconTable.add ( *pBHE );
+        }
+    }
+}
+
+epicsTimerNotify::expireStatus searchCache::expire ( const epicsTime & currentTime )
+{
+    /*
+     * register with the repeater until it confirms, and
+     * periodically after that in case it has been restarted
+     */
+    if ( ! this->repeaterConfirmed ||
+            currentTime - this->lastRegistrationTime >= repeaterRegistrationPeriod ) {
+        if ( this->repeaterConfirmed ) {
+            this->repeaterConfirmed = false;
+            this->registrationAttempts = 0u;
+        }
+        if ( this->registrationAttempts == 100u ) {
+            errlogPrintf ( "caSearchCache: unable to register with the CA repeater, "
+                "server beacons will not be seen\n" );
+        }
+        caRepeaterRegistrationMessage ( this->serverSock,
+            this->repeaterPort, this->registrationAttempts++ );
+        this->lastRegistrationTime = currentTime;
+    }
+
+    this->expireEntries ( currentTime );
+    this->expireRequests ( currentTime );
+    this->expireBeacons ( currentTime );
+
+    if ( this->interest > 0 &&
+            currentTime - this->lastStatisticsTime >= statisticsPeriod ) {
+        this->show ( 0u );
+        this->lastStatisticsTime = currentTime;
+    }
+
+    return expireStatus ( restart, housekeepingPeriod );
+}
+
+void searchCache::show ( unsigned level ) const
+{
+    printf ( "caSearchCache: %u names cached from %u servers, %u pending, "
+        "%u servers beaconing\n",
+        this->nameTable.numEntriesInstalled () - this->pendingList.count (),
+        this->serverTable.numEntriesInstalled (),
+        this->pendingList.count (),
+        this->beaconTable.numEntriesInstalled () );
+    printf ( "\t%lu requests, %lu hits, %lu misses, %lu search frames sent, "
+        "%lu names flushed, %lu expired\n",
+        this->nRequests, this->nHits, this->nMisses, this->nSearchFrames,
+        this->nFlushed, this->nExpired );
+    if ( level > 0u ) {
+        printChannelAccessAddressList ( & this->destList );
+    }
+    fflush ( stdout );
+}
@@ -0,0 +1,187 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *  CA search cache, see caSearchCache.cpp
+ */
+
+#ifndef caSearchCacheh
+#define caSearchCacheh
+
+#include "fdManager.h"
+
+#include "iocinf.h"
+#include "addrList.h"
+#include "bhe.h"
+#include "nciu.h"
+#include "udpiiu.h"
+#include "inetAddrID.h"
+
+// using a wrapper class around the free list avoids
+// Tornado 2.0.1 GNU compiler bugs
+class bheFreeStoreMgr : public bheMemoryManager {
+public:
+    bheFreeStoreMgr () {}
+    void * allocate ( size_t );
+    void release ( void * );
+private:
+    tsFreeList < class bhe, 0x100 > freeList;
+    bheFreeStoreMgr ( const bheFreeStoreMgr & );
+    bheFreeStoreMgr & operator = ( const bheFreeStoreMgr & );
+};
+
+class pvEntry;
+
+//
+// a client waiting for the upstream search reply
+//
+class searchWaiter : public tsDLNode < searchWaiter > {
+public:
+    searchWaiter ( const osiSockAddr & addrIn, ca_uint32_t cidIn ) :
+        addr ( addrIn ), cid ( cidIn ), seqNo ( 0u ), seqNoIsValid ( false ) {}
+    osiSockAddr addr;
+    ca_uint32_t cid;
+    ca_uint32_t seqNo;
+    bool seqNoIsValid;
+    epicsTime lastRequestTime;
+};
+
+//
+// an outstanding upstream search, the chronological id is
+// the cid of the upstream search requests
+//
+class searchRequest : public chronIntIdRes < searchRequest > {
+public:
+    searchRequest ( pvEntry & pvIn ) :
+        pv ( pvIn ), retryDelay ( 0.0 ) {}
+    ~searchRequest ();
+    pvEntry & pv;
+    tsDLList < searchWaiter > waiters;
+    epicsTime lastSearchTime;
+    double retryDelay;
+private:
+    searchRequest ( const searchRequest & );
+    searchRequest & operator = ( const searchRequest & );
+};
+
+class cachedServer;
+
+//
+// a PV name that is either resolved (it is on the list of its
+// server) or being searched for (it is on the pending list)
+//
+class pvEntry : public stringId, public tsSLNode < pvEntry >,
+        public tsDLNode < pvEntry > {
+public:
+    pvEntry ( const char * pName ) :
+        stringId ( pName ), pServer ( 0 ), pRequest ( 0 ) {}
+    cachedServer * pServer;
+    searchRequest * pRequest;
+    epicsTime resolveTime;
+private:
+    pvEntry ( const pvEntry & );
+    pvEntry & operator = ( const pvEntry & );
+};
+
+class cachedServer : public inetAddrID, public tsSLNode < cachedServer > {
+public:
+    cachedServer ( const struct sockaddr_in & addrIn,
+            unsigned minorVersionIn ) :
+        inetAddrID ( addrIn ), addr ( addrIn ),
+        minorVersion ( minorVersionIn ) {}
+    struct sockaddr_in addr;
+    unsigned minorVersion;
+    tsDLList < pvEntry > pvList;
+private:
+    cachedServer ( const cachedServer & );
+    cachedServer & operator = ( const cachedServer & );
+};
+
+class searchCache;
+
+class searchCacheSocket : public fdReg {
+public:
+    searchCacheSocket ( SOCKET sock, searchCache & cacheIn,
+            void ( searchCache :: * pRecvIn ) (
+                const osiSockAddr &, const char *, unsigned ) ) :
+        fdReg ( sock, fdrRead ), cache ( cacheIn ), pRecv ( pRecvIn ) {}
+private:
+    searchCache & cache;
+    void ( searchCache :: * pRecv ) (
+        const osiSockAddr &, const char *, unsigned );
+    void callBack ();
+    searchCacheSocket ( const searchCacheSocket & );
+    searchCacheSocket & operator = ( const searchCacheSocket & );
+};
+
+class searchCache : public epicsTimerNotify {
+public:
+    searchCache ( SOCKET clientSock, SOCKET serverSock,
+        unsigned short port, double timeToLive, unsigned interest );
+    ~searchCache ();
+    void clientRecv ( const osiSockAddr &, const char * pBuf, unsigned size );
+    void serverRecv ( const osiSockAddr &, const char * pBuf, unsigned size );
+    void show ( unsigned level ) const;
+private:
+    epicsMutex mutex;
+    bheFreeStoreMgr bheFreeList;
+    resTable < pvEntry, stringId > nameTable;
+    chronIntIdResTable < searchRequest > requestTable;
+    resTable < cachedServer, inetAddrID > serverTable;
+    resTable < bhe, inetAddrID > beaconTable;
+    tsDLList < pvEntry > pendingList;
+    ELLLIST destList;
+    searchCacheSocket clientReg;
+    searchCacheSocket serverReg;
+    epicsTime programBeginTime;
+    epicsTime lastRegistrationTime;
+    epicsTime lastStatisticsTime;
+    osiSockAddr replyAddr;
+    epicsTimer & timer;
+    const double timeToLive;
+    double connTMO;
+    SOCKET clientSock;
+    SOCKET serverSock;
+    const unsigned interest;
+    unsigned registrationAttempts;
+    unsigned replyBytes;
+    unsigned searchBytes;
+    ca_uint32_t replySeqNo;
+    ca_uint32_t sequenceNumber;
+    unsigned long nRequests;
+    unsigned long nHits;
+    unsigned long nMisses;
+    unsigned long nSearchFrames;
+    unsigned long nFlushed;
+    unsigned long nExpired;
+    unsigned short serverPort;
+    unsigned short repeaterPort;
+    bool replySeqNoIsValid;
+    bool repeaterConfirmed;
+    char replyBuf [MAX_UDP_SEND];
+    char searchBuf [MAX_UDP_SEND];
+    void searchRequestAction ( const osiSockAddr &, const char * pName,
+        ca_uint32_t cid, ca_uint32_t seqNo, bool seqNoIsValid,
+        const epicsTime & currentTime );
+    void searchReplyAction ( const caHdr &, const ca_uint8_t * pPayload,
+        const osiSockAddr &, const epicsTime & currentTime );
+    void beaconAction ( const caHdr &, const epicsTime & currentTime );
+    void pushReply ( const osiSockAddr &, ca_uint32_t cid,
+        ca_uint32_t seqNo, bool seqNoIsValid, const cachedServer & );
+    void flushReplies ();
+    void pushSearch ( const pvEntry & );
+    void flushSearches ();
+    void flushServer ( cachedServer &, const char * pReason );
+    void destroyEntry ( pvEntry & );
+    void expireEntries ( const epicsTime & currentTime );
+    void expireRequests ( const epicsTime & currentTime );
+    void expireBeacons ( const epicsTime & currentTime );
+    void resetRetryDelays ();
+    expireStatus expire ( const epicsTime & currentTime );
+    searchCache ( const searchCache & );
+    searchCache & operator = ( const searchCache & );
+};
+
+#endif // ifndef caSearchCacheh
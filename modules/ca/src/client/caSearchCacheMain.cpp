@@ -0,0 +1,116 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "errlog.h"
+#include "epicsGetopt.h"
+
+#include "caSearchCache.h"
+
+static const unsigned short searchCachePortDefault = 5076u;
+static const double timeToLiveDefault = 300.0; // sec
+
+static SOCKET makeSocket ( unsigned short port )
+{
+    SOCKET sock = epicsSocketCreate ( AF_INET, SOCK_DGRAM, IPPROTO_UDP );
+    if ( sock == INVALID_SOCKET ) {
+        char sockErrBuf[64];
+        epicsSocketConvertErrnoToString (
+            sockErrBuf, sizeof ( sockErrBuf ) );
+        errlogPrintf ( "caSearchCache: unable to create datagram socket because \"%s\"\n",
+            sockErrBuf );
+        return sock;
+    }
+
+    osiSockAddr addr;
+    memset ( (char *) &addr, 0 , sizeof (addr) );
+    addr.ia.sin_family = AF_INET;
+    addr.ia.sin_addr.s_addr = htonl ( INADDR_ANY );
+    addr.ia.sin_port = htons ( port );
+    int status = bind ( sock, &addr.sa, sizeof (addr) );
+    if ( status < 0 ) {
+        char sockErrBuf[64];
+        epicsSocketConvertErrnoToString (
+            sockErrBuf, sizeof ( sockErrBuf ) );
+        epicsSocketDestroy ( sock );
+        errlogPrintf ( "caSearchCache: unable to bind to port %u because \"%s\"\n",
+            port, sockErrBuf );
+        return INVALID_SOCKET;
+    }
+    return sock;
+}
+
+static void usage ()
+{
+    printf ( "usage: caSearchCache [-p port] [-t time to live] [-i interest level]\n" );
+}
+
+int main ( int argc, char ** argv )
+{
+    unsigned port = searchCachePortDefault;
+    double timeToLive = timeToLiveDefault;
+    unsigned interest = 0u;
+    int opt;
+
+    while ( ( opt = getopt ( argc, argv, ":p:t:i:h" ) ) != -1 ) {
+        switch ( opt ) {
+        case 'p':
+            if ( sscanf ( optarg, "%u", & port ) != 1 ||
+                    port == 0u || port > 0xffff ) {
+                usage ();
+                return 1;
+            }
+            break;
+        case 't':
+            if ( sscanf ( optarg, "%lf", & timeToLive ) != 1 ||
+                    timeToLive <= 0.0 ) {
+                usage ();
+                return 1;
+            }
+            break;
+        case 'i':
+            if ( sscanf ( optarg, "%u", & interest ) != 1 ) {
+                usage ();
+                return 1;
+            }
+            break;
+        default:
+            usage ();
+            return opt == 'h' ? 0 : 1;
+        }
+    }
+    if ( optind != argc ) {
+        usage ();
+        return 1;
+    }
+
+    if ( ! osiSockAttach () ) {
+        errlogPrintf ( "caSearchCache: unable to attach to the network\n" );
+        return 1;
+    }
+
+    SOCKET clientSock = makeSocket ( static_cast < unsigned short > ( port ) );
+    if ( clientSock == INVALID_SOCKET ) {
+        return 1;
+    }
+    SOCKET serverSock = makeSocket ( 0u );
+    if ( serverSock == INVALID_SOCKET ) {
+        epicsSocketDestroy ( clientSock );
+        return 1;
+    }
+
+    searchCache cache ( clientSock, serverSock,
+        static_cast < unsigned short > ( port ), timeToLive, interest );
+    if ( interest > 0 ) {
+        printf ( "caSearchCache: listening on port %u\n", port );
+        cache.show ( 1u );
+    }
+
+    while ( true ) {
+        fileDescriptorManager.process ( 1000.0 );
+    }
+}
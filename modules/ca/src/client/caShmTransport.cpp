@@ -0,0 +1,260 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Shared memory rings for same host CA virtual circuits,
+ * cf. caShmTransport.h
+ */
+
+#include <new>
+#include <string.h>
+#include <stdio.h>
+
+#include "epicsAtomic.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "epicsSharedMemory.h"
+#include "epicsTypes.h"
+
+#define epicsExportSharedSymbols
+#include "caShmTransport.h"
+
+// keep the index each side writes in a cache line of its own
+#define CA_SHM_LINE 64u
+
+static const epicsUInt32 caShmMagic = 0x43415348; // "CASH"
+static const epicsUInt32 caShmVersion = 1u;
+
+struct caShmRingCtl {
+    int head;           // written by the writer only
+    char pad0 [ CA_SHM_LINE - sizeof ( int ) ];
+    int tail;           // written by the reader only
+    char pad1 [ CA_SHM_LINE - sizeof ( int ) ];
+    int readerWaiting;  // set by the reader, cleared by whoever wins
+    char pad2 [ CA_SHM_LINE - sizeof ( int ) ];
+};
+
+struct caShmSegmentHdr {
+    epicsUInt32 magic;
+    epicsUInt32 version;
+    epicsUInt32 ringSize;
+    char pad [ CA_SHM_LINE - 3 * sizeof ( epicsUInt32 ) ];
+    // ring [0] client to server, ring [1] server to client
+    caShmRingCtl ring [ 2 ];
+};
+
+struct caShmTransport {
+    epicsSharedMemoryId shm;
+    caShmRingCtl * pOut;
+    caShmRingCtl * pIn;
+    char * pOutData;
+    char * pInData;
+    unsigned ringSize;
+};
+
+static caShmTransport * caShmTransportAttach (
+    epicsSharedMemoryId shm, bool server )
+{
+    caShmTransport * pTransport = new ( std::nothrow ) caShmTransport;
+    if ( ! pTransport ) {
+        epicsSharedMemoryDestroy ( shm );
+        return 0;
+    }
+    caShmSegmentHdr * pHdr = static_cast < caShmSegmentHdr * >
+        ( epicsSharedMemoryAddress ( shm ) );
+    char * pData = reinterpret_cast < char * > ( pHdr + 1 );
+    unsigned out = server ? 1u : 0u;
+    pTransport->shm = shm;
+    pTransport->ringSize = pHdr->ringSize;
+    pTransport->pOut = & pHdr->ring [ out ];
+    pTransport->pIn = & pHdr->ring [ 1u - out ];
+    pTransport->pOutData = pData + out * pHdr->ringSize;
+    pTransport->pInData = pData + ( 1u - out ) * pHdr->ringSize;
+    return pTransport;
+}
+
+caShmTransportId caShmTransportCreate ( char * pName, unsigned nameSize,
+    unsigned maxMsgSize )
+{
+    static int sequence;
+    unsigned ringSize = CA_SHM_TRANSPORT_RING_SIZE;
+    while ( ringSize < maxMsgSize && 
+            ringSize < CA_SHM_TRANSPORT_RING_SIZE_MAX ) {
+        ringSize <<= 1u;
+    }
+    const size_t size = sizeof ( caShmSegmentHdr ) + 2u * size_t ( ringSize );
+
+    // the name only has to be unique on this host, a collision
+    // with another process is detected by create and retried
+    for ( unsigned i = 0u; i < 8u; i++ ) {
+        char name [ EPICS_SHARED_MEMORY_NAME_SIZE ];
+        epicsTimeStamp stamp;
+        epicsTimeGetCurrent ( & stamp );
+        int nChar = sprintf ( name, "/epicsCA.%x.%x.%x",
+            static_cast < unsigned > ( reinterpret_cast < size_t > ( & sequence ) ),
+            stamp.nsec, static_cast < unsigned > (
+                epicsAtomicIncrIntT ( & sequence ) ) );
+        if ( nChar < 0 || static_cast < unsigned > ( nChar ) >= nameSize ) {
+            return 0;
+        }
+        epicsSharedMemoryId shm = epicsSharedMemoryCreate ( name, size );
+        if ( shm ) {
+            caShmSegmentHdr * pHdr = static_cast < caShmSegmentHdr * >
+                ( epicsSharedMemoryAddress ( shm ) );
+            pHdr->ringSize = ringSize;
+            pHdr->version = caShmVersion;
+            epicsAtomicWriteMemoryBarrier ();
+            pHdr->magic = caShmMagic;
+            strcpy ( pName, name );
+            return caShmTransportAttach ( shm, true );
+        }
+    }
+    return 0;
+}
+
+caShmTransportId caShmTransportOpen ( const char * pName )
+{
+    epicsSharedMemoryId shm = epicsSharedMemoryOpen ( pName );
+    if ( ! shm ) {
+        return 0;
+    }
+    caShmSegmentHdr * pHdr = static_cast < caShmSegmentHdr * >
+        ( epicsSharedMemoryAddress ( shm ) );
+    size_t size = epicsSharedMemorySize ( shm );
+    if ( size < sizeof ( *pHdr ) ||
+            pHdr->magic != caShmMagic ||
+            pHdr->version != caShmVersion ||
+            pHdr->ringSize == 0u ||
+            ( pHdr->ringSize & ( pHdr->ringSize - 1u ) ) ||
+            size < sizeof ( *pHdr ) + 2u * size_t ( pHdr->ringSize ) ) {
+        epicsSharedMemoryDestroy ( shm );
+        return 0;
+    }
+    epicsAtomicReadMemoryBarrier ();
+    return caShmTransportAttach ( shm, false );
+}
+
+void caShmTransportUnlink ( caShmTransportId pTransport )
+{
+    epicsSharedMemoryUnlink ( pTransport->shm );
+}
+
+void caShmTransportDestroy ( caShmTransportId pTransport )
+{
+    if ( pTransport ) {
+        epicsSharedMemoryDestroy ( pTransport->shm );
+        delete pTransport;
+    }
+}
+
+unsigned caShmTransportSend ( caShmTransportId pTransport,
+    const void * pBuf, unsigned nBytes )
+{
+    caShmRingCtl * pCtl = pTransport->pOut;
+    unsigned head = static_cast < unsigned > ( pCtl->head );
+    unsigned tail = static_cast < unsigned > ( epicsAtomicGetIntT ( & pCtl->tail ) );
+    // the reader must be done with the space before it is reused
+    epicsAtomicReadMemoryBarrier ();
+
+    unsigned space = pTransport->ringSize - ( head - tail );
+    if ( space > pTransport->ringSize ) {
+        space = 0u; // only a corrupt segment
+    }
+    // once the ring was full wait for the reader to free a good part of
+    // it, refilling it in small pieces costs a context switch per piece
+    if ( space < nBytes && space < pTransport->ringSize / 4u ) {
+        return 0u;
+    }
+    if ( nBytes > space ) {
+        nBytes = space;
+    }
+    if ( nBytes ) {
+        unsigned index = head & ( pTransport->ringSize - 1u );
+        unsigned first = pTransport->ringSize - index;
+        const char * pSrc = static_cast < const char * > ( pBuf );
+        if ( first > nBytes ) {
+            first = nBytes;
+        }
+        memcpy ( & pTransport->pOutData [ index ], pSrc, first );
+        memcpy ( pTransport->pOutData, pSrc + first, nBytes - first );
+        epicsAtomicWriteMemoryBarrier ();
+        epicsAtomicSetIntT ( & pCtl->head, static_cast < int > ( head + nBytes ) );
+    }
+    return nBytes;
+}
+
+int caShmTransportWakeupNeeded ( caShmTransportId pTransport )
+{
+    // a full barrier orders the head update above before the flag test,
+    // pairing with the one in caShmTransportRecvWaitBegin ()
+    return epicsAtomicCmpAndSwapIntT (
+        & pTransport->pOut->readerWaiting, 1, 0 ) == 1;
+}
+
+void caShmTransportSendBackoff ( unsigned nAttempts )
+{
+    // the reader does not signal free space, so poll; a ring drains
+    // in a few milliseconds when the reader is keeping up
+    if ( nAttempts < 1000u ) {
+        epicsThreadSleep ( 0.00001 );
+    }
+    else {
+        epicsThreadSleep ( 0.001 );
+    }
+}
+
+unsigned caShmTransportRecvPending ( caShmTransportId pTransport )
+{
+    caShmRingCtl * pCtl = pTransport->pIn;
+    unsigned head = static_cast < unsigned > ( epicsAtomicGetIntT ( & pCtl->head ) );
+    return head - static_cast < unsigned > ( pCtl->tail );
+}
+
+unsigned caShmTransportRecv ( caShmTransportId pTransport,
+    void * pBuf, unsigned nBytes )
+{
+    caShmRingCtl * pCtl = pTransport->pIn;
+    unsigned tail = static_cast < unsigned > ( pCtl->tail );
+    unsigned head = static_cast < unsigned > ( epicsAtomicGetIntT ( & pCtl->head ) );
+    epicsAtomicReadMemoryBarrier ();
+
+    unsigned avail = head - tail;
+    if ( avail > pTransport->ringSize ) {
+        avail = 0u; // only a corrupt segment
+    }
+    if ( nBytes > avail ) {
+        nBytes = avail;
+    }
+    if ( nBytes ) {
+        unsigned index = tail & ( pTransport->ringSize - 1u );
+        unsigned first = pTransport->ringSize - index;
+        char * pDest = static_cast < char * > ( pBuf );
+        if ( first > nBytes ) {
+            first = nBytes;
+        }
+        memcpy ( pDest, & pTransport->pInData [ index ], first );
+        memcpy ( pDest + first, pTransport->pInData, nBytes - first );
+        epicsAtomicReadMemoryBarrier ();
+        epicsAtomicSetIntT ( & pCtl->tail, static_cast < int > ( tail + nBytes ) );
+    }
+    return nBytes;
+}
+
+int caShmTransportRecvWaitBegin ( caShmTransportId pTransport )
+{
+    epicsAtomicCmpAndSwapIntT ( & pTransport->pIn->readerWaiting, 0, 1 );
+    if ( caShmTransportRecvPending ( pTransport ) ) {
+        caShmTransportRecvWaitEnd ( pTransport );
+        return true;
+    }
+    return false;
+}
+
+void caShmTransportRecvWaitEnd ( caShmTransportId pTransport )
+{
+    // if the writer cleared the flag first it also sent, or is
+    // sending, a wakeup byte which the reader discards later
+    epicsAtomicCmpAndSwapIntT ( & pTransport->pIn->readerWaiting, 1, 0 );
+}
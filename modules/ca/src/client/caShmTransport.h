@@ -0,0 +1,72 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Shared memory byte stream for a CA virtual circuit whose client and
+ * server are on the same host.
+ *
+ * The server creates a segment holding one ring per direction and
+ * offers its name to the client (CA_PROTO_SHM_REQUEST). After the
+ * CA_PROTO_SHM_SWITCH handshake both ends move the CA message stream
+ * into the rings; the TCP socket stays open to detect the peer going
+ * away and to wake a reader that blocked in recv() on an empty ring.
+ *
+ * Each ring has a single writer and a single reader. A reader that
+ * finds its ring empty calls caShmTransportRecvWaitBegin() and, if
+ * that returns false, blocks in recv() on the socket. A writer that
+ * gets true from caShmTransportWakeupNeeded() after writing must send
+ * one byte on the socket. The reader discards those bytes.
+ */
+
+#ifndef caShmTransporth
+#define caShmTransporth
+
+#include "shareLib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct caShmTransport * caShmTransportId;
+
+/* smallest and largest bytes in each direction */
+#define CA_SHM_TRANSPORT_RING_SIZE ( 1u << 20u )
+#define CA_SHM_TRANSPORT_RING_SIZE_MAX ( 1u << 24u )
+
+/*
+ * server end, the new segment's name is copied to pName; the rings are
+ * big enough for one message of maxMsgSize bytes when the limits allow,
+ * so that a writer rarely waits on a full ring
+ */
+epicsShareFunc caShmTransportId caShmTransportCreate (
+    char * pName, unsigned nameSize, unsigned maxMsgSize );
+/* client end */
+epicsShareFunc caShmTransportId caShmTransportOpen ( const char * pName );
+/* remove the name once the client has it open, or has declined */
+epicsShareFunc void caShmTransportUnlink ( caShmTransportId );
+epicsShareFunc void caShmTransportDestroy ( caShmTransportId );
+
+/* copy up to nBytes into the outgoing ring, returns bytes copied, zero
+ * while the ring is nearly full */
+epicsShareFunc unsigned caShmTransportSend ( caShmTransportId,
+    const void * pBuf, unsigned nBytes );
+/* true if the peer is waiting on the socket for the bytes just sent */
+epicsShareFunc int caShmTransportWakeupNeeded ( caShmTransportId );
+/* back off while the outgoing ring is full, nAttempts counts from zero */
+epicsShareFunc void caShmTransportSendBackoff ( unsigned nAttempts );
+
+/* copy up to nBytes out of the incoming ring, returns bytes copied */
+epicsShareFunc unsigned caShmTransportRecv ( caShmTransportId,
+    void * pBuf, unsigned nBytes );
+epicsShareFunc unsigned caShmTransportRecvPending ( caShmTransportId );
+/* returns true if bytes arrived meanwhile and the caller must not block */
+epicsShareFunc int caShmTransportRecvWaitBegin ( caShmTransportId );
+epicsShareFunc void caShmTransportRecvWaitEnd ( caShmTransportId );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* caShmTransporth */
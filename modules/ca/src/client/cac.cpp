@@ -86,7 +86,9 @@ const cac::pProtoStubTCP cac::tcpJumpTableCAC [] =
     &cac::badTCPRespAction,
     &cac::badTCPRespAction,
     &cac::verifyAndDisconnectChan,
-    &cac::verifyAndDisconnectChan
+    &cac::verifyAndDisconnectChan,
+    &cac::shmRequestAction,
+    &cac::shmSwitchAction
 };
 
 // TCP exception dispatch table
@@ -119,7 +121,9 @@ const cac::pExcepProtoStubTCP cac::tcpExcepJumpTableCAC [] =
     &cac::defaultExcep,     // REPEATER_REGISTER
     &cac::defaultExcep,     // CA_PROTO_SIGNAL
     &cac::defaultExcep,     // CA_PROTO_CREATE_CH_FAIL
-    &cac::defaultExcep      // CA_PROTO_SERVER_DISCONN
+    &cac::defaultExcep,     // CA_PROTO_SERVER_DISCONN
+    &cac::defaultExcep,     // CA_PROTO_SHM_REQUEST
+    &cac::defaultExcep      // CA_PROTO_SHM_SWITCH
 };
 
 //
@@ -148,7 +152,10 @@ cac::cac (
     maxContigFrames ( contiguousMsgCountWhichTriggersFlowControl ),
     beaconAnomalyCount ( 0u ),
     iiuExistenceCount ( 0u ),
-    cacShutdownInProgress ( false )
+    cacShutdownInProgress ( false ),
+    createRequestBatch ( false ),
+    createRequestFlushDeferred ( false ),
+    shmTransport ( false )
 {
     if ( ! osiSockAttach () ) {
         throwWithLocation ( udpiiu :: noSocket () );
@@ -214,6 +221,11 @@ cac::cac (
                 this->maxRecvBytesTCP = maxBytes;
             }
         }
+        int shmTransportEnable;
+        if ( envGetBoolConfigParam ( &EPICS_CA_SHM_TRANSPORT, &shmTransportEnable ) == 0 ) {
+            this->shmTransport = shmTransportEnable != 0;
+        }
+
         freeListInitPvt ( &this->tcpSmallRecvBufFreeList, MAX_TCP, 1 );
         if ( ! this->tcpSmallRecvBufFreeList ) {
             throw std::bad_alloc ();
@@ -834,6 +846,24 @@ bool cac::versionAction ( callbackManager &, tcpiiu & iiu,
     return true;
 }
 
+bool cac::shmRequestAction ( callbackManager &, tcpiiu & iiu,
+    const epicsTime &, const caHdrLargeArray & msg, void * pMsgBdy )
+{
+    const char * pName = static_cast < const char * > ( pMsgBdy );
+    if ( msg.m_postsize == 0u || pName[msg.m_postsize-1u] != '\0' ) {
+        // the server declined, or sent something we dont understand
+        pName = "";
+    }
+    iiu.shmOfferNotify ( pName );
+    return true;
+}
+
+bool cac::shmSwitchAction ( callbackManager &, tcpiiu & iiu,
+    const epicsTime &, const caHdrLargeArray &, void * )
+{
+    return iiu.shmSwitchNotify ();
+}
+
 bool cac::echoRespAction (
     callbackManager & mgr, tcpiiu & iiu,
     const epicsTime & /* current */, const caHdrLargeArray &, void * )
@@ -1298,6 +1328,51 @@ void cac::initiateConnect (
     this->pudpiiu->installNewChannel ( guard, chan, piiu );
 }
 
+void cac::connectPendingEnd (
+    epicsGuard < epicsMutex > & guard, nciu & chan )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    if ( this->pudpiiu ) {
+        this->pudpiiu->connectPendingEnd ( guard, chan );
+    }
+}
+
+//
+// The UDP thread brackets each datagram of search replies with these
+// so that the channel create requests which the replies cause are
+// queued together, and each circuit's send thread is woken only once
+// to send them in a few large TCP frames.
+//
+void cac::beginCreateRequestBatch ()
+{
+    epicsGuard < epicsMutex > guard ( this->mutex );
+    this->createRequestBatch = true;
+}
+
+void cac::endCreateRequestBatch ()
+{
+    epicsGuard < epicsMutex > guard ( this->mutex );
+    this->createRequestBatch = false;
+    if ( this->createRequestFlushDeferred ) {
+        this->createRequestFlushDeferred = false;
+        tsDLIter < tcpiiu > iter = this->circuitList.firstIter ();
+        while ( iter.valid () ) {
+            iter->createRequestFlush ( guard );
+            iter++;
+        }
+    }
+}
+
+bool cac::deferCreateRequestFlush (
+    epicsGuard < epicsMutex > & guard )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    if ( this->createRequestBatch ) {
+        this->createRequestFlushDeferred = true;
+    }
+    return this->createRequestBatch;
+}
+
 void *cacComBufMemoryManager::allocate ( size_t size )
 {
     return this->freeList.allocate ( size );
@@ -139,6 +139,12 @@ public:
         epicsGuard < epicsMutex > &, nciu & );
     void initiateConnect (
         epicsGuard < epicsMutex > &, nciu &, netiiu * & );
+    void connectPendingEnd (
+        epicsGuard < epicsMutex > &, nciu & );
+    void beginCreateRequestBatch ();
+    void endCreateRequestBatch ();
+    bool deferCreateRequestFlush (
+        epicsGuard < epicsMutex > & );
     nciu * lookupChannel (
         epicsGuard < epicsMutex > &, const cacChannel::ioid & );
 
@@ -195,6 +201,7 @@ public:
     double connectionTimeout ( epicsGuard < epicsMutex > & );
 
     unsigned maxContiguousFrames ( epicsGuard < epicsMutex > & ) const;
+    bool sharedMemoryTransport () const;
 
     // misc
     const char * userNamePointer () const;
@@ -276,6 +283,9 @@ private:
     unsigned short _serverPort;
     unsigned iiuExistenceCount;
     bool cacShutdownInProgress;
+    bool createRequestBatch;
+    bool createRequestFlushDeferred;
+    bool shmTransport;
 
     void recycleReadNotifyIO (
         epicsGuard < epicsMutex > &, netReadNotifyIO &io );
@@ -321,6 +331,10 @@ private:
         const epicsTime & currentTime, const caHdrLargeArray &, void *pMsgBdy );
     bool verifyAndDisconnectChan ( callbackManager &, tcpiiu &,
         const epicsTime & currentTime, const caHdrLargeArray &, void *pMsgBdy );
+    bool shmRequestAction ( callbackManager &, tcpiiu &,
+        const epicsTime & currentTime, const caHdrLargeArray &, void *pMsgBdy );
+    bool shmSwitchAction ( callbackManager &, tcpiiu &,
+        const epicsTime & currentTime, const caHdrLargeArray &, void *pMsgBdy );
     bool badTCPRespAction ( callbackManager &, tcpiiu &,
         const epicsTime & currentTime, const caHdrLargeArray &, void *pMsgBdy );
 
@@ -354,6 +368,17 @@ private:
     friend class tcpiiu;
 };
 
+// brackets a datagram of search replies, see cac::beginCreateRequestBatch
+class createRequestBatch {
+public:
+    createRequestBatch ( cac & );
+    ~createRequestBatch ();
+private:
+    cac & cacRef;
+    createRequestBatch ( const createRequestBatch & );
+    createRequestBatch & operator = ( const createRequestBatch & );
+};
+
 inline const char * cac::userNamePointer () const
 {
     return this->pUserName;
@@ -406,6 +431,17 @@ inline callbackManager::callbackManager (
 {
 }
 
+inline createRequestBatch::createRequestBatch ( cac & cacIn ) :
+    cacRef ( cacIn )
+{
+    this->cacRef.beginCreateRequestBatch ();
+}
+
+inline createRequestBatch::~createRequestBatch ()
+{
+    this->cacRef.endCreateRequestBatch ();
+}
+
 inline nciu * cac::lookupChannel (
     epicsGuard < epicsMutex > & guard,
     const cacChannel::ioid & idIn )
@@ -425,6 +461,11 @@ inline unsigned cac ::
     return maxContigFrames;
 }
 
+inline bool cac :: sharedMemoryTransport () const
+{
+    return this->shmTransport;
+}
+
 inline double cac ::
     connectionTimeout ( epicsGuard < epicsMutex > & guard )
 {
@@ -29,6 +29,7 @@
 
 #include "epicsAssert.h"
 #include "epicsTime.h"
+#include "envDefs.h"
 #include "cadef.h"
 #include "caProto.h"
 
@@ -558,6 +559,11 @@ int catime ( const char * channelName,
         printf ( "Testing with %u channels named %s\n", 
              channelCount, channelName );
     }
+    {
+        /* compare a same host IOC with and without shared memory */
+        const char * pShm = envGetConfigParamPtr ( &EPICS_CA_SHM_TRANSPORT );
+        printf ( "EPICS_CA_SHM_TRANSPORT=%s\n", pShm ? pShm : "NO" );
+    }
 
     strsize = sizeof ( pItemList[0].name ) - 1;
     nBytesSent = 0;
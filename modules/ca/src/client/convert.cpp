@@ -98,6 +98,52 @@ inline epicsUInt32 dbr_htonl ( const epicsUInt32 & host )
     return tmp;
 }
 
+/*
+ * On little endian hosts with little endian floating point words every
+ * 32 and 64 bit type is converted by reversing its bytes, which is the
+ * same operation in both directions. These whole array loops move bytes
+ * individually, which optimizing compilers turn into vector shuffles.
+ */
+#if EPICS_BYTE_ORDER == EPICS_ENDIAN_LITTLE && \
+    EPICS_FLOAT_WORD_ORDER == EPICS_ENDIAN_LITTLE
+#   define CA_ARRAY_SWAP
+
+static EPICS_SIMD_CLONES void swapArray32 ( 
+    const void * s, void * d, arrayElementCount num )
+{
+    const epicsUInt8 * pSrc = static_cast < const epicsUInt8 * > ( s );
+    epicsUInt8 * pDest = static_cast < epicsUInt8 * > ( d );
+
+    for ( arrayElementCount i = 0; i < 4u * num; i += 4u ) {
+        epicsUInt8 b0 = pSrc[i], b1 = pSrc[i+1], b2 = pSrc[i+2], b3 = pSrc[i+3];
+        pDest[i] = b3;
+        pDest[i+1] = b2;
+        pDest[i+2] = b1;
+        pDest[i+3] = b0;
+    }
+}
+
+static EPICS_SIMD_CLONES void swapArray64 ( 
+    const void * s, void * d, arrayElementCount num )
+{
+    const epicsUInt8 * pSrc = static_cast < const epicsUInt8 * > ( s );
+    epicsUInt8 * pDest = static_cast < epicsUInt8 * > ( d );
+
+    for ( arrayElementCount i = 0; i < 8u * num; i += 8u ) {
+        epicsUInt8 b0 = pSrc[i], b1 = pSrc[i+1], b2 = pSrc[i+2], b3 = pSrc[i+3];
+        epicsUInt8 b4 = pSrc[i+4], b5 = pSrc[i+5], b6 = pSrc[i+6], b7 = pSrc[i+7];
+        pDest[i] = b7;
+        pDest[i+1] = b6;
+        pDest[i+2] = b5;
+        pDest[i+3] = b4;
+        pDest[i+4] = b3;
+        pDest[i+5] = b2;
+        pDest[i+6] = b1;
+        pDest[i+7] = b0;
+    }
+}
+#endif
+
 /*
  * if hton is true then it is a host to network conversion
  * otherwise vise-versa
@@ -188,6 +234,12 @@ arrayElementCount   num         /* number of values     */
     dbr_long_t          *pSrc = (dbr_long_t *) s;
     dbr_long_t          *pDest = (dbr_long_t *) d;
 
+#ifdef CA_ARRAY_SWAP
+    if ( num > 1 ) {
+        swapArray32 ( s, d, num );
+        return;
+    }
+#endif
     if(encode){
         for(arrayElementCount i=0; i<num; i++){
             pDest[i] = dbr_htonl( pSrc[i] );
@@ -248,6 +300,12 @@ arrayElementCount   num         /* number of values     */
     const dbr_float_t   *pSrc = (const dbr_float_t *) s;
     dbr_float_t         *pDest = (dbr_float_t *) d;
 
+#ifdef CA_ARRAY_SWAP
+    if ( num > 1 ) {
+        swapArray32 ( s, d, num );
+        return;
+    }
+#endif
     if(encode){
         for(arrayElementCount i=0; i<num; i++){
             dbr_htonf ( &pSrc[i], &pDest[i] );
@@ -273,6 +331,12 @@ arrayElementCount   num         /* number of values     */
     dbr_double_t        *pSrc = (dbr_double_t *) s;
     dbr_double_t        *pDest = (dbr_double_t *) d;
 
+#ifdef CA_ARRAY_SWAP
+    if ( num > 1 ) {
+        swapArray64 ( s, d, num );
+        return;
+    }
+#endif
     if(encode){
         for(arrayElementCount i=0; i<num; i++){
             dbr_htond ( &pSrc[i], &pDest[i] );
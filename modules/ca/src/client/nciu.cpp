@@ -49,7 +49,8 @@ nciu::nciu ( cac & cacIn, netiiu & iiuIn, cacChannelNotify & chanIn,
     retry ( 0u ),
     nameLength ( 0u ),
     typeCode ( USHRT_MAX ),
-    priority ( static_cast <ca_uint8_t> ( pri ) )
+    priority ( static_cast <ca_uint8_t> ( pri ) ),
+    usedSinceConnect ( false )
 {
 	size_t nameLengthTmp = strlen ( pNameIn ) + 1;
 
@@ -92,6 +93,9 @@ void nciu::destroy (
         this->getPIIU(mutualExcusionGuard)->clearChannelRequest (
                         mutualExcusionGuard, this->sid, this->id );
     }
+    if ( this->channelNode::connectPending ) {
+        this->cacCtx.connectPendingEnd ( mutualExcusionGuard, *this );
+    }
     this->piiu->uninstallChan ( mutualExcusionGuard, *this );
     this->cacCtx.destroyChannel ( mutualExcusionGuard, *this );
 }
@@ -126,6 +130,10 @@ void nciu::connect ( unsigned nativeType,
     this->typeCode = static_cast < unsigned short > ( nativeType );
     this->count = nativeCount;
     this->sid = sidIn;
+    this->usedSinceConnect = false;
+    if ( this->channelNode::connectPending ) {
+        this->cacCtx.connectPendingEnd ( guard, *this );
+    }
 
     /*
      * if less than v4.1 then the server will never
@@ -276,6 +284,7 @@ cacChannel::ioStatus nciu::read (
     cacReadNotify &notify, ioid *pId )
 {
     guard.assertIdenticalMutex ( this->cacCtx.mutexRef () );
+    this->usedSinceConnect = true;
 
     if ( ! this->connected ( guard ) ) {
         throw cacChannel::notConnected ();
@@ -321,6 +330,7 @@ void nciu::write (
     unsigned type, arrayElementCount countIn, const void * pValue )
 {
     guard.assertIdenticalMutex ( this->cacCtx.mutexRef () );
+    this->usedSinceConnect = true;
 
     // make sure that they get this and not "no write access"
     // if disconnected
@@ -343,6 +353,7 @@ cacChannel::ioStatus nciu::write (
     epicsGuard < epicsMutex > & guard, unsigned type, arrayElementCount countIn,
     const void * pValue, cacWriteNotify & notify, ioid * pId )
 {
+    this->usedSinceConnect = true;
     // make sure that they get this and not "no write access"
     // if disconnected
     if ( ! this->connected ( guard ) ) {
@@ -372,6 +383,7 @@ void nciu::subscribe (
     arrayElementCount nElem, unsigned mask,
     cacStateNotify & notify, ioid *pId )
 {
+    this->usedSinceConnect = true;
     netSubscription & io = this->cacCtx.subscriptionRequest (
                 guard, *this, *this, type, nElem, mask, notify,
                 this->channelNode::isInstalledInServer ( guard ) );
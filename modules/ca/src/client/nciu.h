@@ -41,7 +41,7 @@
 #   include "shareLib.h"
 #endif
 
-#define CA_MINOR_PROTOCOL_REVISION 13
+#define CA_MINOR_PROTOCOL_REVISION 14
 #include "caProto.h"
 
 #include "cacIO.h"
@@ -58,6 +58,7 @@ protected:
     channelNode ();
     bool isInstalledInServer ( epicsGuard < epicsMutex > & ) const;
     bool isConnected ( epicsGuard < epicsMutex > & ) const;
+    bool connectPending; // counted by udpiiu until it connects
 public:
     static unsigned getMaxSearchTimerCount ();
 private:
@@ -206,6 +207,7 @@ public:
     void disconnectAllIO (
         epicsGuard < epicsMutex > &, epicsGuard < epicsMutex > & );
     bool connected ( epicsGuard < epicsMutex > & ) const;
+    bool recentlyUsed ( epicsGuard < epicsMutex > & ) const;
     unsigned getcount() const { return count; }
 
 private:
@@ -220,6 +222,7 @@ private:
     unsigned short nameLength; // channel name length
     ca_uint16_t typeCode;
     ca_uint8_t priority;
+    bool usedSinceConnect; // IO requested since the last connect
     virtual void destroy (
         CallbackGuard & callbackGuard,
         epicsGuard < epicsMutex > & mutualExclusionGuard );
@@ -360,7 +363,16 @@ inline cacChannel::priLev nciu::getPriority (
     return this->priority;
 }
 
+// Channels with subscriptions, or which saw IO requests during their
+// last connection, are searched for first after a server restart
+inline bool nciu::recentlyUsed (
+    epicsGuard < epicsMutex > & ) const
+{
+    return this->usedSinceConnect || this->eventq.count () > 0u;
+}
+
 inline channelNode::channelNode () :
+    connectPending ( false ),
     listMember ( cs_none )
 {
 }
@@ -101,7 +101,13 @@ void searchTimer::shutdown (
 void searchTimer::installChannel ( 
     epicsGuard < epicsMutex > & guard, nciu & chan )
 {
-    this->chanListReqPending.add ( chan );
+    // channels which the application is using go out in the first frames
+    if ( chan.recentlyUsed ( guard ) ) {
+        this->chanListReqPending.push ( chan );
+    }
+    else {
+        this->chanListReqPending.add ( chan );
+    }
     chan.channelNode::setReqPendingState ( guard, this->index );
 }
 
@@ -227,6 +233,23 @@ epicsTimerNotify::expireStatus searchTimer::expire (
 #endif
     }
 
+    // frames are only sent while the rate limit shared with the
+    // other timers allows it
+    double frameLimit = this->framesPerTry;
+    if ( this->chanListReqPending.count () ) {
+        double credit = this->iiu.searchFrameCredit ( guard, currentTime );
+        if ( credit < 1.0 ) {
+            this->searchAttempts = 0;
+            this->searchResponses = 0;
+            double delay = this->iiu.searchFrameDelay ( guard );
+            double period = this->period ( guard );
+            return expireStatus ( restart, delay > period ? delay : period );
+        }
+        if ( credit < frameLimit ) {
+            frameLimit = credit;
+        }
+    }
+
     this->dgSeqNoAtTimerExpireBegin = 
         this->iiu.datagramSeqNumber ( guard );
 
@@ -247,7 +270,7 @@ epicsTimerNotify::expireStatus searchTimer::expire (
         if ( ! success ) {
             if ( this->iiu.datagramFlush ( guard, currentTime ) ) {
                 nFrameSent++;
-                if ( nFrameSent < this->framesPerTry ) {
+                if ( nFrameSent < frameLimit ) {
                     success = pChan->searchMsg ( guard );
                 }
             }
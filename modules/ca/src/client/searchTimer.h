@@ -57,6 +57,11 @@ public:
         const epicsTime & currentTime ) = 0;
     virtual ca_uint32_t datagramSeqNumber (
         epicsGuard < epicsMutex > & ) const = 0;
+    virtual double searchFrameCredit (
+        epicsGuard < epicsMutex > &,
+        const epicsTime & currentTime ) = 0;
+    virtual double searchFrameDelay (
+        epicsGuard < epicsMutex > & ) = 0;
 };
 
 class searchTimer : private epicsTimerNotify {
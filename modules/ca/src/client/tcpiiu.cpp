@@ -44,9 +44,25 @@
 #include "epicsSignal.h"
 #include "caerr.h"
 #include "udpiiu.h"
+#include "caShmTransport.h"
 
 using namespace std;
 
+// A server address is on this host if we can bind to it,
+// which is also how the repeater recognizes local clients.
+static bool addressIsLocal ( const osiSockAddr & addr )
+{
+    SOCKET sock = epicsSocketCreate ( AF_INET, SOCK_DGRAM, IPPROTO_UDP );
+    if ( sock == INVALID_SOCKET ) {
+        return false;
+    }
+    osiSockAddr tmp = addr;
+    tmp.ia.sin_port = htons ( 0 );
+    int status = bind ( sock, & tmp.sa, sizeof ( tmp.ia ) );
+    epicsSocketDestroy ( sock );
+    return status == 0;
+}
+
 tcpSendThread::tcpSendThread (
         class tcpiiu & iiuIn, const char * pName, 
         unsigned stackSize, unsigned priority ) :
@@ -114,6 +130,11 @@ void tcpSendThread::run ()
                 this->iiu.echoRequest ( guard );
             }
 
+            if ( this->iiu.shmSwitchPending ) {
+                this->iiu.shmSwitchPending = false;
+                this->iiu.shmSwitchRequest ( guard, true );
+            }
+
             while ( nciu * pChan = this->iiu.createReqPend.get () ) {
                 this->iiu.createChannelRequest ( *pChan, guard );
 
@@ -235,6 +256,15 @@ unsigned tcpiiu::sendBytes ( const void *pBuf,
     unsigned nBytes = 0u;
     assert ( nBytesInBuf <= INT_MAX );
 
+    if ( this->shmSendArmed ) {
+        if ( this->shmSendBytesViaTCP == 0u ) {
+            return this->shmSendBytes ( pBuf, nBytesInBuf, currentTime );
+        }
+        if ( nBytesInBuf > this->shmSendBytesViaTCP ) {
+            nBytesInBuf = this->shmSendBytesViaTCP;
+        }
+    }
+
     this->sendDog.start ( currentTime );
 
     while ( true ) {
@@ -243,6 +273,9 @@ unsigned tcpiiu::sendBytes ( const void *pBuf,
         if ( status > 0 ) {
             nBytes = static_cast <unsigned> ( status );
             // printf("SEND: %u\n", nBytes );
+            if ( this->shmSendArmed ) {
+                this->shmSendBytesViaTCP -= nBytes;
+            }
             break;
         }
         else {
@@ -297,14 +330,75 @@ unsigned tcpiiu::sendBytes ( const void *pBuf,
     return nBytes;
 }
 
+// only called by the send thread, after the switch message went out by TCP
+unsigned tcpiiu::shmSendBytes ( const void *pBuf, 
+    unsigned nBytesInBuf, const epicsTime & currentTime )
+{
+    unsigned nBytes = 0u;
+
+    this->sendDog.start ( currentTime );
+
+    for ( unsigned attempt = 0u; true; attempt++ ) {
+        nBytes = caShmTransportSend ( this->pShm, pBuf, nBytesInBuf );
+        if ( nBytes > 0u ) {
+            break;
+        }
+        epicsGuard < epicsMutex > guard ( this->mutex );
+        if ( this->state != iiucs_connected &&
+            this->state != iiucs_clean_shutdown ) {
+            break;
+        }
+        epicsGuardRelease < epicsMutex > unguard ( guard );
+        caShmTransportSendBackoff ( attempt );
+    }
+
+    if ( nBytes > 0u && caShmTransportWakeupNeeded ( this->pShm ) ) {
+        // the byte only wakes up the server, a failure
+        // here is also seen by the receive thread
+        char doorbell = 0;
+        ::send ( this->sock, & doorbell, 1, 0 );
+    }
+
+    this->sendDog.cancel ();
+
+    return nBytes;
+}
+
 void tcpiiu::recvBytes ( 
         void * pBuf, unsigned nBytesInBuf, statusWireIO & stat )
 {
     assert ( nBytesInBuf <= INT_MAX );
 
     while ( true ) {
-        int status = ::recv ( this->sock, static_cast <char *> ( pBuf ), 
-            static_cast <int> ( nBytesInBuf ), 0 );
+        char * pRecvBuf = static_cast <char *> ( pBuf );
+        int nRecvBytes = static_cast <int> ( nBytesInBuf );
+        char doorbell[64];
+
+        if ( this->shmRecvActive ) {
+            unsigned nBytes = caShmTransportRecv ( 
+                this->pShm, pBuf, nBytesInBuf );
+            if ( nBytes > 0u ) {
+                stat.bytesCopied = nBytes;
+                stat.circuitState = swioConnected;
+                return;
+            }
+            if ( caShmTransportRecvWaitBegin ( this->pShm ) ) {
+                continue;
+            }
+            // block until the server wakes us up, or the circuit
+            // goes away; the bytes themselves carry nothing
+            pRecvBuf = doorbell;
+            nRecvBytes = static_cast <int> ( sizeof ( doorbell ) );
+        }
+
+        int status = ::recv ( this->sock, pRecvBuf, nRecvBytes, 0 );
+
+        if ( this->shmRecvActive ) {
+            caShmTransportRecvWaitEnd ( this->pShm );
+            if ( status > 0 ) {
+                continue;
+            }
+        }
 
         if ( status > 0 ) {
             stat.bytesCopied = static_cast <unsigned> ( status );
@@ -469,12 +563,19 @@ void tcpRecvThread::run ()
             // file manager call backs works correctly. This does not 
             // appear to impact performance.
             //
-            if ( ! pComBuf ) {
-                pComBuf = new ( this->iiu.comBufMemMgr ) comBuf;
-            }
-
+            // the body of a large message is received directly into
+            // the message body cache instead of through the comBuf queue
+            const bool largeBody = this->iiu.largeMsgBodyPending ();
             statusWireIO stat;
-            pComBuf->fillFromWire ( this->iiu, stat );
+            if ( largeBody ) {
+                this->iiu.recvLargeMsgBody ( stat );
+            }
+            else {
+                if ( ! pComBuf ) {
+                    pComBuf = new ( this->iiu.comBufMemMgr ) comBuf;
+                }
+                pComBuf->fillFromWire ( this->iiu, stat );
+            }
 
             epicsTime currentTime = epicsTime::getCurrent ();
 
@@ -488,8 +589,17 @@ void tcpRecvThread::run ()
                     continue;
                 }
 
-                this->iiu.recvQue.pushLastComBufReceived ( *pComBuf );
-                pComBuf = 0;
+                if ( largeBody ) {
+                    // no need for the callback lock until the body is complete
+                    if ( this->iiu.largeMsgBodyPending () ) {
+                        this->iiu.recvDog.messageArrivalNotify ( guard );
+                        continue;
+                    }
+                }
+                else {
+                    this->iiu.recvQue.pushLastComBufReceived ( *pComBuf );
+                    pComBuf = 0;
+                }
 
                 this->iiu._receiveThreadIsBusy = true;
             }
@@ -688,6 +798,7 @@ tcpiiu::tcpiiu (
     recvQue ( comBufMemMgrIn ),
     curDataMax ( MAX_TCP ),
     curDataBytes ( 0ul ),
+    smallMsgsSinceLarge ( 0u ),
     comBufMemMgr ( comBufMemMgrIn ),
     cacRef ( cac ),
     pCurData ( (char*) freeListMalloc(this->cacRef.tcpSmallRecvBufFreeList) ),
@@ -712,7 +823,12 @@ tcpiiu::tcpiiu (
     recvProcessPostponedFlush ( false ),
     discardingPendingData ( false ),
     socketHasBeenClosed ( false ),
-    unresponsiveCircuit ( false )
+    unresponsiveCircuit ( false ),
+    pShm ( 0 ),
+    shmSendBytesViaTCP ( 0u ),
+    shmSwitchPending ( false ),
+    shmSendArmed ( false ),
+    shmRecvActive ( false )
 {
     if(!pCurData)
         throw std::bad_alloc();
@@ -759,6 +875,11 @@ tcpiiu::tcpiiu (
         this->versionMessage ( guard, this->priority() );
         this->userNameSetRequest ( guard );
         this->hostNameSetRequest ( guard );
+        if ( this->cacRef.sharedMemoryTransport () &&
+                CA_V414 ( this->minorProtocolVersion ) &&
+                ! this->isNameService () && addressIsLocal ( addrIn ) ) {
+            this->shmRequest ( guard );
+        }
     }
 
 #   if 0
@@ -1027,6 +1148,8 @@ tcpiiu :: ~tcpiiu ()
         epicsSocketDestroy ( this->sock );
     }
 
+    caShmTransportDestroy ( this->pShm );
+
     // free message body cache
     if ( this->pCurData ) {
         if ( this->curDataMax <= MAX_TCP ) {
@@ -1056,6 +1179,8 @@ void tcpiiu::show ( unsigned level ) const
             this->contigRecvMsgCount, this->busyStateDetected, this->flowControlActive );
         ::printf ( "\receive thread is busy=%u\n", 
             this->_receiveThreadIsBusy );
+        ::printf ( "\tshared memory transport send=%u, receive=%u\n", 
+            this->shmSendArmed, this->shmRecvActive );
     }
     if ( level > 2u ) {
         ::printf ( "\tvirtual circuit socket identifier %d\n", this->sock );
@@ -1144,6 +1269,72 @@ void tcpiiu::flushIfRecvProcessRequested (
     }
 }
 
+//
+// true when the remainder of the current message body can be received
+// directly into the message body cache, bypassing the comBuf queue
+// (only called by the receive thread)
+//
+bool tcpiiu::largeMsgBodyPending () const
+{
+    return this->msgHeaderAvailable &&
+        this->curMsg.m_postsize > MAX_TCP &&
+        this->curMsg.m_postsize <= this->curDataMax &&
+        this->curDataBytes < this->curMsg.m_postsize &&
+        this->recvQue.occupiedBytes () == 0u;
+}
+
+void tcpiiu::recvLargeMsgBody ( statusWireIO & stat )
+{
+    this->recvBytes ( & this->pCurData[this->curDataBytes],
+        this->curMsg.m_postsize - this->curDataBytes, stat );
+    if ( stat.circuitState == swioConnected ) {
+        this->curDataBytes += stat.bytesCopied;
+    }
+}
+
+//
+// return to a small message body cache after a large message has
+// been delivered so that a circuit that received one large array
+// does not hold EPICS_CA_MAX_ARRAY_BYTES until it is destroyed,
+// but only once enough small messages or time have passed since, so
+// that a stream of large monitor updates keeps the same cache
+//
+static const unsigned largeMsgBodyCacheSmallMsgs = 64u;
+static const double largeMsgBodyCacheIdle = 2.0; // sec
+
+void tcpiiu::releaseLargeMsgBodyCache ( const epicsTime & currentTime )
+{
+    if ( this->curMsg.m_postsize > MAX_TCP ) {
+        this->lastLargeMsgTime = currentTime;
+        this->smallMsgsSinceLarge = 0u;
+        return;
+    }
+    if ( this->smallMsgsSinceLarge < largeMsgBodyCacheSmallMsgs ) {
+        this->smallMsgsSinceLarge++;
+    }
+    if ( this->curDataMax <= MAX_TCP ||
+            this->recvQue.occupiedBytes () > 0u ) {
+        return;
+    }
+    if ( this->smallMsgsSinceLarge < largeMsgBodyCacheSmallMsgs &&
+            currentTime - this->lastLargeMsgTime < largeMsgBodyCacheIdle ) {
+        return;
+    }
+    char * pSmall = static_cast < char * > (
+        freeListMalloc ( this->cacRef.tcpSmallRecvBufFreeList ) );
+    if ( ! pSmall ) {
+        return;
+    }
+    if ( this->cacRef.tcpLargeRecvBufFreeList ) {
+        freeListFree ( this->cacRef.tcpLargeRecvBufFreeList, this->pCurData );
+    }
+    else {
+        free ( this->pCurData );
+    }
+    this->pCurData = pSmall;
+    this->curDataMax = MAX_TCP;
+}
+
 bool tcpiiu::processIncoming ( 
     const epicsTime & currentTime, 
     callbackManager & mgr )
@@ -1265,6 +1456,7 @@ bool tcpiiu::processIncoming (
             if ( ! msgOK ) {
                 return false;
             }
+            this->releaseLargeMsgBodyCache ( currentTime );
         }
         else {
             static bool once = false;
@@ -1398,6 +1590,45 @@ void tcpiiu::versionMessage ( epicsGuard < epicsMutex > & guard,
     minder.commit ();
 }
 
+void tcpiiu::shmRequest ( epicsGuard < epicsMutex > & guard )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+
+    if ( this->sendQue.flushEarlyThreshold ( 16u ) ) {
+        this->flushRequest ( guard );
+    }
+    comQueSendMsgMinder minder ( this->sendQue, guard );
+    this->sendQue.insertRequestHeader ( 
+        CA_PROTO_SHM_REQUEST, 0u, 
+        0u, 0u, 0u, 0u, 
+        CA_V49 ( this->minorProtocolVersion ) );
+    minder.commit ();
+}
+
+void tcpiiu::shmSwitchRequest ( 
+    epicsGuard < epicsMutex > & guard, bool accept )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+
+    if ( this->sendQue.flushEarlyThreshold ( 16u ) ) {
+        this->flushRequest ( guard );
+    }
+    comQueSendMsgMinder minder ( this->sendQue, guard );
+    this->sendQue.insertRequestHeader ( 
+        CA_PROTO_SHM_SWITCH, 0u, 
+        0u, 0u, 0u, accept ? 1u : 0u, 
+        CA_V49 ( this->minorProtocolVersion ) );
+    minder.commit ();
+
+    if ( accept ) {
+        // everything queued so far, this message included, is sent 
+        // by TCP and sendBytes () continues in the ring after that
+        this->shmSendBytesViaTCP = this->sendQue.occupiedBytes ();
+        this->shmSendArmed = true;
+    }
+    this->flushRequest ( guard );
+}
+
 void tcpiiu::echoRequest ( epicsGuard < epicsMutex > & guard )
 {
     guard.assertIdenticalMutex ( this->mutex );
@@ -1952,8 +2183,21 @@ void tcpiiu::installChannel (
     chan.channelNode::listMember = channelNode::cs_createReqPend;
     chan.searchReplySetUp ( *this, sidIn, typeIn, countIn, guard );
     // The tcp send thread runs at apriority below the udp thread 
-    // so that this will not send small packets
-    this->sendThreadFlushEvent.signal ();
+    // so that this will not send small packets. Where thread priorities
+    // are not honored the UDP thread instead defers the wakeup until it
+    // has processed the entire datagram of search replies.
+    if ( ! this->cacRef.deferCreateRequestFlush ( guard ) ) {
+        this->sendThreadFlushEvent.signal ();
+    }
+}
+
+void tcpiiu::createRequestFlush (
+    epicsGuard < epicsMutex > & guard )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    if ( this->createReqPend.count () ) {
+        this->sendThreadFlushEvent.signal ();
+    }
 }
 
 bool tcpiiu :: connectNotify ( 
@@ -2045,6 +2289,9 @@ void tcpiiu::flushRequest ( epicsGuard < epicsMutex > & )
 
 bool tcpiiu::bytesArePendingInOS () const
 {
+    if ( this->shmRecvActive ) {
+        return caShmTransportRecvPending ( this->pShm ) > 0u;
+    }
 #if 0
     FD_SET readBits;
     FD_ZERO ( & readBits );
@@ -2191,6 +2438,38 @@ void tcpiiu :: versionRespNotify ( const caHdrLargeArray & msg )
     this->minorProtocolVersion = msg.m_count;
 }
 
+// the server answered our CA_PROTO_SHM_REQUEST, an empty name
+// if it wont use shared memory for this circuit
+void tcpiiu :: shmOfferNotify ( const char * pName )
+{
+    if ( pName[0] == '\0' || this->pShm ) {
+        return;
+    }
+    caShmTransportId pTransport = caShmTransportOpen ( pName );
+
+    epicsGuard < epicsMutex > guard ( this->mutex );
+    if ( pTransport ) {
+        // the send thread sends the switch so that it can 
+        // tell which bytes still go by TCP
+        this->pShm = pTransport;
+        this->shmSwitchPending = true;
+        this->sendThreadFlushEvent.signal ();
+    }
+    else {
+        this->shmSwitchRequest ( guard, false );
+    }
+}
+
+// the server moved its side of the stream into the ring
+bool tcpiiu :: shmSwitchNotify ()
+{
+    if ( ! this->pShm || this->shmRecvActive ) {
+        return false;
+    }
+    this->shmRecvActive = true;
+    return true;
+}
+
 void tcpiiu :: searchRespNotify (
     const epicsTime & currentTime, const caHdrLargeArray & msg )
 {    
@@ -93,6 +93,30 @@ double getMaxPeriod()
     return maxPeriod;
 }
 
+static
+double getMaxSearchRate()
+{
+    double maxRate = maxSearchRateDefault;
+
+    if ( envGetConfigParamPtr ( & EPICS_CA_MAX_SEARCH_RATE ) ) {
+        long longStatus = envGetDoubleConfigParam (
+            & EPICS_CA_MAX_SEARCH_RATE, & maxRate );
+        if ( longStatus ) {
+            maxRate = maxSearchRateDefault;
+            epicsPrintf ( "EPICS \"%s\" wasnt a real number\n",
+                            EPICS_CA_MAX_SEARCH_RATE.name );
+            epicsPrintf ( "Setting \"%s\" = %f frames per second\n",
+                EPICS_CA_MAX_SEARCH_RATE.name, maxRate );
+        }
+        else if ( maxRate < 0.0 ) {
+            // zero disables the limit
+            maxRate = 0.0;
+        }
+    }
+
+    return maxRate;
+}
+
 static
 unsigned getNTimers(double maxPeriod)
 {
@@ -132,6 +156,19 @@ udpiiu::udpiiu (
         m_repeaterTimerNotify, timerQueue, cbMutexIn, ctxNotifyIn ),
     govTmr ( *this, timerQueue, cacMutexIn ),
     maxPeriod ( getMaxPeriod() ),
+    maxSearchRate ( getMaxSearchRate() ),
+    searchCredit ( 1.0 ),
+    searchCreditTime ( epicsTime::getCurrent () ),
+    connectBegin ( searchCreditTime ),
+    connectTimeLast ( 0.0 ),
+    connectTimeMax ( 0.0 ),
+    connectTimeLatest ( 0.0 ),
+    nSearchFrames ( 0u ),
+    nSearchDeferred ( 0u ),
+    nConnectPending ( 0u ),
+    nConnectChannels ( 0u ),
+    nConnected ( 0u ),
+    nConnectChannelsLast ( 0u ),
     rtteMean ( minRoundTripEstimate ),
     rtteMeanDev ( 0 ),
     cacRef ( cac ),
@@ -434,6 +471,7 @@ void udpRecvThread::run ()
             }
         }
         else if ( status > 0 ) {
+            createRequestBatch batch ( this->iiu.cacRef );
             this->iiu.postMsg ( src, this->iiu.recvBuf, 
                 (arrayElementCount) status, epicsTime::getCurrent() );
         }
@@ -1138,15 +1176,77 @@ bool udpiiu :: datagramFlush (
 
     this->pushVersionMsg ();
 
+    this->nSearchFrames++;
+    if ( this->maxSearchRate > 0.0 ) {
+        this->searchCredit -= 1.0;
+    }
+
     return true;
 }
 
+//
+// All of the search timers draw from one budget of EPICS_CA_MAX_SEARCH_RATE
+// frames per second so that, after a server restart, thousands of
+// disconnected channels are searched for at a bounded rate instead of
+// in a burst from every timer at once. The per timer frames per try
+// continues to back off when search replies go missing.
+//
+double udpiiu::searchFrameCredit (
+    epicsGuard < epicsMutex > & guard, const epicsTime & currentTime )
+{
+    guard.assertIdenticalMutex ( this->cacMutex );
+
+    if ( this->maxSearchRate <= 0.0 ) {
+        return DBL_MAX;
+    }
+    double delay = currentTime - this->searchCreditTime;
+    if ( delay > 0.0 ) {
+        this->searchCreditTime = currentTime;
+        this->searchCredit += delay * this->maxSearchRate;
+        double burst = this->maxSearchRate * maxSearchBurstPeriod;
+        if ( burst < 1.0 ) {
+            burst = 1.0;
+        }
+        if ( this->searchCredit > burst ) {
+            this->searchCredit = burst;
+        }
+    }
+    if ( this->searchCredit < 1.0 ) {
+        this->nSearchDeferred++;
+    }
+    return this->searchCredit;
+}
+
+double udpiiu::searchFrameDelay (
+    epicsGuard < epicsMutex > & guard )
+{
+    guard.assertIdenticalMutex ( this->cacMutex );
+
+    if ( this->maxSearchRate <= 0.0 || this->searchCredit >= 1.0 ) {
+        return 0.0;
+    }
+    return ( 1.0 - this->searchCredit ) / this->maxSearchRate;
+}
+
 void udpiiu :: show ( unsigned level ) const
 {
     epicsGuard < epicsMutex > guard ( this->cacMutex );
 
     ::printf ( "Datagram IO circuit (and disconnected channel repository)\n");
     if ( level > 1u ) {
+        ::printf ( "\t%u channels waiting to connect", this->nConnectPending );
+        if ( this->nConnectPending ) {
+            ::printf ( " for %.3f sec, %u of %u connected after %.3f sec",
+                epicsTime::getCurrent () - this->connectBegin,
+                this->nConnected, this->nConnectChannels,
+                this->connectTimeLatest );
+        }
+        ::printf ( "\n\tlast time all connected: %u channels in %.3f sec, "
+            "longest %.3f sec\n", this->nConnectChannelsLast, 
+            this->connectTimeLast, this->connectTimeMax );
+        ::printf ( "\t%lu search frames sent, %lu searches deferred "
+            "by EPICS_CA_MAX_SEARCH_RATE=%g\n", this->nSearchFrames, 
+            this->nSearchDeferred, this->maxSearchRate );
         ::printf ("\trepeater port %u\n", this->repeaterPort );
         ::printf ("\tdefault server port %u\n", this->serverPort );
         ::printf ( "Search Destination List with %u items\n", 
@@ -1260,6 +1360,7 @@ void udpiiu::installNewChannel (
     epicsGuard < epicsMutex > & guard, nciu & chan, netiiu * & piiu )
 {
     piiu = this;
+    this->connectPendingBegin ( guard, chan );
     this->ppSearchTmr[0]->installChannel ( guard, chan );
 }
 
@@ -1267,9 +1368,58 @@ void udpiiu::installDisconnectedChannel (
     epicsGuard < epicsMutex > & guard, nciu & chan )
 {
     chan.setServerAddressUnknown ( *this, guard );
+    this->connectPendingBegin ( guard, chan );
     this->govTmr.installChan ( guard, chan );
 }
 
+//
+// Time how long it takes for all of the channels to connect after
+// a burst of them is created or disconnected, such as when a server
+// restarts. The time is measured from the first of them until the
+// last one connects or is destroyed.
+//
+void udpiiu::connectPendingBegin (
+    epicsGuard < epicsMutex > & guard, nciu & chan )
+{
+    guard.assertIdenticalMutex ( this->cacMutex );
+
+    if ( chan.channelNode::connectPending ) {
+        return;
+    }
+    chan.channelNode::connectPending = true;
+    if ( this->nConnectPending++ == 0u ) {
+        this->connectBegin = epicsTime::getCurrent ();
+        this->connectTimeLatest = 0.0;
+        this->nConnectChannels = 0u;
+        this->nConnected = 0u;
+    }
+    this->nConnectChannels++;
+}
+
+void udpiiu::connectPendingEnd (
+    epicsGuard < epicsMutex > & guard, nciu & chan )
+{
+    guard.assertIdenticalMutex ( this->cacMutex );
+
+    if ( ! chan.channelNode::connectPending ) {
+        return;
+    }
+    chan.channelNode::connectPending = false;
+    assert ( this->nConnectPending > 0u );
+    if ( chan.connected ( guard ) ) {
+        this->connectTimeLatest = 
+            epicsTime::getCurrent () - this->connectBegin;
+        this->nConnected++;
+    }
+    if ( --this->nConnectPending == 0u ) {
+        this->connectTimeLast = this->connectTimeLatest;
+        if ( this->connectTimeLast > this->connectTimeMax ) {
+            this->connectTimeMax = this->connectTimeLast;
+        }
+        this->nConnectChannelsLast = this->nConnected;
+    }
+}
+
 void udpiiu::noSearchRespNotify ( 
     epicsGuard < epicsMutex > & guard, nciu & chan, unsigned index )
 {
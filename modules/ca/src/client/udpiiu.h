@@ -84,6 +84,8 @@ static const double maxRoundTripEstimate = 30; // seconds
 static const double maxSearchPeriodDefault = 5.0 * 60.0; // seconds
 static const double maxSearchPeriodLowerLimit = 60.0; // seconds
 static const double beaconAnomalySearchPeriod = 5.0; // seconds
+static const double maxSearchRateDefault = 1000.0; // UDP frames per second
+static const double maxSearchBurstPeriod = 0.1; // seconds of unused rate saved
 
 class udpiiu : 
     private netiiu, 
@@ -104,6 +106,8 @@ public:
         epicsGuard < epicsMutex > &, nciu &, netiiu * & );
     void installDisconnectedChannel ( 
         epicsGuard < epicsMutex > &, nciu & );
+    void connectPendingEnd (
+        epicsGuard < epicsMutex > &, nciu & );
     void beaconAnomalyNotify ( 
         epicsGuard < epicsMutex > & guard );
     void shutdown ( epicsGuard < epicsMutex > & cbGuard, 
@@ -162,6 +166,19 @@ private:
     disconnectGovernorTimer govTmr;
     tsDLList < SearchDest > _searchDestList;
     const double maxPeriod;
+    const double maxSearchRate;
+    double searchCredit;
+    epicsTime searchCreditTime;
+    epicsTime connectBegin;
+    double connectTimeLast;
+    double connectTimeMax;
+    double connectTimeLatest;
+    unsigned long nSearchFrames;
+    unsigned long nSearchDeferred;
+    unsigned nConnectPending;
+    unsigned nConnectChannels;
+    unsigned nConnected;
+    unsigned nConnectChannelsLast;
     double rtteMean;
     double rtteMeanDev;
     cac & cacRef;
@@ -190,6 +207,8 @@ private:
     bool lastReceivedSeqNoIsValid;
 
     bool wakeupMsg ();
+    void connectPendingBegin (
+        epicsGuard < epicsMutex > &, nciu & );
 
     void postMsg ( 
             const osiSockAddr & net_addr, 
@@ -298,6 +317,10 @@ private:
         epicsGuard < epicsMutex > &, const epicsTime & currentTime );
     ca_uint32_t datagramSeqNumber ( 
         epicsGuard < epicsMutex > & ) const;
+    double searchFrameCredit (
+        epicsGuard < epicsMutex > &, const epicsTime & currentTime );
+    double searchFrameDelay (
+        epicsGuard < epicsMutex > & );
 
     // disconnectGovernorNotify
     void govExpireNotify ( 
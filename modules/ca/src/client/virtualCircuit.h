@@ -36,6 +36,7 @@
 #include "tcpSendWatchdog.h"
 #include "hostNameCache.h"
 #include "SearchDest.h"
+#include "caShmTransport.h"
 #include "compilerDependencies.h"
 
 class callbackManager;
@@ -189,6 +190,8 @@ public:
     void installChannel ( 
         epicsGuard < epicsMutex > &, nciu & chan, 
         unsigned sidIn, ca_uint16_t typeIn, arrayElementCount countIn );
+    void createRequestFlush (
+        epicsGuard < epicsMutex > & );
     void uninstallChan ( 
         epicsGuard < epicsMutex > & guard, nciu & chan );
     bool connectNotify ( 
@@ -197,6 +200,8 @@ public:
     void searchRespNotify ( 
         const epicsTime &, const caHdrLargeArray & );
     void versionRespNotify ( const caHdrLargeArray & );
+    void shmOfferNotify ( const char * pName );
+    bool shmSwitchNotify ();
 
     void * operator new ( size_t size, 
         tsFreeList < class tcpiiu, 32, epicsMutexNOOP >  & );
@@ -223,6 +228,8 @@ private:
     caHdrLargeArray curMsg;
     arrayElementCount curDataMax;
     arrayElementCount curDataBytes;
+    epicsTime lastLargeMsgTime;
+    unsigned smallMsgsSinceLarge;
     comBufMemoryManager & comBufMemMgr;
     cac & cacRef;
     char * pCurData;
@@ -256,11 +263,21 @@ private:
     bool discardingPendingData;
     bool socketHasBeenClosed;
     bool unresponsiveCircuit;
+    caShmTransportId pShm; // set by the recv thread before switching
+    unsigned shmSendBytesViaTCP; // only used by the send thread
+    bool shmSwitchPending;
+    bool shmSendArmed; // only used by the send thread
+    bool shmRecvActive; // only used by the recv thread
 
     bool processIncoming ( 
         const epicsTime & currentTime, callbackManager & );
+    bool largeMsgBodyPending () const;
+    void recvLargeMsgBody ( statusWireIO & );
+    void releaseLargeMsgBodyCache ( const epicsTime & currentTime );
     unsigned sendBytes ( const void *pBuf, 
         unsigned nBytesInBuf, const epicsTime & currentTime );
+    unsigned shmSendBytes ( const void *pBuf, 
+        unsigned nBytesInBuf, const epicsTime & currentTime );
     void recvBytes ( 
         void * pBuf, unsigned nBytesInBuf, statusWireIO & );
     const char * pHostName (
@@ -294,6 +311,10 @@ private:
         epicsGuard < epicsMutex > & );
     void userNameSetRequest ( 
         epicsGuard < epicsMutex > & );
+    void shmRequest ( 
+        epicsGuard < epicsMutex > & );
+    void shmSwitchRequest ( 
+        epicsGuard < epicsMutex > &, bool accept );
     void createChannelRequest ( 
         nciu &, epicsGuard < epicsMutex > & );
     void writeRequest ( 
@@ -0,0 +1,222 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Run a search cache on the loopback interface between a client socket
+ * and a fake server socket, and check that it answers repeated searches
+ * itself until the name's time to live expires
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "epicsTime.h"
+#include "envDefs.h"
+#include "osiWireFormat.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#include "caSearchCache.h"
+
+static const char * const testName = "caSearchCacheTest:pv";
+static const unsigned short testServerPort = 12345u;
+static const double timeToLive = 1.0; // sec
+
+static SOCKET loopbackSocket ( osiSockAddr & addr )
+{
+    SOCKET sock = epicsSocketCreate ( AF_INET, SOCK_DGRAM, IPPROTO_UDP );
+    osiSocklen_t len = sizeof ( addr );
+
+    if ( sock == INVALID_SOCKET ) {
+        testAbort ( "Can't create a UDP socket" );
+    }
+    memset ( & addr, 0, sizeof ( addr ) );
+    addr.ia.sin_family = AF_INET;
+    addr.ia.sin_addr.s_addr = htonl ( INADDR_LOOPBACK );
+    addr.ia.sin_port = 0;
+    if ( bind ( sock, & addr.sa, sizeof ( addr.ia ) ) ||
+            getsockname ( sock, & addr.sa, & len ) ) {
+        testAbort ( "Can't bind a UDP socket" );
+    }
+    return sock;
+}
+
+static void putHdr ( char * pBuf, unsigned cmmd, unsigned postSize,
+    unsigned dataType, unsigned count, ca_uint32_t cid, ca_uint32_t available )
+{
+    caHdr * pMsg = reinterpret_cast < caHdr * > ( pBuf );
+    AlignedWireRef < epicsUInt16 > ( pMsg->m_cmmd ) = cmmd;
+    AlignedWireRef < epicsUInt16 > ( pMsg->m_postsize ) = postSize;
+    AlignedWireRef < epicsUInt16 > ( pMsg->m_dataType ) = dataType;
+    AlignedWireRef < epicsUInt16 > ( pMsg->m_count ) = count;
+    AlignedWireRef < epicsUInt32 > ( pMsg->m_cid ) = cid;
+    AlignedWireRef < epicsUInt32 > ( pMsg->m_available ) = available;
+}
+
+// the first CA_PROTO_SEARCH message in a datagram
+static const caHdr * findSearch ( const char * pBuf, int len )
+{
+    while ( len >= (int) sizeof ( caHdr ) ) {
+        const caHdr * pMsg = reinterpret_cast < const caHdr * > ( pBuf );
+        unsigned size = sizeof ( caHdr ) +
+            AlignedWireRef < const epicsUInt16 > ( pMsg->m_postsize );
+        if ( (int) size > len ) {
+            break;
+        }
+        if ( AlignedWireRef < const epicsUInt16 > ( pMsg->m_cmmd ) ==
+                CA_PROTO_SEARCH ) {
+            return pMsg;
+        }
+        pBuf += size;
+        len -= size;
+    }
+    return 0;
+}
+
+static void sendSearch ( SOCKET sock, const osiSockAddr & cache,
+    ca_uint32_t cid )
+{
+    char buf [MAX_UDP_SEND];
+    unsigned nameLength = strlen ( testName ) + 1u;
+    unsigned postSize = CA_MESSAGE_ALIGN ( nameLength );
+
+    memset ( buf, 0, sizeof ( buf ) );
+    putHdr ( buf, CA_PROTO_VERSION, 0u, sequenceNoIsValid,
+        CA_MINOR_PROTOCOL_REVISION, cid, 0u );
+    putHdr ( buf + sizeof ( caHdr ), CA_PROTO_SEARCH, postSize, DONTREPLY,
+        CA_MINOR_PROTOCOL_REVISION, cid, cid );
+    memcpy ( buf + 2 * sizeof ( caHdr ), testName, nameLength );
+    sendto ( sock, buf, 2 * sizeof ( caHdr ) + postSize, 0,
+        & cache.sa, sizeof ( cache.ia ) );
+}
+
+static void sendReply ( SOCKET sock, const osiSockAddr & cache,
+    ca_uint32_t id )
+{
+    char buf [2 * sizeof ( caHdr ) + 8u];
+
+    memset ( buf, 0, sizeof ( buf ) );
+    putHdr ( buf, CA_PROTO_VERSION, 0u, 0u, CA_MINOR_PROTOCOL_REVISION,
+        0u, 0u );
+    putHdr ( buf + sizeof ( caHdr ), CA_PROTO_SEARCH, 8u, testServerPort,
+        0u, INADDR_LOOPBACK, id );
+    buf[2 * sizeof ( caHdr ) + 1u] = CA_MINOR_PROTOCOL_REVISION;
+    sendto ( sock, buf, sizeof ( buf ), 0, & cache.sa, sizeof ( cache.ia ) );
+}
+
+//
+// the cache runs in this thread, so it is given the chance to
+// process whatever arrives while waiting for a datagram
+//
+static int waitFor ( SOCKET sock, char * pBuf, unsigned size,
+    osiSockAddr & from, double timeout )
+{
+    epicsTime begin = epicsTime::getCurrent ();
+
+    while ( epicsTime::getCurrent () - begin < timeout ) {
+        fileDescriptorManager.process ( 0.01 );
+
+        struct timeval noWait = { 0, 0 };
+        fd_set fds;
+        FD_ZERO ( & fds );
+        FD_SET ( sock, & fds );
+        if ( select ( sock + 1, & fds, NULL, NULL, & noWait ) > 0 ) {
+            osiSocklen_t len = sizeof ( from );
+            return recvfrom ( sock, pBuf, size, 0, & from.sa, & len );
+        }
+    }
+    return 0;
+}
+
+// the cache's upstream search for testName, returns its id
+static bool upstreamSearch ( SOCKET server, osiSockAddr & cache,
+    ca_uint32_t & id, double timeout )
+{
+    char buf [MAX_UDP_RECV];
+    int len = waitFor ( server, buf, sizeof ( buf ), cache, timeout );
+    const caHdr * pMsg = findSearch ( buf, len );
+
+    if ( ! pMsg || strcmp ( reinterpret_cast < const char * > ( pMsg + 1 ),
+            testName ) ) {
+        return false;
+    }
+    id = AlignedWireRef < const epicsUInt32 > ( pMsg->m_available );
+    return true;
+}
+
+static void checkReply ( SOCKET client, ca_uint32_t cid )
+{
+    char buf [MAX_UDP_RECV];
+    osiSockAddr from;
+    int len = waitFor ( client, buf, sizeof ( buf ), from, 1.0 );
+    const caHdr * pMsg = findSearch ( buf, len );
+
+    if ( ! testOk ( pMsg != 0, "Client %u got a search reply", cid ) ) {
+        return;
+    }
+    epicsUInt32 replyCid = AlignedWireRef < const epicsUInt32 > ( pMsg->m_available );
+    epicsUInt32 addr = AlignedWireRef < const epicsUInt32 > ( pMsg->m_cid );
+    epicsUInt16 port = AlignedWireRef < const epicsUInt16 > ( pMsg->m_dataType );
+    testOk ( replyCid == cid && addr == INADDR_LOOPBACK &&
+            port == testServerPort,
+        "Reply is for cid %u at %08x:%u", replyCid, addr, port );
+}
+
+MAIN(caSearchCacheTest)
+{
+    osiSockAddr clientAddr, cacheAddr, upstreamAddr, serverAddr, from;
+    char addrList [32];
+    ca_uint32_t id = 0u;
+
+    testPlan ( 9 );
+    osiSockAttach ();
+
+    SOCKET client = loopbackSocket ( clientAddr );
+    SOCKET cacheSock = loopbackSocket ( cacheAddr );
+    SOCKET upstreamSock = loopbackSocket ( upstreamAddr );
+    SOCKET server = loopbackSocket ( serverAddr );
+
+    sprintf ( addrList, "127.0.0.1:%u", ntohs ( serverAddr.ia.sin_port ) );
+    epicsEnvSet ( "EPICS_CA_ADDR_LIST", addrList );
+    epicsEnvSet ( "EPICS_CA_AUTO_ADDR_LIST", "NO" );
+
+    searchCache * pCache = new searchCache ( cacheSock, upstreamSock,
+        ntohs ( cacheAddr.ia.sin_port ), timeToLive, 0u );
+
+    testDiag ( "A name that isn't cached is searched for upstream" );
+
+    sendSearch ( client, cacheAddr, 1u );
+    testOk ( upstreamSearch ( server, from, id, 1.0 ),
+        "Server got an upstream search for %s", testName );
+    sendReply ( server, from, id );
+    checkReply ( client, 1u );
+
+    testDiag ( "The cache answers the next search itself" );
+
+    sendSearch ( client, cacheAddr, 2u );
+    checkReply ( client, 2u );
+    testOk ( ! upstreamSearch ( server, from, id, 0.3 ),
+        "Server didn't see the search" );
+
+    testDiag ( "The name is searched for again after its time to live" );
+
+    epicsTime begin = epicsTime::getCurrent ();
+    while ( epicsTime::getCurrent () - begin < 2.5 * timeToLive ) {
+        fileDescriptorManager.process ( 0.1 );
+    }
+    sendSearch ( client, cacheAddr, 3u );
+    testOk ( upstreamSearch ( server, from, id, 1.0 ),
+        "Server got a new upstream search for %s", testName );
+    sendReply ( server, from, id );
+    checkReply ( client, 3u );
+
+    delete pCache;
+    epicsSocketDestroy ( server );
+    epicsSocketDestroy ( upstreamSock );
+    epicsSocketDestroy ( cacheSock );
+    epicsSocketDestroy ( client );
+    osiSockRelease ();
+    return testDone ();
+}
@@ -0,0 +1,131 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Check that EPICS_CA_MAX_SEARCH_RATE limits the search frames a client
+ * sends while it looks for many channels which don't exist
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "cadef.h"
+#include "envDefs.h"
+#include "epicsTime.h"
+#include "osiSock.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NCHANNELS 2000
+#define WINDOW 2.0      /* seconds */
+
+static SOCKET searchSocket(unsigned short *pport)
+{
+    SOCKET sock = epicsSocketCreate(AF_INET, SOCK_DGRAM, 0);
+    osiSockAddr addr;
+    osiSocklen_t len = sizeof(addr);
+
+    if (sock == INVALID_SOCKET)
+        testAbort("Can't create a UDP socket");
+
+    memset(&addr, 0, sizeof(addr));
+    addr.ia.sin_family = AF_INET;
+    addr.ia.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.ia.sin_port = 0;
+    if (bind(sock, &addr.sa, sizeof(addr.ia)) ||
+        getsockname(sock, &addr.sa, &len))
+        testAbort("Can't bind a UDP socket");
+
+    *pport = ntohs(addr.ia.sin_port);
+    return sock;
+}
+
+/* Datagrams which arrive within WINDOW seconds of the first one */
+static unsigned countFrames(SOCKET sock)
+{
+    epicsTimeStamp first, now;
+    unsigned count = 0;
+    char buf[2048];
+
+    for (;;) {
+        struct timeval timeout;
+        fd_set fds;
+        double left = WINDOW;
+
+        if (count) {
+            epicsTimeGetCurrent(&now);
+            left -= epicsTimeDiffInSeconds(&now, &first);
+            if (left <= 0.0)
+                break;
+        }
+        timeout.tv_sec = (long) left;
+        timeout.tv_usec = (long) ((left - timeout.tv_sec) * 1e6);
+        FD_ZERO(&fds);
+        FD_SET(sock, &fds);
+        if (select(sock + 1, &fds, NULL, NULL, &timeout) <= 0)
+            break;
+        if (recv(sock, buf, sizeof(buf), 0) <= 0)
+            break;
+        if (!count++)
+            epicsTimeGetCurrent(&first);
+    }
+    return count;
+}
+
+static unsigned searchFrames(const char *rate)
+{
+    static chid chans[NCHANNELS];
+    unsigned short port;
+    SOCKET sock = searchSocket(&port);
+    char addrList[32];
+    unsigned count;
+    int i;
+
+    sprintf(addrList, "127.0.0.1:%u", port);
+    epicsEnvSet("EPICS_CA_ADDR_LIST", addrList);
+    epicsEnvSet("EPICS_CA_AUTO_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CA_MAX_SEARCH_RATE", rate);
+
+    if (ca_context_create(ca_enable_preemptive_callback) != ECA_NORMAL)
+        testAbort("Can't create a CA context");
+
+    for (i = 0; i < NCHANNELS; i++) {
+        char name[40];
+
+        sprintf(name, "caSearchRateTest:missing:%d", i);
+        if (ca_create_channel(name, NULL, NULL, 0, &chans[i]) != ECA_NORMAL)
+            testAbort("Can't create channel %s", name);
+    }
+    ca_flush_io();
+
+    count = countFrames(sock);
+
+    ca_context_destroy();
+    epicsSocketDestroy(sock);
+    return count;
+}
+
+MAIN(caSearchRateTest)
+{
+    unsigned limited, unlimited;
+
+    testPlan(3);
+    osiSockAttach();
+
+    testDiag("Searching for %d channels for %g seconds", NCHANNELS, WINDOW);
+
+    unlimited = searchFrames("0");
+    testOk(unlimited > 0, "Unlimited client sent %u frames", unlimited);
+
+    /* The first frames come from the burst allowance of 2 */
+    limited = searchFrames("20");
+    testOk(limited > 0 && limited <= 20 * WINDOW + 2 + 1,
+        "Client limited to 20 frames/sec sent %u frames", limited);
+    testOk(unlimited > limited,
+        "The limit deferred %u frames", unlimited - limited);
+
+    osiSockRelease();
+    return testDone();
+}
@@ -0,0 +1,14 @@
+/* menuPriority.h generated from menuPriority.dbd */
+
+#ifndef INC_menuPriority_H
+#define INC_menuPriority_H
+
+typedef enum {
+    menuPriorityLOW                 /* LOW */,
+    menuPriorityMEDIUM              /* MEDIUM */,
+    menuPriorityHIGH                /* HIGH */
+} menuPriority;
+#define menuPriority_NUM_CHOICES 3
+
+
+#endif /* INC_menuPriority_H */
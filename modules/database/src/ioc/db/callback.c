@@ -25,6 +25,7 @@
 #include "epicsAtomic.h"
 #include "epicsEvent.h"
 #include "epicsInterrupt.h"
+#include "epicsRingMPMC.h"
 #include "epicsRingPointer.h"
 #include "epicsString.h"
 #include "epicsThread.h"
@@ -50,9 +51,26 @@
 
 static int callbackQueueSize = 2000;
 
+/* Queue implementations, selected by callbackSetQueueMode() */
+enum cbQueueMode_t {
+    cbQueueLocked,   /* one spinlock-protected ring per priority */
+    cbQueueLockFree, /* one lock-free MPMC ring per priority */
+    cbQueueStealing, /* one lock-free ring per worker, idle workers steal */
+};
+
+static const char *queueModeName[] = {
+    "locked", "lockfree", "stealing"
+};
+
+static int callbackQueueMode = cbQueueLocked;
+
 typedef struct cbQueueSet {
     epicsEventId semWakeUp;
-    epicsRingPointerId queue;
+    epicsRingPointerId queue;   /* cbQueueLocked */
+    epicsRingMPMCId *subQueue;  /* cbQueueLockFree and cbQueueStealing */
+    int nSubQueues;
+    int nextSubQueue;   /* round-robin push index, use atomic */
+    int nextWorker;     /* home sub-queue of the next worker, use atomic */
     int queueOverflow;
     int queueOverflows;
     int shutdown; // use atomic
@@ -107,6 +125,160 @@ int callbackSetQueueSize(int size)
     return 0;
 }
 
+int callbackSetQueueMode(const char *mode)
+{
+    int i;
+
+    if (epicsAtomicGetIntT(&cbState)!=cbInit) {
+        fprintf(stderr, "Callback system already initialized\n");
+        return -1;
+    }
+    if (!mode || *mode == 0) {
+        callbackQueueMode = cbQueueLocked;
+        return 0;
+    }
+    for (i = 0; i < (int)NELEMENTS(queueModeName); i++) {
+        if (epicsStrCaseCmp(mode, queueModeName[i]) == 0) {
+            callbackQueueMode = i;
+            return 0;
+        }
+    }
+    fprintf(stderr, "callbackSetQueueMode: Unknown mode \"%s\", "
+        "expected locked, lockfree or stealing\n", mode);
+    return -1;
+}
+
+/* Queue operations, dispatching on callbackQueueMode */
+
+static int queuePush(cbQueueSet *mySet, void *ptr)
+{
+    int n = mySet->nSubQueues;
+    unsigned start;
+    int i;
+
+    if (mySet->queue)
+        return epicsRingPointerPush(mySet->queue, ptr);
+
+    if (n == 1)
+        return epicsRingMPMCPush(mySet->subQueue[0], ptr);
+
+    /* Spread requests over the workers, fall back to any with room */
+    start = (unsigned)epicsAtomicIncrIntT(&mySet->nextSubQueue);
+    for (i = 0; i < n; i++) {
+        if (epicsRingMPMCPush(mySet->subQueue[(start + i) % n], ptr))
+            return 1;
+    }
+    return 0;
+}
+
+static void* queuePop(cbQueueSet *mySet, int home)
+{
+    int n = mySet->nSubQueues;
+    int i;
+
+    if (mySet->queue)
+        return epicsRingPointerPop(mySet->queue);
+
+    /* Own sub-queue first, then steal from the others */
+    for (i = 0; i < n; i++) {
+        void *ptr = epicsRingMPMCPop(mySet->subQueue[(home + i) % n]);
+        if (ptr)
+            return ptr;
+    }
+    return NULL;
+}
+
+static int queueIsEmpty(cbQueueSet *mySet)
+{
+    int i;
+
+    if (mySet->queue)
+        return epicsRingPointerIsEmpty(mySet->queue);
+
+    for (i = 0; i < mySet->nSubQueues; i++) {
+        if (!epicsRingMPMCIsEmpty(mySet->subQueue[i]))
+            return FALSE;
+    }
+    return TRUE;
+}
+
+static int queueGetUsed(cbQueueSet *mySet)
+{
+    int i, used = 0;
+
+    if (mySet->queue)
+        return epicsRingPointerGetUsed(mySet->queue);
+
+    for (i = 0; i < mySet->nSubQueues; i++)
+        used += epicsRingMPMCGetUsed(mySet->subQueue[i]);
+    return used;
+}
+
+/* With several sub-queues this is the sum of their individual marks,
+ * an upper bound of the true high-water mark.
+ */
+static int queueGetHighWaterMark(cbQueueSet *mySet)
+{
+    int i, hwm = 0;
+
+    if (mySet->queue)
+        return epicsRingPointerGetHighWaterMark(mySet->queue);
+
+    for (i = 0; i < mySet->nSubQueues; i++)
+        hwm += epicsRingMPMCGetHighWaterMark(mySet->subQueue[i]);
+    return hwm;
+}
+
+static void queueResetHighWaterMark(cbQueueSet *mySet)
+{
+    int i;
+
+    if (mySet->queue) {
+        epicsRingPointerResetHighWaterMark(mySet->queue);
+        return;
+    }
+    for (i = 0; i < mySet->nSubQueues; i++)
+        epicsRingMPMCResetHighWaterMark(mySet->subQueue[i]);
+}
+
+static int queueCreate(cbQueueSet *mySet)
+{
+    int i, n, size;
+
+    if (callbackQueueMode == cbQueueLocked) {
+        mySet->queue = epicsRingPointerLockedCreate(callbackQueueSize);
+        return mySet->queue != NULL;
+    }
+
+    n = 1;
+    if (callbackQueueMode == cbQueueStealing && mySet->threadsConfigured > 1)
+        n = mySet->threadsConfigured;
+    size = (callbackQueueSize + n - 1) / n;
+
+    mySet->subQueue = callocMustSucceed(n, sizeof(epicsRingMPMCId),
+        "callbackInit");
+    mySet->nSubQueues = n;
+    for (i = 0; i < n; i++) {
+        mySet->subQueue[i] = epicsRingMPMCCreate(size);
+        if (!mySet->subQueue[i])
+            return FALSE;
+    }
+    return TRUE;
+}
+
+static void queueDelete(cbQueueSet *mySet)
+{
+    int i;
+
+    if (mySet->queue) {
+        epicsRingPointerDelete(mySet->queue);
+        return;
+    }
+    for (i = 0; i < mySet->nSubQueues; i++)
+        epicsRingMPMCDelete(mySet->subQueue[i]);
+    free(mySet->subQueue);
+}
+
 int callbackQueueStatus(const int reset, callbackQueueStats *result)
 {
     int ret;
@@ -115,9 +287,9 @@ int callbackQueueStatus(const int reset, callbackQueueStats *result)
         int prio;
         result->size = callbackQueueSize;
         for(prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
-            epicsRingPointerId qId = callbackQueue[prio].queue;
-            result->numUsed[prio] = epicsRingPointerGetUsed(qId);
-            result->maxUsed[prio] = epicsRingPointerGetHighWaterMark(qId);
+            cbQueueSet *mySet = &callbackQueue[prio];
+            result->numUsed[prio] = queueGetUsed(mySet);
+            result->maxUsed[prio] = queueGetHighWaterMark(mySet);
             result->numOverflow[prio] = epicsAtomicGetIntT(&callbackQueue[prio].queueOverflows);
         }
         ret = 0;
@@ -127,7 +299,7 @@ int callbackQueueStatus(const int reset, callbackQueueStats *result)
     if (reset) {
         int prio;
         for(prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
-            epicsRingPointerResetHighWaterMark(callbackQueue[prio].queue);
+            queueResetHighWaterMark(&callbackQueue[prio]);
         }
     }
     return ret;
@@ -141,6 +313,8 @@ void callbackQueueShow(const int reset)
             "iocInit before using this command.\n");
     } else {
         int prio;
+        if (callbackQueueMode != cbQueueLocked)
+            printf("Queue mode: %s\n", queueModeName[callbackQueueMode]);
         printf("PRIORITY  HIGH-WATER MARK  ITEMS IN Q  Q SIZE  %% USED  Q OVERFLOWS\n");
         for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
             double qusage = 100.0 * stats.numUsed[prio] / stats.size;
@@ -206,18 +380,22 @@ static void callbackTask(void *arg)
 {
     int prio = *(int*)arg;
     cbQueueSet *mySet = &callbackQueue[prio];
+    int home = epicsAtomicIncrIntT(&mySet->nextWorker) - 1;
+
+    if (mySet->nSubQueues > 0)
+        home %= mySet->nSubQueues;
 
     taskwdInsert(0, NULL, NULL);
     epicsEventSignal(startStopEvent);
 
     while(!epicsAtomicGetIntT(&mySet->shutdown)) {
         void *ptr;
-        if (epicsRingPointerIsEmpty(mySet->queue))
+        if (queueIsEmpty(mySet))
             epicsEventMustWait(mySet->semWakeUp);
 
-        while ((ptr = epicsRingPointerPop(mySet->queue))) {
+        while ((ptr = queuePop(mySet, home))) {
             CALLBACK *pcallback = (CALLBACK *)ptr;
-            if(!epicsRingPointerIsEmpty(mySet->queue))
+            if(!queueIsEmpty(mySet))
                 epicsEventMustTrigger(mySet->semWakeUp);
             mySet->queueOverflow = FALSE;
             (*pcallback->callback)(pcallback);
@@ -263,7 +441,7 @@ void callbackCleanup(void)
 
         assert(epicsAtomicGetIntT(&mySet->threadsRunning)==0);
         epicsEventDestroy(mySet->semWakeUp);
-        epicsRingPointerDelete(mySet->queue);
+        queueDelete(mySet);
     }
 
     epicsTimerQueueRelease(timerQueue);
@@ -290,13 +468,12 @@ void callbackInit(void)
         epicsThreadId tid;
 
         callbackQueue[i].semWakeUp = epicsEventMustCreate(epicsEventEmpty);
-        callbackQueue[i].queue = epicsRingPointerLockedCreate(callbackQueueSize);
-        if (callbackQueue[i].queue == 0)
-            cantProceed("epicsRingPointerLockedCreate failed for %s\n",
-                threadNamePrefix[i]);
         callbackQueue[i].queueOverflow = FALSE;
         if (callbackQueue[i].threadsConfigured == 0)
             callbackQueue[i].threadsConfigured = callbackThreadsDefault;
+        if (!queueCreate(&callbackQueue[i]))
+            cantProceed("Failed to create %s callback queue for %s\n",
+                queueModeName[callbackQueueMode], threadNamePrefix[i]);
 
         for (j = 0; j < callbackQueue[i].threadsConfigured; j++) {
             if (callbackQueue[i].threadsConfigured > 1 )
@@ -335,7 +512,7 @@ int callbackRequest(CALLBACK *pcallback)
     mySet = &callbackQueue[priority];
     if (mySet->queueOverflow) return S_db_bufFull;
 
-    pushOK = epicsRingPointerPush(mySet->queue, pcallback);
+    pushOK = queuePush(mySet, pcallback);
 
     if (!pushOK) {
         epicsInterruptContextMessage(fullMessage[priority]);
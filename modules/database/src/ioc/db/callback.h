@@ -80,6 +80,7 @@ epicsShareFunc void callbackCancelDelayed(CALLBACK *pcallback);
 epicsShareFunc void callbackRequestProcessCallbackDelayed(
     CALLBACK *pCallback, int Priority, void *pRec, double seconds);
 epicsShareFunc int callbackSetQueueSize(int size);
+epicsShareFunc int callbackSetQueueMode(const char *mode);
 epicsShareFunc int callbackQueueStatus(const int reset, callbackQueueStats *result);
 epicsShareFunc void callbackQueueShow(const int reset);
 epicsShareFunc int callbackParallelThreads(int count, const char *prio);
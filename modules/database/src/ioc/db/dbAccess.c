@@ -1060,7 +1060,7 @@ static long dbPutFieldLink(DBADDR *paddr,
         return status;
 
     if (link_info.ltype == PV_LINK &&
-        (link_info.modifiers & (pvlOptCA | pvlOptCP | pvlOptCPP)) == 0) {
+        dbLinkWantDb(pfldDes->field_type, link_info.modifiers)) {
         DBADDR tempaddr;
 
         if (dbNameToAddr(link_info.target, &tempaddr)==0) {
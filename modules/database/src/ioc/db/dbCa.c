@@ -26,6 +26,7 @@
 #include "epicsExit.h"
 #include "epicsMutex.h"
 #include "epicsPrint.h"
+#include "epicsStdio.h"
 #include "epicsString.h"
 #include "epicsThread.h"
 #include "epicsAtomic.h"
@@ -51,6 +52,7 @@
 #include "link.h"
 #include "recGbl.h"
 #include "recSup.h"
+#include "epicsExport.h"
 
 /* defined in dbContext.cpp
  * Setup local CA access
@@ -58,17 +60,35 @@
 extern void dbServiceIOInit();
 extern int dbServiceIsolate;
 
-static ELLLIST workList = ELLLIST_INIT;    /* Work list for dbCaTask */
-static epicsMutexId workListLock; /*Mutual exclusions semaphores for workList*/
-static epicsEventId workListEvent; /*wakeup event for dbCaTask*/
-static int removesOutstanding = 0;
+/* Each caLink is handled by one dbCaTask thread */
+typedef struct dbCaShard {
+    ELLLIST workList;           /* Work list for dbCaTask */
+    epicsMutexId workListLock;  /* Mutual exclusion semaphore for workList */
+    epicsEventId workListEvent; /* wakeup event for dbCaTask */
+    int removesOutstanding;
+    epicsThreadId worker;
+} dbCaShard;
+
+static dbCaShard *shards;
+static int nShards;
+static int nextShard;
 #define removesOutstandingWarning 10000
 
 static volatile enum dbCaCtl_t {
     ctlInit, ctlRun, ctlPause, ctlExit
 } dbCaCtl;
 static epicsEventId startStopEvent;
-static epicsThreadId dbCaWorker;
+
+/* Number of dbCaTask threads, CA links are given to each in turn.
+ * Negative values are subtracted from the number of CPUs.
+ */
+epicsShareDef int dbCaLinkThreads = 1;
+epicsExportAddress(int, dbCaLinkThreads);
+
+/* Most workList entries a dbCaTask handles between calls to ca_flush_io()
+ */
+epicsShareDef int dbCaBatchSize = 64;
+epicsExportAddress(int, dbCaBatchSize);
 
 struct ca_client_context * dbCaClientContext;
 
@@ -89,7 +109,8 @@ static int dbca_chan_count;
  *  dbScanLock -> caLink.lock -> workListLock
  *
  * workListLock:
- *   Guards access to workList.
+ *   Each dbCaShard has one, guarding access to its workList
+ *   and the work list statistics of its caLinks.
  *
  * dbScanLock:
  *   All dbCa* functions operating on a single link may only be called when
@@ -109,6 +130,8 @@ static int dbca_chan_count;
  *
  * The dbCaTask only locks caLink, and must not lock the record (a violation of lock order).
  *
+ * A caLink stays with the same dbCaTask, so its requests are made in order.
+ *
  * During link modification or IOC shutdown the pca->plink pointer (guarded by caLink.lock)
  * is used as a flag to indicate that a link is no longer active.
  *
@@ -127,9 +150,10 @@ static int dbca_chan_count;
 
 static void addAction(caLink *pca, short link_action)
 {
+    dbCaShard *shard = pca->shard;
     int callAdd;
 
-    epicsMutexMustLock(workListLock);
+    epicsMutexMustLock(shard->workListLock);
     callAdd = (pca->link_action == 0);
     if (pca->link_action & CA_CLEAR_CHANNEL) {
         errlogPrintf("dbCa::addAction %d with CA_CLEAR_CHANNEL set\n",
@@ -138,22 +162,25 @@ static void addAction(caLink *pca, short link_action)
         link_action = 0;
     }
     if (link_action & CA_CLEAR_CHANNEL) {
-        if (++removesOutstanding >= removesOutstandingWarning) {
+        if (++shard->removesOutstanding >= removesOutstandingWarning) {
             errlogPrintf("dbCa::addAction pausing, %d channels to clear\n",
-                removesOutstanding);
+                shard->removesOutstanding);
         }
-        while (removesOutstanding >= removesOutstandingWarning) {
-            epicsMutexUnlock(workListLock);
+        while (shard->removesOutstanding >= removesOutstandingWarning) {
+            epicsMutexUnlock(shard->workListLock);
             epicsThreadSleep(1.0);
-            epicsMutexMustLock(workListLock);
+            epicsMutexMustLock(shard->workListLock);
         }
     }
     pca->link_action |= link_action;
+    if (callAdd) {
+        pca->queuedAt = epicsMonotonicGet();
+        ellAdd(&shard->workList, &pca->node);
+    } else
+        pca->nCoalesced++;
+    epicsMutexUnlock(shard->workListLock);
     if (callAdd)
-        ellAdd(&workList, &pca->node);
-    epicsMutexUnlock(workListLock);
-    if (callAdd)
-        epicsEventSignal(workListEvent);
+        epicsEventSignal(shard->workListEvent);
 }
 
 static void caLinkInc(caLink *pca)
@@ -175,7 +202,7 @@ static void caLinkDec(caLink *pca)
 
     if (pca->chid) {
         ca_clear_channel(pca->chid);
-        --dbca_chan_count;
+        epicsAtomicDecrIntT(&dbca_chan_count);
     }
     callback = pca->putCallback;
     if (callback) {
@@ -193,39 +220,45 @@ static void caLinkDec(caLink *pca)
     if (callback) callback(userPvt);
 }
 
-/* Block until worker thread has processed all previously queued actions.
+/* Block until worker threads have processed all previously queued actions.
  * Does not prevent additional actions from being queued.
  */
 void dbCaSync(void)
 {
     epicsEventId wake;
     caLink templink;
-
-    /* we only partially initialize templink.
-     * It has no link field and no subscription
-     * so the worker must handle it early
-     */
-    memset(&templink, 0, sizeof(templink));
-    templink.refcount = 1;
+    int i;
 
     wake = epicsEventMustCreate(epicsEventEmpty);
-    templink.lock = epicsMutexMustCreate();
 
-    templink.userPvt = wake;
+    for (i = 0; i < nShards; i++) {
+        dbCaShard *shard = &shards[i];
+
+        /* we only partially initialize templink.
+         * It has no link field and no subscription
+         * so the worker must handle it early
+         */
+        memset(&templink, 0, sizeof(templink));
+        templink.refcount = 1;
+        templink.shard = shard;
+        templink.lock = epicsMutexMustCreate();
 
-    addAction(&templink, CA_SYNC);
+        templink.userPvt = wake;
 
-    epicsEventMustWait(wake);
-    /* Worker holds workListLock when calling epicsEventMustTrigger()
-     * we cycle through workListLock to ensure worker call to
-     * epicsEventMustTrigger() returns before we destroy the event.
-     */
-    epicsMutexMustLock(workListLock);
-    epicsMutexUnlock(workListLock);
+        addAction(&templink, CA_SYNC);
 
-    assert(templink.refcount==1);
+        epicsEventMustWait(wake);
+        /* Worker holds workListLock when calling epicsEventMustTrigger()
+         * we cycle through workListLock to ensure worker call to
+         * epicsEventMustTrigger() returns before we reuse the event.
+         */
+        epicsMutexMustLock(shard->workListLock);
+        epicsMutexUnlock(shard->workListLock);
 
-    epicsMutexDestroy(templink.lock);
+        assert(templink.refcount==1);
+
+        epicsMutexDestroy(templink.lock);
+    }
     epicsEventDestroy(wake);
 }
 
@@ -252,20 +285,38 @@ void dbCaCallbackProcess(void *userPvt)
     dbLinkAsyncComplete(plink);
 }
 
+static void signalWorkers(void)
+{
+    int i;
+
+    for (i = 0; i < nShards; i++)
+        epicsEventSignal(shards[i].workListEvent);
+}
+
 void dbCaShutdown(void)
 {
     enum dbCaCtl_t cur = dbCaCtl;
+    int i;
+
     assert(cur == ctlRun || cur == ctlPause);
     dbCaCtl = ctlExit;
-    epicsEventSignal(workListEvent);
-    epicsEventMustWait(startStopEvent);
-    if(dbCaWorker)
-        epicsThreadMustJoin(dbCaWorker);
+
+    /* The first worker owns the CA context, so it must stop last */
+    for (i = nShards - 1; i >= 0; i--) {
+        epicsEventSignal(shards[i].workListEvent);
+        if (i == 0)
+            epicsEventMustWait(startStopEvent);
+        if (shards[i].worker)
+            epicsThreadMustJoin(shards[i].worker);
+        shards[i].worker = NULL;
+    }
 }
 
 static void dbCaLinkInitImpl(int isolate)
 {
     epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    int nWorkers = dbCaLinkThreads;
+    int i;
 
     opts.stackSize = epicsThreadGetStackSize(epicsThreadStackBig);
     opts.priority = epicsThreadPriorityMedium;
@@ -274,18 +325,47 @@ static void dbCaLinkInitImpl(int isolate)
     dbServiceIsolate = isolate;
     dbServiceIOInit();
 
-    if (!workListLock)
-        workListLock = epicsMutexMustCreate();
-    if (!workListEvent)
-        workListEvent = epicsEventMustCreate(epicsEventEmpty);
+    if (nWorkers < 0)
+        nWorkers += epicsThreadGetCPUs();
+    if (nWorkers < 1)
+        nWorkers = 1;
+
+    if (shards && nShards != nWorkers) {
+        /* Stopped IOC, all work lists are empty */
+        for (i = 0; i < nShards; i++) {
+            assert(ellCount(&shards[i].workList) == 0);
+            epicsMutexDestroy(shards[i].workListLock);
+            epicsEventDestroy(shards[i].workListEvent);
+        }
+        free(shards);
+        shards = NULL;
+    }
+    if (!shards) {
+        shards = dbCalloc(nWorkers, sizeof(*shards));
+        for (i = 0; i < nWorkers; i++) {
+            ellInit(&shards[i].workList);
+            shards[i].workListLock = epicsMutexMustCreate();
+            shards[i].workListEvent = epicsEventMustCreate(epicsEventEmpty);
+        }
+        nShards = nWorkers;
+    }
 
     if(!startStopEvent)
         startStopEvent = epicsEventMustCreate(epicsEventEmpty);
     dbCaCtl = ctlPause;
 
-    dbCaWorker = epicsThreadCreateOpt("dbCaLink", dbCaTask, NULL, &opts);
+    shards[0].worker = epicsThreadCreateOpt("dbCaLink", dbCaTask,
+        &shards[0], &opts);
     /* wait for worker to startup and initialize dbCaClientContext */
     epicsEventMustWait(startStopEvent);
+
+    for (i = 1; i < nShards; i++) {
+        char name[20];
+
+        epicsSnprintf(name, sizeof(name), "dbCaLink-%d", i);
+        shards[i].worker = epicsThreadCreateOpt(name, dbCaTask,
+            &shards[i], &opts);
+    }
 }
 
 void dbCaLinkInitIsolated(void)
@@ -302,7 +382,7 @@ void dbCaRun(void)
 {
     if (dbCaCtl == ctlPause) {
         dbCaCtl = ctlRun;
-        epicsEventSignal(workListEvent);
+        signalWorkers();
     }
 }
 
@@ -310,7 +390,7 @@ void dbCaPause(void)
 {
     if (dbCaCtl == ctlRun) {
         dbCaCtl = ctlPause;
-        epicsEventSignal(workListEvent);
+        signalWorkers();
     }
 }
 
@@ -323,6 +403,8 @@ void dbCaAddLinkCallback(struct link *plink,
 
     pca = (caLink *)dbCalloc(1, sizeof(caLink));
     pca->refcount = 1;
+    pca->shard = &shards[(unsigned)epicsAtomicIncrIntT(&nextShard) %
+        (unsigned)nShards];
     pca->lock = epicsMutexMustCreate();
     pca->plink = plink;
     pca->pvname = epicsStrDup(plink->value.pv_link.pvname);
@@ -406,6 +488,7 @@ long dbCaGetLink(struct link *plink, short dbrType, void *pdest,
         status = -1;
         goto done;
     }
+    pca->newInNative = FALSE;
     newType = dbDBRoldToDBFnew[pca->dbrType];
     if (!nelements || *nelements == 1) {
         long (*fConvert)(const void *from, void *to, struct dbAddr *paddr);
@@ -900,6 +983,9 @@ static void eventCallback(struct event_handler_args arg)
         memcpy(pca->pgetNative, dbr_value_ptr(arg.dbr, arg.type), size);
         pca->usedelements = arg.count;
         pca->gotInNative = TRUE;
+        if (pca->newInNative)
+            pca->nOverwrite++;
+        pca->newInNative = TRUE;
         break;
     default:
         errlogPrintf("dbCa: eventCallback Logic Error. dbr=%ld dbf=%d\n",
@@ -1044,162 +1130,209 @@ static void getAttribEventCallback(struct event_handler_args arg)
     if (connect) connect(userPvt);
 }
 
+/* Carry out the requests for one caLink, called by its dbCaTask */
+static void doActions(caLink *pca, short link_action)
+{
+    int status;
+
+    if (link_action & CA_CLEAR_CHANNEL) {   /* This must be first */
+        caLinkDec(pca);
+        /* No alarm is raised. Since link is changing so what? */
+        return; /* No other link_action makes sense */
+    }
+    if (link_action & CA_CONNECT) {
+        status = ca_create_channel(
+              pca->pvname,connectionCallback,(void *)pca,
+              CA_PRIORITY_DB_LINKS, &(pca->chid));
+        if (status != ECA_NORMAL) {
+            errlogPrintf("dbCaTask ca_create_channel %s\n",
+                ca_message(status));
+            printLinks(pca);
+            return;
+        }
+        epicsAtomicIncrIntT(&dbca_chan_count);
+        status = ca_replace_access_rights_event(pca->chid,
+            accessRightsCallback);
+        if (status != ECA_NORMAL) {
+            errlogPrintf("dbCaTask replace_access_rights_event %s\n",
+                ca_message(status));
+            printLinks(pca);
+        }
+        return; /*Other options must wait until connect*/
+    }
+    if (ca_state(pca->chid) != cs_conn) return;
+    if (link_action & CA_WRITE_NATIVE) {
+        assert(pca->pputNative);
+        if (pca->putType == CA_PUT) {
+            status = ca_array_put(
+                pca->dbrType, pca->putnelements,
+                pca->chid, pca->pputNative);
+        } else if (pca->putType==CA_PUT_CALLBACK) {
+            status = ca_array_put_callback(
+                pca->dbrType, pca->putnelements,
+                pca->chid, pca->pputNative,
+                putComplete, pca);
+        } else {
+            status = ECA_PUTFAIL;
+        }
+        if (status != ECA_NORMAL) {
+            errlogPrintf("dbCaTask ca_array_put %s\n",
+                ca_message(status));
+            printLinks(pca);
+        }
+        epicsMutexMustLock(pca->lock);
+        if (status == ECA_NORMAL) pca->newOutNative = FALSE;
+        epicsMutexUnlock(pca->lock);
+    }
+    if (link_action & CA_WRITE_STRING) {
+        assert(pca->pputString);
+        if (pca->putType == CA_PUT) {
+            status = ca_array_put(
+                DBR_STRING, 1,
+                pca->chid, pca->pputString);
+        } else if (pca->putType==CA_PUT_CALLBACK) {
+            status = ca_array_put_callback(
+                DBR_STRING, 1,
+                pca->chid, pca->pputString,
+                putComplete, pca);
+        } else {
+            status = ECA_PUTFAIL;
+        }
+        if (status != ECA_NORMAL) {
+            errlogPrintf("dbCaTask ca_array_put %s\n",
+                ca_message(status));
+            printLinks(pca);
+        }
+        epicsMutexMustLock(pca->lock);
+        if (status == ECA_NORMAL) pca->newOutString = FALSE;
+        epicsMutexUnlock(pca->lock);
+    }
+    /*CA_GET_ATTRIBUTES before CA_MONITOR so that attributes available
+     * before the first monitor callback                              */
+    if (link_action & CA_GET_ATTRIBUTES) {
+        status = ca_get_callback(DBR_CTRL_DOUBLE,
+            pca->chid, getAttribEventCallback, pca);
+        if (status != ECA_NORMAL) {
+            errlogPrintf("dbCaTask ca_get_callback %s\n",
+                ca_message(status));
+            printLinks(pca);
+        }
+    }
+    if (link_action & CA_MONITOR_NATIVE) {
+
+        epicsMutexMustLock(pca->lock);
+        pca->elementSize = dbr_value_size[ca_field_type(pca->chid)];
+        pca->pgetNative = dbCalloc(pca->nelements, pca->elementSize);
+        epicsMutexUnlock(pca->lock);
+
+        status = ca_add_array_event(
+            dbf_type_to_DBR_TIME(ca_field_type(pca->chid)),
+            0, /* dynamic size */
+            pca->chid, eventCallback, pca, 0.0, 0.0, 0.0,
+            &pca->evidNative);
+        if (status != ECA_NORMAL) {
+            errlogPrintf("dbCaTask ca_add_array_event %s\n",
+                ca_message(status));
+            printLinks(pca);
+        }
+    }
+    if (link_action & CA_MONITOR_STRING) {
+        epicsMutexMustLock(pca->lock);
+        pca->pgetString = dbCalloc(1, MAX_STRING_SIZE);
+        epicsMutexUnlock(pca->lock);
+        status = ca_add_array_event(DBR_TIME_STRING, 1,
+            pca->chid, eventCallback, pca, 0.0, 0.0, 0.0,
+            &pca->evidString);
+        if (status != ECA_NORMAL) {
+            errlogPrintf("dbCaTask ca_add_array_event %s\n",
+                ca_message(status));
+            printLinks(pca);
+        }
+    }
+}
+
 static void dbCaTask(void *arg)
 {
+    dbCaShard *shard = (dbCaShard *)arg;
+    int isFirst = (shard == &shards[0]);
+    int nbatch = dbCaBatchSize > 0 ? dbCaBatchSize : 1;
+    caLink **batch = dbCalloc(nbatch, sizeof(*batch));
+    short *actions = dbCalloc(nbatch, sizeof(*actions));
+
     taskwdInsert(0, NULL, NULL);
-    SEVCHK(ca_context_create(ca_enable_preemptive_callback),
-        "dbCaTask calling ca_context_create");
-    dbCaClientContext = ca_current_context ();
-    SEVCHK(ca_add_exception_event(exceptionCallback,NULL),
-        "ca_add_exception_event");
-    epicsEventSignal(startStopEvent);
+    if (isFirst) {
+        SEVCHK(ca_context_create(ca_enable_preemptive_callback),
+            "dbCaTask calling ca_context_create");
+        dbCaClientContext = ca_current_context ();
+        SEVCHK(ca_add_exception_event(exceptionCallback,NULL),
+            "ca_add_exception_event");
+        epicsEventSignal(startStopEvent);
+    } else {
+        SEVCHK(ca_attach_context(dbCaClientContext),
+            "dbCaTask calling ca_attach_context");
+    }
 
     /* channel access event loop */
     while (TRUE){
         do {
-            epicsEventMustWait(workListEvent);
+            epicsEventMustWait(shard->workListEvent);
         } while (dbCaCtl == ctlPause);
         while (TRUE) { /* process all requests in workList*/
+            epicsUInt64 now = epicsMonotonicGet();
             caLink *pca;
-            short  link_action;
-            int    status;
+            int n = 0, i;
+
+            /* Take a batch off the list head */
+            epicsMutexMustLock(shard->workListLock);
+            while (n < nbatch &&
+                   (pca = (caLink *)ellGet(&shard->workList))) {
+                epicsUInt64 waited = now > pca->queuedAt ?
+                    now - pca->queuedAt : 0;
+
+                pca->nAction++;
+                pca->queueTime += waited;
+                if (waited > pca->queueMax)
+                    pca->queueMax = waited;
+
+                actions[n] = pca->link_action;
+                pca->link_action = 0;
+                if (actions[n] & CA_CLEAR_CHANNEL)
+                    --shard->removesOutstanding;
+                batch[n++] = pca;
+            }
+            epicsMutexUnlock(shard->workListLock);
 
-            epicsMutexMustLock(workListLock);
-            if (!(pca = (caLink *)ellGet(&workList))){  /* Take off list head */
-                epicsMutexUnlock(workListLock);
+            if (n == 0) {
                 if (dbCaCtl == ctlExit) goto shutdown;
                 break; /* workList is empty */
             }
-            link_action = pca->link_action;
-            if (link_action&CA_SYNC)
-                epicsEventMustTrigger((epicsEventId)pca->userPvt); /* dbCaSync() requires workListLock to be held here */
-            pca->link_action = 0;
-            if (link_action & CA_CLEAR_CHANNEL) --removesOutstanding;
-            epicsMutexUnlock(workListLock);         /* Give back immediately */
-            if (link_action&CA_SYNC)
-                continue;
-            if (link_action & CA_CLEAR_CHANNEL) {   /* This must be first */
-                caLinkDec(pca);
-                /* No alarm is raised. Since link is changing so what? */
-                continue; /* No other link_action makes sense */
-            }
-            if (link_action & CA_CONNECT) {
-                status = ca_create_channel(
-                      pca->pvname,connectionCallback,(void *)pca,
-                      CA_PRIORITY_DB_LINKS, &(pca->chid));
-                if (status != ECA_NORMAL) {
-                    errlogPrintf("dbCaTask ca_create_channel %s\n",
-                        ca_message(status));
-                    printLinks(pca);
+
+            for (i = 0; i < n; i++) {
+                if (actions[i] & CA_SYNC) {
+                    /* dbCaSync() requires workListLock to be held here */
+                    epicsMutexMustLock(shard->workListLock);
+                    epicsEventMustTrigger((epicsEventId)batch[i]->userPvt);
+                    epicsMutexUnlock(shard->workListLock);
                     continue;
                 }
-                dbca_chan_count++;
-                status = ca_replace_access_rights_event(pca->chid,
-                    accessRightsCallback);
-                if (status != ECA_NORMAL) {
-                    errlogPrintf("dbCaTask replace_access_rights_event %s\n",
-                        ca_message(status));
-                    printLinks(pca);
-                }
-                continue; /*Other options must wait until connect*/
-            }
-            if (ca_state(pca->chid) != cs_conn) continue;
-            if (link_action & CA_WRITE_NATIVE) {
-                assert(pca->pputNative);
-                if (pca->putType == CA_PUT) {
-                    status = ca_array_put(
-                        pca->dbrType, pca->putnelements,
-                        pca->chid, pca->pputNative);
-                } else if (pca->putType==CA_PUT_CALLBACK) {
-                    status = ca_array_put_callback(
-                        pca->dbrType, pca->putnelements,
-                        pca->chid, pca->pputNative,
-                        putComplete, pca);
-                } else {
-                    status = ECA_PUTFAIL;
-                }
-                if (status != ECA_NORMAL) {
-                    errlogPrintf("dbCaTask ca_array_put %s\n",
-                        ca_message(status));
-                    printLinks(pca);
-                }
-                epicsMutexMustLock(pca->lock);
-                if (status == ECA_NORMAL) pca->newOutNative = FALSE;
-                epicsMutexUnlock(pca->lock);
-            }
-            if (link_action & CA_WRITE_STRING) {
-                assert(pca->pputString);
-                if (pca->putType == CA_PUT) {
-                    status = ca_array_put(
-                        DBR_STRING, 1,
-                        pca->chid, pca->pputString);
-                } else if (pca->putType==CA_PUT_CALLBACK) {
-                    status = ca_array_put_callback(
-                        DBR_STRING, 1,
-                        pca->chid, pca->pputString,
-                        putComplete, pca);
-                } else {
-                    status = ECA_PUTFAIL;
-                }
-                if (status != ECA_NORMAL) {
-                    errlogPrintf("dbCaTask ca_array_put %s\n",
-                        ca_message(status));
-                    printLinks(pca);
-                }
-                epicsMutexMustLock(pca->lock);
-                if (status == ECA_NORMAL) pca->newOutString = FALSE;
-                epicsMutexUnlock(pca->lock);
-            }
-            /*CA_GET_ATTRIBUTES before CA_MONITOR so that attributes available
-             * before the first monitor callback                              */
-            if (link_action & CA_GET_ATTRIBUTES) {
-                status = ca_get_callback(DBR_CTRL_DOUBLE,
-                    pca->chid, getAttribEventCallback, pca);
-                if (status != ECA_NORMAL) {
-                    errlogPrintf("dbCaTask ca_get_callback %s\n",
-                        ca_message(status));
-                    printLinks(pca);
-                }
-            }
-            if (link_action & CA_MONITOR_NATIVE) {
-
-                epicsMutexMustLock(pca->lock);
-                pca->elementSize = dbr_value_size[ca_field_type(pca->chid)];
-                pca->pgetNative = dbCalloc(pca->nelements, pca->elementSize);
-                epicsMutexUnlock(pca->lock);
-
-                status = ca_add_array_event(
-                    dbf_type_to_DBR_TIME(ca_field_type(pca->chid)),
-                    0, /* dynamic size */
-                    pca->chid, eventCallback, pca, 0.0, 0.0, 0.0,
-                    &pca->evidNative);
-                if (status != ECA_NORMAL) {
-                    errlogPrintf("dbCaTask ca_add_array_event %s\n",
-                        ca_message(status));
-                    printLinks(pca);
-                }
-            }
-            if (link_action & CA_MONITOR_STRING) {
-                epicsMutexMustLock(pca->lock);
-                pca->pgetString = dbCalloc(1, MAX_STRING_SIZE);
-                epicsMutexUnlock(pca->lock);
-                status = ca_add_array_event(DBR_TIME_STRING, 1,
-                    pca->chid, eventCallback, pca, 0.0, 0.0, 0.0,
-                    &pca->evidString);
-                if (status != ECA_NORMAL) {
-                    errlogPrintf("dbCaTask ca_add_array_event %s\n",
-                        ca_message(status));
-                    printLinks(pca);
-                }
+                doActions(batch[i], actions[i]);
             }
+            /* Send each batch, rather than waiting until the list is empty */
+            SEVCHK(ca_flush_io(), "dbCaTask");
         }
-        SEVCHK(ca_flush_io(), "dbCaTask");
     }
 shutdown:
     taskwdRemove(0);
-    if (dbca_chan_count == 0)
+    free(batch);
+    free(actions);
+    if (!isFirst) {
+        ca_detach_context();
+        return;
+    }
+    if (epicsAtomicGetIntT(&dbca_chan_count) == 0)
         ca_context_destroy();
     else
-        fprintf(stderr, "dbCa: chan_count = %d at shutdown\n", dbca_chan_count);
+        fprintf(stderr, "dbCa: chan_count = %d at shutdown\n",
+            epicsAtomicGetIntT(&dbca_chan_count));
     epicsEventSignal(startStopEvent);
 }
@@ -48,6 +48,9 @@ extern struct ca_client_context * dbCaClientContext;
 
 #ifdef EPICS_DBCA_PRIVATE_API
 epicsShareFunc void dbCaSync(void);
+
+epicsShareExtern int dbCaLinkThreads;
+epicsShareExtern int dbCaBatchSize;
 epicsShareFunc unsigned long dbCaGetUpdateCount(struct link *plink);
 #endif
 
@@ -34,9 +34,12 @@
 #define CA_PUT          0x1
 #define CA_PUT_CALLBACK 0x2
 
+struct dbCaShard;
+
 typedef struct caLink
 {
     ELLNODE		node;
+    struct dbCaShard *shard; /* worker which handles this link */
     int         refcount;
     epicsMutexId	lock;
     struct link	*plink;
@@ -88,11 +91,19 @@ typedef struct caLink
     char		gotOutString;
     char		newOutNative;
     char		newOutString;
+    char		newInNative; /* update not yet read by dbCaGetLink() */
     unsigned char scanningOnce;
     /* The following are for dbcar*/
     unsigned long	nDisconnect;
     unsigned long	nNoWrite; /*only modified by dbCaPutLink*/
     unsigned long   nUpdate;
+    unsigned long   nOverwrite; /* updates replaced before being read */
+    /* The following are guarded by the shard's workListLock */
+    epicsUInt64     queuedAt;   /* epicsMonotonicGet() when queued */
+    unsigned long   nAction;    /* times taken off the workList */
+    unsigned long   nCoalesced; /* actions added while already queued */
+    epicsUInt64     queueTime;  /* total ns spent on the workList */
+    epicsUInt64     queueMax;   /* longest ns spent on the workList */
 }caLink;
 
 #endif /* INC_dbCaPvt_H */
@@ -68,6 +68,11 @@ long dbcar(char *precordname, int level)
     int                 noWriteAccess=0;
     unsigned long       nDisconnect=0;
     unsigned long       nNoWrite=0;
+    unsigned long       nUpdate=0;
+    unsigned long       nOverwrite=0;
+    unsigned long       nAction=0;
+    unsigned long       nCoalesced=0;
+    epicsUInt64         queueMax=0;
     caLink              *pca;
     int                 j;
 
@@ -100,6 +105,12 @@ long dbcar(char *precordname, int level)
                             nconnected++;
                             nDisconnect += pca->nDisconnect;
                             nNoWrite += pca->nNoWrite;
+                            nUpdate += pca->nUpdate;
+                            nOverwrite += pca->nOverwrite;
+                            nAction += pca->nAction;
+                            nCoalesced += pca->nCoalesced;
+                            if (pca->queueMax > queueMax)
+                                queueMax = pca->queueMax;
                             if (!ca_read_access(pca->chid)) noReadAccess++;
                             if (!ca_write_access(pca->chid)) noWriteAccess++;
                             if (level>1) {
@@ -123,6 +134,14 @@ long dbcar(char *precordname, int level)
                                     mask & pvlOptOutString ? "OS" : "  ",
                                     ca_host_name(pca->chid),
                                     rights[rw]);
+                                printf("%21s %lu updates (%lu unread), "
+                                    "%lu requests (%lu coalesced), "
+                                    "queued avg %.3f max %.3f ms\n", "",
+                                    pca->nUpdate, pca->nOverwrite,
+                                    pca->nAction, pca->nCoalesced,
+                                    pca->nAction ?
+                                        pca->queueTime * 1e-6 / pca->nAction : 0.0,
+                                    pca->queueMax * 1e-6);
                             }
                         } else {
                             if (level>0) {
@@ -152,8 +171,12 @@ done:
            nconnected, (ncalinks - nconnected));
     printf("    %d can't read, %d can't write.",
            noReadAccess, noWriteAccess);
-    printf("  (%lu disconnects, %lu writes prohibited)\n\n",
+    printf("  (%lu disconnects, %lu writes prohibited)\n",
            nDisconnect, nNoWrite);
+    printf("    %lu updates, %lu replaced before being read.\n",
+           nUpdate, nOverwrite);
+    printf("    %lu requests, %lu coalesced, longest queued %.3f ms.\n\n",
+           nAction, nCoalesced, queueMax * 1e-6);
     dbFinishEntry(pdbentry);
     
     if ( level > 2  && dbCaClientContext != 0 ) {
@@ -15,14 +15,18 @@
 
 #include <stdio.h>
 #include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "cantProceed.h"
 #include "epicsAssert.h"
+#include "epicsAtomic.h"
+#include "epicsMutex.h"
 #include "epicsString.h"
 #include "epicsStdio.h"
 #include "errlog.h"
 #include "freeList.h"
+#include "ellLib.h"
 #include "gpHash.h"
 #include "yajl_parse.h"
 
@@ -50,12 +54,33 @@ static void *dbChannelFreeList;
 static void *chFilterFreeList;
 static void *dbchStringFreeList;
 
+/* A free list for each size of array snapshot in use */
+typedef struct snapshotPool {
+    ELLNODE node;
+    size_t size;
+    void *freeList;
+} snapshotPool;
+
+static ELLLIST snapshotPools = ELLLIST_INIT;
+static epicsMutexId snapshotPoolLock;
+
 void dbChannelExit(void)
 {
+    snapshotPool *pool;
+
     freeListCleanup(dbChannelFreeList);
     freeListCleanup(chFilterFreeList);
     freeListCleanup(dbchStringFreeList);
     dbChannelFreeList = chFilterFreeList = dbchStringFreeList = NULL;
+
+    while ((pool = (snapshotPool *) ellGet(&snapshotPools))) {
+        freeListCleanup(pool->freeList);
+        free(pool);
+    }
+    if (snapshotPoolLock) {
+        epicsMutexDestroy(snapshotPoolLock);
+        snapshotPoolLock = NULL;
+    }
 }
 
 void dbChannelInit (void)
@@ -66,6 +91,7 @@ void dbChannelInit (void)
     freeListInitPvt(&dbChannelFreeList,  sizeof(dbChannel), 128);
     freeListInitPvt(&chFilterFreeList,  sizeof(chFilter), 64);
     freeListInitPvt(&dbchStringFreeList, sizeof(epicsOldString), 128);
+    snapshotPoolLock = epicsMutexMustCreate();
 }
 
 static void chf_value(parseContext *parser, parse_result *presult)
@@ -651,12 +677,52 @@ long dbChannelGet(dbChannel *chan, short type, void *pbuffer,
     return dbGet(&chan->addr, type, pbuffer, options, nRequest, pfl);
 }
 
+/* True if a get of this channel may be read from a snapshot
+ * (see dbScanSnapshotBegin()) instead of under the record lock.
+ * This is limited to unfiltered single element numeric fields which
+ * dbGet() copies straight out of the record, and to options which only
+ * copy dbCommon scalars.  Anything calling into record support is not.
+ */
+int dbChannelSnapshotOk(dbChannel *chan, short dbrType, long options,
+        void *pfl)
+{
+    const dbAddr *paddr = &chan->addr;
+
+    return dbLockSnapshotGets && !pfl &&
+        !(options & ~(DBR_STATUS | DBR_TIME)) &&
+        dbrType >= DBR_CHAR && dbrType <= DBR_ENUM &&
+        paddr->field_type >= DBF_CHAR && paddr->field_type <= DBF_ENUM &&
+        paddr->no_elements == 1 &&
+        paddr->special != SPC_DBADDR && paddr->special != SPC_ATTRIBUTE;
+}
+
 long dbChannelGetField(dbChannel *chan, short dbrType, void *pbuffer,
         long *options, long *nRequest, void *pfl)
 {
     dbCommon *precord = chan->addr.precord;
     long status = 0;
 
+    if (dbChannelSnapshotOk(chan, dbrType, options ? *options : 0, pfl)) {
+        long opts = options ? *options : 0;
+        long nReq = nRequest ? *nRequest : 1;
+        int tries;
+
+        for (tries = 0; tries < DBSCAN_SNAPSHOT_TRIES; tries++) {
+            dbScanSnapshot snap;
+
+            if (!dbScanSnapshotBegin(precord, &snap))
+                break;
+            status = dbChannelGet(chan, dbrType, pbuffer, options, nRequest,
+                NULL);
+            if (dbScanSnapshotEnd(&snap))
+                return status;
+
+            /* dbGet() may have modified these */
+            if (options) *options = opts;
+            if (nRequest) *nRequest = nReq;
+        }
+    }
+
     dbScanLock(precord);
     status = dbChannelGet(chan, dbrType, pbuffer, options, nRequest, pfl);
     dbScanUnlock(precord);
@@ -766,6 +832,97 @@ void dbChannelMakeArrayCopy(void *pvt, db_field_log *pfl, dbChannel *chan)
     pfl->u.r.field = p;
 }
 
+typedef union snapshotHeader {
+    struct {
+        int refcount;
+        void *freeList;     /* which this came from */
+    } s;
+    epicsFloat64 align;     /* for the data that follows */
+} snapshotHeader;
+
+static void releaseSnapshot(db_field_log *pfl)
+{
+    snapshotHeader *phdr = (snapshotHeader *) pfl->u.r.pvt;
+
+    if (epicsAtomicDecrIntT(&phdr->s.refcount) == 0)
+        freeListFree(phdr->s.freeList, phdr);
+}
+
+static void *snapshotFreeList(size_t size)
+{
+    snapshotPool *pool;
+    void *freeList = NULL;
+
+    if (!snapshotPoolLock)
+        return NULL;
+
+    epicsMutexMustLock(snapshotPoolLock);
+    for (pool = (snapshotPool *) ellFirst(&snapshotPools); pool;
+         pool = (snapshotPool *) ellNext(&pool->node)) {
+        if (pool->size == size)
+            break;
+    }
+    if (!pool) {
+        pool = calloc(1, sizeof(snapshotPool));
+        if (pool) {
+            pool->size = size;
+            /* allocate large arrays one at a time */
+            freeListInitPvt(&pool->freeList, size, size < 16384 ? 16 : 1);
+            ellAdd(&snapshotPools, &pool->node);
+        }
+    }
+    if (pool)
+        freeList = pool->freeList;
+    epicsMutexUnlock(snapshotPoolLock);
+    return freeList;
+}
+
+void dbChannelMakeArraySnapshot(db_field_log *pfl, dbChannel *chan)
+{
+    struct dbCommon *prec = dbChannelRecord(chan);
+    snapshotHeader *phdr;
+    long no_elements = chan->addr.no_elements;
+    void *freeList;
+
+    if (pfl->type != dbfl_type_rec) return;
+
+    freeList = snapshotFreeList(sizeof(snapshotHeader) +
+        no_elements * chan->addr.field_size);
+    phdr = freeList ? freeListMalloc(freeList) : NULL;
+    if (!phdr) return;  /* leave the field log referring to the record */
+    phdr->s.refcount = 1;
+    phdr->s.freeList = freeList;
+
+    pfl->type = dbfl_type_ref;
+    pfl->stat = prec->stat;
+    pfl->sevr = prec->sevr;
+    pfl->time = prec->time;
+    pfl->field_type  = chan->addr.field_type;
+    pfl->field_size  = chan->addr.field_size;
+    pfl->no_elements = no_elements;
+    pfl->u.r.dtor = releaseSnapshot;
+    pfl->u.r.pvt = phdr;
+    pfl->u.r.field = phdr + 1;
+    if (dbGet(&chan->addr, mapDBFToDBR[pfl->field_type], pfl->u.r.field,
+            NULL, &pfl->no_elements, NULL))
+        pfl->no_elements = 0;
+}
+
+void dbChannelShareArraySnapshot(db_field_log *pdst, const db_field_log *psrc)
+{
+    unsigned int ctx = pdst->ctx;
+
+    assert(dbChannelIsArraySnapshot(psrc));
+    epicsAtomicIncrIntT(&((snapshotHeader *) psrc->u.r.pvt)->s.refcount);
+    *pdst = *psrc;
+    pdst->ctx = ctx;
+}
+
+int dbChannelIsArraySnapshot(const db_field_log *pfl)
+{
+    return pfl->type == dbfl_type_ref && pfl->u.r.dtor == releaseSnapshot;
+}
+
 /* FIXME: Do these belong in a different file? */
 
 void dbRegisterFilter(const char *name, const chFilterIf *fif, void *puser)
@@ -210,6 +210,8 @@ epicsShareFunc long dbChannelGet(dbChannel *chan, short type,
         void *pbuffer, long *options, long *nRequest, void *pfl);
 epicsShareFunc long dbChannelGetField(dbChannel *chan, short type,
         void *pbuffer, long *options, long *nRequest, void *pfl);
+epicsShareFunc int dbChannelSnapshotOk(dbChannel *chan, short type,
+        long options, void *pfl);
 epicsShareFunc long dbChannelPut(dbChannel *chan, short type,
         const void *pbuffer, long nRequest);
 epicsShareFunc long dbChannelPutField(dbChannel *chan, short type,
@@ -226,6 +228,19 @@ epicsShareFunc db_field_log* dbChannelRunPostChain(dbChannel *chan, db_field_log
 epicsShareFunc const chFilterPlugin * dbFindFilter(const char *key, size_t len);
 epicsShareFunc void dbChannelMakeArrayCopy(void *pvt, db_field_log *pfl, dbChannel *chan);
 
+/* Reference counted, immutable copies of a record field.
+ * dbChannelMakeArraySnapshot() copies the field into a new snapshot, which
+ * the record must be locked for, and dbChannelShareArraySnapshot() makes
+ * another field log refer to the same data. The data is freed when the
+ * last field log referring to it is deleted. Snapshots come from a free
+ * list for each size, which is kept until dbChannelExit(). Filters must not
+ * modify the data of a snapshot, but may point u.r.field into it.
+ */
+epicsShareFunc void dbChannelMakeArraySnapshot(db_field_log *pfl, dbChannel *chan);
+epicsShareFunc void dbChannelShareArraySnapshot(db_field_log *pdst,
+        const db_field_log *psrc);
+epicsShareFunc int dbChannelIsArraySnapshot(const db_field_log *pfl);
+
 #ifdef __cplusplus
 }
 #endif
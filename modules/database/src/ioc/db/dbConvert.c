@@ -20,7 +20,6 @@
 
 #include "cvtFast.h"
 #include "dbDefs.h"
-#include "epicsConvert.h"
 #include "epicsStdlib.h"
 #include "errlog.h"
 #include "errMdef.h"
@@ -36,6 +35,32 @@
 #include "recGbl.h"
 #include "recSup.h"
 
+/* Same result as epicsConvertDoubleToFloat(), written without branches
+ * so it can be used inside vectorized loops.
+ */
+static epicsFloat32 clampToFloat(epicsFloat64 value)
+{
+    epicsFloat64 abs = fabs(value);
+
+    value = (abs >= FLT_MAX && abs <= DBL_MAX) ?
+        (value > 0 ? FLT_MAX : -FLT_MAX) : value;
+    value = (abs <= FLT_MIN && abs > 0) ?
+        (value > 0 ? FLT_MIN : -FLT_MIN) : value;
+    return (epicsFloat32) value;
+}
+
+/* The range checks make this conversion much slower than the others,
+ * so it is also built for wider vector units where available.
+ */
+static EPICS_SIMD_CLONES void doubleToFloat(const epicsFloat64 *psrc,
+    epicsFloat32 *pdst, long n)
+{
+    long i;
+
+    for (i = 0; i < n; i++)
+        pdst[i] = clampToFloat(psrc[i]);
+}
+
 /* Helper for copy as bytes with no type conversion.
  * Assumes nRequest <= no_bytes
  * nRequest, no_bytes, and offset should be given in bytes.
@@ -60,22 +85,30 @@ static void copyNoConvert(const void *pfrom,
 #define COPYNOCONVERT(N, FROM, TO, NREQ, NO_ELEM, OFFSET) \
     copyNoConvert(FROM, TO, (N)*(NREQ), (N)*(NO_ELEM), (N)*(OFFSET))
 
+/* Array conversions are done as up to two counted loops, one for each
+ * side of the point where the record's buffer wraps.  These loops have
+ * no branches inside, so optimizing compilers turn them into vector code.
+ */
 #define GET(typea, typeb) (const dbAddr *paddr, \
     void *pto, long nRequest, long no_elements, long offset) \
 { \
-    typea *psrc = (typea *) paddr->pfield; \
+    const typea *psrc = (const typea *) paddr->pfield; \
     typeb *pdst = (typeb *) pto; \
+    long i, n = nRequest; \
     \
     if (nRequest==1 && offset==0) { \
         *pdst = (typeb) *psrc; \
         return 0; \
     } \
+    if (offset < no_elements && offset + nRequest > no_elements) \
+        n = no_elements - offset; \
     psrc += offset; \
-    while (nRequest--) { \
-        *pdst++ = (typeb) *psrc++; \
-        if (++offset == no_elements) \
-            psrc = (typea *) paddr->pfield; \
-    } \
+    for (i = 0; i < n; i++) \
+        pdst[i] = (typeb) psrc[i]; \
+    psrc = (const typea *) paddr->pfield; \
+    pdst += n; \
+    for (i = 0; i < nRequest - n; i++) \
+        pdst[i] = (typeb) psrc[i]; \
     return 0; \
 }
 
@@ -98,17 +131,21 @@ static void copyNoConvert(const void *pfrom,
 { \
     const typea *psrc = (const typea *) pfrom; \
     typeb *pdst = (typeb *) paddr->pfield; \
+    long i, n = nRequest; \
     \
     if (nRequest==1 && offset==0) { \
         *pdst = (typeb) *psrc; \
         return 0; \
     } \
+    if (offset < no_elements && offset + nRequest > no_elements) \
+        n = no_elements - offset; \
     pdst += offset; \
-    while (nRequest--) { \
-        *pdst++ = (typeb) *psrc++; \
-        if (++offset == no_elements) \
-            pdst = (typeb *) paddr->pfield; \
-    } \
+    for (i = 0; i < n; i++) \
+        pdst[i] = (typeb) psrc[i]; \
+    psrc += n; \
+    pdst = (typeb *) paddr->pfield; \
+    for (i = 0; i < nRequest - n; i++) \
+        pdst[i] = (typeb) psrc[i]; \
     return 0; \
 }
 
@@ -810,20 +847,18 @@ static long getDoubleUInt64 GET(epicsFloat64, epicsUInt64)
 static long getDoubleFloat(const dbAddr *paddr,
     void *pto, long nRequest, long no_elements, long offset)
 {
-    epicsFloat64 *psrc = (epicsFloat64 *) paddr->pfield;
+    const epicsFloat64 *psrc = (const epicsFloat64 *) paddr->pfield;
     epicsFloat32 *pdst = (epicsFloat32 *) pto;
+    long n = nRequest;
 
     if (nRequest==1 && offset==0) {
-        *pdst = epicsConvertDoubleToFloat(*psrc);
+        *pdst = clampToFloat(*psrc);
         return 0;
     }
-    psrc += offset;
-    while (nRequest--) {
-        *pdst = epicsConvertDoubleToFloat(*psrc);
-        ++psrc; ++pdst;
-        if (++offset == no_elements)
-            psrc = (epicsFloat64 *) paddr->pfield;
-    }
+    if (offset < no_elements && offset + nRequest > no_elements)
+        n = no_elements - offset;
+    doubleToFloat(psrc + offset, pdst, n);
+    doubleToFloat(psrc, pdst + n, nRequest - n);
     return 0;
 }
 
@@ -1641,17 +1676,16 @@ static long putDoubleFloat(dbAddr *paddr,
 {
     const epicsFloat64 *psrc = (const epicsFloat64 *) pfrom;
     epicsFloat32 *pdst = (epicsFloat32 *) paddr->pfield;
+    long n = nRequest;
 
     if (nRequest==1 && offset==0) {
-        *pdst = epicsConvertDoubleToFloat(*psrc);
+        *pdst = clampToFloat(*psrc);
         return 0;
     }
-    pdst += offset;
-    while (nRequest--) {
-        *pdst++ = epicsConvertDoubleToFloat(*psrc++);
-        if (++offset == no_elements)
-            pdst = (epicsFloat32 *) paddr->pfield;
-    }
+    if (offset < no_elements && offset + nRequest > no_elements)
+        n = no_elements - offset;
+    doubleToFloat(psrc, pdst + offset, n);
+    doubleToFloat(psrc + n, pdst, nRequest - n);
     return 0;
 }
 
@@ -274,10 +274,12 @@ dbEventCtx db_init_events (void)
     if (!dbevEventSubscriptionFreeList) {
         freeListInitPvt(&dbevEventSubscriptionFreeList,
             sizeof(struct evSubscrip),256);
+        freeListSetThreadCache(dbevEventSubscriptionFreeList, 16);
     }
     if (!dbevFieldLogFreeList) {
         freeListInitPvt(&dbevFieldLogFreeList,
             sizeof(struct db_field_log),2048);
+        freeListSetThreadCache(dbevFieldLogFreeList, 64);
     }
 
     evUser = (struct event_user *)
@@ -654,13 +656,86 @@ int db_post_extra_labor (dbEventCtx ctx)
     return DB_EVENT_OK;
 }
 
+/*
+ * Array snapshots made during one db_post_events() call, so that all of
+ * the subscriptions to a field share a single copy of its data.
+ */
+#define SNAPSHOT_CACHE_SIZE 4
+
+struct snapshot_cache {
+    unsigned        count;
+    struct {
+        void            *pfield;
+        short           field_type;
+        db_field_log    *pLog;      /* holds a reference, never queued */
+    } entry[SNAPSHOT_CACHE_SIZE];
+};
+
+static void snapshot_cache_release (struct snapshot_cache *pCache)
+{
+    unsigned i;
+
+    for ( i = 0u; i < pCache->count; i++ ) {
+        db_delete_field_log(pCache->entry[i].pLog);
+    }
+    pCache->count = 0u;
+}
+
+/*
+ * Subscriptions with pre-queue filters get a snapshot of array and string
+ * data, so that the filters see data which matches the time stamp and
+ * alarm status. Without filters the data is read from the record when it
+ * is sent. Post-queue filters such as arr read just the elements they
+ * need from the record themselves, so they don't need a snapshot.
+ */
+static void make_event_snapshot (db_field_log *pLog, struct dbChannel *chan,
+    struct snapshot_cache *pCache)
+{
+    void *pfield = dbChannelField(chan);
+    short field_type = dbChannelFieldType(chan);
+    db_field_log *pShared;
+    unsigned i;
+
+    if ( pCache ) {
+        for ( i = 0u; i < pCache->count; i++ ) {
+            if ( pCache->entry[i].pfield == pfield &&
+                 pCache->entry[i].field_type == field_type ) {
+                dbChannelShareArraySnapshot(pLog, pCache->entry[i].pLog);
+                return;
+            }
+        }
+    }
+
+    if ( ! pCache || pCache->count == SNAPSHOT_CACHE_SIZE ) {
+        dbChannelMakeArraySnapshot(pLog, chan);
+        return;
+    }
+
+    pShared = (db_field_log *) freeListCalloc(dbevFieldLogFreeList);
+    if ( ! pShared ) {
+        return;
+    }
+    pShared->ctx = dbfl_context_event;
+    dbChannelMakeArraySnapshot(pShared, chan);
+    if ( ! dbChannelIsArraySnapshot(pShared) ) {
+        db_delete_field_log(pShared);
+        return;
+    }
+    pCache->entry[pCache->count].pfield = pfield;
+    pCache->entry[pCache->count].field_type = field_type;
+    pCache->entry[pCache->count].pLog = pShared;
+    pCache->count++;
+    dbChannelShareArraySnapshot(pLog, pShared);
+}
+
 /*
  *  DB_CREATE_EVENT_LOG()
  *
  *  NOTE: This assumes that the db scan lock is already applied
  *        (as it copies data from the record)
  */
-db_field_log* db_create_event_log (struct evSubscrip *pevent)
+static db_field_log* create_event_log (struct evSubscrip *pevent,
+    struct snapshot_cache *pCache)
 {
     db_field_log *pLog = (db_field_log *) freeListCalloc(dbevFieldLogFreeList);
 
@@ -685,11 +760,18 @@ db_field_log* db_create_event_log (struct evSubscrip *pevent)
                    dbChannelFieldSize(chan));
         } else {
             pLog->type = dbfl_type_rec;
+            if (ellCount(&chan->pre_chain))
+                make_event_snapshot(pLog, chan, pCache);
         }
     }
     return pLog;
 }
 
+db_field_log* db_create_event_log (struct evSubscrip *pevent)
+{
+    return create_event_log(pevent, NULL);
+}
+
 /*
  *  DB_CREATE_READ_LOG()
  *
@@ -706,23 +788,17 @@ db_field_log* db_create_read_log (struct dbChannel *chan)
 }
 
 /*
- *  DB_QUEUE_EVENT_LOG()
+ *  QUEUE_EVENT_LOG_LOCKED()
  *
+ *  event queue lock _must_ be applied
+ *  returns true if the event handler needs to be notified
  */
-static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
+static int queue_event_log_locked (evSubscrip *pevent, db_field_log *pLog)
 {
-    struct event_que    *ev_que;
+    struct event_que * const ev_que = pevent->ev_que;
     int firstEventFlag;
     unsigned rngSpace;
 
-    ev_que = pevent->ev_que;
-    /*
-     * evUser ring buffer must be locked for the multiple
-     * threads writing/reading it
-     */
-
-    LOCKEVQUE (ev_que);
-
     /*
      * if we have an event on the queue and both the last
      * event on the queue and the current event are emtpy
@@ -733,8 +809,7 @@ static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
         (*pevent->pLastLog)->type == dbfl_type_rec &&
         pLog->type == dbfl_type_rec) {
         db_delete_field_log(pLog);
-        UNLOCKEVQUE (ev_que);
-        return;
+        return 0;
     }
 
     /*
@@ -789,6 +864,24 @@ static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
         ev_que->putix = RNGINC ( ev_que->putix );
     }
 
+    return firstEventFlag;
+}
+
+/*
+ *  DB_QUEUE_EVENT_LOG()
+ *
+ */
+static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
+{
+    struct event_que * const ev_que = pevent->ev_que;
+    int firstEventFlag;
+
+    /*
+     * evUser ring buffer must be locked for the multiple
+     * threads writing/reading it
+     */
+    LOCKEVQUE (ev_que);
+    firstEventFlag = queue_event_log_locked (pevent, pLog);
     UNLOCKEVQUE (ev_que);
 
     /*
@@ -805,6 +898,54 @@ static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
     }
 }
 
+/*
+ *  DB_QUEUE_EVENT_BATCH()
+ *
+ *  Queue the logs for several subscriptions, locking each event queue
+ *  once for all of its entries in the batch. The event handlers are only
+ *  notified after all of the queues have been unlocked.
+ */
+#define EVENT_POST_BATCH 64
+
+struct post_entry {
+    evSubscrip      *pevent;
+    db_field_log    *pLog;
+};
+
+static void db_queue_event_batch (struct post_entry *batch, unsigned nbatch)
+{
+    struct event_que *wake[EVENT_POST_BATCH];
+    unsigned i, j, nwake = 0u;
+
+    for ( i = 0u; i < nbatch; i++ ) {
+        struct event_que *ev_que;
+        int firstEventFlag = 0;
+
+        if ( ! batch[i].pevent ) {
+            continue;   /* already queued with an earlier entry */
+        }
+        ev_que = batch[i].pevent->ev_que;
+
+        LOCKEVQUE (ev_que);
+        for ( j = i; j < nbatch; j++ ) {
+            if ( batch[j].pevent && batch[j].pevent->ev_que == ev_que ) {
+                firstEventFlag |= queue_event_log_locked (
+                    batch[j].pevent, batch[j].pLog );
+                batch[j].pevent = NULL;
+            }
+        }
+        UNLOCKEVQUE (ev_que);
+
+        if (firstEventFlag) {
+            wake[nwake++] = ev_que;
+        }
+    }
+
+    for ( i = 0u; i < nwake; i++ ) {
+        epicsEventSignal(wake[i]->evUser->ppendsem);
+    }
+}
+
 /*
  *  DB_POST_EVENTS()
  *
@@ -819,9 +960,14 @@ unsigned int    caEventMask
 {
     struct dbCommon   * const prec = (struct dbCommon *) pRecord;
     struct evSubscrip *pevent;
+    struct post_entry batch[EVENT_POST_BATCH];
+    unsigned nbatch = 0u;
+    struct snapshot_cache cache;
 
     if (prec->mlis.count == 0) return DB_EVENT_OK;       /* no monitors set */
 
+    cache.count = 0u;
+
     LOCKREC (prec);
 
     for (pevent = (struct evSubscrip *) prec->mlis.node.next;
@@ -833,13 +979,24 @@ unsigned int    caEventMask
          */
         if ( (dbChannelField(pevent->chan) == (void *)pField || pField==NULL) &&
             (caEventMask & pevent->select)) {
-            db_field_log *pLog = db_create_event_log(pevent);
+            db_field_log *pLog = create_event_log(pevent, &cache);
             pLog = dbChannelRunPreChain(pevent->chan, pLog);
-            if (pLog) db_queue_event_log(pevent, pLog);
+            if (pLog) {
+                batch[nbatch].pevent = pevent;
+                batch[nbatch].pLog = pLog;
+                if (++nbatch == EVENT_POST_BATCH) {
+                    db_queue_event_batch(batch, nbatch);
+                    nbatch = 0u;
+                }
+            }
         }
     }
 
+    if (nbatch) db_queue_event_batch(batch, nbatch);
+
     UNLOCKREC (prec);
+
+    snapshot_cache_release(&cache);
     return DB_EVENT_OK;
 
 }
@@ -285,6 +285,19 @@ static const iocshFuncDef dbLockShowLockedFuncDef =
 static void dbLockShowLockedCallFunc(const iocshArgBuf *args)
 { dbLockShowLocked(args[0].ival);}
 
+/* dblsa */
+static const iocshArg dblsaArg0 = { "number of sets",iocshArgInt};
+static const iocshArg dblsaArg1 = { "interest level",iocshArgInt};
+static const iocshArg * const dblsaArgs[2] = {&dblsaArg0,&dblsaArg1};
+static const iocshFuncDef dblsaFuncDef = {"dblsa",2,dblsaArgs};
+static void dblsaCallFunc(const iocshArgBuf *args)
+{ dblsa(args[0].ival,args[1].ival);}
+
+/* dbLockStatsReset */
+static const iocshFuncDef dbLockStatsResetFuncDef = {"dbLockStatsReset",0,NULL};
+static void dbLockStatsResetCallFunc(const iocshArgBuf *args)
+{ dbLockStatsReset();}
+
 /* scanOnceSetQueueSize */
 static const iocshArg scanOnceSetQueueSizeArg0 = { "size",iocshArgInt};
 static const iocshArg * const scanOnceSetQueueSizeArgs[1] =
@@ -314,6 +327,23 @@ static const iocshFuncDef scanpplFuncDef = {"scanppl",1,scanpplArgs};
 static void scanpplCallFunc(const iocshArgBuf *args)
 { scanppl(args[0].dval);}
 
+/* scanStats */
+static const iocshArg scanStatsArg0 = { "rate",iocshArgDouble};
+static const iocshArg scanStatsArg1 = { "level",iocshArgInt};
+static const iocshArg * const scanStatsArgs[2] =
+    {&scanStatsArg0,&scanStatsArg1};
+static const iocshFuncDef scanStatsFuncDef = {"scanStats",2,scanStatsArgs};
+static void scanStatsCallFunc(const iocshArgBuf *args)
+{ scanStats(args[0].dval, args[1].ival);}
+
+/* scanStatsReset */
+static const iocshArg scanStatsResetArg0 = { "rate",iocshArgDouble};
+static const iocshArg * const scanStatsResetArgs[1] = {&scanStatsResetArg0};
+static const iocshFuncDef scanStatsResetFuncDef =
+    {"scanStatsReset",1,scanStatsResetArgs};
+static void scanStatsResetCallFunc(const iocshArgBuf *args)
+{ scanStatsReset(args[0].dval);}
+
 /* scanpel */
 static const iocshArg scanpelArg0 = { "event name",iocshArgString};
 static const iocshArg * const scanpelArgs[1] = {&scanpelArg0};
@@ -346,6 +376,17 @@ static void callbackSetQueueSizeCallFunc(const iocshArgBuf *args)
     callbackSetQueueSize(args[0].ival);
 }
 
+/* callbackSetQueueMode */
+static const iocshArg callbackSetQueueModeArg0 = { "mode",iocshArgString};
+static const iocshArg * const callbackSetQueueModeArgs[1] =
+    {&callbackSetQueueModeArg0};
+static const iocshFuncDef callbackSetQueueModeFuncDef =
+    {"callbackSetQueueMode",1,callbackSetQueueModeArgs};
+static void callbackSetQueueModeCallFunc(const iocshArgBuf *args)
+{
+    callbackSetQueueMode(args[0].sval);
+}
+
 /* callbackQueueShow */
 static const iocshArg callbackQueueShowArg0 = { "reset", iocshArgInt};
 static const iocshArg * const callbackQueueShowArgs[1] =
@@ -461,15 +502,20 @@ void dbIocRegister(void)
     iocshRegister(&tpnFuncDef,tpnCallFunc);
     iocshRegister(&dblsrFuncDef,dblsrCallFunc);
     iocshRegister(&dbLockShowLockedFuncDef,dbLockShowLockedCallFunc);
+    iocshRegister(&dblsaFuncDef,dblsaCallFunc);
+    iocshRegister(&dbLockStatsResetFuncDef,dbLockStatsResetCallFunc);
 
     iocshRegister(&scanOnceSetQueueSizeFuncDef,scanOnceSetQueueSizeCallFunc);
     iocshRegister(&scanOnceQueueShowFuncDef,scanOnceQueueShowCallFunc);
     iocshRegister(&scanpplFuncDef,scanpplCallFunc);
+    iocshRegister(&scanStatsFuncDef,scanStatsCallFunc);
+    iocshRegister(&scanStatsResetFuncDef,scanStatsResetCallFunc);
     iocshRegister(&scanpelFuncDef,scanpelCallFunc);
     iocshRegister(&postEventFuncDef,postEventCallFunc);
     iocshRegister(&scanpiolFuncDef,scanpiolCallFunc);
 
     iocshRegister(&callbackSetQueueSizeFuncDef,callbackSetQueueSizeCallFunc);
+    iocshRegister(&callbackSetQueueModeFuncDef,callbackSetQueueModeCallFunc);
     iocshRegister(&callbackQueueShowFuncDef,callbackQueueShowCallFunc);
     iocshRegister(&callbackParallelThreadsFuncDef,callbackParallelThreadsCallFunc);
 
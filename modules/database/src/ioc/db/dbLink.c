@@ -47,6 +47,15 @@
 #include "recGbl.h"
 #include "recSup.h"
 #include "special.h"
+#include "epicsExport.h"
+
+/* Make NPP input and output links to records in this IOC CA links,
+ * so they don't merge the lock sets of the records at each end.
+ * A CA put calls dbPutField(), so output links to PP fields will
+ * then process their target record.
+ */
+epicsShareDef int dbLinkNppAsCA = 0;
+epicsExportAddress(int, dbLinkNppAsCA);
 
 /* How to identify links in error messages */
 const char * dbLinkFieldName(const struct link *plink)
@@ -89,6 +98,17 @@ static void TSEL_modified(struct link *plink)
 
 /***************************** Generic Link API *****************************/
 
+/* Should a PV link with these options become a DB link if its target
+ * is in this IOC?  DB links merge the lock sets of the two records.
+ */
+int dbLinkWantDb(short dbfType, int pvlMask)
+{
+    if (pvlMask & (pvlOptCA | pvlOptCP | pvlOptCPP))
+        return 0;
+
+    return !dbLinkNppAsCA || dbfType == DBF_FWDLINK || (pvlMask & pvlOptPP);
+}
+
 void dbInitLink(struct link *plink, short dbfType)
 {
     struct dbCommon *precord = plink->precord;
@@ -115,7 +135,7 @@ void dbInitLink(struct link *plink, short dbfType)
     if (plink == &precord->tsel)
         TSEL_modified(plink);
 
-    if (!(plink->value.pv_link.pvlMask & (pvlOptCA | pvlOptCP | pvlOptCPP))) {
+    if (dbLinkWantDb(dbfType, plink->value.pv_link.pvlMask)) {
         /* Make it a DB link if possible */
         if (!dbDbInitLink(plink, dbfType))
             return;
@@ -366,6 +366,9 @@ typedef struct lset {
 
 epicsShareFunc const char * dbLinkFieldName(const struct link *plink);
 
+epicsShareExtern int dbLinkNppAsCA;
+
+epicsShareFunc int dbLinkWantDb(short dbfType, int pvlMask);
 epicsShareFunc void dbInitLink(struct link *plink, short dbfType);
 epicsShareFunc void dbAddLink(struct dbLocker *locker, struct link *plink,
         short dbfType, DBADDR *ptarget);
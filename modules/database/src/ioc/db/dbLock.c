@@ -23,6 +23,7 @@
 #include "epicsSpin.h"
 #include "epicsStdio.h"
 #include "epicsThread.h"
+#include "epicsTime.h"
 #include "errMdef.h"
 
 #define epicsExportSharedSymbols
@@ -35,6 +36,13 @@
 #include "dbLockPvt.h"
 #include "dbStaticLib.h"
 #include "link.h"
+#include "epicsExport.h"
+
+/* Allow dbChannel gets of scalar fields to be served from a
+ * consistent snapshot instead of taking the record's lock.
+ */
+epicsShareDef int dbLockSnapshotGets = 1;
+epicsExportAddress(int, dbLockSnapshotGets);
 
 typedef struct dbScanLockNode dbScanLockNode;
 
@@ -58,6 +66,42 @@ static size_t recomputeCnt;
 #endif
 
 /*private routines */
+
+/* Called with ls->lock held after it has been locked, and
+ * before it is unlocked.  Makes ls->seq odd for the duration
+ * of the outermost lock.
+ */
+static EPICS_ALWAYS_INLINE void lockSetEnter(lockSet *ls)
+{
+    if(ls->depth++ == 0) {
+        epicsAtomicSetSizeT(&ls->seq, ls->seq+1);
+        epicsAtomicWriteMemoryBarrier();
+    }
+}
+
+/* epicsMutexMustLock(ls->lock), counting the times we block */
+static void lockSetLock(lockSet *ls)
+{
+    epicsUInt64 start;
+
+    if(epicsMutexTryLock(ls->lock)==epicsMutexLockOK)
+        return;
+
+    start = epicsMonotonicGet();
+    epicsMutexMustLock(ls->lock);
+    ls->nwait++;
+    ls->waitns += epicsMonotonicGet() - start;
+}
+
+static EPICS_ALWAYS_INLINE void lockSetLeave(lockSet *ls)
+{
+    assert(ls->depth>0);
+    if(--ls->depth == 0) {
+        epicsAtomicWriteMemoryBarrier();
+        epicsAtomicSetSizeT(&ls->seq, ls->seq+1);
+    }
+}
+
 static void dbLockOnce(void* ignore)
 {
     lockSetsGuard = epicsMutexMustCreate();
@@ -91,6 +135,9 @@ static lockSet* makeSet(void)
         epicsMutexMustLock(lockSetsGuard);
     }
 #endif
+    ls->nwait = 0;
+    ls->waitns = 0;
+
     /* the initial reference for the first lockRecord */
     iref = epicsAtomicIncrIntT(&ls->refcount);
     ellAdd(&lockSetsActive, &ls->node);
@@ -175,6 +222,45 @@ lockSet* dbLockGetRef(lockRecord *lr)
     return ls;
 }
 
+int dbScanSnapshotBegin(dbCommon *precord, dbScanSnapshot *psnap)
+{
+    lockSet *ls = dbLockGetRef(precord->lset);
+    size_t seq = epicsAtomicGetSizeT(&ls->seq);
+
+    if(seq&1) {
+        /* held by someone */
+        dbLockDecRef(ls);
+        return 0;
+    }
+    epicsAtomicReadMemoryBarrier();
+
+    psnap->precord = precord;
+    psnap->plockSet = ls;
+    psnap->seq = seq;
+    return 1;
+}
+
+int dbScanSnapshotEnd(dbScanSnapshot *psnap)
+{
+    lockRecord * const lr = psnap->precord->lset;
+    lockSet *ls = psnap->plockSet;
+    int ok;
+
+    epicsAtomicReadMemoryBarrier();
+    ok = epicsAtomicGetSizeT(&ls->seq)==psnap->seq;
+    if(ok) {
+        /* a merge or split moves records between lockSets
+         * while both are held, so this can only fail together
+         * with the seq test.  Checked anyway for clarity.
+         */
+        epicsSpinLock(lr->spin);
+        ok = lr->plockSet==ls;
+        epicsSpinUnlock(lr->spin);
+    }
+    dbLockDecRef(ls);
+    return ok;
+}
+
 unsigned long dbLockGetLockId(dbCommon *precord)
 {
     unsigned long id=0;
@@ -196,7 +282,7 @@ void dbScanLock(dbCommon *precord)
     assert(epicsAtomicGetIntT(&ls->refcount)>0);
 
 retry:
-    epicsMutexMustLock(ls->lock);
+    lockSetLock(ls);
 
     epicsSpinLock(lr->spin);
     if(ls!=lr->plockSet) {
@@ -224,6 +310,8 @@ retry:
     cnt = epicsAtomicDecrIntT(&ls->refcount);
     assert(cnt>0);
 
+    lockSetEnter(ls);
+
 #ifdef LOCKSET_DEBUG
     if(ls->owner) {
         assert(ls->owner==epicsThreadGetIdSelf());
@@ -248,6 +336,7 @@ void dbScanUnlock(dbCommon *precord)
     if(ls->ownercount==0)
         ls->owner = NULL;
 #endif
+    lockSetLeave(ls);
     epicsMutexUnlock(ls->lock);
     dbLockDecRef(ls);
 }
@@ -412,7 +501,8 @@ retry:
             continue;
         plock = ref->plockSet;
 
-        epicsMutexMustLock(plock->lock);
+        lockSetLock(plock);
+        lockSetEnter(plock);
         assert(plock->ownerlocker==NULL);
         plock->ownerlocker = locker;
         ellAdd(&locker->locked, &plock->lockernode);
@@ -470,6 +560,7 @@ void dbScanUnlockMany(dbLocker* locker)
             plock->owner = NULL;
 #endif
 
+        lockSetLeave(plock);
         epicsMutexUnlock(plock->lock);
         /* release ref for locked list */
         dbLockDecRef(plock);
@@ -619,6 +710,9 @@ void dbLockSetMerge(dbLocker *locker, dbCommon *pfirst, dbCommon *psecond)
     if(A==B)
         return; /* already in the same lockSet */
 
+    A->nwait += B->nwait;
+    A->waitns += B->waitns;
+
     Nb = ellCount(&B->lockRecordList);
     assert(Nb>0);
 
@@ -664,6 +758,7 @@ void dbLockSetMerge(dbLocker *locker, dbCommon *pfirst, dbCommon *psecond)
         B->ownerlocker = NULL;
         epicsAtomicDecrIntT(&B->refcount);
 
+        lockSetLeave(B);
         epicsMutexUnlock(B->lock);
     }
 
@@ -805,6 +900,7 @@ void dbLockSetSplit(dbLocker *locker, dbCommon *pfirst, dbCommon *psecond)
         splitset = makeSet(); /* reference for locker->locked */
 
         epicsMutexMustLock(splitset->lock);
+        lockSetEnter(splitset);
 
         assert(splitset->ownerlocker==NULL);
         ellAdd(&locker->locked, &splitset->lockernode);
@@ -981,6 +1077,247 @@ long dbLockShowLocked(int level)
     return 0;
 }
 
+/* Take a reference to a lockSet found on lockSetsActive,
+ * unless it is already on its way to the free list.
+ * Caller must hold lockSetsGuard.
+ */
+static int lockSetTryRef(lockSet *ls)
+{
+    int cnt = epicsAtomicGetIntT(&ls->refcount);
+
+    while(cnt>0) {
+        int prev = epicsAtomicCmpAndSwapIntT(&ls->refcount, cnt, cnt+1);
+        if(prev==cnt)
+            return 1;
+        cnt = prev;
+    }
+    return 0;
+}
+
+/* Would this DB link remain one with dbLinkNppAsCA set? */
+static int linkKeepsSet(const DBLINK *plink)
+{
+    const dbCommon *prec = plink->precord;
+    const dbRecordType *rtype = prec->rdes;
+    size_t i;
+
+    if(plink->value.pv_link.pvlMask & pvlOptPP)
+        return 1;
+
+    for(i=0; i<rtype->no_links; i++) {
+        const dbFldDes *pdesc = rtype->papFldDes[rtype->link_ind[i]];
+
+        if(plink == (const DBLINK*)((const char*)prec + pdesc->offset))
+            return pdesc->field_type==DBF_FWDLINK;
+    }
+    return 1;
+}
+
+typedef struct {
+    lockSet *ls;
+    int nrecords;
+} lockSetInfo;
+
+static int lockSetInfoCmp(const void *rawA, const void *rawB)
+{
+    const lockSetInfo *A = rawA, *B = rawB;
+    return B->nrecords - A->nrecords; /* largest first */
+}
+
+/* Report on one lockSet, which the caller has locked */
+static void lockSetAnalyze(lockSet *ls, int level)
+{
+    ELLLIST toInspect = ELLLIST_INIT;
+    lockRecord *lr;
+    int nnpp = 0, nparts = 0, largest = 0;
+
+    /* Count the records connected without NPP links, using the same
+     * breadth first traversal as dbLockSetSplit().
+     */
+    for(lr = (lockRecord*)ellFirst(&ls->lockRecordList); lr;
+        lr = (lockRecord*)ellNext(&lr->node))
+    {
+        ELLNODE *cur;
+        int size = 0;
+
+        if(lr->compflag)
+            continue;
+
+        nparts++;
+        ellAdd(&toInspect, &lr->compnode);
+        lr->compflag = 1;
+
+        while((cur=ellGet(&toInspect))!=NULL) {
+            lockRecord *plr = CONTAINER(cur, lockRecord, compnode);
+            dbCommon *prec = plr->precord;
+            dbRecordType *rtype = prec->rdes;
+            size_t i;
+            ELLNODE *bcur;
+
+            size++;
+
+            for(i=0; i<rtype->no_links; i++) {
+                dbFldDes *pdesc = rtype->papFldDes[rtype->link_ind[i]];
+                DBLINK *plink = (DBLINK*)((char*)prec + pdesc->offset);
+                lockRecord *target;
+
+                if(plink->type!=DB_LINK)
+                    continue;
+
+                if(!linkKeepsSet(plink)) {
+                    nnpp++;
+                    continue;
+                }
+                target = ((DBADDR*)plink->value.pv_link.pvt)->precord->lset;
+                if(target->compflag)
+                    continue;
+                ellAdd(&toInspect, &target->compnode);
+                target->compflag = 1;
+            }
+
+            for(bcur=ellFirst(&prec->bklnk); bcur; bcur=ellNext(bcur)) {
+                struct pv_link *plink1 = CONTAINER(bcur, struct pv_link, backlinknode);
+                union value *plink2 = CONTAINER(plink1, union value, pv_link);
+                DBLINK *plink = CONTAINER(plink2, DBLINK, value);
+                lockRecord *source = plink->precord->lset;
+
+                if(source->compflag || !linkKeepsSet(plink))
+                    continue;
+                ellAdd(&toInspect, &source->compnode);
+                source->compflag = 1;
+            }
+        }
+        if(size>largest)
+            largest = size;
+    }
+
+    printf("%8lu %8d %10lu %10.3f %8d %6d %8d\n",
+           ls->id, ellCount(&ls->lockRecordList),
+           (unsigned long)ls->nwait, ls->waitns*1e-6,
+           nnpp, nparts, largest);
+
+    for(lr = (lockRecord*)ellFirst(&ls->lockRecordList); lr;
+        lr = (lockRecord*)ellNext(&lr->node))
+    {
+        dbCommon *prec = lr->precord;
+        dbRecordType *rtype = prec->rdes;
+        size_t i;
+
+        lr->compflag = 0;
+        if(level<1)
+            continue;
+
+        for(i=0; i<rtype->no_links; i++) {
+            dbFldDes *pdesc = rtype->papFldDes[rtype->link_ind[i]];
+            DBLINK *plink = (DBLINK*)((char*)prec + pdesc->offset);
+
+            if(plink->type!=DB_LINK || linkKeepsSet(plink))
+                continue;
+            printf("\t%s.%s NPP %s\n", prec->name, pdesc->name,
+                   ((DBADDR*)plink->value.pv_link.pvt)->precord->name);
+        }
+    }
+}
+
+long dblsa(int nsets, int level)
+{
+    lockSetInfo *info;
+    ELLNODE *cur;
+    size_t nactive, n = 0, i;
+    unsigned long nrecords = 0;
+    unsigned long hist[32];
+
+    if(!lockSetsGuard) {
+        printf("No lock sets, call after iocInit\n");
+        return 0;
+    }
+    if(nsets<=0)
+        nsets = 10;
+
+    /* Can't lock a lockSet while holding lockSetsGuard,
+     * so take references to them all and sort them by size.
+     */
+    epicsMutexMustLock(lockSetsGuard);
+    nactive = ellCount(&lockSetsActive);
+    info = calloc(nactive ? nactive : 1, sizeof(*info));
+    if(!info) {
+        epicsMutexUnlock(lockSetsGuard);
+        printf("Out of memory\n");
+        return -1;
+    }
+    for(cur = ellFirst(&lockSetsActive); cur; cur = ellNext(cur)) {
+        lockSet *ls = (lockSet*)cur;
+
+        if(!lockSetTryRef(ls))
+            continue;
+        info[n].ls = ls;
+        info[n].nrecords = ellCount(&ls->lockRecordList);
+        n++;
+    }
+    epicsMutexUnlock(lockSetsGuard);
+
+    qsort(info, n, sizeof(*info), lockSetInfoCmp);
+
+    memset(hist, 0, sizeof(hist));
+    for(i=0; i<n; i++) {
+        unsigned long size = info[i].nrecords;
+        unsigned bin = 0;
+
+        nrecords += size;
+        while(size>1 && bin<NELEMENTS(hist)-1) {
+            size >>= 1;
+            bin++;
+        }
+        hist[bin]++;
+    }
+
+    printf("%lu records in %lu lock sets\n", nrecords, (unsigned long)n);
+    printf("%17s %8s\n", "records", "sets");
+    for(i=0; i<NELEMENTS(hist); i++) {
+        if(!hist[i])
+            continue;
+        printf("%8lu - %6lu %8lu\n", 1ul<<i, (2ul<<i)-1, hist[i]);
+    }
+
+    printf("\nLargest lock sets, with the sets they would split into\n"
+           "if their NPP links were CA links (dbLinkNppAsCA):\n");
+    printf("%8s %8s %10s %10s %8s %6s %8s\n", "id", "records",
+           "lock waits", "wait (ms)", "NPP", "split", "largest");
+
+    for(i=0; i<n; i++) {
+        lockSet *ls = info[i].ls;
+
+        if(i<(size_t)nsets) {
+            epicsMutexMustLock(ls->lock);
+            if(ellCount(&ls->lockRecordList))
+                lockSetAnalyze(ls, level);
+            epicsMutexUnlock(ls->lock);
+        }
+        dbLockDecRef(ls);
+    }
+
+    free(info);
+    return 0;
+}
+
+void dbLockStatsReset(void)
+{
+    ELLNODE *cur;
+
+    if(!lockSetsGuard)
+        return;
+
+    epicsMutexMustLock(lockSetsGuard);
+    for(cur = ellFirst(&lockSetsActive); cur; cur = ellNext(cur)) {
+        lockSet *ls = (lockSet*)cur;
+
+        /* racy, but only statistics */
+        ls->nwait = 0;
+        ls->waitns = 0;
+    }
+    epicsMutexUnlock(lockSetsGuard);
+}
+
 int * dbLockSetAddrTrace(dbCommon *precord)
 {
     lockRecord	*plockRecord = precord->lset;
@@ -38,6 +38,32 @@ epicsShareFunc void dbLockerFree(dbLocker *);
 epicsShareFunc void dbScanLockMany(dbLocker*);
 epicsShareFunc void dbScanUnlockMany(dbLocker*);
 
+/* Lock-free reads of a record's fields.
+ *
+ * dbScanSnapshotBegin() returns 0 if the lockSet is currently held,
+ * in which case the caller must fall back to dbScanLock().
+ * Otherwise the caller may copy fields it knows to be safe to read
+ * from a torn record (ie. plain scalars, no pointers to follow), then
+ * calls dbScanSnapshotEnd(), which returns 1 if no other thread
+ * locked the lockSet in between and the copy is consistent.
+ * dbScanSnapshotEnd() must always be called after a successful
+ * dbScanSnapshotBegin().
+ */
+typedef struct dbScanSnapshot {
+    struct dbCommon *precord;
+    void *plockSet;
+    size_t seq;
+} dbScanSnapshot;
+
+epicsShareExtern int dbLockSnapshotGets;
+
+/* Attempts before a reader gives up and takes the lock */
+#define DBSCAN_SNAPSHOT_TRIES 2
+
+epicsShareFunc int dbScanSnapshotBegin(struct dbCommon *precord,
+                                       dbScanSnapshot *psnap);
+epicsShareFunc int dbScanSnapshotEnd(dbScanSnapshot *psnap);
+
 epicsShareFunc unsigned long dbLockGetLockId(
     struct dbCommon *precord);
 
@@ -52,6 +78,13 @@ epicsShareFunc long dblsr(char *recordname,int level);
 
 epicsShareFunc long dbLockShowLocked(int level);
 
+/* Lock Set Analysis: size distribution, then the nsets largest sets
+ * with their lock contention and how they would split if their NPP
+ * links were CA links.  level>0 also lists those NPP links.
+ */
+epicsShareFunc long dblsa(int nsets, int level);
+epicsShareFunc void dbLockStatsReset(void);
+
 /*KLUDGE to support field TPRO*/
 epicsShareFunc int * dbLockSetAddrTrace(struct dbCommon *precord);
 
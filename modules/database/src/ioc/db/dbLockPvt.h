@@ -10,6 +10,7 @@
 
 #include "dbLock.h"
 #include "epicsSpin.h"
+#include "epicsTypes.h"
 
 /* Define to enable additional error checking */
 #undef LOCKSET_DEBUG
@@ -20,7 +21,7 @@
 /* Define to disable use of recomputeCnt optimization */
 #undef LOCKSET_NOCNT
 
-/* except for refcount (and lock), all members of dbLockSet
+/* except for refcount, seq (and lock), all members of dbLockSet
  * are guarded by its lock.
  */
 typedef struct dbLockSet {
@@ -30,6 +31,16 @@ typedef struct dbLockSet {
     unsigned long	id;
 
     int                 refcount;
+    /* Bumped when the lock is first taken and when it is finally
+     * released, so it is odd while the lockSet is held.
+     * Written with lock held, read without (see dbScanSnapshotBegin()).
+     */
+    size_t              seq;
+    int                 depth; /* recursive lock count */
+
+    /* Times dbScanLock*() had to wait for lock, and for how long */
+    size_t              nwait;
+    epicsUInt64         waitns;
 #ifdef LOCKSET_DEBUG
     int                 ownercount;
     epicsThreadId       owner;
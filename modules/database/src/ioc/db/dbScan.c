@@ -15,6 +15,7 @@
  */
 
 #include <stddef.h>
+#include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 #include <limits.h>
@@ -47,6 +48,7 @@
 #include "dbScan.h"
 #include "dbStaticLib.h"
 #include "devSup.h"
+#include "epicsExport.h"
 #include "link.h"
 #include "recGbl.h"
 
@@ -80,6 +82,10 @@ typedef struct scan_element{
     ELLNODE             node;
     scan_list           *pscan_list;
     struct dbCommon     *precord;
+    /* Processing times sampled by periodic scans, see scanRecordTiming */
+    unsigned long       samples;
+    epicsUInt64         sumNS;
+    epicsUInt64         maxNS;
 } scan_element;
 
 
@@ -87,6 +93,37 @@ typedef struct scan_element{
 
 #define OVERRUN_REPORT_DELAY 10.0   /* Time between initial reports */
 #define OVERRUN_REPORT_MAX 3600.0   /* Maximum time between reports */
+
+/* Number of threads that share the processing of each periodic scan list.
+ * Records are assigned to a shard by lock set, so records that share a
+ * lock set are always processed by the same thread in scan list order.
+ * Negative values are subtracted from the number of CPUs.
+ */
+epicsShareDef int scanPeriodicShards = 1;
+epicsExportAddress(int, scanPeriodicShards);
+
+/* Time the processing of each record on every N'th periodic scan,
+ * 0 disables record timing.
+ */
+epicsShareDef int scanRecordTiming = 0;
+epicsExportAddress(int, scanRecordTiming);
+
+struct periodic_scan_list;
+
+typedef struct scan_shard {
+    struct periodic_scan_list *ppsl;
+    epicsEventId        go;         /* NULL for shard 0 */
+    dbCommon            **precords; /* this shard's records, in list order */
+    unsigned            nRecords;
+    unsigned            maxRecords;
+    unsigned            *groupEnd;  /* end of each PHAS group in precords */
+    unsigned            maxGroups;
+    /* Timing of the current and most recent scan, and the worst seen */
+    double              busyTime;
+    double              lastTime;
+    double              maxTime;
+} scan_shard;
+
 typedef struct periodic_scan_list {
     scan_list           scan_list;
     double              period;
@@ -94,6 +131,23 @@ typedef struct periodic_scan_list {
     unsigned long       overruns;
     volatile enum ctl   scanCtl;
     epicsEventId        loopEvent;
+    /* Sharding, only used when nShards > 1 */
+    int                 nShards;
+    scan_shard          *shards;
+    unsigned            nGroups;
+    unsigned            group;      /* PHAS group being processed */
+    int                 shardsBusy; /* workers still busy, atomic */
+    epicsEventId        shardsDone;
+    /* Timing statistics, protected by scan_list.lock */
+    int                 timed;      /* time records in this pass */
+    unsigned long       cycles;
+    double              sumTime;
+    double              lastTime;
+    double              maxTime;
+    double              lastJitter;
+    double              maxJitter;
+    unsigned long       timeHist[SCAN_HIST_BINS];
+    unsigned long       jitterHist[SCAN_HIST_BINS];
 } periodic_scan_list;
 
 static int nPeriodic = 0;
@@ -138,6 +192,9 @@ static epicsMutexId ioscan_lock;
 static void onceTask(void *);
 static void initOnce(void);
 static void periodicTask(void *arg);
+static void shardTask(void *arg);
+static void scanShards(periodic_scan_list *ppsl);
+static void stopShards(periodic_scan_list *ppsl);
 static void initPeriodic(void);
 static void deletePeriodic(void);
 static void spawnPeriodic(int ind);
@@ -146,7 +203,7 @@ static void ioscanInit(void);
 static void ioscanCallback(CALLBACK *pcallback);
 static void ioscanDestroy(void);
 static void printList(scan_list *psl, char *message);
-static void scanList(scan_list *psl);
+static void scanList(scan_list *psl, int timed);
 static void buildScanLists(void);
 static void addToList(struct dbCommon *precord, scan_list *psl);
 static void deleteFromList(struct dbCommon *precord, scan_list *psl);
@@ -400,6 +457,206 @@ int scanppl(double period)      /* print periodic scan list(s) */
         sprintf(message, "Records with SCAN = '%s' (%lu over-runs):",
             ppsl->name, ppsl->overruns);
         printList(&ppsl->scan_list, message);
+
+        if (ppsl->nShards > 1) {
+            int j;
+
+            printf("Scan '%s' is sharded across %d threads:\n",
+                ppsl->name, ppsl->nShards);
+            for (j = 0; j < ppsl->nShards; j++) {
+                scan_shard *pss = &ppsl->shards[j];
+
+                printf("    Shard %d: %u records, last %.3f ms, max %.3f ms\n",
+                    j, pss->nRecords, pss->lastTime * 1e3,
+                    pss->maxTime * 1e3);
+            }
+        }
+    }
+    return 0;
+}
+
+int scanPeriodicStatus(int scan, const int reset, scanPeriodicStats *result)
+{
+    periodic_scan_list *ppsl;
+    int ret;
+
+    scan -= SCAN_1ST_PERIODIC;
+    if (!papPeriodic || scan < 0 || scan >= nPeriodic)
+        return -1;
+    ppsl = papPeriodic[scan];
+    if (!ppsl)
+        return -1;
+
+    epicsMutexMustLock(ppsl->scan_list.lock);
+    if (result) {
+        result->period = ppsl->period;
+        result->cycles = ppsl->cycles;
+        result->overruns = ppsl->overruns;
+        result->lastTime = ppsl->lastTime;
+        result->meanTime = ppsl->cycles ? ppsl->sumTime / ppsl->cycles : 0.0;
+        result->maxTime = ppsl->maxTime;
+        result->lastJitter = ppsl->lastJitter;
+        result->maxJitter = ppsl->maxJitter;
+        memcpy(result->timeHist, ppsl->timeHist, sizeof(ppsl->timeHist));
+        memcpy(result->jitterHist, ppsl->jitterHist,
+            sizeof(ppsl->jitterHist));
+        ret = 0;
+    } else {
+        ret = -2;
+    }
+    if (reset) {
+        scan_element *pse;
+
+        /* overruns counts for the life of the IOC, as scanppl shows */
+        ppsl->cycles = 0;
+        ppsl->sumTime = ppsl->lastTime = ppsl->maxTime = 0.0;
+        ppsl->lastJitter = ppsl->maxJitter = 0.0;
+        memset(ppsl->timeHist, 0, sizeof(ppsl->timeHist));
+        memset(ppsl->jitterHist, 0, sizeof(ppsl->jitterHist));
+        for (pse = (scan_element *)ellFirst(&ppsl->scan_list.list); pse;
+             pse = (scan_element *)ellNext(&pse->node)) {
+            pse->samples = 0;
+            pse->sumNS = pse->maxNS = 0;
+        }
+    }
+    epicsMutexUnlock(ppsl->scan_list.lock);
+    return ret;
+}
+
+/* Call with the record locked */
+int scanRecordTimes(struct dbCommon *precord, scanRecordStats *result)
+{
+    scan_element *pse = precord->spvt;
+
+    if (!pse || precord->scan < SCAN_1ST_PERIODIC || !result)
+        return -1;
+
+    result->samples = pse->samples;
+    result->meanTime = pse->samples ? pse->sumNS * 1e-9 / pse->samples : 0.0;
+    result->maxTime = pse->maxNS * 1e-9;
+    return 0;
+}
+
+typedef struct record_time {
+    const char *name;
+    unsigned long samples;
+    double mean;
+    double max;
+} record_time;
+
+static int cmpRecordTime(const void *a, const void *b)
+{
+    const record_time *pa = a, *pb = b;
+
+    return pa->mean < pb->mean ? 1 : pa->mean > pb->mean ? -1 : 0;
+}
+
+#define RECORD_TIMES_SHOWN 10
+
+static void printRecordTimes(periodic_scan_list *ppsl)
+{
+    scan_list *psl = &ppsl->scan_list;
+    record_time *ptimes;
+    scan_element *pse;
+    int i, n = 0;
+
+    epicsMutexMustLock(psl->lock);
+    ptimes = calloc(ellCount(&psl->list) + 1, sizeof(record_time));
+    if (!ptimes) {
+        epicsMutexUnlock(psl->lock);
+        return;
+    }
+    for (pse = (scan_element *)ellFirst(&psl->list); pse;
+         pse = (scan_element *)ellNext(&pse->node)) {
+        if (!pse->samples)
+            continue;
+        ptimes[n].name = pse->precord->name;
+        ptimes[n].samples = pse->samples;
+        ptimes[n].mean = pse->sumNS * 1e-9 / pse->samples;
+        ptimes[n].max = pse->maxNS * 1e-9;
+        n++;
+    }
+    epicsMutexUnlock(psl->lock);
+
+    if (n == 0) {
+        printf("    No record times, set scanRecordTiming to collect them\n");
+    }
+    else {
+        qsort(ptimes, n, sizeof(record_time), cmpRecordTime);
+        printf("    %-28s %10s %12s %12s\n",
+            "Slowest records", "Samples", "Mean (us)", "Max (us)");
+        for (i = 0; i < n && i < RECORD_TIMES_SHOWN; i++) {
+            printf("    %-28s %10lu %12.1f %12.1f\n", ptimes[i].name,
+                ptimes[i].samples, ptimes[i].mean * 1e6, ptimes[i].max * 1e6);
+        }
+    }
+    free(ptimes);
+}
+
+int scanStats(double period, int level)   /* print periodic scan timing */
+{
+    int i;
+
+    if (!papPeriodic) {
+        printf("scanStats: dbScan subsystem not initialized\n");
+        return -1;
+    }
+
+    for (i = 0; i < nPeriodic; i++) {
+        periodic_scan_list *ppsl = papPeriodic[i];
+        scanPeriodicStats stats;
+
+        if (!ppsl ||
+            (period > 0.0 && fabs(period - ppsl->period) > 0.05) ||
+            scanPeriodicStatus(i + SCAN_1ST_PERIODIC, 0, &stats))
+            continue;
+
+        printf("Scan '%s': %lu scans, %lu over-runs\n",
+            ppsl->name, stats.cycles, stats.overruns);
+        printf("    Time:   last %.3f ms, mean %.3f ms, max %.3f ms"
+            " (mean %.1f%% of period)\n",
+            stats.lastTime * 1e3, stats.meanTime * 1e3, stats.maxTime * 1e3,
+            stats.meanTime / stats.period * 100.0);
+        printf("    Jitter: last %.3f ms, max %.3f ms\n",
+            stats.lastJitter * 1e3, stats.maxJitter * 1e3);
+
+        if (level > 0 && stats.cycles) {
+            int bin;
+
+            printf("    %14s %10s %10s\n", "Below (us)", "Time", "Jitter");
+            for (bin = 0; bin < SCAN_HIST_BINS; bin++) {
+                if (!stats.timeHist[bin] && !stats.jitterHist[bin])
+                    continue;
+                if (bin == SCAN_HIST_BINS - 1)
+                    printf("    %14s", "longer");
+                else
+                    printf("    %14.0f", ldexp(1.0, bin + 1));
+                printf(" %10lu %10lu\n",
+                    stats.timeHist[bin], stats.jitterHist[bin]);
+            }
+        }
+        if (level > 1)
+            printRecordTimes(ppsl);
+    }
+    return 0;
+}
+
+int scanStatsReset(double period)
+{
+    int i;
+
+    if (!papPeriodic) {
+        printf("scanStatsReset: dbScan subsystem not initialized\n");
+        return -1;
+    }
+
+    for (i = 0; i < nPeriodic; i++) {
+        periodic_scan_list *ppsl = papPeriodic[i];
+
+        if (!ppsl ||
+            (period > 0.0 && fabs(period - ppsl->period) > 0.05))
+            continue;
+        scanPeriodicStatus(i + SCAN_1ST_PERIODIC, 1, NULL);
     }
     return 0;
 }
@@ -453,7 +710,7 @@ static void eventCallback(CALLBACK *pcallback)
     scan_list *psl;
 
     callbackGetUser(psl, pcallback);
-    scanList(psl);
+    scanList(psl, 0);
 }
 
 static void eventOnce(void *arg)
@@ -638,7 +895,7 @@ unsigned int scanIoImmediate(IOSCANPVT piosh, int prio)
     if (ellCount(&piosl->scan_list.list) == 0)
         return 0;
 
-    scanList(&piosl->scan_list);
+    scanList(&piosl->scan_list, 0);
 
     if (piosh->cb)
         piosh->cb(piosh->arg, piosh, prio);
@@ -773,6 +1030,51 @@ static void initOnce(void)
     epicsEventWait(startStopEvent);
 }
 
+static int histBin(double seconds)
+{
+    double us = seconds * 1e6;
+    int i = 0;
+
+    while (us >= 2.0 && i < SCAN_HIST_BINS - 1) {
+        us /= 2.0;
+        i++;
+    }
+    return i;
+}
+
+static void updateStats(periodic_scan_list *ppsl, double jitter, double time)
+{
+    if (jitter < 0.0)
+        jitter = 0.0;   /* woke up early */
+
+    epicsMutexMustLock(ppsl->scan_list.lock);
+    ppsl->cycles++;
+    ppsl->sumTime += time;
+    ppsl->lastTime = time;
+    if (time > ppsl->maxTime)
+        ppsl->maxTime = time;
+    ppsl->timeHist[histBin(time)]++;
+    ppsl->lastJitter = jitter;
+    if (jitter > ppsl->maxJitter)
+        ppsl->maxJitter = jitter;
+    ppsl->jitterHist[histBin(jitter)]++;
+    epicsMutexUnlock(ppsl->scan_list.lock);
+}
+
+/* Called with the record locked */
+static void timedProcess(struct dbCommon *precord, scan_element *pse)
+{
+    epicsUInt64 start = epicsMonotonicGet();
+    epicsUInt64 ns;
+
+    dbProcess(precord);
+    ns = epicsMonotonicGet() - start;
+    pse->samples++;
+    pse->sumNS += ns;
+    if (ns > pse->maxNS)
+        pse->maxNS = ns;
+}
+
 static void periodicTask(void *arg)
 {
     periodic_scan_list *ppsl = (periodic_scan_list *)arg;
@@ -794,8 +1096,19 @@ static void periodicTask(void *arg)
         double delay;
         epicsTimeStamp now;
 
-        if (ppsl->scanCtl == ctlRun)
-            scanList(&ppsl->scan_list);
+        if (ppsl->scanCtl == ctlRun) {
+            epicsUInt64 start = epicsMonotonicGet();
+
+            epicsTimeGetCurrent(&now);
+            ppsl->timed = scanRecordTiming > 0 &&
+                ppsl->cycles % scanRecordTiming == 0;
+            if (ppsl->nShards > 1)
+                scanShards(ppsl);
+            else
+                scanList(&ppsl->scan_list, ppsl->timed);
+            updateStats(ppsl, epicsTimeDiffInSeconds(&now, &next),
+                (epicsMonotonicGet() - start) * 1e-9);
+        }
 
         epicsTimeAddSeconds(&next, ppsl->period);
         epicsTimeGetCurrent(&now);
@@ -840,10 +1153,184 @@ static void periodicTask(void *arg)
         epicsEventWaitWithTimeout(ppsl->loopEvent, delay);
     }
 
+    stopShards(ppsl);
     taskwdRemove(0);
     epicsEventSignal(startStopEvent);
 }
 
+/* Assign the records in a periodic scan list to shards.
+ * Called with the scan list locked.
+ */
+static void shardAppend(scan_shard *pss, dbCommon *precord)
+{
+    if (pss->nRecords == pss->maxRecords) {
+        pss->maxRecords = pss->maxRecords ? 2 * pss->maxRecords : 64;
+        pss->precords = realloc(pss->precords,
+            pss->maxRecords * sizeof(dbCommon *));
+        if (!pss->precords)
+            cantProceed("dbScan: No memory for scan shard\n");
+    }
+    pss->precords[pss->nRecords++] = precord;
+}
+
+static void shardEndGroup(periodic_scan_list *ppsl)
+{
+    int i;
+
+    for (i = 0; i < ppsl->nShards; i++) {
+        scan_shard *pss = &ppsl->shards[i];
+
+        if (ppsl->nGroups == pss->maxGroups) {
+            pss->maxGroups = pss->maxGroups ? 2 * pss->maxGroups : 4;
+            pss->groupEnd = realloc(pss->groupEnd,
+                pss->maxGroups * sizeof(unsigned));
+            if (!pss->groupEnd)
+                cantProceed("dbScan: No memory for scan shard\n");
+        }
+        pss->groupEnd[ppsl->nGroups] = pss->nRecords;
+    }
+    ppsl->nGroups++;
+}
+
+static void buildShards(periodic_scan_list *ppsl)
+{
+    scan_list *psl = &ppsl->scan_list;
+    scan_element *pse;
+    int i;
+
+    for (i = 0; i < ppsl->nShards; i++)
+        ppsl->shards[i].nRecords = 0;
+    ppsl->nGroups = 0;
+
+    /* Lock sets can be merged or split at run-time by link changes,
+     * so the shards are rebuilt for every pass through the list.
+     */
+    epicsMutexMustLock(psl->lock);
+    pse = (scan_element *)ellFirst(&psl->list);
+    while (pse) {
+        dbCommon *precord = pse->precord;
+        scan_element *pnext = (scan_element *)ellNext(&pse->node);
+
+        shardAppend(&ppsl->shards[dbLockGetLockId(precord) % ppsl->nShards],
+            precord);
+        if (!pnext || pnext->precord->phas != precord->phas)
+            shardEndGroup(ppsl);
+        pse = pnext;
+    }
+    psl->modified = FALSE;
+    epicsMutexUnlock(psl->lock);
+}
+
+static void scanShardGroup(scan_shard *pss, unsigned group)
+{
+    periodic_scan_list *ppsl = pss->ppsl;
+    unsigned i = group ? pss->groupEnd[group - 1] : 0;
+    unsigned end = pss->groupEnd[group];
+    epicsUInt64 start = epicsMonotonicGet();
+
+    for (; i < end; i++) {
+        dbCommon *precord = pss->precords[i];
+        scan_element *pse;
+
+        dbScanLock(precord);
+        /* Skip records whose SCAN was changed after the shards were
+         * built. That happens with the record locked, so this is safe.
+         */
+        pse = precord->spvt;
+        if (pse && pse->pscan_list == &ppsl->scan_list) {
+            if (ppsl->timed)
+                timedProcess(precord, pse);
+            else
+                dbProcess(precord);
+        }
+        dbScanUnlock(precord);
+    }
+
+    pss->busyTime += (epicsMonotonicGet() - start) * 1e-9;
+}
+
+static int shardHasGroup(scan_shard *pss, unsigned group)
+{
+    return pss->groupEnd[group] > (group ? pss->groupEnd[group - 1] : 0);
+}
+
+/* Records are processed one PHAS group at a time, with all shards
+ * finishing a group before any of them start on the next one.
+ */
+static void scanShards(periodic_scan_list *ppsl)
+{
+    unsigned group;
+    int i;
+
+    buildShards(ppsl);
+
+    for (group = 0; group < ppsl->nGroups; group++) {
+        int busy = 0;
+
+        for (i = 1; i < ppsl->nShards; i++)
+            busy += shardHasGroup(&ppsl->shards[i], group);
+
+        ppsl->group = group;
+        epicsAtomicSetIntT(&ppsl->shardsBusy, busy);
+        for (i = 1; i < ppsl->nShards; i++) {
+            if (shardHasGroup(&ppsl->shards[i], group))
+                epicsEventMustTrigger(ppsl->shards[i].go);
+        }
+
+        scanShardGroup(&ppsl->shards[0], group);
+
+        if (busy)
+            epicsEventMustWait(ppsl->shardsDone);
+    }
+
+    /* All workers are idle now */
+    for (i = 0; i < ppsl->nShards; i++) {
+        scan_shard *pss = &ppsl->shards[i];
+
+        pss->lastTime = pss->busyTime;
+        if (pss->lastTime > pss->maxTime)
+            pss->maxTime = pss->lastTime;
+        pss->busyTime = 0.0;
+    }
+}
+
+static void shardTask(void *arg)
+{
+    scan_shard *pss = (scan_shard *)arg;
+    periodic_scan_list *ppsl = pss->ppsl;
+
+    taskwdInsert(0, NULL, NULL);
+    epicsEventSignal(startStopEvent);
+
+    for (;;) {
+        epicsEventMustWait(pss->go);
+        if (ppsl->scanCtl == ctlExit)
+            break;
+
+        scanShardGroup(pss, ppsl->group);
+
+        if (epicsAtomicDecrIntT(&ppsl->shardsBusy) == 0)
+            epicsEventMustTrigger(ppsl->shardsDone);
+    }
+
+    taskwdRemove(0);
+    if (epicsAtomicDecrIntT(&ppsl->shardsBusy) == 0)
+        epicsEventMustTrigger(ppsl->shardsDone);
+}
+
+static void stopShards(periodic_scan_list *ppsl)
+{
+    int i;
+
+    if (ppsl->nShards <= 1)
+        return;
+
+    epicsAtomicSetIntT(&ppsl->shardsBusy, ppsl->nShards - 1);
+    for (i = 1; i < ppsl->nShards; i++)
+        epicsEventMustTrigger(ppsl->shards[i].go);
+    epicsEventMustWait(ppsl->shardsDone);
+}
+
 
 static void initPeriodic(void)
 {
@@ -918,6 +1405,20 @@ static void deletePeriodic(void)
         periodic_scan_list *ppsl = papPeriodic[i];
 
         if (!ppsl) continue;
+        if (ppsl->shards) {
+            int j;
+
+            for (j = 0; j < ppsl->nShards; j++) {
+                scan_shard *pss = &ppsl->shards[j];
+
+                if (pss->go)
+                    epicsEventDestroy(pss->go);
+                free(pss->precords);
+                free(pss->groupEnd);
+            }
+            free(ppsl->shards);
+            epicsEventDestroy(ppsl->shardsDone);
+        }
         ellFree(&ppsl->scan_list.list);
         epicsEventDestroy(ppsl->loopEvent);
         epicsMutexDestroy(ppsl->scan_list.lock);
@@ -931,10 +1432,22 @@ static void deletePeriodic(void)
 static void spawnPeriodic(int ind)
 {
     periodic_scan_list *ppsl = papPeriodic[ind];
-    char taskName[20];
+    int nShards = scanPeriodicShards;
+    char taskName[32];
+    int i;
 
     if (!ppsl) return;
 
+    if (nShards < 0)
+        nShards += epicsThreadGetCPUs();
+    if (nShards > 1) {
+        ppsl->nShards = nShards;
+        ppsl->shards = dbCalloc(nShards, sizeof(scan_shard));
+        ppsl->shardsDone = epicsEventMustCreate(epicsEventEmpty);
+        for (i = 0; i < nShards; i++)
+            ppsl->shards[i].ppsl = ppsl;
+    }
+
     sprintf(taskName, "scan-%g", ppsl->period);
     periodicTaskId[ind] = epicsThreadCreate(
         taskName, epicsThreadPriorityScanLow + ind,
@@ -942,6 +1455,19 @@ static void spawnPeriodic(int ind)
         periodicTask, (void *)ppsl);
 
     epicsEventWait(startStopEvent);
+
+    for (i = 1; i < ppsl->nShards; i++) {
+        scan_shard *pss = &ppsl->shards[i];
+
+        pss->go = epicsEventMustCreate(epicsEventEmpty);
+        sprintf(taskName, "scan-%g-%d", ppsl->period, i);
+        epicsThreadMustCreate(
+            taskName, epicsThreadPriorityScanLow + ind,
+            epicsThreadGetStackSize(epicsThreadStackBig),
+            shardTask, (void *)pss);
+
+        epicsEventWait(startStopEvent);
+    }
 }
 
 static void ioscanCallback(CALLBACK *pcallback)
@@ -951,7 +1477,7 @@ static void ioscanCallback(CALLBACK *pcallback)
 
     callbackGetUser(piosh, pcallback);
     callbackGetPriority(prio, pcallback);
-    scanList(&piosh->iosl[prio].scan_list);
+    scanList(&piosh->iosl[prio].scan_list, 0);
     if (piosh->cb)
         piosh->cb(piosh->arg, piosh, prio);
 }
@@ -981,7 +1507,7 @@ static void printList(scan_list *psl, char *message)
     }
 }
 
-static void scanList(scan_list *psl)
+static void scanList(scan_list *psl, int timed)
 {
     /* When reading this code remember that the call to dbProcess can result
      * in the SCAN field being changed in an arbitrary number of records.
@@ -1001,7 +1527,10 @@ static void scanList(scan_list *psl)
         struct dbCommon *precord = pse->precord;
 
         dbScanLock(precord);
-        dbProcess(precord);
+        if (timed)
+            timedProcess(precord, pse);
+        else
+            dbProcess(precord);
         dbScanUnlock(precord);
 
         epicsMutexMustLock(psl->lock);
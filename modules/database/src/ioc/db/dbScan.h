@@ -49,6 +49,38 @@ typedef struct scanOnceQueueStats {
     int numOverflow;
 } scanOnceQueueStats;
 
+/* Histogram bin i counts times of 2^i to 2^(i+1) microseconds, the
+ * first and last bins also count anything shorter or longer.
+ */
+#define SCAN_HIST_BINS 24
+
+typedef struct scanPeriodicStats {
+    double period;
+    unsigned long cycles;
+    unsigned long overruns;
+    /* Time taken to process the scan list, in seconds */
+    double lastTime;
+    double meanTime;
+    double maxTime;
+    /* Lateness of the start of each scan, in seconds */
+    double lastJitter;
+    double maxJitter;
+    unsigned long timeHist[SCAN_HIST_BINS];
+    unsigned long jitterHist[SCAN_HIST_BINS];
+} scanPeriodicStats;
+
+typedef struct scanRecordStats {
+    /* Times sampled when scanRecordTiming is set, in seconds */
+    unsigned long samples;
+    double meanTime;
+    double maxTime;
+} scanRecordStats;
+
+/* Threads sharing each periodic scan list, see dbScan.c */
+epicsShareExtern int scanPeriodicShards;
+/* Time record processing on every N'th periodic scan, 0 for never */
+epicsShareExtern int scanRecordTiming;
+
 epicsShareFunc long scanInit(void);
 epicsShareFunc void scanRun(void);
 epicsShareFunc void scanPause(void);
@@ -70,6 +102,14 @@ epicsShareFunc void scanOnceQueueShow(const int reset);
 /*print periodic lists*/
 epicsShareFunc int scanppl(double rate);
 
+/*periodic scan timing statistics, scan is a menuScan index*/
+epicsShareFunc int scanPeriodicStatus(int scan, const int reset,
+    scanPeriodicStats *result);
+epicsShareFunc int scanRecordTimes(struct dbCommon *precord,
+    scanRecordStats *result);
+epicsShareFunc int scanStats(double rate, int level);
+epicsShareFunc int scanStatsReset(double rate);
+
 /*print event lists*/
 epicsShareFunc int scanpel(const char *event_name);
 
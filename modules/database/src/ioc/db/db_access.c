@@ -137,6 +137,39 @@ int dbChannel_get(struct dbChannel *chan,
     return result;
 }
 
+static long getLocked(struct dbChannel *chan, int buffer_type,
+    void *pbuffer, long *nRequest, void *pfl);
+
+/* The plain, STS and TIME buffer types of a numeric value are
+ * eligible for snapshot reads, see dbChannelSnapshotOk().
+ */
+static int snapshotOk(struct dbChannel *chan, int buffer_type, void *pfl)
+{
+    long options;
+    short dbrType;
+
+    if (buffer_type > oldDBR_TIME_DOUBLE)
+        return 0;
+    if (buffer_type >= oldDBR_TIME_STRING)
+        options = DBR_STATUS | DBR_TIME;
+    else if (buffer_type >= oldDBR_STS_STRING)
+        options = DBR_STATUS;
+    else
+        options = 0;
+
+    switch (buffer_type % oldDBR_STS_STRING) {
+    case oldDBR_SHORT:  dbrType = DBR_SHORT;  break;
+    case oldDBR_FLOAT:  dbrType = DBR_FLOAT;  break;
+    case oldDBR_ENUM:   dbrType = DBR_ENUM;   break;
+    case oldDBR_CHAR:   dbrType = DBR_UCHAR;  break;
+    case oldDBR_LONG:   dbrType = DBR_LONG;   break;
+    case oldDBR_DOUBLE: dbrType = DBR_DOUBLE; break;
+    default:
+        return 0;
+    }
+    return dbChannelSnapshotOk(chan, dbrType, options, pfl);
+}
+
 /* Performs the work of the public db_get_field API, but also returns the number
  * of elements actually copied to the buffer.  The caller is responsible for
  * zeroing the remaining part of the buffer. */
@@ -145,6 +178,34 @@ int dbChannel_get_count(
     void *pbuffer, long *nRequest, void *pfl)
 {
     long status;
+
+    if (snapshotOk(chan, buffer_type, pfl)) {
+        long nReq = *nRequest;
+        int tries;
+
+        for (tries = 0; tries < DBSCAN_SNAPSHOT_TRIES; tries++) {
+            dbScanSnapshot snap;
+
+            if (!dbScanSnapshotBegin(dbChannelRecord(chan), &snap))
+                break;
+            status = getLocked(chan, buffer_type, pbuffer, nRequest, NULL);
+            if (dbScanSnapshotEnd(&snap))
+                return status;
+            *nRequest = nReq;
+        }
+    }
+
+    dbScanLock(dbChannelRecord(chan));
+    status = getLocked(chan, buffer_type, pbuffer, nRequest, pfl);
+    dbScanUnlock(dbChannelRecord(chan));
+    return status;
+}
+
+/* dbChannel_get_count() with the record locked, or inside a snapshot */
+static long getLocked(struct dbChannel *chan, int buffer_type,
+    void *pbuffer, long *nRequest, void *pfl)
+{
+    long status;
     long options;
     long i;
     long zero = 0;
@@ -154,8 +215,6 @@ int dbChannel_get_count(
     * in the dbAccess.c dbGet() and getOptions() routines.
     */
 
-    dbScanLock(dbChannelRecord(chan));
-
     switch(buffer_type) {
     case(oldDBR_STRING):
         status = dbChannelGet(chan, DBR_STRING, pbuffer, &zero, nRequest, pfl);
@@ -798,8 +857,6 @@ int dbChannel_get_count(
         break;
     }
 
-    dbScanUnlock(dbChannelRecord(chan));
-
     if (status) return -1;
     return 0;
 }
@@ -25,6 +25,7 @@
 
 #include "epicsEvent.h"
 #include "epicsMutex.h"
+#include "epicsSharedMemory.h"
 #include "epicsStdio.h"
 #include "epicsString.h"
 #include "epicsThread.h"
@@ -479,6 +480,21 @@ static void no_read_access_event ( struct client *pClient,
     }
 }
 
+/*
+ *  read_reply_flush()
+ *
+ * Ensures timely response for events, but does queue 
+ * them up like db requests when the OPI does not keep up.
+ * The event task runs the extra labor, which flushes, once it
+ * has emptied all of its queues, so that a burst of updates
+ * is sent with as few system calls as possible.
+ */
+static void read_reply_flush ( struct client *pClient, int eventsRemaining )
+{
+    if ( ! eventsRemaining )
+        db_post_extra_labor ( pClient->evuser );
+}
+
 /*
  *  read_reply()
  */
@@ -518,9 +534,8 @@ static void read_reply ( void *pArg, struct dbChannel *dbch,
             "server unable to load read (or subscription update) response "
             "into protocol buffer PV=\"%s\" max bytes=%u",
             RECORD_NAME ( dbch ), rsrvSizeofLargeBufTCP );
-        if ( ! eventsRemaining )
-            cas_send_bs_msg ( pClient, FALSE );
         SEND_UNLOCK ( pClient );
+        read_reply_flush ( pClient, eventsRemaining );
         return;
     }
 
@@ -529,9 +544,8 @@ static void read_reply ( void *pArg, struct dbChannel *dbch,
      */
     if ( ! readAccess ) {
         no_read_access_event ( pClient, pevext );
-        if ( ! eventsRemaining )
-            cas_send_bs_msg ( pClient, FALSE );
         SEND_UNLOCK ( pClient );
+        read_reply_flush ( pClient, eventsRemaining );
         return;
     }
 
@@ -594,15 +608,10 @@ static void read_reply ( void *pArg, struct dbChannel *dbch,
         cas_commit_msg ( pClient, payload_size );
     }
 
-    /*
-     * Ensures timely response for events, but does queue 
-     * them up like db requests when the OPI does not keep up.
-     */
-    if ( ! eventsRemaining )
-        cas_send_bs_msg ( pClient, FALSE );
-
     SEND_UNLOCK ( pClient );
 
+    read_reply_flush ( pClient, eventsRemaining );
+
     return;
 }
 
@@ -1452,7 +1461,12 @@ static void write_notify_reply ( struct client * pClient )
     /*
      * wakeup the TCP thread if it is waiting for a cb to complete
      */
-    epicsEventSignal ( pClient->blockSem );
+    if ( pClient->pIoThread ) {
+        rsrvIoResume ( pClient );
+    }
+    else {
+        epicsEventSignal ( pClient->blockSem );
+    }
 }
 
 /*
@@ -1683,7 +1697,22 @@ static int write_notify_action ( caHdrLargeArray *mp, void *pPayload,
 
     size = dbr_size_n (mp->m_dataType, mp->m_count);
 
-    if ( pciu->pPutNotify ) {
+    if ( pciu->pPutNotify && client->pIoThread ) {
+        char busyTmp;
+
+        /*
+         * an I/O thread parks the request instead of waiting,
+         * write_notify_reply() resumes it
+         */
+        epicsMutexMustLock(client->putNotifyLock);
+        busyTmp = pciu->pPutNotify->busy;
+        epicsMutexUnlock(client->putNotifyLock);
+        if ( busyTmp ) {
+            client->ioParked = TRUE;
+            return RSRV_OK;
+        }
+    }
+    else if ( pciu->pPutNotify ) {
 
         /*
          * serialize concurrent put notifies
@@ -2312,6 +2341,107 @@ static int search_reply_tcp (
     return RSRV_OK;
 }
 
+/*
+ * casPeerIsLocal()
+ *
+ * The peer is on this host if we can bind to its address
+ */
+static int casPeerIsLocal ( const struct sockaddr_in *pAddr )
+{
+    osiSockAddr tmp;
+    SOCKET sock;
+    int status;
+
+    sock = epicsSocketCreate ( AF_INET, SOCK_DGRAM, IPPROTO_UDP );
+    if ( sock == INVALID_SOCKET ) {
+        return FALSE;
+    }
+    tmp.ia = *pAddr;
+    tmp.ia.sin_port = htons ( 0 );
+    status = bind ( sock, &tmp.sa, sizeof ( tmp.ia ) );
+    epicsSocketDestroy ( sock );
+    return status == 0;
+}
+
+/*
+ * shm_request_action()
+ *
+ * Offer the client a shared memory segment for the rest of the circuit,
+ * or reply with an empty payload when we wont use one
+ */
+static int shm_request_action ( caHdrLargeArray *mp,
+                       void *pPayload, struct client *pClient )
+{
+    char name[EPICS_SHARED_MEMORY_NAME_SIZE];
+    ca_uint32_t size = 0u;
+    char *pPayloadOut;
+    int status;
+
+    /* the I/O thread pool only waits on sockets */
+    if ( rsrvShmTransport && ! pClient->pIoThread && ! pClient->pShm &&
+            casPeerIsLocal ( &pClient->addr ) ) {
+        pClient->pShm = caShmTransportCreate ( name, sizeof ( name ),
+            rsrvSizeofLargeBufTCP );
+        if ( pClient->pShm ) {
+            size = strlen ( name ) + 1u;
+        }
+    }
+
+    SEND_LOCK ( pClient );
+    status = cas_copy_in_header ( pClient, CA_PROTO_SHM_REQUEST, size,
+        0u, 0u, 0u, 0u, ( void * ) &pPayloadOut );
+    if ( status == ECA_NORMAL ) {
+        memset ( pPayloadOut, 0, CA_MESSAGE_ALIGN ( size ) );
+        if ( size ) {
+            memcpy ( pPayloadOut, name, size );
+        }
+        cas_commit_msg ( pClient, size );
+    }
+    SEND_UNLOCK ( pClient );
+    return RSRV_OK;
+}
+
+/*
+ * shm_switch_action()
+ *
+ * The client opened the segment (m_available nonzero) and sends
+ * everything after this message through it, or it gave up
+ */
+static int shm_switch_action ( caHdrLargeArray *mp,
+                       void *pPayload, struct client *pClient )
+{
+    int status;
+
+    if ( ! pClient->pShm || pClient->shmRecvActive ) {
+        log_header ( "unexpected shared memory switch",
+            pClient, mp, pPayload, 0 );
+        return RSRV_ERROR;
+    }
+
+    caShmTransportUnlink ( pClient->pShm );
+    if ( ! mp->m_available ) {
+        caShmTransportDestroy ( pClient->pShm );
+        pClient->pShm = NULL;
+        return RSRV_OK;
+    }
+    pClient->shmRecvActive = TRUE;
+
+    /*
+     * everything queued so far, the reply included, still goes by
+     * TCP, the client moves to the ring when it sees the reply
+     */
+    SEND_LOCK ( pClient );
+    status = cas_copy_in_header ( pClient, CA_PROTO_SHM_SWITCH, 0u,
+        0u, 0u, 0u, 1u, 0 );
+    if ( status == ECA_NORMAL ) {
+        cas_commit_msg ( pClient, 0u );
+    }
+    cas_send_bs_msg ( pClient, FALSE );
+    pClient->shmSendActive = TRUE;
+    SEND_UNLOCK ( pClient );
+    return RSRV_OK;
+}
+
 typedef int (*pProtoStubTCP) (caHdrLargeArray *mp, void *pPayload, struct client *client);
 
 /*
@@ -2346,7 +2476,9 @@ static const pProtoStubTCP tcpJumpTable[] =
     bad_tcp_cmd_action,
     bad_tcp_cmd_action,
     bad_tcp_cmd_action,
-    bad_tcp_cmd_action
+    bad_tcp_cmd_action,
+    shm_request_action,
+    shm_switch_action
 };
 
 /*
@@ -2382,6 +2514,8 @@ static const pProtoStubUDP udpJumpTable[] =
     bad_udp_cmd_action,
     bad_udp_cmd_action,
     bad_udp_cmd_action,
+    bad_udp_cmd_action,
+    bad_udp_cmd_action,
     bad_udp_cmd_action
 };
 
@@ -2523,7 +2657,20 @@ int camessage ( struct client *client )
             break;
         }
 
+        /*
+         * an I/O thread doesn't wait for a client, it parks the
+         * remaining requests until the blocked send drains
+         */
+        if ( client->pIoThread && client->sendBlocked ) {
+            client->ioParked = TRUE;
+        }
+        if ( client->ioParked ) {
+            status = RSRV_OK;
+            break;
+        }
+
         nmsg++;
+        casNoteMessageSize ( &client->recv, msgsize );
 
         if ( CASDEBUG > 2 )
             log_header (NULL, client, &msg, pBody, nmsg);
@@ -2548,6 +2695,10 @@ int camessage ( struct client *client )
                     status = RSRV_ERROR;
                     break;
                 }
+                if ( client->ioParked ) {
+                    /* processed again by rsrvIoResume() */
+                    break;
+                }
             }
             else {
                 return bad_tcp_cmd_action ( &msg, pBody, client );
@@ -0,0 +1,537 @@
+/*************************************************************************\
+* Copyright (c) 2019 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *  CA server TCP I/O thread pool
+ *
+ *  When rsrvIoThreads is set before iocInit a small fixed number of
+ *  threads serve all TCP client circuits, instead of one camsgtask()
+ *  thread for each client.  Each I/O thread waits for socket activity
+ *  on its circuits with an fdmgr context, the sockets are non-blocking,
+ *  and requests are dispatched by camessage() on the I/O thread.  The
+ *  wire protocol is unchanged.
+ *
+ *  Other threads, mostly the per client event task, tell an I/O thread
+ *  about a blocked or drained send buffer, a completed put callback or
+ *  a lost circuit by queuing a request on the client and sending one
+ *  byte to the I/O thread's loopback wakeup socket.  Requests are only
+ *  queued with SEND_LOCK() held and before client::disconnect is set,
+ *  which allows the I/O thread to tear down a client without further
+ *  synchronization.
+ *
+ *  An I/O thread never waits for one client.  While a client's send is
+ *  blocked, or a request must wait for its put callback, camessage()
+ *  parks the remaining requests in the receive buffer, the socket is
+ *  not read, and the thread returns to its other clients.  The parked
+ *  requests are processed again once the reason is gone.  The event
+ *  tasks stay one per client, they wait for a blocked send themselves.
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cantProceed.h"
+#include "dbDefs.h"
+#include "epicsAtomic.h"
+#include "epicsSignal.h"
+#include "epicsStdio.h"
+#include "epicsTime.h"
+#include "errlog.h"
+#include "fdmgr.h"
+#include "osiSock.h"
+#include "taskwd.h"
+
+#define epicsExportSharedSymbols
+#include "rsrv.h"
+#include "server.h"
+
+/* client::ioRequests */
+#define ioReqAttach 0x1u
+#define ioReqWrite  0x2u
+#define ioReqResume 0x4u
+#define ioReqClose  0x8u
+
+/* receives from one circuit before other circuits get a turn */
+#define IO_RECV_PASSES 8
+
+static void ioClientReadable ( void *pParam );
+static void ioClientWritable ( void *pParam );
+
+static int ioOnThread ( struct client *client )
+{
+    return client->pIoThread->tid == epicsThreadGetIdSelf ();
+}
+
+static void ioPost ( struct client *client, unsigned request )
+{
+    rsrv_io_thread *pio = client->pIoThread;
+    int wakeup = FALSE;
+
+    epicsMutexMustLock ( pio->lock );
+    if ( ! client->ioRequests ) {
+        client->pNextPending = pio->pPending;
+        pio->pPending = client;
+    }
+    client->ioRequests |= request;
+    if ( ! pio->wakeupPending ) {
+        pio->wakeupPending = TRUE;
+        wakeup = TRUE;
+    }
+    epicsMutexUnlock ( pio->lock );
+
+    if ( wakeup ) {
+        char msg = 0;
+        sendto ( pio->wakeupSock, &msg, sizeof ( msg ), 0,
+            &pio->wakeupAddr.sa, sizeof ( pio->wakeupAddr.ia ) );
+    }
+}
+
+/*
+ * Called by the I/O thread to register interest in the socket events
+ * that the client currently needs: readable unless requests are parked
+ * or the send buffer is blocked, and writable while it is.  A writable
+ * callback can not re-register itself, so it passes armWrite=FALSE.
+ * sendBlocked is read without the lock since another thread changing
+ * it also posts a request.
+ */
+static int ioUpdateInterest ( struct client *client, int armWrite )
+{
+    rsrv_io_thread *pio = client->pIoThread;
+    int readable = ! client->sendBlocked && ! client->ioParked;
+    int status = 0;
+
+    if ( readable && ! client->ioReadArmed ) {
+        status = fdmgr_add_callback ( pio->pfdctx, client->sock, fdi_read,
+            ioClientReadable, client );
+        client->ioReadArmed = ! status;
+    }
+    else if ( ! readable && client->ioReadArmed ) {
+        fdmgr_clear_callback ( pio->pfdctx, client->sock, fdi_read );
+        client->ioReadArmed = FALSE;
+    }
+
+    if ( ! status && armWrite &&
+            client->sendBlocked && ! client->ioWriteArmed ) {
+        status = fdmgr_add_callback ( pio->pfdctx, client->sock, fdi_write,
+            ioClientWritable, client );
+        client->ioWriteArmed = ! status;
+    }
+
+    if ( status ) {
+        errlogPrintf ( "CAS: %s unable to register client socket %d\n",
+            pio->name, (int) client->sock );
+    }
+    return status;
+}
+
+static void ioClientClose ( struct client *client )
+{
+    rsrv_io_thread *pio = client->pIoThread;
+
+    /*
+     * Once a thread holding SEND_LOCK() has seen this no further
+     * requests are posted, and threads waiting for send buffer
+     * space give up.  The shutdown wakes them up at once.
+     */
+    client->disconnect = TRUE;
+    shutdown ( client->sock, SHUT_RDWR );
+    SEND_LOCK ( client );
+    SEND_UNLOCK ( client );
+
+    if ( client->ioReadArmed ) {
+        fdmgr_clear_callback ( pio->pfdctx, client->sock, fdi_read );
+        client->ioReadArmed = FALSE;
+    }
+    if ( client->ioWriteArmed ) {
+        fdmgr_clear_callback ( pio->pfdctx, client->sock, fdi_write );
+        client->ioWriteArmed = FALSE;
+    }
+
+    epicsMutexMustLock ( pio->lock );
+    if ( client->ioRequests ) {
+        struct client **ppNext = &pio->pPending;
+        while ( *ppNext != client ) {
+            ppNext = &(*ppNext)->pNextPending;
+        }
+        *ppNext = client->pNextPending;
+        client->ioRequests = 0u;
+    }
+    epicsMutexUnlock ( pio->lock );
+
+    LOCK_CLIENTQ;
+    ellDelete ( &clientQ, &client->node );
+    UNLOCK_CLIENTQ;
+
+    epicsAtomicDecrIntT ( &pio->nClients );
+
+    destroy_tcp_client ( client );
+}
+
+static void ioClientReadable ( void *pParam )
+{
+    struct client *client = (struct client *) pParam;
+    rsrv_io_thread *pio = client->pIoThread;
+    epicsUInt64 start = epicsMonotonicGet ();
+    int lost = FALSE;
+    int pass;
+
+    epicsThreadPrivateSet ( rsrvCurrentClient, client );
+
+    for ( pass = 0; pass < IO_RECV_PASSES; pass++ ) {
+        long nchars;
+        int anerrno;
+
+        if ( castcp_ctl != ctlRun || client->disconnect ||
+                client->sendBlocked || client->ioParked ) {
+            break;
+        }
+
+        client->recv.stk = 0;
+        assert ( client->recv.maxstk >= client->recv.cnt );
+        nchars = recv ( client->sock, &client->recv.buf[client->recv.cnt],
+                (int) ( client->recv.maxstk - client->recv.cnt ), 0 );
+        anerrno = SOCKERRNO;
+        if ( nchars < 0 && anerrno == SOCK_EWOULDBLOCK ) {
+            break;
+        }
+        if ( nchars > 0 ) {
+            pio->nRecv++;
+            pio->nBytesRecv += (unsigned long) nchars;
+        }
+        if ( camsgReceived ( client, nchars, anerrno ) ) {
+            lost = TRUE;
+            break;
+        }
+        if ( nchars < 0 ) {
+            /* retried on the next readiness callback */
+            break;
+        }
+    }
+
+    epicsThreadPrivateSet ( rsrvCurrentClient, NULL );
+
+    if ( ! lost && castcp_ctl == ctlRun && ! client->disconnect ) {
+        /*
+         * no more input, or a fair share of it,
+         * so send the responses
+         */
+        cas_send_bs_msg ( client, TRUE );
+    }
+
+    if ( lost || castcp_ctl != ctlRun || client->disconnect ||
+            ioUpdateInterest ( client, TRUE ) ) {
+        ioClientClose ( client );
+    }
+
+    pio->busyNS += epicsMonotonicGet () - start;
+}
+
+/*
+ * Process the requests parked by camessage() once the send
+ * has drained.  Returns RSRV_ERROR when the circuit is lost.
+ */
+static int ioClientResume ( struct client *client )
+{
+    int status;
+
+    if ( ! client->ioParked || client->sendBlocked ) {
+        return RSRV_OK;
+    }
+    client->ioParked = FALSE;
+
+    epicsThreadPrivateSet ( rsrvCurrentClient, client );
+    client->recv.stk = 0;
+    status = camsgProcess ( client );
+    epicsThreadPrivateSet ( rsrvCurrentClient, NULL );
+
+    if ( status == RSRV_OK && ! client->disconnect ) {
+        cas_send_bs_msg ( client, TRUE );
+    }
+    return status;
+}
+
+static void ioClientWritable ( void *pParam )
+{
+    struct client *client = (struct client *) pParam;
+    rsrv_io_thread *pio = client->pIoThread;
+    epicsUInt64 start = epicsMonotonicGet ();
+
+    /* write callbacks are once only */
+    client->ioWriteArmed = FALSE;
+
+    /*
+     * Never wait here for a thread which might itself be waiting for
+     * send buffer space.  A thread holding the lock posts a new request
+     * if it finds the send still blocked.
+     */
+    if ( epicsMutexTryLock ( client->lock ) == epicsMutexLockOK ) {
+        cas_send_bs_msg ( client, FALSE );
+        casShrinkSendBuffer ( client );
+        SEND_UNLOCK ( client );
+    }
+
+    if ( client->disconnect || ioClientResume ( client ) ||
+            ioUpdateInterest ( client, FALSE ) ) {
+        ioClientClose ( client );
+    }
+    else if ( client->sendBlocked ) {
+        /* re-arm after this once only callback is gone */
+        SEND_LOCK ( client );
+        if ( ! client->disconnect ) {
+            ioPost ( client, ioReqWrite );
+        }
+        SEND_UNLOCK ( client );
+    }
+
+    pio->busyNS += epicsMonotonicGet () - start;
+}
+
+static void ioWakeup ( void *pParam )
+{
+    rsrv_io_thread *pio = (rsrv_io_thread *) pParam;
+    epicsUInt64 start = epicsMonotonicGet ();
+    char buf[64];
+
+    epicsMutexMustLock ( pio->lock );
+    pio->wakeupPending = FALSE;
+    epicsMutexUnlock ( pio->lock );
+
+    /* requests posted after this are found below, or wake us again */
+    while ( recv ( pio->wakeupSock, buf, sizeof ( buf ), 0 ) > 0 ) {
+    }
+
+    while ( TRUE ) {
+        struct client *client;
+        unsigned requests;
+
+        epicsMutexMustLock ( pio->lock );
+        client = pio->pPending;
+        if ( client ) {
+            pio->pPending = client->pNextPending;
+            requests = client->ioRequests;
+            client->ioRequests = 0u;
+        }
+        epicsMutexUnlock ( pio->lock );
+
+        if ( ! client ) {
+            break;
+        }
+
+        if ( ( requests & ioReqClose ) || client->disconnect ||
+                ioClientResume ( client ) ||
+                ioUpdateInterest ( client, TRUE ) ) {
+            ioClientClose ( client );
+        }
+    }
+
+    pio->busyNS += epicsMonotonicGet () - start;
+}
+
+static void ioThread ( void *pParam )
+{
+    rsrv_io_thread *pio = (rsrv_io_thread *) pParam;
+
+    taskwdInsert ( epicsThreadGetIdSelf (), NULL, NULL );
+    epicsSignalInstallSigAlarmIgnore ();
+    epicsSignalInstallSigPipeIgnore ();
+
+    while ( TRUE ) {
+        struct timeval timeout;
+
+        timeout.tv_sec = 10;
+        timeout.tv_usec = 0;
+        fdmgr_pend_event ( pio->pfdctx, &timeout );
+    }
+}
+
+static int ioThreadInit ( rsrv_io_thread *pio, unsigned index )
+{
+    osiSocklen_t addrSize = sizeof ( pio->wakeupAddr.ia );
+    osiSockIoctl_t yes = TRUE;
+
+    epicsSnprintf ( pio->name, sizeof ( pio->name ), "CAS-io-%u", index );
+
+    pio->wakeupSock = epicsSocketCreate ( AF_INET, SOCK_DGRAM, 0 );
+    if ( pio->wakeupSock == INVALID_SOCKET ) {
+        return -1;
+    }
+
+    memset ( &pio->wakeupAddr, 0, sizeof ( pio->wakeupAddr ) );
+    pio->wakeupAddr.ia.sin_family = AF_INET;
+    pio->wakeupAddr.ia.sin_addr.s_addr = htonl ( INADDR_LOOPBACK );
+    pio->wakeupAddr.ia.sin_port = 0;
+    if ( bind ( pio->wakeupSock, &pio->wakeupAddr.sa,
+                sizeof ( pio->wakeupAddr.ia ) ) ||
+            getsockname ( pio->wakeupSock, &pio->wakeupAddr.sa, &addrSize ) ||
+            socket_ioctl ( pio->wakeupSock, FIONBIO, &yes ) < 0 ) {
+        epicsSocketDestroy ( pio->wakeupSock );
+        return -1;
+    }
+
+    pio->pfdctx = fdmgr_init ();
+    if ( ! pio->pfdctx ) {
+        epicsSocketDestroy ( pio->wakeupSock );
+        return -1;
+    }
+    if ( fdmgr_add_callback ( pio->pfdctx, pio->wakeupSock, fdi_read,
+                ioWakeup, pio ) ) {
+        fdmgr_delete ( pio->pfdctx );
+        epicsSocketDestroy ( pio->wakeupSock );
+        return -1;
+    }
+
+    pio->lock = epicsMutexMustCreate ();
+    pio->startNS = epicsMonotonicGet ();
+    pio->tid = epicsThreadMustCreate ( pio->name, epicsThreadPriorityCAServerLow,
+        epicsThreadGetStackSize ( epicsThreadStackBig ), ioThread, pio );
+    return 0;
+}
+
+/*
+ *  rsrvIoPoolInit()
+ *
+ *  Start the I/O threads, called once by rsrv_init()
+ */
+void rsrvIoPoolInit ( void )
+{
+    unsigned i;
+
+    if ( rsrvIoThreads <= 0 ) {
+        return;
+    }
+
+    rsrvIoPool = callocMustSucceed ( rsrvIoThreads, sizeof ( *rsrvIoPool ),
+        "rsrvIoPoolInit" );
+    for ( i = 0u; i < (unsigned) rsrvIoThreads; i++ ) {
+        if ( ioThreadInit ( &rsrvIoPool[i], i ) ) {
+            char sockErrBuf[64];
+            epicsSocketConvertErrnoToString (
+                sockErrBuf, sizeof ( sockErrBuf ) );
+            errlogPrintf ( "CAS: Unable to start I/O thread %u: %s\n",
+                i, sockErrBuf );
+            break;
+        }
+    }
+    rsrvIoPoolSize = i;
+    if ( ! rsrvIoPoolSize ) {
+        errlogPrintf ( "CAS: Using a thread for each client instead\n" );
+    }
+}
+
+/*
+ *  rsrvIoPoolAttach()
+ *
+ *  Hand a new TCP client to the least loaded I/O thread.
+ *  The client belongs to that thread after success.
+ */
+int rsrvIoPoolAttach ( struct client *client )
+{
+    rsrv_io_thread *pio = NULL;
+    osiSockIoctl_t yes = TRUE;
+    unsigned i;
+
+    if ( ! rsrvIoPoolSize ) {
+        return RSRV_ERROR;
+    }
+
+    if ( socket_ioctl ( client->sock, FIONBIO, &yes ) < 0 ) {
+        char sockErrBuf[64];
+        epicsSocketConvertErrnoToString (
+            sockErrBuf, sizeof ( sockErrBuf ) );
+        errlogPrintf ( "CAS: Unable to set non-blocking client socket: %s\n",
+            sockErrBuf );
+        return RSRV_ERROR;
+    }
+
+    for ( i = 0u; i < rsrvIoPoolSize; i++ ) {
+        if ( ! pio || epicsAtomicGetIntT ( &rsrvIoPool[i].nClients ) <
+                epicsAtomicGetIntT ( &pio->nClients ) ) {
+            pio = &rsrvIoPool[i];
+        }
+    }
+    epicsAtomicIncrIntT ( &pio->nClients );
+
+    client->pIoThread = pio;
+    ioPost ( client, ioReqAttach );
+    return RSRV_OK;
+}
+
+/*
+ * The following are called with SEND_LOCK() held by
+ * cas_send_bs_msg() for clients of the I/O thread pool.
+ * The I/O thread updates its own socket interest after
+ * each callback, so only other threads post requests.
+ */
+void rsrvIoSendBlocked ( struct client *client )
+{
+    client->sendBlocked = TRUE;
+    if ( ! client->disconnect && ! ioOnThread ( client ) ) {
+        ioPost ( client, ioReqWrite );
+    }
+}
+
+void rsrvIoSendResumed ( struct client *client )
+{
+    if ( ! client->sendBlocked ) {
+        return;
+    }
+    client->sendBlocked = FALSE;
+    if ( ! client->disconnect && ! ioOnThread ( client ) ) {
+        ioPost ( client, ioReqResume );
+    }
+}
+
+void rsrvIoSendFailed ( struct client *client )
+{
+    if ( ! ioOnThread ( client ) ) {
+        ioPost ( client, ioReqClose );
+    }
+}
+
+/*
+ *  rsrvIoResume()
+ *
+ *  A put callback completed, so a request parked by
+ *  write_notify_action() can be processed again
+ */
+void rsrvIoResume ( struct client *client )
+{
+    SEND_LOCK ( client );
+    if ( ! client->disconnect ) {
+        ioPost ( client, ioReqResume );
+    }
+    SEND_UNLOCK ( client );
+}
+
+/*
+ *  rsrvIoPoolShow()
+ */
+void rsrvIoPoolShow ( unsigned level )
+{
+    epicsUInt64 now = epicsMonotonicGet ();
+    unsigned i;
+
+    if ( ! rsrvIoPoolSize ) {
+        return;
+    }
+
+    printf ( "CAS I/O thread pool with %u thread%s:\n",
+        rsrvIoPoolSize, rsrvIoPoolSize == 1u ? "" : "s" );
+    for ( i = 0u; i < rsrvIoPoolSize; i++ ) {
+        rsrv_io_thread *pio = &rsrvIoPool[i];
+        double elapsed = (double) ( now - pio->startNS );
+        int n = epicsAtomicGetIntT ( &pio->nClients );
+
+        printf ( "    %s: %d client%s, %lu receives, %lu bytes, %.1f%% busy\n",
+            pio->name, n, n == 1 ? "" : "s", pio->nRecv, pio->nBytesRecv,
+            elapsed > 0.0 ? 100.0 * (double) pio->busyNS / elapsed : 0.0 );
+        if ( level >= 2u ) {
+            printf ( "\tWakeup socket FD = %d\n", (int) pio->wakeupSock );
+        }
+    }
+}
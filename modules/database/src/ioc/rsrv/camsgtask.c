@@ -34,6 +34,121 @@
 #include "rsrv.h"
 #include "server.h"
 
+/*
+ *  camsgReceived()
+ *
+ *  Process the result of one recv() on a TCP client circuit.
+ *  Shared by camsgtask() and the I/O thread pool.
+ *
+ *  Returns RSRV_ERROR when the circuit should be disconnected.
+ */
+int camsgReceived ( struct client *client, long nchars, int anerrno )
+{
+    if ( nchars == 0 ){
+        if ( CASDEBUG > 0 ) {
+            /* convert to u long so that %lu works on both 32 and 64 bit archs */
+            unsigned long cnt = sizeof ( client->recv.buf ) - client->recv.cnt;
+            errlogPrintf ( "CAS: nill message disconnect ( %lu bytes request )\n",
+                cnt );
+        }
+        return RSRV_ERROR;
+    }
+    else if ( nchars < 0 ) {
+        if ( anerrno == SOCK_EINTR ) {
+            return RSRV_OK;
+        }
+
+        if ( anerrno == SOCK_ENOBUFS ) {
+            /* an I/O thread must not stall its other clients */
+            if ( client->pIoThread ) {
+                errlogPrintf (
+                    "CAS: Out of network buffers, retrying receive\n" );
+            }
+            else {
+                errlogPrintf (
+                    "CAS: Out of network buffers, retring receive in 15 seconds\n" );
+                epicsThreadSleep ( 15.0 );
+            }
+            return RSRV_OK;
+        }
+
+        /*
+         * normal conn lost conditions
+         */
+        if (    ( anerrno != SOCK_ECONNABORTED &&
+            anerrno != SOCK_ECONNRESET &&
+            anerrno != SOCK_ETIMEDOUT ) ||
+            CASDEBUG > 2 ) {
+            char sockErrBuf[64];
+
+            epicsSocketConvertErrorToString(
+                sockErrBuf, sizeof ( sockErrBuf ), anerrno);
+            errlogPrintf ( "CAS: Client disconnected - %s\n",
+                sockErrBuf );
+        }
+        return RSRV_ERROR;
+    }
+
+    epicsTimeGetCurrent ( &client->time_at_last_recv );
+    client->recv.cnt += ( unsigned ) nchars;
+
+    return camsgProcess ( client );
+}
+
+/*
+ *  camsgProcess()
+ *
+ *  Process the requests in the receive buffer, and keep any that
+ *  are incomplete, or parked by camessage(), for the next call.
+ *
+ *  Returns RSRV_ERROR when the circuit should be disconnected.
+ */
+int camsgProcess ( struct client *client )
+{
+    int status;
+
+    status = camessage ( client );
+    if (status == 0) {
+        /*
+         * if there is a partial message
+         * align it with the start of the buffer
+         */
+        if (client->recv.cnt > client->recv.stk) {
+            unsigned bytes_left;
+
+            bytes_left = client->recv.cnt - client->recv.stk;
+
+            /*
+             * overlapping regions handled
+             * properly by memmove 
+             */
+            memmove (client->recv.buf, 
+                &client->recv.buf[client->recv.stk], bytes_left);
+            client->recv.cnt = bytes_left;
+        }
+        else {
+            client->recv.cnt = 0ul;
+            casShrinkRecvBuffer ( client );
+        }
+    }
+    else {
+        char buf[64];
+
+        /* flush any queued messages before shutdown */
+        cas_send_bs_msg(client, 1);
+        
+        client->recv.cnt = 0ul;
+        
+        /*
+         * disconnect when there are severe message errors
+         */
+        ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
+        epicsPrintf ("CAS: forcing disconnect from %s\n", buf);
+        return RSRV_ERROR;
+    }
+    return RSRV_OK;
+}
+
 /*
  *  camsgtask()
  *
@@ -50,6 +165,20 @@ void camsgtask ( void *pParm )
         long nchars;
         int status;
 
+        if ( client->shmRecvActive ) {
+            if ( caShmTransportRecvPending ( client->pShm ) == 0u ) {
+                cas_send_bs_msg(client, TRUE);
+            }
+            client->recv.stk = 0;
+            assert ( client->recv.maxstk >= client->recv.cnt );
+            nchars = casShmRecv ( client, &client->recv.buf[client->recv.cnt],
+                client->recv.maxstk - client->recv.cnt );
+            if ( camsgReceived ( client, nchars, SOCKERRNO ) ) {
+                break;
+            }
+            continue;
+        }
+
         /*
          * allow message to batch up if more are comming
          */
@@ -71,87 +200,14 @@ void camsgtask ( void *pParm )
         assert ( client->recv.maxstk >= client->recv.cnt );
         nchars = recv ( client->sock, &client->recv.buf[client->recv.cnt], 
                 (int) ( client->recv.maxstk - client->recv.cnt ), 0 );
-        if ( nchars == 0 ){
-            if ( CASDEBUG > 0 ) {
-                /* convert to u long so that %lu works on both 32 and 64 bit archs */
-                unsigned long cnt = sizeof ( client->recv.buf ) - client->recv.cnt;
-                errlogPrintf ( "CAS: nill message disconnect ( %lu bytes request )\n",
-                    cnt );
-            }
-            break;
-        }
-        else if ( nchars < 0 ) {
-            int anerrno = SOCKERRNO;
-
-            if ( anerrno == SOCK_EINTR ) {
-                continue;
-            }
-
-            if ( anerrno == SOCK_ENOBUFS ) {
-                errlogPrintf (
-                    "CAS: Out of network buffers, retring receive in 15 seconds\n" );
-                epicsThreadSleep ( 15.0 );
-                continue;
-            }
-
-            /*
-             * normal conn lost conditions
-             */
-            if (    ( anerrno != SOCK_ECONNABORTED &&
-                anerrno != SOCK_ECONNRESET &&
-                anerrno != SOCK_ETIMEDOUT ) ||
-                CASDEBUG > 2 ) {
-                char sockErrBuf[64];
-
-                epicsSocketConvertErrorToString(
-                    sockErrBuf, sizeof ( sockErrBuf ), anerrno);
-                errlogPrintf ( "CAS: Client disconnected - %s\n",
-                    sockErrBuf );
-            }
+        if ( camsgReceived ( client, nchars, SOCKERRNO ) ) {
             break;
         }
+    }
 
-        epicsTimeGetCurrent ( &client->time_at_last_recv );
-        client->recv.cnt += ( unsigned ) nchars;
-
-        status = camessage ( client );
-        if (status == 0) {
-            /*
-             * if there is a partial message
-             * align it with the start of the buffer
-             */
-            if (client->recv.cnt > client->recv.stk) {
-                unsigned bytes_left;
-
-                bytes_left = client->recv.cnt - client->recv.stk;
-
-                /*
-                 * overlapping regions handled
-                 * properly by memmove 
-                 */
-                memmove (client->recv.buf, 
-                    &client->recv.buf[client->recv.stk], bytes_left);
-                client->recv.cnt = bytes_left;
-            }
-            else {
-                client->recv.cnt = 0ul;
-            }
-        }
-        else {
-            char buf[64];
-
-            /* flush any queued messages before shutdown */
-            cas_send_bs_msg(client, 1);
-            
-            client->recv.cnt = 0ul;
-            
-            /*
-             * disconnect when there are severe message errors
-             */
-            ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
-            epicsPrintf ("CAS: forcing disconnect from %s\n", buf);
-                break;
-        }
+    if ( client->pShm ) {
+        /* release an event task waiting for room in the ring */
+        client->disconnect = TRUE;
     }
 
     LOCK_CLIENTQ;
@@ -21,10 +21,15 @@
 #include <errno.h>
 #include <limits.h>
 
+#if !defined(_WIN32)
+#   include <sys/uio.h>
+#endif
+
 #include "dbDefs.h"
 #include "epicsSignal.h"
 #include "epicsTime.h"
 #include "errlog.h"
+#include "freeList.h"
 #include "osiSock.h"
 
 #include "caerr.h"
@@ -33,6 +38,299 @@
 #define epicsExportSharedSymbols
 #include "server.h"
 
+/*
+ * casShmSendVectored()
+ *
+ * Copy as much of the queued send buffers as fits into the shared
+ * memory ring, waiting for space only when nothing fits
+ */
+static int casShmSendVectored ( struct client *pclient )
+{
+    unsigned nSent = 0u;
+    unsigned attempt;
+
+    for ( attempt = 0u; ! nSent; attempt++ ) {
+        unsigned i;
+        for ( i = 0u; i <= pclient->nSendChain; i++ ) {
+            char *pBuf;
+            unsigned nBytes, n;
+            if ( i < pclient->nSendChain ) {
+                pBuf = pclient->sendChain[i].buf;
+                nBytes = pclient->sendChain[i].stk;
+            }
+            else {
+                pBuf = &pclient->send.buf[pclient->send.cnt];
+                nBytes = pclient->send.stk - pclient->send.cnt;
+            }
+            n = caShmTransportSend ( pclient->pShm, pBuf, nBytes );
+            nSent += n;
+            if ( n < nBytes ) {
+                break;
+            }
+        }
+        if ( nSent ) {
+            break;
+        }
+        if ( pclient->disconnect ) {
+            return -1;
+        }
+#ifdef MSG_DONTWAIT
+        {
+            /* the ring stays full if the client went away */
+            char peek;
+            if ( recv ( pclient->sock, &peek, 1,
+                    MSG_PEEK | MSG_DONTWAIT ) == 0 ) {
+                pclient->disconnect = TRUE;
+                return -1;
+            }
+        }
+#endif
+        caShmTransportSendBackoff ( attempt );
+    }
+
+    if ( caShmTransportWakeupNeeded ( pclient->pShm ) ) {
+        /* the byte only wakes up the client, a failure
+         * here is also seen by the receive thread */
+        char doorbell = 0;
+        send ( pclient->sock, &doorbell, 1, 0 );
+    }
+    return (int) nSent;
+}
+
+/*
+ * casShmRecv()
+ *
+ * recv() replacement for a client whose requests arrive through the
+ * shared memory ring, the socket only carries wakeup bytes then
+ */
+long casShmRecv ( struct client *pclient, char *pBuf, unsigned nBytes )
+{
+    while ( TRUE ) {
+        char doorbell[64];
+        unsigned n;
+        long status;
+
+        n = caShmTransportRecv ( pclient->pShm, pBuf, nBytes );
+        if ( n ) {
+            return (long) n;
+        }
+        if ( caShmTransportRecvWaitBegin ( pclient->pShm ) ) {
+            continue;
+        }
+        status = recv ( pclient->sock, doorbell, sizeof ( doorbell ), 0 );
+        caShmTransportRecvWaitEnd ( pclient->pShm );
+        if ( status <= 0 ) {
+            return status;
+        }
+    }
+}
+
+/*
+ * casSendVectored()
+ *
+ * Send the queued send buffers followed by the current one
+ * with a single system call.
+ */
+static int casSendVectored ( struct client *pclient )
+{
+    unsigned n = pclient->nSendChain;
+    unsigned i;
+#if defined(_WIN32)
+    WSABUF iov[CAS_SEND_CHAIN_MAX + CAS_SEND_CHAIN_SPARE + 1];
+    DWORD nSent;
+#else
+    struct iovec iov[CAS_SEND_CHAIN_MAX + CAS_SEND_CHAIN_SPARE + 1];
+    struct msghdr msg;
+#endif
+
+    if ( pclient->shmSendActive ) {
+        return casShmSendVectored ( pclient );
+    }
+
+    if ( n == 0u ) {
+        return send ( pclient->sock, &pclient->send.buf[pclient->send.cnt],
+            pclient->send.stk - pclient->send.cnt, 0 );
+    }
+
+#if defined(_WIN32)
+    for ( i = 0u; i < n; i++ ) {
+        iov[i].buf = pclient->sendChain[i].buf;
+        iov[i].len = pclient->sendChain[i].stk;
+    }
+    if ( pclient->send.stk ) {
+        iov[n].buf = &pclient->send.buf[pclient->send.cnt];
+        iov[n].len = pclient->send.stk - pclient->send.cnt;
+        n++;
+    }
+    if ( WSASend ( pclient->sock, iov, n, &nSent, 0, NULL, NULL ) ) {
+        return -1;
+    }
+    return (int) nSent;
+#else
+    for ( i = 0u; i < n; i++ ) {
+        iov[i].iov_base = pclient->sendChain[i].buf;
+        iov[i].iov_len = pclient->sendChain[i].stk;
+    }
+    if ( pclient->send.stk ) {
+        iov[n].iov_base = &pclient->send.buf[pclient->send.cnt];
+        iov[n].iov_len = pclient->send.stk - pclient->send.cnt;
+        n++;
+    }
+    memset ( &msg, 0, sizeof ( msg ) );
+    msg.msg_iov = iov;
+    msg.msg_iovlen = n;
+    return (int) sendmsg ( pclient->sock, &msg, 0 );
+#endif
+}
+
+static void casFreeSendSegment ( struct send_segment *pSeg )
+{
+    if ( pSeg->fromHeap ) {
+        free ( pSeg->buf );
+    }
+    else {
+        freeListFree ( rsrvSmallBufFreeListTCP, pSeg->buf );
+    }
+}
+
+/*
+ * casSendComplete()
+ *
+ * Remove sent bytes from the queued send buffers and then from
+ * the current one.  Returns TRUE when nothing is left to send.
+ * The current buffer is only compacted when room is needed, so
+ * that the rest of a large array is not moved after each partial
+ * send, cf. casCompactSendBuffer()
+ */
+static int casSendComplete ( struct client *pclient, unsigned transferSize )
+{
+    unsigned i = 0u;
+
+    while ( i < pclient->nSendChain &&
+            transferSize >= pclient->sendChain[i].stk ) {
+        transferSize -= pclient->sendChain[i].stk;
+        casFreeSendSegment ( &pclient->sendChain[i] );
+        i++;
+    }
+    if ( i ) {
+        pclient->nSendChain -= i;
+        memmove ( pclient->sendChain, &pclient->sendChain[i],
+            pclient->nSendChain * sizeof ( pclient->sendChain[0] ) );
+    }
+
+    if ( pclient->nSendChain ) {
+        struct send_segment *pSeg = &pclient->sendChain[0];
+        if ( transferSize ) {
+            pSeg->stk -= transferSize;
+            memmove ( pSeg->buf, &pSeg->buf[transferSize], pSeg->stk );
+        }
+        return FALSE;
+    }
+
+    if ( transferSize >= pclient->send.stk - pclient->send.cnt ) {
+        pclient->send.stk = 0u;
+        pclient->send.cnt = 0u;
+        return TRUE;
+    }
+    else {
+        pclient->send.cnt += transferSize;
+        return FALSE;
+    }
+}
+
+/*
+ * casCompactSendBuffer()
+ *
+ * Move the unsent bytes to the start of the current send buffer
+ */
+static void casCompactSendBuffer ( struct client *pclient )
+{
+    if ( pclient->send.cnt ) {
+        unsigned bytesLeft = pclient->send.stk - pclient->send.cnt;
+        memmove ( pclient->send.buf, &pclient->send.buf[pclient->send.cnt],
+            bytesLeft );
+        pclient->send.stk = bytesLeft;
+        pclient->send.cnt = 0u;
+    }
+}
+
+/*
+ * casChainSendBuffer()
+ *
+ * Instead of flushing a full small send buffer, queue it and
+ * continue in a fresh one.  Returns FALSE if the caller must flush.
+ */
+static int casChainSendBuffer ( struct client *pclient )
+{
+    struct send_segment *pSeg;
+    char *pNewBuf;
+
+    if ( pclient->send.type != mbtSmallTCP || ! pclient->send.stk ||
+            pclient->nSendChain >= CAS_SEND_CHAIN_MAX ) {
+        return FALSE;
+    }
+    pNewBuf = (char *) freeListMalloc ( rsrvSmallBufFreeListTCP );
+    if ( ! pNewBuf ) {
+        return FALSE;
+    }
+    casCompactSendBuffer ( pclient );
+    pSeg = &pclient->sendChain[pclient->nSendChain++];
+    pSeg->buf = pclient->send.buf;
+    pSeg->stk = pclient->send.stk;
+    pSeg->fromHeap = FALSE;
+    pclient->send.buf = pNewBuf;
+    pclient->send.stk = 0u;
+    return TRUE;
+}
+
+/*
+ * casOverflowSendBuffer()
+ *
+ * Queue a copy of the unsent bytes in the current send buffer, of
+ * any size, in one of the spare segments.  Returns FALSE if there
+ * is none left.
+ */
+static int casOverflowSendBuffer ( struct client *pclient )
+{
+    struct send_segment *pSeg;
+    unsigned nBytes = pclient->send.stk - pclient->send.cnt;
+    char *pNewBuf;
+
+    if ( pclient->nSendChain >= CAS_SEND_CHAIN_MAX + CAS_SEND_CHAIN_SPARE ) {
+        return FALSE;
+    }
+    pNewBuf = (char *) malloc ( nBytes );
+    if ( ! pNewBuf ) {
+        return FALSE;
+    }
+    memcpy ( pNewBuf, &pclient->send.buf[pclient->send.cnt], nBytes );
+    pSeg = &pclient->sendChain[pclient->nSendChain++];
+    pSeg->buf = pNewBuf;
+    pSeg->stk = nBytes;
+    pSeg->fromHeap = TRUE;
+    pclient->send.stk = 0u;
+    pclient->send.cnt = 0u;
+    return TRUE;
+}
+
+void casDiscardSendChain ( struct client *pclient )
+{
+    while ( pclient->nSendChain ) {
+        casFreeSendSegment ( &pclient->sendChain[--pclient->nSendChain] );
+    }
+}
+
+unsigned casSendBytesPending ( struct client *pclient )
+{
+    unsigned nBytes = pclient->send.stk - pclient->send.cnt;
+    unsigned i;
+
+    for ( i = 0u; i < pclient->nSendChain; i++ ) {
+        nBytes += pclient->sendChain[i].stk;
+    }
+    return nBytes;
+}
+
 /*
  *  cas_send_bs_msg()
  *
@@ -49,8 +347,9 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
         SEND_LOCK ( pclient );
     }
 
-    if ( CASDEBUG > 2 && pclient->send.stk ) {
-        errlogPrintf ( "CAS: Sending a message of %d bytes\n", pclient->send.stk );
+    if ( CASDEBUG > 2 && ( pclient->send.stk || pclient->nSendChain ) ) {
+        errlogPrintf ( "CAS: Sending a message of %u bytes\n",
+            casSendBytesPending ( pclient ) );
     }
 
     if ( pclient->disconnect ) {
@@ -59,26 +358,23 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
                 pclient->sock, (unsigned) pclient->addr.sin_addr.s_addr );
         }
         pclient->send.stk = 0u;
+        pclient->send.cnt = 0u;
+        casDiscardSendChain ( pclient );
         if(lock_needed)
             SEND_UNLOCK(pclient);
         return;
     }
 
-    while ( pclient->send.stk && ! pclient->disconnect ) {
-        status = send ( pclient->sock, pclient->send.buf, pclient->send.stk, 0 );
+    while ( ( pclient->send.stk || pclient->nSendChain ) &&
+            ! pclient->disconnect ) {
+        status = casSendVectored ( pclient );
         if ( status >= 0 ) {
-            unsigned transferSize = (unsigned) status;
-            if ( transferSize >= pclient->send.stk ) {
-                pclient->send.stk = 0;
+            pclient->nSendCalls++;
+            pclient->nSendBytes += (unsigned) status;
+            if ( casSendComplete ( pclient, (unsigned) status ) ) {
                 epicsTimeGetCurrent ( &pclient->time_at_last_send );
                 break;
             }
-            else {
-                unsigned bytesLeft = pclient->send.stk - transferSize;
-                memmove ( pclient->send.buf, &pclient->send.buf[transferSize], 
-                    bytesLeft );
-                pclient->send.stk = bytesLeft;
-            }
         }
         else {
             int causeWasSocketHangup = 0;
@@ -87,6 +383,7 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
 
             if ( pclient->disconnect ) {
                 pclient->send.stk = 0u;
+                pclient->send.cnt = 0u;
                 break;
             }
 
@@ -94,6 +391,12 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
                 continue;
             }
 
+            if ( anerrno == SOCK_EWOULDBLOCK && pclient->pIoThread ) {
+                /* resumed by the I/O thread once the socket is writable */
+                rsrvIoSendBlocked ( pclient );
+                break;
+            }
+
             if ( anerrno == SOCK_ENOBUFS ) {
                 errlogPrintf (
                     "CAS: Out of network buffers, retrying send in 15 seconds\n" );
@@ -119,10 +422,15 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
             }
             pclient->disconnect = TRUE;
             pclient->send.stk = 0u;
+            pclient->send.cnt = 0u;
 
             /*
              * wakeup the receive thread
              */
+            if ( pclient->pIoThread ) {
+                rsrvIoSendFailed ( pclient );
+                break;
+            }
             if ( ! causeWasSocketHangup ) {
                 enum epicsSocketSystemCallInterruptMechanismQueryInfo info  =
                     epicsSocketSystemCallInterruptMechanismQuery ();
@@ -156,7 +464,18 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
         }
     }
 
+    if ( pclient->disconnect ) {
+        casDiscardSendChain ( pclient );
+    }
+
+    if ( pclient->pIoThread &&
+            pclient->send.stk == 0u && pclient->nSendChain == 0u ) {
+        rsrvIoSendResumed ( pclient );
+    }
+
     if ( lock_needed ) {
+        /* no response is under construction, cf. cas_copy_in_header() */
+        casShrinkSendBuffer ( pclient );
         SEND_UNLOCK(pclient);
     }
 
@@ -165,6 +484,80 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
     return;
 }
 
+/*
+ *  casMakeSendRoom()
+ *
+ *  For a client of the I/O thread pool, where cas_send_bs_msg()
+ *  does not block and may leave data in the send buffer.  Grow the
+ *  buffer up to the large buffer size.  An I/O thread then queues
+ *  the unsent data in a spare segment of the send chain instead of
+ *  waiting, since camessage() parks the client's other requests
+ *  until the send drains.  Any other thread waits for the socket
+ *  without the send lock, which the I/O thread may need meanwhile.
+ *
+ *  send lock must be on while in this routine
+ */
+static void casMakeSendRoom ( struct client *pclient, unsigned msgSize )
+{
+    int onIoThread = pclient->pIoThread->tid == epicsThreadGetIdSelf ();
+
+    while ( pclient->send.stk > pclient->send.maxstk - msgSize &&
+            ! pclient->disconnect ) {
+        fd_set fds;
+        struct timeval timeout;
+
+        if ( pclient->send.cnt ) {
+            casCompactSendBuffer ( pclient );
+            continue;
+        }
+
+        if ( pclient->send.maxstk < rsrvSizeofLargeBufTCP ) {
+            unsigned maxstk = pclient->send.maxstk;
+            ca_uint32_t size = pclient->send.stk + msgSize;
+
+            if ( size > rsrvSizeofLargeBufTCP ) {
+                size = rsrvSizeofLargeBufTCP;
+            }
+            casExpandSendBuffer ( pclient, size );
+            if ( pclient->send.maxstk != maxstk ) {
+                continue;
+            }
+        }
+
+        if ( onIoThread ) {
+            if ( ! casOverflowSendBuffer ( pclient ) ) {
+                char buf[64];
+
+                ipAddrToDottedIP ( &pclient->addr, buf, sizeof(buf) );
+                errlogPrintf ( "CAS: TCP send to %s overflowed, disconnecting\n",
+                    buf );
+                pclient->disconnect = TRUE;
+            }
+            continue;
+        }
+
+        SEND_UNLOCK ( pclient );
+        if ( FD_IN_FDSET ( pclient->sock ) ) {
+            FD_ZERO ( &fds );
+            FD_SET ( pclient->sock, &fds );
+            timeout.tv_sec = 1;
+            timeout.tv_usec = 0;
+            select ( pclient->sock + 1, NULL, &fds, NULL, &timeout );
+        }
+        else {
+            epicsThreadSleep ( 0.01 );
+        }
+        SEND_LOCK ( pclient );
+        cas_send_bs_msg ( pclient, FALSE );
+    }
+
+    if ( pclient->disconnect ) {
+        pclient->send.stk = 0u;
+        pclient->send.cnt = 0u;
+        casDiscardSendChain ( pclient );
+    }
+}
+
 /*
  *  cas_send_dg_msg()
  *
@@ -204,6 +597,8 @@ void cas_send_dg_msg ( struct client * pclient )
     status = sendto ( pclient->sock, pDG, sizeDG, 0,
        (struct sockaddr *)&pclient->addr, sizeof(pclient->addr) );
     if ( status >= 0 ) {
+        pclient->nSendCalls++;
+        pclient->nSendBytes += (unsigned) status;
         if ( status >= sizeDG ) {
             epicsTimeGetCurrent ( &pclient->time_at_last_send );
         }
@@ -271,20 +666,38 @@ int cas_copy_in_header (
         msgSize += 2 * sizeof ( ca_uint32_t );
     }
 
+    casNoteMessageSize ( &pclient->send, msgSize );
+
     if ( msgSize > pclient->send.maxstk ) {
+        /*
+         * queue the responses already in the small buffer instead
+         * of copying them into the large one
+         */
+        if ( pclient->proto == IPPROTO_TCP ) {
+            casChainSendBuffer ( pclient );
+        }
         casExpandSendBuffer ( pclient, msgSize );
         if ( msgSize > pclient->send.maxstk ) {
             return ECA_TOLARGE;
         }
     }
 
+    if ( pclient->send.stk > pclient->send.maxstk - msgSize ) {
+        casCompactSendBuffer ( pclient );
+    }
     if ( pclient->send.stk > pclient->send.maxstk - msgSize ) {
         if ( pclient->disconnect ) {
-            pclient->send.stk = 0;
+            pclient->send.stk = 0u;
+            pclient->send.cnt = 0u;
         }
         else{
             if ( pclient->proto == IPPROTO_TCP) {
-                cas_send_bs_msg ( pclient, FALSE );
+                if ( ! casChainSendBuffer ( pclient ) ) {
+                    cas_send_bs_msg ( pclient, FALSE );
+                    if ( pclient->pIoThread ) {
+                        casMakeSendRoom ( pclient, msgSize );
+                    }
+                }
             }
             else if ( pclient->proto == IPPROTO_UDP ) {
                 cas_send_dg_msg ( pclient );
@@ -364,6 +777,7 @@ void cas_commit_msg ( struct client *pClient, ca_uint32_t size )
         size += sizeof ( caHdr );
     }
     pClient->send.stk += size;
+    pClient->nSendMsgs++;
 }
 
 /*
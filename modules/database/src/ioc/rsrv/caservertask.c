@@ -56,7 +56,7 @@ epicsThreadPrivateId rsrvCurrentClient;
  *  CA server task
  *
  *  Waits for connections at the CA port and spawns a task to
- *  handle each of them
+ *  handle each of them, or hands them to the I/O thread pool
  *
  */
 static void req_server (void *pParm)
@@ -117,6 +117,17 @@ static void req_server (void *pParm)
             ellAdd ( &clientQ, &pClient->node );
             UNLOCK_CLIENTQ;
 
+            if ( rsrvIoPoolSize ) {
+                if ( rsrvIoPoolAttach ( pClient ) ) {
+                    LOCK_CLIENTQ;
+                    ellDelete ( &clientQ, &pClient->node );
+                    UNLOCK_CLIENTQ;
+                    destroy_tcp_client ( pClient );
+                    epicsThreadSleep ( 15.0 );
+                }
+                continue;
+            }
+
             id = epicsThreadCreate ( "CAS-client", epicsThreadPriorityCAServerLow,
                     epicsThreadGetStackSize ( epicsThreadStackBig ),
                     camsgtask, pClient );
@@ -489,6 +500,7 @@ void rsrv_init (void)
     freeListInitPvt ( &rsrvChanFreeList, sizeof(struct channel_in_use), 512 );
     freeListInitPvt ( &rsrvEventFreeList, sizeof(struct event_ext), 512 );
     freeListInitPvt ( &rsrvSmallBufFreeListTCP, MAX_TCP, 16 );
+    freeListSetThreadCache ( rsrvSmallBufFreeListTCP, 2 );
     initializePutNotifyFreeList ();
 
     epicsSignalInstallSigPipeIgnore ();
@@ -545,6 +557,9 @@ void rsrv_init (void)
         freeListInitPvt ( &rsrvLargeBufFreeListTCP, rsrvSizeofLargeBufTCP, 1 );
     else
         rsrvLargeBufFreeListTCP = NULL;
+
+    if(envGetBoolConfigParam(&EPICS_CAS_SHM_TRANSPORT, &rsrvShmTransport))
+        rsrvShmTransport = 1;
     pCaBucket = bucketCreate(CAS_HASH_TABLE_SIZE);
     if (!pCaBucket)
         cantProceed("RSRV failed to allocate ID lookup table\n");
@@ -581,6 +596,9 @@ void rsrv_init (void)
         }
     }
 
+    /* before any TCP client is accepted */
+    rsrvIoPoolInit ();
+
     {
         unsigned short sport = ca_server_port;
         socks = rsrv_grab_tcp(&sport);
@@ -860,20 +878,32 @@ static void log_one_client (struct client *client, unsigned level)
         send_delay = epicsTimeDiffInSeconds(&current,&client->time_at_last_send);
         recv_delay = epicsTimeDiffInSeconds(&current,&client->time_at_last_recv);
 
-        printf ("\tTask Id = %p, Socket FD = %d\n",
-            (void *) client->tid, (int)client->sock);
+        if ( client->pIoThread ) {
+            printf ("\tI/O thread = %s, Socket FD = %d\n",
+                client->pIoThread->name, (int)client->sock);
+        }
+        else {
+            printf ("\tTask Id = %p, Socket FD = %d\n",
+                (void *) client->tid, (int)client->sock);
+        }
         printf(
         "\t%.2f secs since last send, %.2f secs since last receive\n",
             send_delay, recv_delay);
         printf(
         "\tUnprocessed request bytes = %u, Undelivered response bytes = %u\n",
             client->recv.cnt - client->recv.stk,
-            client->send.stk );
+            casSendBytesPending ( client ) );
         printf(
-        "\tState = %s%s%s\n",
+        "\tSent %lu messages, %.0f bytes in %lu system calls\n",
+            client->nSendMsgs, (double) client->nSendBytes,
+            client->nSendCalls );
+        printf(
+        "\tState = %s%s%s%s%s\n",
             state[client->disconnect?1:0],
             client->send.type == mbtLargeTCP ? " jumbo-send-buf" : "",
-            client->recv.type == mbtLargeTCP ? " jumbo-recv-buf" : "");
+            client->recv.type == mbtLargeTCP ? " jumbo-recv-buf" : "",
+            client->sendBlocked ? " send-blocked" : "",
+            client->shmSendActive ? " shared-memory" : "");
     }
 
     if ( level >= 1u ) {
@@ -970,6 +1000,8 @@ void casr (unsigned level)
 
             iface = (rsrv_iface_config *) ellNext(&iface->node);
         }
+
+        rsrvIoPoolShow ( level - 1 );
     }
 
     if (level>=1) {
@@ -1070,6 +1102,8 @@ void destroy_client ( struct client *client )
     }
 
     if ( client->proto == IPPROTO_TCP ) {
+        caShmTransportDestroy ( client->pShm );
+        casDiscardSendChain ( client );
         if ( client->send.buf ) {
             if ( client->send.type == mbtSmallTCP ) {
                 freeListFree ( rsrvSmallBufFreeListTCP,  client->send.buf );
@@ -1304,6 +1338,10 @@ struct client * create_client ( SOCKET sock, int proto )
     client->send.cnt = 0u;
     client->recv.stk = 0u;
     client->recv.cnt = 0u;
+    client->send.nSmall = 0u;
+    client->send.lastLarge = 0u;
+    client->recv.nSmall = 0u;
+    client->recv.lastLarge = 0u;
     client->evuser = NULL;
     client->priority = CA_PROTO_PRIORITY_MIN;
     client->disconnect = FALSE;
@@ -1311,6 +1349,16 @@ struct client * create_client ( SOCKET sock, int proto )
     epicsTimeGetCurrent ( &client->time_at_last_recv );
     client->minor_version_number = CA_UKN_MINOR_VERSION;
     client->recvBytesToDrain = 0u;
+    client->pIoThread = NULL;
+    client->ioParked = FALSE;
+    client->sendBlocked = FALSE;
+    client->nSendChain = 0u;
+    client->nSendMsgs = 0u;
+    client->nSendCalls = 0u;
+    client->nSendBytes = 0u;
+    client->pShm = NULL;
+    client->shmRecvActive = FALSE;
+    client->shmSendActive = FALSE;
 
     return client;
 }
@@ -1351,7 +1399,8 @@ void casExpandBuffer ( struct message_buffer *buf, ca_uint32_t size, int sendbuf
         newsize = size;
 
     } else if (size <= rsrvSizeofLargeBufTCP) {
-        newbuf = freeListCalloc ( rsrvLargeBufFreeListTCP );
+        /* as with malloc() above, every byte is written before it is used */
+        newbuf = freeListMalloc ( rsrvLargeBufFreeListTCP );
         newsize = rsrvSizeofLargeBufTCP;
         newtype = mbtLargeTCP;
     }
@@ -1359,20 +1408,31 @@ void casExpandBuffer ( struct message_buffer *buf, ca_uint32_t size, int sendbuf
     if (newbuf) {
         /* copy existing buffer */
         if (sendbuf) {
-            /* send buffer uses [0, stk) */
-            if (!rsrvLargeBufFreeListTCP && buf->type==mbtLargeTCP) {
-                /* realloc already copied */
-            } else {
-                memcpy ( newbuf, buf->buf, buf->stk );
-            }
+            /* send buffer uses [cnt, stk) */
+            unsigned used;
+            char *oldbuf = buf->buf;
+            assert ( buf->stk >= buf->cnt );
+            used = buf->stk - buf->cnt;
+
+            /* realloc() already copied, and may have freed buf->buf */
+            if (!rsrvLargeBufFreeListTCP && buf->type==mbtLargeTCP)
+                oldbuf = newbuf;
+            memmove ( newbuf, &oldbuf[buf->cnt], used );
+
+            buf->stk = used;
+            buf->cnt = 0;
+
         } else {
             /* recv buffer uses [stk, cnt) */
             unsigned used;
+            char *oldbuf = buf->buf;
             assert ( buf->cnt >= buf->stk );
             used = buf->cnt - buf->stk;
 
-            /* buf->buf may be the same as newbuf if realloc() used */
-            memmove ( newbuf, &buf->buf[buf->stk], used );
+            /* realloc() already copied, and may have freed buf->buf */
+            if (!rsrvLargeBufFreeListTCP && buf->type==mbtLargeTCP)
+                oldbuf = newbuf;
+            memmove ( newbuf, &oldbuf[buf->stk], used );
 
             buf->cnt = used;
             buf->stk = 0;
@@ -1391,6 +1451,8 @@ void casExpandBuffer ( struct message_buffer *buf, ca_uint32_t size, int sendbuf
         buf->buf = newbuf;
         buf->type = newtype;
         buf->maxstk = newsize;
+        buf->nSmall = 0u;
+        buf->lastLarge = epicsMonotonicGet ();
     }
 }
 
@@ -1404,6 +1466,76 @@ void casExpandRecvBuffer ( struct client *pClient, ca_uint32_t size )
     casExpandBuffer (&pClient->recv, size, 0);
 }
 
+/*
+ * A large buffer is kept until this many small messages have passed
+ * through it, or this long after the last large one, so that a client
+ * which keeps getting large monitor updates doesn't free and allocate
+ * EPICS_CA_MAX_ARRAY_BYTES for each of them
+ */
+#define CAS_SHRINK_SMALL_MSGS 64u
+#define CAS_SHRINK_IDLE_NS 2000000000ull
+
+/* count a message sent or received through the buffer */
+void casNoteMessageSize ( struct message_buffer *buf, unsigned msgSize )
+{
+    if ( msgSize > MAX_TCP ) {
+        buf->nSmall = 0u;
+        buf->lastLarge = epicsMonotonicGet ();
+    }
+    else if ( buf->nSmall < UINT_MAX ) {
+        buf->nSmall++;
+    }
+}
+
+/*
+ * Return an empty large buffer and continue with a small one, so
+ * that a client only holds EPICS_CA_MAX_ARRAY_BYTES while it is
+ * sending or receiving large messages
+ */
+static void casShrinkBuffer ( struct message_buffer *buf )
+{
+    char *newbuf;
+
+    if ( buf->type != mbtLargeTCP ) return;
+
+    /* never while the last message was a large one */
+    if ( buf->nSmall == 0u ) return;
+    if ( buf->nSmall < CAS_SHRINK_SMALL_MSGS &&
+            epicsMonotonicGet () - buf->lastLarge < CAS_SHRINK_IDLE_NS ) {
+        return;
+    }
+
+    newbuf = freeListMalloc ( rsrvSmallBufFreeListTCP );
+    if ( ! newbuf ) return; /* keep the large one */
+
+    if ( rsrvLargeBufFreeListTCP ) {
+        freeListFree ( rsrvLargeBufFreeListTCP, buf->buf );
+    } else {
+        free ( buf->buf );
+    }
+    buf->buf = newbuf;
+    buf->type = mbtSmallTCP;
+    buf->maxstk = MAX_TCP;
+    buf->stk = 0;
+    buf->cnt = 0;
+}
+
+/* send lock must be on, and no response under construction */
+void casShrinkSendBuffer ( struct client *pClient )
+{
+    if ( pClient->send.stk == 0u && pClient->nSendChain == 0u ) {
+        casShrinkBuffer ( &pClient->send );
+    }
+}
+
+/* only by the thread receiving for the client */
+void casShrinkRecvBuffer ( struct client *pClient )
+{
+    if ( pClient->recv.cnt == 0u ) {
+        casShrinkBuffer ( &pClient->recv );
+    }
+}
+
 /*
  *  create_tcp_client ()
  */
@@ -33,4 +33,5 @@ void rsrvRegistrar(void)
 }
 
 epicsExportAddress(int, CASDEBUG);
+epicsExportAddress(int, rsrvIoThreads);
 epicsExportRegistrar(rsrvRegistrar);
@@ -27,12 +27,13 @@
 #include "asLib.h"
 #include "dbChannel.h"
 #include "dbNotify.h"
-#define CA_MINOR_PROTOCOL_REVISION 13
+#define CA_MINOR_PROTOCOL_REVISION 14
 #include "caProto.h"
 #include "ellLib.h"
 #include "epicsTime.h"
 #include "epicsAssert.h"
 #include "osiSock.h"
+#include "caShmTransport.h"
 
 #ifdef rsrvRestore_epicsExportSharedSymbols
 #define epicsExportSharedSymbols
@@ -63,16 +64,39 @@ typedef struct caHdrLargeArray {
 enum messageBufferType { mbtUDP, mbtSmallTCP, mbtLargeTCP };
 struct message_buffer {
   char                      *buf;
-  /*! points to first filled byte in buffer */
+  /*! points to first filled byte in buffer
+   * (send buffer: first unused byte) */
   unsigned                  stk;
   unsigned                  maxstk;
-  /*! points to first unused byte in buffer (after filled bytes) */
+  /*! points to first unused byte in buffer (after filled bytes)
+   * (send buffer: first byte not yet sent) */
   unsigned                  cnt;
   enum messageBufferType    type;
+  /*! messages of at most MAX_TCP bytes since the last larger one */
+  unsigned                  nSmall;
+  /*! epicsMonotonicGet() when the last larger message was seen */
+  epicsUInt64               lastLarge;
+};
+
+/*
+ * Filled small TCP send buffers are queued ahead of client::send,
+ * instead of being flushed one at a time, so that a burst of
+ * responses goes out with one vectored send, cf. cas_send_bs_msg()
+ */
+#define CAS_SEND_CHAIN_MAX 8
+/* extra segments only queued by an I/O thread, cf. casMakeSendRoom() */
+#define CAS_SEND_CHAIN_SPARE 2
+
+struct send_segment {
+  char                      *buf;
+  unsigned                  stk;
+  char                      fromHeap; /* malloc()ed, else a small buffer */
 };
 
 extern epicsThreadPrivateId rsrvCurrentClient;
 
+struct rsrv_io_thread;
+
 typedef struct client {
   ELLNODE               node;
   /*! guarded by SEND_LOCK()  aka. client::lock */
@@ -101,6 +125,25 @@ typedef struct client {
   unsigned              recvBytesToDrain;
   unsigned              priority;
   char                  disconnect; /* disconnect detected */
+  /* I/O thread pool mode only, cf. camsgpool.c */
+  struct rsrv_io_thread *pIoThread; /* NULL when served by camsgtask() */
+  struct client         *pNextPending; /* guarded by rsrv_io_thread::lock */
+  unsigned              ioRequests; /* guarded by rsrv_io_thread::lock */
+  char                  ioReadArmed; /* accessed only by the I/O thread */
+  char                  ioWriteArmed; /* accessed only by the I/O thread */
+  char                  ioParked; /* accessed only by the I/O thread */
+  char                  sendBlocked; /* guarded by SEND_LOCK() */
+  /*! guarded by SEND_LOCK(), sent before send */
+  struct send_segment   sendChain[CAS_SEND_CHAIN_MAX + CAS_SEND_CHAIN_SPARE];
+  unsigned              nSendChain;
+  /* send statistics, guarded by SEND_LOCK() */
+  unsigned long         nSendMsgs;
+  unsigned long         nSendCalls;
+  epicsUInt64           nSendBytes;
+  /* same host shared memory transport, cf. caShmTransport.h */
+  caShmTransportId      pShm;
+  char                  shmRecvActive; /* accessed only by camsgtask() */
+  char                  shmSendActive; /* guarded by SEND_LOCK() */
 } client;
 
 /* Channel state shows which struct client list a
@@ -166,6 +209,27 @@ typedef struct {
     unsigned int startbcast:1;
 } rsrv_iface_config;
 
+/*
+ * A thread which multiplexes many TCP client circuits
+ * with non-blocking sockets (rsrvIoThreads > 0)
+ */
+typedef struct rsrv_io_thread {
+    epicsThreadId tid;
+    epicsMutexId lock;
+    struct client *pPending; /* clients with ioRequests, guarded by lock */
+    int wakeupPending; /* guarded by lock */
+    void *pfdctx;
+    SOCKET wakeupSock;
+    osiSockAddr wakeupAddr;
+    int nClients; /* epicsAtomic */
+    /* statistics, written only by the I/O thread */
+    unsigned long nRecv;
+    unsigned long nBytesRecv;
+    epicsUInt64 busyNS;
+    epicsUInt64 startNS;
+    char name[16];
+} rsrv_io_thread;
+
 enum ctl {ctlInit, ctlRun, ctlPause, ctlExit};
 
 /*  NOTE: external used so they remember the state across loads */
@@ -188,6 +252,10 @@ enum ctl {ctlInit, ctlRun, ctlPause, ctlExit};
 #endif
 
 GLBLTYPE int                CASDEBUG;
+GLBLTYPE int                rsrvIoThreads;
+GLBLTYPE int                rsrvShmTransport;
+GLBLTYPE rsrv_io_thread     *rsrvIoPool;
+GLBLTYPE unsigned           rsrvIoPoolSize;
 GLBLTYPE unsigned short     ca_server_port, ca_udp_port, ca_beacon_port;
 GLBLTYPE ELLLIST            clientQ             GLBLTYPE_INIT(ELLLIST_INIT);
 GLBLTYPE ELLLIST            servers; /* rsrv_iface_config::node, read-only after rsrv_init() */
@@ -224,6 +292,15 @@ GLBLTYPE unsigned int       threadPrios[5];
 #define UNLOCK_CLIENTQ  epicsMutexUnlock (clientQlock);
 
 void camsgtask (void *client);
+int camsgReceived ( struct client *client, long nchars, int anerrno );
+int camsgProcess ( struct client *client );
+void rsrvIoPoolInit ( void );
+int rsrvIoPoolAttach ( struct client *client );
+void rsrvIoSendBlocked ( struct client *client );
+void rsrvIoSendResumed ( struct client *client );
+void rsrvIoSendFailed ( struct client *client );
+void rsrvIoResume ( struct client *client );
+void rsrvIoPoolShow ( unsigned level );
 void cas_send_bs_msg ( struct client *pclient, int lock_needed );
 void cas_send_dg_msg ( struct client *pclient );
 void rsrv_online_notify_task (void *);
@@ -251,6 +328,12 @@ void casExpandRecvBuffer ( struct client *pClient, ca_uint32_t size );
  * outgoing protocol maintenance
  */
 void casExpandSendBuffer ( struct client *pClient, ca_uint32_t size );
+void casShrinkRecvBuffer ( struct client *pClient );
+void casShrinkSendBuffer ( struct client *pClient );
+void casNoteMessageSize ( struct message_buffer *buf, unsigned msgSize );
+void casDiscardSendChain ( struct client *pClient );
+unsigned casSendBytesPending ( struct client *pClient );
+long casShmRecv ( struct client *pClient, char *pBuf, unsigned nBytes );
 int cas_copy_in_header (
     struct client *pClient, ca_uint16_t response, ca_uint32_t payloadSize,
     ca_uint16_t dataType, ca_uint32_t nElem, ca_uint32_t cid,
@@ -0,0 +1,132 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *   Device support for the IOC log client's statistics
+ *
+ *   The INP field is "@<item>", which selects the value. The records
+ *   are INVALID until iocLogInit() has started the log client.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "alarm.h"
+#include "dbDefs.h"
+#include "dbAccess.h"
+#include "logClient.h"
+#include "recGbl.h"
+#include "devSup.h"
+#include "epicsString.h"
+
+#include "biRecord.h"
+#include "longinRecord.h"
+#include "epicsExport.h"
+
+static long parseLink(dbCommon *prec, DBLINK *plink,
+    const char * const *items, int nItems, const char *func)
+{
+    int i;
+
+    if (plink->type == INST_IO) {
+        for (i = 0; i < nItems; i++) {
+            if (!epicsStrCaseCmp(plink->value.instio.string, items[i])) {
+                prec->dpvt = (void *)&items[i];
+                return 0;
+            }
+        }
+    }
+
+    prec->dpvt = NULL;
+    recGblRecordError(S_db_badField, (void *)prec, func);
+    prec->pact = TRUE;
+    return S_db_badField;
+}
+
+static long getStats(dbCommon *prec, logClientStats *pstats)
+{
+    if (!prec->dpvt) return -1;
+
+    if (iocLogGetStats(pstats)) {
+        recGblSetSevr(prec, READ_ALARM, INVALID_ALARM);
+        return -1;
+    }
+    return 0;
+}
+
+
+/********* bi record **********/
+static const char * const bi_items[] = {
+    "CONNECTED"
+};
+
+static long init_bi(biRecord *prec)
+{
+    return parseLink((dbCommon *)prec, &prec->inp, bi_items,
+        NELEMENTS(bi_items), "devBiLogClientStats::init_bi: Bad INP field");
+}
+
+static long read_bi(biRecord *prec)
+{
+    logClientStats stats;
+
+    if (getStats((dbCommon *)prec, &stats))
+        return -1;
+
+    prec->rval = stats.connected != 0;
+    prec->udf = FALSE;
+    return 0;
+}
+
+struct {
+    dset common;
+    DEVSUPFUN read_write;
+} devBiLogClientStats = {
+    {5, NULL, NULL, init_bi, NULL}, read_bi
+};
+epicsExportAddress(dset, devBiLogClientStats);
+
+
+/******* longin record *************/
+enum {liQueued, liSent, liDropped, liReconnects, liPending};
+
+static const char * const li_items[] = {
+    "QUEUED", "SENT", "DROPPED", "RECONNECTS", "PENDING"
+};
+
+static long init_li(longinRecord *prec)
+{
+    return parseLink((dbCommon *)prec, &prec->inp, li_items,
+        NELEMENTS(li_items), "devLiLogClientStats::init_li: Bad INP field");
+}
+
+static long read_li(longinRecord *prec)
+{
+    logClientStats stats;
+    unsigned long val = 0;
+
+    if (getStats((dbCommon *)prec, &stats))
+        return -1;
+
+    switch ((const char * const *)prec->dpvt - li_items) {
+    case liQueued:     val = stats.queued; break;
+    case liSent:       val = stats.sent; break;
+    case liDropped:    val = stats.dropped; break;
+    case liReconnects: val = stats.reconnects; break;
+    case liPending:    val = stats.pending; break;
+    }
+    prec->val = (epicsInt32)val;
+    prec->udf = FALSE;
+    return 0;
+}
+
+struct {
+    dset common;
+    DEVSUPFUN read_write;
+} devLiLogClientStats = {
+    {5, NULL, NULL, init_li, NULL}, read_li
+};
+epicsExportAddress(dset, devLiLogClientStats);
@@ -0,0 +1,268 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *   Device support for periodic scan timing statistics
+ *
+ *   The INP or OUT field is "@<scan> <item>", where <scan> is a periodic
+ *   menuScan choice such as ".1 second" and <item> selects the value.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "alarm.h"
+#include "dbDefs.h"
+#include "dbAccess.h"
+#include "dbEvent.h"
+#include "dbScan.h"
+#include "dbStaticLib.h"
+#include "recGbl.h"
+#include "devSup.h"
+#include "epicsString.h"
+#include "menuFtype.h"
+
+#include "aiRecord.h"
+#include "boRecord.h"
+#include "longinRecord.h"
+#include "waveformRecord.h"
+#include "epicsExport.h"
+
+typedef struct scanStatsPvt {
+    int scan;   /* menuScan index */
+    int item;
+} scanStatsPvt;
+
+static long parseLink(dbCommon *prec, DBLINK *plink,
+    const char * const *items, int nItems, const char *func)
+{
+    dbMenu *pmenu = dbFindMenu(pdbbase, "menuScan");
+    scanStatsPvt *pvt;
+    char *parm, *item;
+    int scan, i;
+
+    prec->dpvt = NULL;
+    if (plink->type != INST_IO || !pmenu) {
+        recGblRecordError(S_db_badField, (void *)prec, func);
+        prec->pact = TRUE;
+        return S_db_badField;
+    }
+
+    parm = epicsStrDup(plink->value.instio.string);
+    item = strrchr(parm, ' ');
+    if (!item)
+        goto bad;
+    *item++ = '\0';
+
+    for (scan = SCAN_1ST_PERIODIC; scan < pmenu->nChoice; scan++) {
+        if (!epicsStrCaseCmp(parm, pmenu->papChoiceValue[scan]))
+            break;
+    }
+    if (scan >= pmenu->nChoice)
+        goto bad;
+
+    for (i = 0; i < nItems; i++) {
+        if (!epicsStrCaseCmp(item, items[i])) {
+            pvt = dbCalloc(1, sizeof(scanStatsPvt));
+            pvt->scan = scan;
+            pvt->item = i;
+            prec->dpvt = pvt;
+            free(parm);
+            return 0;
+        }
+    }
+
+bad:
+    free(parm);
+    recGblRecordError(S_db_badField, (void *)prec, func);
+    prec->pact = TRUE;
+    return S_db_badField;
+}
+
+static long getStats(dbCommon *prec, scanPeriodicStats *pstats)
+{
+    scanStatsPvt *pvt = (scanStatsPvt *)prec->dpvt;
+
+    if (!pvt) return -1;
+
+    if (scanPeriodicStatus(pvt->scan, 0, pstats)) {
+        recGblSetSevr(prec, READ_ALARM, INVALID_ALARM);
+        return -1;
+    }
+    return 0;
+}
+
+
+/********* ai record **********/
+enum {aiLast, aiMean, aiMax, aiJitter, aiJitterMax, aiLoad};
+
+static const char * const ai_items[] = {
+    "LAST", "MEAN", "MAX", "JITTER", "JITMAX", "LOAD"
+};
+
+static long init_ai(aiRecord *prec)
+{
+    return parseLink((dbCommon *)prec, &prec->inp, ai_items,
+        NELEMENTS(ai_items), "devAiScanStats::init_ai: Bad INP field");
+}
+
+static long read_ai(aiRecord *prec)
+{
+    scanPeriodicStats stats;
+
+    if (getStats((dbCommon *)prec, &stats))
+        return -1;
+
+    switch (((scanStatsPvt *)prec->dpvt)->item) {
+    case aiLast:      prec->val = stats.lastTime; break;
+    case aiMean:      prec->val = stats.meanTime; break;
+    case aiMax:       prec->val = stats.maxTime; break;
+    case aiJitter:    prec->val = stats.lastJitter; break;
+    case aiJitterMax: prec->val = stats.maxJitter; break;
+    case aiLoad:      prec->val = stats.meanTime / stats.period * 100.0; break;
+    }
+    prec->udf = FALSE;
+    return 2;
+}
+
+struct {
+    dset common;
+    DEVSUPFUN read_write;
+    DEVSUPFUN special_linconv;
+} devAiScanStats = {
+    {6, NULL, NULL, init_ai, NULL}, read_ai,  NULL
+};
+epicsExportAddress(dset, devAiScanStats);
+
+
+/********* bo record **********/
+static const char * const bo_items[] = {
+    "RESET"
+};
+
+static long init_bo(boRecord *prec)
+{
+    long status = parseLink((dbCommon *)prec, &prec->out, bo_items,
+        NELEMENTS(bo_items), "devBoScanStats::init_bo: Bad OUT field");
+
+    if (status)
+        return status;
+    prec->mask = 0;
+    return 2;
+}
+
+static long write_bo(boRecord *prec)
+{
+    scanStatsPvt *pvt = (scanStatsPvt *)prec->dpvt;
+
+    if (!pvt) return -1;
+
+    scanPeriodicStatus(pvt->scan, 1, NULL);
+    return 0;
+}
+
+struct {
+    dset common;
+    DEVSUPFUN read_write;
+} devBoScanStats = {
+    {5, NULL, NULL, init_bo, NULL}, write_bo
+};
+epicsExportAddress(dset, devBoScanStats);
+
+
+/******* longin record *************/
+enum {liScans, liOverruns};
+
+static const char * const li_items[] = {
+    "SCANS", "OVERRUNS"
+};
+
+static long init_li(longinRecord *prec)
+{
+    return parseLink((dbCommon *)prec, &prec->inp, li_items,
+        NELEMENTS(li_items), "devLiScanStats::init_li: Bad INP field");
+}
+
+static long read_li(longinRecord *prec)
+{
+    scanPeriodicStats stats;
+
+    if (getStats((dbCommon *)prec, &stats))
+        return -1;
+
+    switch (((scanStatsPvt *)prec->dpvt)->item) {
+    case liScans:    prec->val = (epicsInt32)stats.cycles; break;
+    case liOverruns: prec->val = (epicsInt32)stats.overruns; break;
+    }
+    prec->udf = FALSE;
+    return 0;
+}
+
+struct {
+    dset common;
+    DEVSUPFUN read_write;
+} devLiScanStats = {
+    {5, NULL, NULL, init_li, NULL}, read_li
+};
+epicsExportAddress(dset, devLiScanStats);
+
+
+/********* waveform record **********/
+enum {wfTimeHist, wfJitterHist};
+
+static const char * const wf_items[] = {
+    "TIMEHIST", "JITTERHIST"
+};
+
+static long init_wf(waveformRecord *prec)
+{
+    if (prec->ftvl != menuFtypeLONG &&
+        prec->ftvl != menuFtypeULONG &&
+        prec->ftvl != menuFtypeDOUBLE) {
+        recGblRecordError(S_db_badField, (void *)prec,
+            "devWfScanStats::init_wf: FTVL must be LONG, ULONG or DOUBLE");
+        prec->pact = TRUE;
+        return S_db_badField;
+    }
+    return parseLink((dbCommon *)prec, &prec->inp, wf_items,
+        NELEMENTS(wf_items), "devWfScanStats::init_wf: Bad INP field");
+}
+
+static long read_wf(waveformRecord *prec)
+{
+    scanPeriodicStats stats;
+    unsigned long *hist;
+    epicsUInt32 nord = prec->nord;
+    epicsUInt32 i, n = prec->nelm;
+
+    if (getStats((dbCommon *)prec, &stats))
+        return -1;
+
+    hist = ((scanStatsPvt *)prec->dpvt)->item == wfTimeHist ?
+        stats.timeHist : stats.jitterHist;
+    if (n > SCAN_HIST_BINS)
+        n = SCAN_HIST_BINS;
+
+    for (i = 0; i < n; i++) {
+        if (prec->ftvl == menuFtypeDOUBLE)
+            ((epicsFloat64 *)prec->bptr)[i] = hist[i];
+        else
+            ((epicsUInt32 *)prec->bptr)[i] = (epicsUInt32)hist[i];
+    }
+    prec->nord = n;
+    if (nord != prec->nord)
+        db_post_events(prec, &prec->nord, DBE_VALUE | DBE_LOG);
+    prec->udf = FALSE;
+    return 0;
+}
+
+struct {
+    dset common;
+    DEVSUPFUN read_write;
+} devWfScanStats = {
+    {5, NULL, NULL, init_wf, NULL}, read_wf
+};
+epicsExportAddress(dset, devWfScanStats);
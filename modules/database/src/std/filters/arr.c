@@ -148,6 +148,12 @@ static db_field_log* filter(void* pvt, dbChannel *chan, db_field_log *pfl)
         pdst = NULL;
         nSource = pfl->no_elements;
         nTarget = wrapArrayIndices(&start, my->incr, &end, nSource);
+        if (nTarget && my->incr == 1 && dbChannelIsArraySnapshot(pfl)) {
+            /* Contiguous slice of a shared snapshot, no need to copy */
+            pfl->u.r.field = (char *) pfl->u.r.field + start * pfl->field_size;
+            pfl->no_elements = nTarget;
+            break;
+        }
         pfl->no_elements = nTarget;
         if (nTarget) {
             /* Copy the data out */
@@ -165,6 +171,9 @@ static db_field_log* filter(void* pvt, dbChannel *chan, db_field_log *pfl)
             pfl->u.r.pvt = my->arrayFreeList;
             pfl->u.r.field = pdst;
         }
+        else {
+            pfl->u.r.dtor = NULL;
+        }
         break;
     }
     return pfl;
@@ -0,0 +1,576 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/* lnkACalc.c */
+
+/*  Usage
+ *      {acalc:{expr:"A*B", args:[{...}, ...], units:"mm"}}
+ *  First link in 'args' is 'A', second is 'B', and so forth.
+ *  The expression is evaluated element-wise over array arguments.
+ */
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "alarm.h"
+#include "dbDefs.h"
+#include "errlog.h"
+#include "epicsString.h"
+#include "epicsTypes.h"
+#include "dbAccessDefs.h"
+#include "dbCommon.h"
+#include "dbConvertFast.h"
+#include "dbLink.h"
+#include "dbJLink.h"
+#include "dbStaticLib.h"
+#include "dbStaticPvt.h"
+#include "postfix.h"
+#include "recGbl.h"
+#include "epicsExport.h"
+
+
+typedef long (*FASTCONVERT)();
+
+typedef struct acalc_link {
+    jlink jlink;        /* embedded object */
+    int nArgs;
+    enum {
+        ps_init,
+        ps_expr,
+        ps_args,
+        ps_prec,
+        ps_units,
+        ps_error
+    } pstate;
+    short prec;
+    char *expr;
+    char *post_expr;
+    calcCompiled *cmpl;
+    char *units;
+    struct link inp[CALCPERFORM_NARGS];
+    double *arg[CALCPERFORM_NARGS];
+    epicsUInt32 nelem[CALCPERFORM_NARGS];
+    epicsUInt32 nalloc[CALCPERFORM_NARGS];
+    double *val;
+    epicsUInt32 nval;
+    epicsUInt32 nord;
+} acalc_link;
+
+static lset lnkACalc_lset;
+
+
+/* Make sure buffer *pbuf can hold n doubles, keeping its contents */
+static int growBuffer(double **pbuf, epicsUInt32 *palloc, epicsUInt32 n)
+{
+    double *buf;
+
+    if (n <= *palloc)
+        return 0;
+
+    buf = realloc(*pbuf, n * sizeof(double));
+    if (!buf) {
+        errlogPrintf("lnkACalc: Out of memory\n");
+        return -1;
+    }
+    memset(buf + *palloc, 0, (n - *palloc) * sizeof(double));
+    *pbuf = buf;
+    *palloc = n;
+    return 0;
+}
+
+static void freeBuffers(acalc_link *clink)
+{
+    int i;
+
+    for (i = 0; i < CALCPERFORM_NARGS; i++)
+        free(clink->arg[i]);
+
+    calcFreeCompiled(clink->cmpl);
+    free(clink->expr);
+    free(clink->post_expr);
+    free(clink->units);
+    free(clink->val);
+}
+
+
+/*************************** jlif Routines **************************/
+
+static jlink* lnkACalc_alloc(short dbfType)
+{
+    acalc_link *clink;
+
+    if (dbfType != DBF_INLINK) {
+        errlogPrintf("lnkACalc: Only input links are supported\n");
+        return NULL;
+    }
+
+    clink = calloc(1, sizeof(struct acalc_link));
+    if (!clink) {
+        errlogPrintf("lnkACalc: calloc() failed.\n");
+        return NULL;
+    }
+
+    clink->nArgs = 0;
+    clink->pstate = ps_init;
+    clink->prec = 15;   /* standard value for a double */
+
+    return &clink->jlink;
+}
+
+static void lnkACalc_free(jlink *pjlink)
+{
+    acalc_link *clink = CONTAINER(pjlink, struct acalc_link, jlink);
+    int i;
+
+    for (i = 0; i < clink->nArgs; i++)
+        dbJLinkFree(clink->inp[i].value.json.jlink);
+
+    freeBuffers(clink);
+    free(clink);
+}
+
+static jlif_result addScalarArg(acalc_link *clink, double num)
+{
+    int i = clink->nArgs;
+
+    if (i == CALCPERFORM_NARGS) {
+        errlogPrintf("lnkACalc: Too many input args, limit is %d\n",
+            CALCPERFORM_NARGS);
+        return jlif_stop;
+    }
+
+    if (growBuffer(&clink->arg[i], &clink->nalloc[i], 1))
+        return jlif_stop;
+
+    clink->arg[i][0] = num;
+    clink->nelem[i] = 1;
+    clink->nArgs++;
+
+    return jlif_continue;
+}
+
+static jlif_result lnkACalc_integer(jlink *pjlink, long long num)
+{
+    acalc_link *clink = CONTAINER(pjlink, struct acalc_link, jlink);
+
+    if (clink->pstate == ps_prec) {
+        clink->prec = num;
+        return jlif_continue;
+    }
+
+    if (clink->pstate != ps_args) {
+        errlogPrintf("lnkACalc: Unexpected integer %lld\n", num);
+        return jlif_stop;
+    }
+
+    return addScalarArg(clink, num);
+}
+
+static jlif_result lnkACalc_double(jlink *pjlink, double num)
+{
+    acalc_link *clink = CONTAINER(pjlink, struct acalc_link, jlink);
+
+    if (clink->pstate != ps_args) {
+        errlogPrintf("lnkACalc: Unexpected double %g\n", num);
+        return jlif_stop;
+    }
+
+    return addScalarArg(clink, num);
+}
+
+static jlif_result lnkACalc_string(jlink *pjlink, const char *val, size_t len)
+{
+    acalc_link *clink = CONTAINER(pjlink, struct acalc_link, jlink);
+    short err;
+
+    if (clink->pstate == ps_units) {
+        clink->units = epicsStrnDup(val, len);
+        return jlif_continue;
+    }
+
+    if (clink->pstate != ps_expr) {
+        errlogPrintf("lnkACalc: Unexpected string \"%.*s\"\n", (int) len, val);
+        return jlif_stop;
+    }
+
+    clink->post_expr = malloc(INFIX_TO_POSTFIX_SIZE(len+1));
+    clink->expr = epicsStrnDup(val, len);
+    if (!clink->post_expr || !clink->expr) {
+        errlogPrintf("lnkACalc: Out of memory\n");
+        return jlif_stop;
+    }
+
+    if (postfix(clink->expr, clink->post_expr, &err) < 0) {
+        errlogPrintf("lnkACalc: Error in calc expression, %s\n",
+            calcErrorStr(err));
+        return jlif_stop;
+    }
+
+    clink->cmpl = calcCompile(clink->post_expr);
+    if (!clink->cmpl) {
+        errlogPrintf("lnkACalc: Can't compile expression \"%s\"\n",
+            clink->expr);
+        return jlif_stop;
+    }
+
+    return jlif_continue;
+}
+
+static jlif_key_result lnkACalc_start_map(jlink *pjlink)
+{
+    acalc_link *clink = CONTAINER(pjlink, struct acalc_link, jlink);
+
+    if (clink->pstate == ps_args)
+        return jlif_key_child_inlink;
+
+    if (clink->pstate != ps_init) {
+        errlogPrintf("lnkACalc: Unexpected map\n");
+        return jlif_key_stop;
+    }
+
+    return jlif_key_continue;
+}
+
+static jlif_result lnkACalc_map_key(jlink *pjlink, const char *key, size_t len)
+{
+    acalc_link *clink = CONTAINER(pjlink, struct acalc_link, jlink);
+
+    if (len == 4 && !strncmp(key, "expr", len) && !clink->post_expr)
+        clink->pstate = ps_expr;
+    else if (len == 4 && !strncmp(key, "args", len) && !clink->nArgs)
+        clink->pstate = ps_args;
+    else if (len == 4 && !strncmp(key, "prec", len))
+        clink->pstate = ps_prec;
+    else if (len == 5 && !strncmp(key, "units", len) && !clink->units)
+        clink->pstate = ps_units;
+    else {
+        errlogPrintf("lnkACalc: Unknown key \"%.*s\"\n", (int) len, key);
+        return jlif_stop;
+    }
+
+    return jlif_continue;
+}
+
+static jlif_result lnkACalc_end_map(jlink *pjlink)
+{
+    acalc_link *clink = CONTAINER(pjlink, struct acalc_link, jlink);
+
+    if (clink->pstate == ps_error)
+        return jlif_stop;
+    else if (!clink->post_expr) {
+        errlogPrintf("lnkACalc: No expression ('expr' key)\n");
+        return jlif_stop;
+    }
+
+    return jlif_continue;
+}
+
+static jlif_result lnkACalc_start_array(jlink *pjlink)
+{
+    acalc_link *clink = CONTAINER(pjlink, struct acalc_link, jlink);
+
+    if (clink->pstate != ps_args) {
+        errlogPrintf("lnkACalc: Unexpected array\n");
+        return jlif_stop;
+    }
+
+    return jlif_continue;
+}
+
+static jlif_result lnkACalc_end_array(jlink *pjlink)
+{
+    acalc_link *clink = CONTAINER(pjlink, struct acalc_link, jlink);
+
+    if (clink->pstate == ps_error)
+        return jlif_stop;
+
+    return jlif_continue;
+}
+
+static void lnkACalc_end_child(jlink *parent, jlink *child)
+{
+    acalc_link *clink = CONTAINER(parent, struct acalc_link, jlink);
+    struct link *plink;
+
+    if (clink->pstate != ps_args) {
+        errlogPrintf("lnkACalc: Unexpected child link, parser state = %d\n",
+            clink->pstate);
+        goto errOut;
+    }
+    if (clink->nArgs == CALCPERFORM_NARGS) {
+        errlogPrintf("lnkACalc: Too many input args, limit is %d\n",
+            CALCPERFORM_NARGS);
+        goto errOut;
+    }
+
+    clink->nelem[clink->nArgs] = 1;
+    plink = &clink->inp[clink->nArgs++];
+    plink->type = JSON_LINK;
+    plink->value.json.string = NULL;
+    plink->value.json.jlink = child;
+    return;
+
+errOut:
+    clink->pstate = ps_error;
+    dbJLinkFree(child);
+}
+
+static struct lset* lnkACalc_get_lset(const jlink *pjlink)
+{
+    return &lnkACalc_lset;
+}
+
+static void lnkACalc_report(const jlink *pjlink, int level, int indent)
+{
+    acalc_link *clink = CONTAINER(pjlink, struct acalc_link, jlink);
+    int i;
+
+    printf("%*s'acalc': \"%s\" = [%u elements] %s\n", indent, "",
+        clink->expr, clink->nord, clink->units ? clink->units : "");
+
+    if (level > 0) {
+        for (i = 0; i < clink->nArgs; i++) {
+            struct link *plink = &clink->inp[i];
+            jlink *child = plink->type == JSON_LINK ?
+                plink->value.json.jlink : NULL;
+
+            printf("%*s  Input %c: %u elements\n", indent, "",
+                i + 'A', clink->nelem[i]);
+
+            if (child)
+                dbJLinkReport(child, level - 1, indent + 4);
+        }
+    }
+}
+
+static long lnkACalc_map_children(jlink *pjlink, jlink_map_fn rtn, void *ctx)
+{
+    acalc_link *clink = CONTAINER(pjlink, struct acalc_link, jlink);
+    int i;
+
+    for (i = 0; i < clink->nArgs; i++) {
+        struct link *child = &clink->inp[i];
+        long status = dbJLinkMapChildren(child, rtn, ctx);
+
+        if (status)
+            return status;
+    }
+    return 0;
+}
+
+/*************************** lset Routines **************************/
+
+static void lnkACalc_open(struct link *plink)
+{
+    acalc_link *clink = CONTAINER(plink->value.json.jlink,
+        struct acalc_link, jlink);
+    int i;
+
+    for (i = 0; i < clink->nArgs; i++) {
+        struct link *child = &clink->inp[i];
+
+        if (child->type != JSON_LINK)
+            continue;
+
+        child->precord = plink->precord;
+        dbJLinkInit(child);
+
+        /* Constant children only provide their value here, and don't
+         * say how long it is, so keep doubling the buffer until it fits.
+         */
+        if (dbLinkIsConstant(child)) {
+            epicsUInt32 size = 16;
+            long n = 0;
+
+            do {
+                size *= 2;
+                if (growBuffer(&clink->arg[i], &clink->nalloc[i], size))
+                    break;
+                n = size;
+                if (dbLoadLinkArray(child, DBR_DOUBLE, clink->arg[i], &n))
+                    n = 0;
+            } while (n == size);
+
+            if (n > 0)
+                clink->nelem[i] = n;
+        }
+    }
+}
+
+static void lnkACalc_remove(struct dbLocker *locker, struct link *plink)
+{
+    acalc_link *clink = CONTAINER(plink->value.json.jlink,
+        struct acalc_link, jlink);
+    int i;
+
+    for (i = 0; i < clink->nArgs; i++) {
+        struct link *child = &clink->inp[i];
+
+        if (child->type == JSON_LINK)
+            dbRemoveLink(locker, child);
+    }
+
+    freeBuffers(clink);
+    free(clink);
+    plink->value.json.jlink = NULL;
+}
+
+static int lnkACalc_isConn(const struct link *plink)
+{
+    acalc_link *clink = CONTAINER(plink->value.json.jlink,
+        struct acalc_link, jlink);
+    int connected = 1;
+    int i;
+
+    for (i = 0; i < clink->nArgs; i++) {
+        struct link *child = &clink->inp[i];
+
+        if (child->type == JSON_LINK &&
+            dbLinkIsVolatile(child) &&
+            !dbIsLinkConnected(child))
+            connected = 0;
+    }
+
+    return connected;
+}
+
+static int lnkACalc_getDBFtype(const struct link *plink)
+{
+    return DBF_DOUBLE;
+}
+
+/* The result can't be longer than the longest argument */
+static long lnkACalc_getElements(const struct link *plink, long *nelements)
+{
+    acalc_link *clink = CONTAINER(plink->value.json.jlink,
+        struct acalc_link, jlink);
+    long nmax = 1;
+    int i;
+
+    for (i = 0; i < clink->nArgs; i++) {
+        struct link *child = &clink->inp[i];
+        long n = clink->nelem[i];
+
+        if (child->type == JSON_LINK && !dbLinkIsConstant(child))
+            dbGetNelements(child, &n);
+        if (n > nmax)
+            nmax = n;
+    }
+    *nelements = nmax;
+    return 0;
+}
+
+static long lnkACalc_getValue(struct link *plink, short dbrType, void *pbuffer,
+    long *pnRequest)
+{
+    acalc_link *clink = CONTAINER(plink->value.json.jlink,
+        struct acalc_link, jlink);
+    FASTCONVERT conv = dbFastPutConvertRoutine[DBR_DOUBLE][dbrType];
+    epicsUInt32 nres = pnRequest ? *pnRequest : 1;
+    short dbrSize = dbValueSize(dbrType);
+    char *pdest = pbuffer;
+    epicsUInt32 i;
+    long status;
+    int j;
+
+    /* Any link errors will trigger a LINK/INVALID alarm in the child link */
+    for (j = 0; j < clink->nArgs; j++) {
+        struct link *child = &clink->inp[j];
+        long nReq;
+
+        if (child->type != JSON_LINK || dbLinkIsConstant(child))
+            continue;
+
+        if (dbGetNelements(child, &nReq) || nReq < 1)
+            nReq = 1;
+        if (growBuffer(&clink->arg[j], &clink->nalloc[j], nReq))
+            return S_db_noMemory;
+
+        if (!dbGetLink(child, DBR_DOUBLE, clink->arg[j], NULL, &nReq) &&
+            nReq > 0)
+            clink->nelem[j] = nReq;
+    }
+
+    if (growBuffer(&clink->val, &clink->nval, nres))
+        return S_db_noMemory;
+
+    status = calcArrayPerform(clink->cmpl,
+        (const double * const *) clink->arg, clink->nelem, clink->val, &nres);
+    if (status) {
+        recGblSetSevr(plink->precord, LINK_ALARM, INVALID_ALARM);
+        return status;
+    }
+    clink->nord = nres;
+
+    if (dbrType == DBR_DOUBLE) {
+        memcpy(pbuffer, clink->val, nres * sizeof(double));
+    }
+    else {
+        for (i = 0; i < nres; i++) {
+            status = conv(&clink->val[i], pdest, NULL);
+            if (status)
+                return status;
+            pdest += dbrSize;
+        }
+    }
+    if (pnRequest)
+        *pnRequest = nres;
+
+    return 0;
+}
+
+static long lnkACalc_getPrecision(const struct link *plink, short *precision)
+{
+    acalc_link *clink = CONTAINER(plink->value.json.jlink,
+        struct acalc_link, jlink);
+
+    *precision = clink->prec;
+    return 0;
+}
+
+static long lnkACalc_getUnits(const struct link *plink, char *units, int len)
+{
+    acalc_link *clink = CONTAINER(plink->value.json.jlink,
+        struct acalc_link, jlink);
+
+    if (clink->units) {
+        strncpy(units, clink->units, --len);
+        units[len] = '\0';
+    }
+    else
+        units[0] = '\0';
+    return 0;
+}
+
+static long doLocked(struct link *plink, dbLinkUserCallback rtn, void *priv)
+{
+    return rtn(plink, priv);
+}
+
+
+/************************* Interface Tables *************************/
+
+static lset lnkACalc_lset = {
+    0, 1, /* not Constant, Volatile */
+    lnkACalc_open, lnkACalc_remove,
+    NULL, NULL, NULL,
+    lnkACalc_isConn, lnkACalc_getDBFtype, lnkACalc_getElements,
+    lnkACalc_getValue,
+    NULL, NULL, NULL,
+    lnkACalc_getPrecision, lnkACalc_getUnits,
+    NULL, NULL,
+    NULL, NULL,
+    NULL, doLocked
+};
+
+static jlif lnkACalcIf = {
+    "acalc", lnkACalc_alloc, lnkACalc_free,
+    NULL, NULL, lnkACalc_integer, lnkACalc_double, lnkACalc_string,
+    lnkACalc_start_map, lnkACalc_map_key, lnkACalc_end_map,
+    lnkACalc_start_array, lnkACalc_end_array,
+    lnkACalc_end_child, lnkACalc_get_lset,
+    lnkACalc_report, lnkACalc_map_children, NULL
+};
+epicsExportAddress(jlif, lnkACalcIf);
@@ -0,0 +1,349 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Record Support Routines for Array Calculation records */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "errlog.h"
+#include "alarm.h"
+#include "cantProceed.h"
+#include "dbAccess.h"
+#include "dbEvent.h"
+#include "dbFldTypes.h"
+#include "errMdef.h"
+#include "recSup.h"
+#include "recGbl.h"
+#include "special.h"
+
+#define GEN_SIZE_OFFSET
+#include "acalcRecord.h"
+#undef  GEN_SIZE_OFFSET
+#include "epicsExport.h"
+
+/* Create RSET - Record Support Entry Table */
+
+#define report NULL
+#define initialize NULL
+static long init_record(struct dbCommon *prec, int pass);
+static long process(struct dbCommon *prec);
+static long special(DBADDR *paddr, int after);
+#define get_value NULL
+static long cvt_dbaddr(DBADDR *paddr);
+static long get_array_info(DBADDR *paddr, long *no_elements, long *offset);
+static long put_array_info(DBADDR *paddr, long nNew);
+static long get_units(DBADDR *paddr, char *units);
+static long get_precision(const DBADDR *paddr, long *precision);
+#define get_enum_str NULL
+#define get_enum_strs NULL
+#define put_enum_str NULL
+static long get_graphic_double(DBADDR *paddr, struct dbr_grDouble *pgd);
+static long get_control_double(DBADDR *paddr, struct dbr_ctrlDouble *pcd);
+#define get_alarm_double NULL
+
+rset acalcRSET={
+    RSETNUMBER,
+    report,
+    initialize,
+    init_record,
+    process,
+    special,
+    get_value,
+    cvt_dbaddr,
+    get_array_info,
+    put_array_info,
+    get_units,
+    get_precision,
+    get_enum_str,
+    get_enum_strs,
+    put_enum_str,
+    get_graphic_double,
+    get_control_double,
+    get_alarm_double
+};
+epicsExportAddress(rset, acalcRSET);
+
+static void monitor(acalcRecord *prec, epicsUInt32 nord);
+static long fetch_values(acalcRecord *prec);
+
+
+static long init_record(struct dbCommon *pcommon, int pass)
+{
+    struct acalcRecord *prec = (struct acalcRecord *)pcommon;
+    short error_number;
+    int i;
+
+    if (pass == 0) {
+        if (prec->nelm == 0)
+            prec->nelm = 1;
+        prec->val = callocMustSucceed(prec->nelm, sizeof(double),
+            "acalc: init_record");
+        for (i = 0; i < CALCPERFORM_NARGS; i++)
+            (&prec->a)[i] = callocMustSucceed(prec->nelm, sizeof(double),
+                "acalc: init_record");
+        prec->nord = 0;
+        return 0;
+    }
+
+    for (i = 0; i < CALCPERFORM_NARGS; i++) {
+        long n = prec->nelm;
+
+        dbLoadLinkArray(&(&prec->inpa)[i], DBF_DOUBLE, (&prec->a)[i], &n);
+        if (n > 0)
+            (&prec->na)[i] = n;
+    }
+    if (postfix(prec->calc, prec->rpcl, &error_number)) {
+        recGblRecordError(S_db_badField, (void *)prec,
+                          "acalc: init_record: Illegal CALC field");
+        errlogPrintf("%s.CALC: %s in expression \"%s\"\n",
+                     prec->name, calcErrorStr(error_number), prec->calc);
+    }
+    else
+        prec->cmpl = calcCompile(prec->rpcl);
+    return 0;
+}
+
+static long process(struct dbCommon *pcommon)
+{
+    struct acalcRecord *prec = (struct acalcRecord *)pcommon;
+    epicsUInt32 nord = prec->nord;
+
+    prec->pact = TRUE;
+    if (fetch_values(prec) == 0) {
+        epicsUInt32 nres = prec->nelm;
+
+        if (!prec->cmpl ||
+            calcArrayPerform(prec->cmpl, (const double * const *)&prec->a,
+                &prec->na, prec->val, &nres)) {
+            recGblSetSevr(prec, CALC_ALARM, INVALID_ALARM);
+        } else {
+            prec->nord = nres;
+            prec->udf = FALSE;
+        }
+    }
+
+    recGblGetTimeStamp(prec);
+    if (prec->udf)
+        recGblSetSevr(prec, UDF_ALARM, prec->udfs);
+    /* check event list */
+    monitor(prec, nord);
+    /* process the forward scan link record */
+    recGblFwdLink(prec);
+    prec->pact = FALSE;
+    return 0;
+}
+
+static long special(DBADDR *paddr, int after)
+{
+    acalcRecord *prec = (acalcRecord *)paddr->precord;
+    short error_number;
+
+    if (!after) return 0;
+    if (paddr->special == SPC_CALC) {
+        calcFreeCompiled(prec->cmpl);
+        prec->cmpl = NULL;
+        if (postfix(prec->calc, prec->rpcl, &error_number)) {
+            recGblRecordError(S_db_badField, (void *)prec,
+                              "acalc: Illegal CALC field");
+            errlogPrintf("%s.CALC: %s in expression \"%s\"\n",
+                         prec->name, calcErrorStr(error_number), prec->calc);
+            return S_db_badField;
+        }
+        prec->cmpl = calcCompile(prec->rpcl);
+        return 0;
+    }
+    recGblDbaddrError(S_db_badChoice, paddr, "acalc::special - bad special value!");
+    return S_db_badChoice;
+}
+
+#define indexof(field) acalcRecord##field
+
+static long get_linkNumber(int fieldIndex) {
+    if (fieldIndex >= indexof(A) && fieldIndex <= indexof(L))
+        return fieldIndex - indexof(A);
+    return -1;
+}
+
+static long cvt_dbaddr(DBADDR *paddr)
+{
+    acalcRecord *prec = (acalcRecord *)paddr->precord;
+    int fieldIndex = dbGetFieldIndex(paddr);
+    int linkNumber = get_linkNumber(fieldIndex);
+
+    if (fieldIndex == indexof(VAL))
+        paddr->pfield = prec->val;
+    else if (linkNumber >= 0)
+        paddr->pfield = (&prec->a)[linkNumber];
+    else {
+        errlogPrintf("acalcRecord::cvt_dbaddr called for %s.%s\n",
+            prec->name, paddr->pfldDes->name);
+        return 0;
+    }
+    paddr->no_elements    = prec->nelm;
+    paddr->field_type     = DBF_DOUBLE;
+    paddr->field_size     = sizeof(double);
+    paddr->dbr_field_type = DBR_DOUBLE;
+    return 0;
+}
+
+static long get_array_info(DBADDR *paddr, long *no_elements, long *offset)
+{
+    acalcRecord *prec = (acalcRecord *)paddr->precord;
+    int fieldIndex = dbGetFieldIndex(paddr);
+    int linkNumber = get_linkNumber(fieldIndex);
+
+    if (fieldIndex == indexof(VAL))
+        *no_elements = prec->nord;
+    else if (linkNumber >= 0)
+        *no_elements = (&prec->na)[linkNumber];
+    else {
+        errlogPrintf("acalcRecord::get_array_info called for %s.%s\n",
+            prec->name, paddr->pfldDes->name);
+    }
+    *offset = 0;
+    return 0;
+}
+
+static long put_array_info(DBADDR *paddr, long nNew)
+{
+    acalcRecord *prec = (acalcRecord *)paddr->precord;
+    int fieldIndex = dbGetFieldIndex(paddr);
+    int linkNumber = get_linkNumber(fieldIndex);
+
+    if (nNew > prec->nelm)
+        nNew = prec->nelm;
+
+    if (fieldIndex == indexof(VAL)) {
+        epicsUInt32 nord = prec->nord;
+
+        prec->nord = nNew;
+        if (nord != prec->nord)
+            db_post_events(prec, &prec->nord, DBE_VALUE | DBE_LOG);
+    }
+    else if (linkNumber >= 0)
+        (&prec->na)[linkNumber] = nNew;
+    else {
+        errlogPrintf("acalcRecord::put_array_info called for %s.%s\n",
+            prec->name, paddr->pfldDes->name);
+    }
+    return 0;
+}
+
+static long get_units(DBADDR *paddr, char *units)
+{
+    acalcRecord *prec = (acalcRecord *)paddr->precord;
+    int fieldIndex = dbGetFieldIndex(paddr);
+    int linkNumber = get_linkNumber(fieldIndex);
+
+    if (linkNumber >= 0)
+        dbGetUnits(&prec->inpa + linkNumber, units, DB_UNITS_SIZE);
+    else if (fieldIndex == indexof(VAL) ||
+             fieldIndex == indexof(HOPR) ||
+             fieldIndex == indexof(LOPR))
+        strncpy(units, prec->egu, DB_UNITS_SIZE);
+    return 0;
+}
+
+static long get_precision(const DBADDR *paddr, long *pprecision)
+{
+    acalcRecord *prec = (acalcRecord *)paddr->precord;
+    int fieldIndex = dbGetFieldIndex(paddr);
+    int linkNumber;
+
+    *pprecision = prec->prec;
+    if (fieldIndex == indexof(VAL))
+        return 0;
+
+    linkNumber = get_linkNumber(fieldIndex);
+    if (linkNumber >= 0) {
+        short precision;
+
+        if (dbGetPrecision(&prec->inpa + linkNumber, &precision) == 0)
+            *pprecision = precision;
+    } else
+        recGblGetPrec(paddr, pprecision);
+    return 0;
+}
+
+static long get_graphic_double(DBADDR *paddr, struct dbr_grDouble *pgd)
+{
+    acalcRecord *prec = (acalcRecord *)paddr->precord;
+    int fieldIndex = dbGetFieldIndex(paddr);
+    int linkNumber;
+
+    switch (fieldIndex) {
+        case indexof(VAL):
+            pgd->lower_disp_limit = prec->lopr;
+            pgd->upper_disp_limit = prec->hopr;
+            break;
+        case indexof(NORD):
+            pgd->lower_disp_limit = 0;
+            pgd->upper_disp_limit = prec->nelm;
+            break;
+        default:
+            linkNumber = get_linkNumber(fieldIndex);
+            if (linkNumber >= 0) {
+                dbGetGraphicLimits(&prec->inpa + linkNumber,
+                    &pgd->lower_disp_limit,
+                    &pgd->upper_disp_limit);
+            } else
+                recGblGetGraphicDouble(paddr,pgd);
+    }
+    return 0;
+}
+
+static long get_control_double(DBADDR *paddr, struct dbr_ctrlDouble *pcd)
+{
+    acalcRecord *prec = (acalcRecord *)paddr->precord;
+
+    switch (dbGetFieldIndex(paddr)) {
+        case indexof(VAL):
+            pcd->lower_ctrl_limit = prec->lopr;
+            pcd->upper_ctrl_limit = prec->hopr;
+            break;
+        case indexof(NORD):
+            pcd->lower_ctrl_limit = 0;
+            pcd->upper_ctrl_limit = prec->nelm;
+            break;
+        default:
+            recGblGetControlDouble(paddr,pcd);
+    }
+    return 0;
+}
+
+static void monitor(acalcRecord *prec, epicsUInt32 nord)
+{
+    unsigned monitor_mask = recGblResetAlarms(prec);
+
+    if (nord != prec->nord)
+        db_post_events(prec, &prec->nord, monitor_mask | DBE_VALUE | DBE_LOG);
+
+    /* Comparing the old and new arrays costs as much as calculating them,
+     * so VAL is posted every time the record processes.
+     */
+    db_post_events(prec, prec->val, monitor_mask | DBE_VALUE | DBE_LOG);
+}
+
+static long fetch_values(acalcRecord *prec)
+{
+    struct link *plink = &prec->inpa;
+    long status = 0;
+    int i;
+
+    for (i = 0; i < CALCPERFORM_NARGS; i++, plink++) {
+        long nRequest = prec->nelm;
+        long newStatus;
+
+        newStatus = dbGetLink(plink, DBR_DOUBLE, (&prec->a)[i], 0, &nRequest);
+        if (!newStatus && nRequest > 0)
+            (&prec->na)[i] = nRequest;
+        if (status == 0) status = newStatus;
+    }
+    return status;
+}
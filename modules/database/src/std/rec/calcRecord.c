@@ -107,6 +107,8 @@ static long init_record(struct dbCommon *pcommon, int pass)
         errlogPrintf("%s.CALC: %s in expression \"%s\"\n",
                      prec->name, calcErrorStr(error_number), prec->calc);
     }
+    else
+        prec->cmpl = calcCompile(prec->rpcl);
     return 0;
 }
 
@@ -117,7 +119,11 @@ static long process(struct dbCommon *pcommon)
 
     prec->pact = TRUE;
     if (fetch_values(prec) == 0) {
-        if (calcPerform(&prec->a, &prec->val, prec->rpcl)) {
+        long status = prec->cmpl ?
+            calcPerformCompiled(prec->cmpl, &prec->a, &prec->val) :
+            calcPerform(&prec->a, &prec->val, prec->rpcl);
+
+        if (status) {
             recGblSetSevr(prec, CALC_ALARM, INVALID_ALARM);
         } else
             prec->udf = isnan(prec->val);
@@ -142,6 +148,8 @@ static long special(DBADDR *paddr, int after)
 
     if (!after) return 0;
     if (paddr->special == SPC_CALC) {
+        calcFreeCompiled(prec->cmpl);
+        prec->cmpl = NULL;
         if (postfix(prec->calc, prec->rpcl, &error_number)) {
             recGblRecordError(S_db_badField, (void *)prec,
                               "calc: Illegal CALC field");
@@ -149,6 +157,7 @@ static long special(DBADDR *paddr, int after)
                          prec->name, calcErrorStr(error_number), prec->calc);
             return S_db_badField;
         }
+        prec->cmpl = calcCompile(prec->rpcl);
         return 0;
     }
     recGblDbaddrError(S_db_badChoice, paddr, "calc::special - bad special value!");
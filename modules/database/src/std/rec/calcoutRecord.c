@@ -204,6 +204,8 @@ static long init_record(struct dbCommon *pcommon, int pass)
         errlogPrintf("%s.CALC: %s in expression \"%s\"\n",
                      prec->name, calcErrorStr(error_number), prec->calc);
     }
+    else
+        prec->cmpl = calcCompile(prec->rpcl);
 
     prec->oclv = postfix(prec->ocal, prec->orpc, &error_number);
     if (prec->dopt == calcoutDOPT_Use_OVAL && prec->oclv){
@@ -212,6 +214,8 @@ static long init_record(struct dbCommon *pcommon, int pass)
         errlogPrintf("%s.OCAL: %s in expression \"%s\"\n",
                      prec->name, calcErrorStr(error_number), prec->ocal);
     }
+    if (!prec->oclv)
+        prec->ocmp = calcCompile(prec->orpc);
 
     prpvt = prec->rpvt;
     callbackSetCallback(checkLinksCallback, &prpvt->checkLinkCb);
@@ -243,7 +247,11 @@ static long process(struct dbCommon *pcommon)
             checkLinks(prec);
         }
         if (fetch_values(prec) == 0) {
-            if (calcPerform(&prec->a, &prec->val, prec->rpcl)) {
+            long status = prec->cmpl ?
+                calcPerformCompiled(prec->cmpl, &prec->a, &prec->val) :
+                calcPerform(&prec->a, &prec->val, prec->rpcl);
+
+            if (status) {
                 recGblSetSevr(prec, CALC_ALARM, INVALID_ALARM);
             } else {
                 prec->udf = isnan(prec->val);
@@ -326,6 +334,8 @@ static long special(DBADDR *paddr, int after)
     if (!after) return 0;
     switch(fieldIndex) {
       case(calcoutRecordCALC):
+        calcFreeCompiled(prec->cmpl);
+        prec->cmpl = NULL;
         prec->clcv = postfix(prec->calc, prec->rpcl, &error_number);
         if (prec->clcv){
             recGblRecordError(S_db_badField, (void *)prec,
@@ -333,10 +343,14 @@ static long special(DBADDR *paddr, int after)
             errlogPrintf("%s.CALC: %s in expression \"%s\"\n",
                          prec->name, calcErrorStr(error_number), prec->calc);
         }
+        else
+            prec->cmpl = calcCompile(prec->rpcl);
         db_post_events(prec, &prec->clcv, DBE_VALUE);
         return 0;
 
       case(calcoutRecordOCAL):
+        calcFreeCompiled(prec->ocmp);
+        prec->ocmp = NULL;
         prec->oclv = postfix(prec->ocal, prec->orpc, &error_number);
         if (prec->dopt == calcoutDOPT_Use_OVAL && prec->oclv){
             recGblRecordError(S_db_badField, (void *)prec,
@@ -344,6 +358,8 @@ static long special(DBADDR *paddr, int after)
             errlogPrintf("%s.OCAL: %s in expression \"%s\"\n",
                          prec->name, calcErrorStr(error_number), prec->ocal);
         }
+        if (!prec->oclv)
+            prec->ocmp = calcCompile(prec->orpc);
         db_post_events(prec, &prec->oclv, DBE_VALUE);
         return 0;
       case(calcoutRecordINPA):
@@ -612,7 +628,9 @@ static void execOutput(calcoutRecord *prec)
         prec->oval = prec->val;
         break;
     case calcoutDOPT_Use_OVAL:
-        if (calcPerform(&prec->a, &prec->oval, prec->orpc)) {
+        if (prec->ocmp ?
+            calcPerformCompiled(prec->ocmp, &prec->a, &prec->oval) :
+            calcPerform(&prec->a, &prec->oval, prec->orpc)) {
             recGblSetSevr(prec, CALC_ALARM, INVALID_ALARM);
         } else {
             prec->udf = isnan(prec->oval);
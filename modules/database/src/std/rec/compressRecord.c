@@ -20,6 +20,7 @@
 #include <math.h>
 
 #include "dbDefs.h"
+#include "epicsMath.h"
 #include "epicsPrint.h"
 #include "alarm.h"
 #include "dbStaticLib.h"
@@ -87,10 +88,27 @@ static void reset(compressRecord *prec)
     prec->inx = 0;
     prec->cvb = 0.0;
     prec->res = 0;
+    prec->mcnt = 0;
     /* allocate memory for the summing buffer for conversions requiring it */
     if (prec->alg == compressALG_Average && prec->sptr == NULL) {
         prec->sptr = calloc(prec->nsam, sizeof(double));
     }
+    /* the moving window and its sorted copy, sized by N */
+    free(prec->mptr);
+    prec->mptr = NULL;
+    if (prec->alg == compressALG_Moving_Average ||
+        prec->alg == compressALG_Moving_Median) {
+        size_t nwin;
+
+        if (prec->n <= 0)
+            prec->n = 1;
+        nwin = prec->n;
+        if (nwin <= ((size_t) -1) / (2 * sizeof(double)))
+            prec->mptr = calloc(2 * nwin, sizeof(double));
+        if (!prec->mptr)
+            recGblRecordError(S_db_noMemory, (void *)prec,
+                "compress: No memory for the moving window");
+    }
 
     if (prec->bptr && prec->nsam)
         memset(prec->bptr, 0, prec->nsam * sizeof(double));
@@ -147,10 +165,120 @@ static int compare(const void *arg1, const void *arg2)
     else               return  1;
 }
 
+/*
+ * The block kernels below keep four independent minimums or sums, so
+ * each comparison or addition doesn't wait for the one before it.
+ */
+static double block_low(const double *psource, epicsInt32 n)
+{
+    double v0 = psource[0], v1 = v0, v2 = v0, v3 = v0;
+    epicsInt32 j;
+
+    for (j = 1; j + 4 <= n; j += 4) {
+        if (v0 > psource[j])     v0 = psource[j];
+        if (v1 > psource[j + 1]) v1 = psource[j + 1];
+        if (v2 > psource[j + 2]) v2 = psource[j + 2];
+        if (v3 > psource[j + 3]) v3 = psource[j + 3];
+    }
+    for (; j < n; j++) {
+        if (v0 > psource[j]) v0 = psource[j];
+    }
+    if (v0 > v1) v0 = v1;
+    if (v2 > v3) v2 = v3;
+    if (v0 > v2) v0 = v2;
+    return v0;
+}
+
+static double block_high(const double *psource, epicsInt32 n)
+{
+    double v0 = psource[0], v1 = v0, v2 = v0, v3 = v0;
+    epicsInt32 j;
+
+    for (j = 1; j + 4 <= n; j += 4) {
+        if (v0 < psource[j])     v0 = psource[j];
+        if (v1 < psource[j + 1]) v1 = psource[j + 1];
+        if (v2 < psource[j + 2]) v2 = psource[j + 2];
+        if (v3 < psource[j + 3]) v3 = psource[j + 3];
+    }
+    for (; j < n; j++) {
+        if (v0 < psource[j]) v0 = psource[j];
+    }
+    if (v0 < v1) v0 = v1;
+    if (v2 < v3) v2 = v3;
+    if (v0 < v2) v0 = v2;
+    return v0;
+}
+
+static double block_sum(const double *psource, epicsInt32 n)
+{
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    epicsInt32 j;
+
+    for (j = 0; j + 4 <= n; j += 4) {
+        s0 += psource[j];
+        s1 += psource[j + 1];
+        s2 += psource[j + 2];
+        s3 += psource[j + 3];
+    }
+    for (; j < n; j++)
+        s0 += psource[j];
+    return (s0 + s1) + (s2 + s3);
+}
+
+/*
+ * Return the k'th smallest of the n values, which are reordered.
+ * This is Hoare's FIND with a median of three pivot, falling back to
+ * qsort() for what remains if the partitions shrink too slowly.
+ */
+static double select_value(double *pdata, epicsInt32 n, epicsInt32 k)
+{
+    epicsInt32 lo = 0, hi = n - 1;
+    int depth = 2;
+
+    while (n >>= 1)
+        depth += 2;
+
+    while (lo < hi) {
+        double a = pdata[lo], b = pdata[k], c = pdata[hi];
+        double pivot;
+        epicsInt32 i = lo, j = hi;
+
+        if (--depth < 0) {
+            qsort(&pdata[lo], hi - lo + 1, sizeof(double), compare);
+            break;
+        }
+
+        if (a < b)
+            pivot = (b < c) ? b : (a < c) ? c : a;
+        else
+            pivot = (a < c) ? a : (b < c) ? c : b;
+
+        /* the pivot is one of the values, so the scans stop in range */
+        do {
+            while (pdata[i] < pivot)
+                i++;
+            while (pivot < pdata[j])
+                j--;
+            if (i <= j) {
+                double tmp = pdata[i];
+
+                pdata[i++] = pdata[j];
+                pdata[j--] = tmp;
+            }
+        } while (i <= j);
+
+        if (j < k)
+            lo = i;
+        if (k < i)
+            hi = j;
+    }
+    return pdata[k];
+}
+
 static int compress_array(compressRecord *prec,
     double *psource, int no_elements)
 {
-    epicsInt32 i,j;
+    epicsInt32 i;
     epicsInt32 n, nnew;
     epicsInt32 nsam = prec->nsam;
     double value;
@@ -178,43 +306,31 @@ static int compress_array(compressRecord *prec,
     switch (prec->alg){
     case compressALG_N_to_1_Low_Value:
         /* compress N to 1 keeping the lowest value */
-        for (i = 0; i < nnew; i++) {
-            value = *psource++;
-            for (j = 1; j < n; j++, psource++) {
-                if (value > *psource)
-                    value = *psource;
-            }
+        for (i = 0; i < nnew; i++, psource += n) {
+            value = block_low(psource, n);
             put_value(prec, &value, 1);
         }
         break;
     case compressALG_N_to_1_High_Value:
         /* compress N to 1 keeping the highest value */
-        for (i = 0; i < nnew; i++){
-            value = *psource++;
-            for (j = 1; j < n; j++, psource++) {
-                if (value < *psource)
-                    value = *psource;
-            }
+        for (i = 0; i < nnew; i++, psource += n) {
+            value = block_high(psource, n);
             put_value(prec, &value, 1);
         }
         break;
     case compressALG_N_to_1_Average:
         /* compress N to 1 keeping the average value */
-        for (i = 0; i < nnew; i++) {
-            value = 0;
-            for (j = 0; j < n; j++, psource++)
-                value += *psource;
-            value /= n;
+        for (i = 0; i < nnew; i++, psource += n) {
+            value = block_sum(psource, n) / n;
             put_value(prec, &value, 1);
         }
         break;
 
     case compressALG_N_to_1_Median:
         /* compress N to 1 keeping the median value */
-        /* note: sorts source array (OK; it's a work pointer) */
-        for (i = 0; i < nnew; i++, psource += nnew) {
-            qsort(psource, n, sizeof(double), compare);
-            value = psource[n / 2];
+        /* note: reorders source array (OK; it's a work pointer) */
+        for (i = 0; i < nnew; i++, psource += n) {
+            value = select_value(psource, n, n / 2);
             put_value(prec, &value, 1);
         }
         break;
@@ -311,6 +427,100 @@ static int compress_scalar(struct compressRecord *prec,double *psource)
     }
 }
 
+/*
+ * The moving algorithms keep the last N input values in a ring at the
+ * start of mptr, written at INX, and the same values sorted after it.
+ * MCNT counts the values in the window, and CVB holds their sum.
+ */
+
+/* sorting order for the window, with NaNs last */
+static int before(double a, double b)
+{
+    return a < b || (isnan(b) && !isnan(a));
+}
+
+/* index of the first sorted value not before v */
+static epicsUInt32 window_find(const double *psorted, epicsUInt32 count,
+    double v)
+{
+    epicsUInt32 lo = 0, hi = count;
+
+    while (lo < hi) {
+        epicsUInt32 mid = lo + (hi - lo) / 2;
+
+        if (before(psorted[mid], v))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+static double moving_value(compressRecord *prec, double value)
+{
+    epicsUInt32 n = prec->n;
+    double *pring = prec->mptr;
+    double *psorted = pring + n;
+    epicsUInt32 inx = prec->inx;
+    epicsUInt32 count = prec->mcnt;
+    int median = (prec->alg == compressALG_Moving_Median);
+    epicsUInt32 pos;
+
+    if (count == n) {
+        /* the oldest value leaves the window */
+        double old = pring[inx];
+
+        count--;
+        if (median) {
+            pos = window_find(psorted, count + 1, old);
+            memmove(&psorted[pos], &psorted[pos + 1],
+                (count - pos) * sizeof(double));
+        }
+        prec->cvb -= old;
+    }
+
+    if (median) {
+        pos = window_find(psorted, count, value);
+        memmove(&psorted[pos + 1], &psorted[pos],
+            (count - pos) * sizeof(double));
+        psorted[pos] = value;
+    }
+    count++;
+    pring[inx] = value;
+    prec->cvb += value;
+
+    if (++inx >= n || isnan(prec->cvb)) {
+        /* resum once per window so rounding errors don't build up,
+         * and after a NaN so it leaves with the value */
+        if (inx >= n)
+            inx = 0;
+        prec->cvb = block_sum(pring, count);
+    }
+    prec->inx = inx;
+    prec->mcnt = count;
+
+    if (median)
+        return psorted[count / 2];
+    return prec->cvb / count;
+}
+
+/* replace each input value by its window's average or median */
+static int moving_window(compressRecord *prec,
+    double *psource, epicsInt32 no_elements)
+{
+    epicsInt32 i;
+
+    if (!prec->mptr) {
+        recGblSetSevr(prec, SOFT_ALARM, INVALID_ALARM);
+        return 0;
+    }
+
+    for (i = 0; i < no_elements; i++)
+        psource[i] = moving_value(prec, psource[i]);
+    put_value(prec, psource, no_elements);
+    return 0;
+}
+
 /*Beginning of record support routines*/
 static long init_record(struct dbCommon *pcommon, int pass)
 {
@@ -359,6 +569,10 @@ static long process(struct dbCommon *pcommon)
             put_value(prec, prec->wptr, nelements);
             status = 0;
         }
+        else if (alg == compressALG_Moving_Average ||
+                 alg == compressALG_Moving_Median) {
+            status = moving_window(prec, prec->wptr, nelements);
+        }
         else if (nelements > 1) {
             status = compress_array(prec, prec->wptr, nelements);
         }
@@ -0,0 +1,132 @@
+/*************************************************************************\
+* Copyright (c) 2019 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Stress benchmark for the callback queues.
+ *
+ * Several producer threads hammer callbackRequest() while the worker
+ * threads of one priority drain the queue, for each of the queue modes
+ * selectable with callbackSetQueueMode().
+ */
+
+#include <stdlib.h>
+
+#include "callback.h"
+#include "cantProceed.h"
+#include "dbDefs.h"
+#include "epicsAtomic.h"
+#include "epicsEvent.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NREQUESTS 1000000
+
+static const char *modes[] = {"locked", "lockfree", "stealing"};
+
+typedef struct {
+    CALLBACK cb;
+    size_t nrequests;
+    int retries;
+    epicsEventId done;
+} producerPvt;
+
+static size_t executed;
+static size_t expected;
+static epicsEventId allExecuted;
+
+static void benchCallback(CALLBACK *pcb)
+{
+    if (epicsAtomicIncrSizeT(&executed) == expected)
+        epicsEventMustTrigger(allExecuted);
+}
+
+static void producer(void *raw)
+{
+    producerPvt *pvt = raw;
+    size_t i;
+
+    for (i = 0; i < pvt->nrequests; i++) {
+        while (callbackRequest(&pvt->cb)) {
+            pvt->retries++;
+            epicsThreadSleep(1e-4);
+        }
+    }
+    epicsEventMustTrigger(pvt->done);
+}
+
+static void runBench(const char *mode, int nworkers, int nproducers)
+{
+    producerPvt *pvt;
+    epicsTimeStamp start, stop;
+    callbackQueueStats stats;
+    double elapsed;
+    int i, retries = 0;
+
+    pvt = callocMustSucceed(nproducers, sizeof(*pvt), "runBench");
+
+    testOk1(callbackSetQueueMode(mode) == 0);
+    callbackParallelThreads(nworkers, "*");
+    callbackInit();
+
+    executed = 0;
+    expected = (NREQUESTS / nproducers) * nproducers;
+
+    epicsTimeGetCurrent(&start);
+    for (i = 0; i < nproducers; i++) {
+        callbackSetCallback(benchCallback, &pvt[i].cb);
+        callbackSetPriority(priorityMedium, &pvt[i].cb);
+        pvt[i].nrequests = NREQUESTS / nproducers;
+        pvt[i].done = epicsEventMustCreate(epicsEventEmpty);
+        epicsThreadMustCreate("producer", epicsThreadPriorityMedium,
+            epicsThreadGetStackSize(epicsThreadStackSmall),
+            producer, &pvt[i]);
+    }
+    for (i = 0; i < nproducers; i++) {
+        epicsEventMustWait(pvt[i].done);
+        epicsEventDestroy(pvt[i].done);
+        retries += pvt[i].retries;
+    }
+    epicsEventMustWait(allExecuted);
+    epicsTimeGetCurrent(&stop);
+
+    elapsed = epicsTimeDiffInSeconds(&stop, &start);
+    testOk(epicsAtomicGetSizeT(&executed) == expected,
+           "%s: %lu of %lu callbacks executed", mode,
+           (unsigned long)epicsAtomicGetSizeT(&executed),
+           (unsigned long)expected);
+
+    callbackQueueStatus(0, &stats);
+    testDiag("%-8s %2d workers %2d producers: %.3f s, %.0f callbacks/s, "
+             "high-water %d/%d, %d retries",
+             mode, nworkers, nproducers, elapsed, expected / elapsed,
+             stats.maxUsed[priorityMedium], stats.size, retries);
+
+    callbackStop();
+    callbackCleanup();
+    free(pvt);
+}
+
+MAIN(benchCallbackQueue)
+{
+    int ncpus = epicsThreadGetCPUs();
+    int nthreads = ncpus < 2 ? 2 : ncpus;
+    unsigned i;
+
+    testPlan(4 * NELEMENTS(modes));
+
+    allExecuted = epicsEventMustCreate(epicsEventEmpty);
+
+    for (i = 0; i < NELEMENTS(modes); i++) {
+        runBench(modes[i], 1, 1);
+        runBench(modes[i], nthreads, nthreads);
+    }
+
+    epicsEventDestroy(allExecuted);
+    return testDone();
+}
@@ -2,12 +2,20 @@
 * Copyright (c) 2013 Brookhaven Science Assoc, as Operator of Brookhaven
 *     National Laboratory.
 \*************************************************************************/
+/*
+ * Benchmark for the array conversion routines.
+ *
+ * Each database type pair is timed through dbGetConvertRoutine[][] and
+ * dbPutConvertRoutine[][].  The throughput reported counts the bytes
+ * read plus the bytes written.
+ */
 #include "string.h"
 
 #include "cantProceed.h"
 #include "dbAddr.h"
 #include "dbConvert.h"
 #include "dbDefs.h"
+#include "dbFldTypes.h"
 #include "epicsTime.h"
 #include "epicsMath.h"
 #include "epicsAssert.h"
@@ -15,53 +23,119 @@
 #include "epicsUnitTest.h"
 #include "testMain.h"
 
+typedef enum {benchGet, benchPut} benchKind;
+
+typedef struct {
+    benchKind kind;
+    short from, to;
+} benchPair;
+
+static const benchPair pairs[] = {
+    {benchGet, DBF_SHORT, DBF_SHORT},
+    {benchGet, DBF_SHORT, DBF_LONG},
+    {benchGet, DBF_SHORT, DBF_FLOAT},
+    {benchGet, DBF_SHORT, DBF_DOUBLE},
+    {benchGet, DBF_LONG, DBF_DOUBLE},
+    {benchGet, DBF_FLOAT, DBF_DOUBLE},
+    {benchGet, DBF_DOUBLE, DBF_FLOAT},
+    {benchGet, DBF_DOUBLE, DBF_LONG},
+    {benchGet, DBF_DOUBLE, DBF_SHORT},
+    {benchGet, DBF_DOUBLE, DBF_DOUBLE},
+    {benchPut, DBF_SHORT, DBF_DOUBLE},
+    {benchPut, DBF_FLOAT, DBF_DOUBLE},
+    {benchPut, DBF_DOUBLE, DBF_FLOAT},
+    {benchPut, DBF_DOUBLE, DBF_SHORT},
+};
+
+static const char * const kindNames[] = {"get", "put"};
+
 typedef struct {
+    const benchPair *pair;
     size_t nelem, niter;
 
-    short *output;
-    short *input;
+    void *output;
+    void *input;
 
     GETCONVERTFUNC getter;
+    PUTCONVERTFUNC putter;
 
     DBADDR addr;
 } testData;
 
+static size_t dbfSize(short dbf)
+{
+    switch (dbf) {
+    case DBF_SHORT:  return sizeof(epicsInt16);
+    case DBF_LONG:   return sizeof(epicsInt32);
+    case DBF_FLOAT:  return sizeof(epicsFloat32);
+    case DBF_DOUBLE: return sizeof(epicsFloat64);
+    }
+    return 0;
+}
+
+static void fillInput(void *pbuf, short dbf, size_t nelem)
+{
+    size_t i;
+
+    for (i = 0; i < nelem; i++) {
+        epicsInt16 v = (epicsInt16) i;
+
+        switch (dbf) {
+        case DBF_SHORT:  ((epicsInt16 *) pbuf)[i] = v; break;
+        case DBF_LONG:   ((epicsInt32 *) pbuf)[i] = v; break;
+        case DBF_FLOAT:  ((epicsFloat32 *) pbuf)[i] = v; break;
+        case DBF_DOUBLE: ((epicsFloat64 *) pbuf)[i] = v; break;
+        }
+    }
+}
+
 static long runRep(testData *D)
 {
     size_t i;
 
     for(i=0; i<D->niter; i++) {
-        D->getter(&D->addr, D->output, D->nelem, D->nelem, 0);
+        if (D->pair->kind == benchPut)
+            D->putter(&D->addr, D->input, D->nelem, D->nelem, 0);
+        else
+            D->getter(&D->addr, D->output, D->nelem, D->nelem, 0);
     }
     return 0;
 }
 
-static void runBench(size_t nelem, size_t niter, size_t nrep)
+static void runBench(const benchPair *pair, size_t nelem, size_t niter,
+    size_t nrep)
 {
     size_t i;
     testData tdat;
     double *reptimes;
-    testDiag("Using %lu element arrays.",(unsigned long)nelem);
-    testDiag("run %lu reps with %lu iterations each",
-             (unsigned long)nrep, (unsigned long)niter);
+    short from = pair->from, to = pair->to;
+    size_t nbytes = nelem * (dbfSize(from) + dbfSize(to));
 
     reptimes = callocMustSucceed(nrep, sizeof(*reptimes), "runBench");
-    tdat.output = callocMustSucceed(nelem, sizeof(*tdat.output), "runBench");
-    tdat.input = callocMustSucceed(nelem, sizeof(*tdat.input), "runBench");
+    tdat.output = callocMustSucceed(nelem, dbfSize(to), "runBench");
+    tdat.input = callocMustSucceed(nelem, dbfSize(from), "runBench");
 
+    tdat.pair = pair;
     tdat.nelem = nelem;
     tdat.niter = niter;
 
-    tdat.getter = dbGetConvertRoutine[DBF_SHORT][DBF_SHORT];
-
     memset(&tdat.addr, 0, sizeof(tdat.addr));
-    tdat.addr.field_type = DBF_SHORT;
-    tdat.addr.field_size = nelem*sizeof(*tdat.input);
     tdat.addr.no_elements = nelem;
-    tdat.addr.pfield = (void*)tdat.input;
+    if (pair->kind == benchPut) {
+        /* The record field is the destination */
+        tdat.putter = dbPutConvertRoutine[from][to];
+        tdat.addr.field_type = to;
+        tdat.addr.field_size = dbfSize(to);
+        tdat.addr.pfield = tdat.output;
+    }
+    else {
+        tdat.getter = dbGetConvertRoutine[from][to];
+        tdat.addr.field_type = from;
+        tdat.addr.field_size = dbfSize(from);
+        tdat.addr.pfield = tdat.input;
+    }
 
-    for(i=0; i<nelem; i++)
-        tdat.input[i] = (short)i;
+    fillInput(tdat.input, from, nelem);
 
     for(i=0; i<nrep; i++)
     {
@@ -81,11 +155,6 @@ static void runBench(size_t nelem, size_t niter, size_t nrep)
         }
 
         reptimes[i] = epicsTimeDiffInSeconds(&stop, &start);
-
-        testDiag("%lu bytes in %.03f ms.  %.1f MB/s",
-                 (unsigned long)(nelem*niter),
-                 reptimes[i]*1e3,
-                 (nelem*niter)/reptimes[i]/1e6);
     }
 
     {
@@ -96,11 +165,15 @@ static void runBench(size_t nelem, size_t niter, size_t nrep)
         }
 
         mean = sum/nrep;
-        testDiag("Final: %.04f ms +- %.05f ms.  %.1f MB/s  (for %lu elements)",
+        testDiag("%-6s %-6s -> %-6s %8lu elements: %9.4f ms +- %.5f ms  "
+                 "%6.2f GB/s",
+                 kindNames[pair->kind],
+                 pamapdbfType[from].strvalue + 4,
+                 pamapdbfType[to].strvalue + 4,
+                 (unsigned long)nelem,
                  mean*1e3,
                  sqrt(sum2/nrep - mean*mean)*1e3,
-                 (nelem*niter)/mean/1e6,
-                 (unsigned long)nelem);
+                 (nbytes*niter)/mean/1e9);
     }
 
 done:
@@ -111,14 +184,13 @@ done:
 
 MAIN(benchdbConvert)
 {
+    unsigned i;
+
     testPlan(0);
-    runBench(1, 10000000, 10);
-    runBench(2,  5000000, 10);
-    runBench(10, 1000000, 10);
-    runBench(100, 100000, 10);
-    runBench(10000, 1000, 10);
-    runBench(100000, 100, 10);
-    runBench(1000000, 10, 10);
-    runBench(10000000, 1, 10);
+    for (i = 0; i < NELEMENTS(pairs); i++) {
+        runBench(&pairs[i], 100, 100000, 10);
+        runBench(&pairs[i], 10000, 1000, 10);
+        runBench(&pairs[i], 1000000, 10, 10);
+    }
     return testDone();
 }
@@ -0,0 +1,146 @@
+/*************************************************************************\
+* Copyright (c) 2019 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Benchmark for the fan-out cost of db_post_events().
+ *
+ * One record is monitored by many subscriptions, spread over a varying
+ * number of event users (as if they came from that many CA clients).
+ * The record's value is posted repeatedly while the event tasks drain
+ * their queues, then every subscription must have received the final
+ * value.
+ */
+
+#include <stdlib.h>
+
+#include "cantProceed.h"
+#include "dbDefs.h"
+#include "epicsAtomic.h"
+#include "errlog.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "dbAccess.h"
+#include "dbChannel.h"
+#include "dbEvent.h"
+#include "dbLock.h"
+#include "dbUnitTest.h"
+#include "testMain.h"
+#include "xRecord.h"
+
+#define NSUBS 300
+#define NPOSTS 2000
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+typedef struct subPvt {
+    dbChannel *chan;
+    dbEventSubscription sub;
+    int last;
+} subPvt;
+
+static size_t delivered;
+
+static void benchMonitor(void *user_arg, struct dbChannel *chan,
+    int eventsRemaining, struct db_field_log *pfl)
+{
+    subPvt *pvt = user_arg;
+
+    if (pfl && pfl->type == dbfl_type_val)
+        epicsAtomicSetIntT(&pvt->last, pfl->u.v.field.dbf_long);
+    epicsAtomicIncrSizeT(&delivered);
+}
+
+static void runBench(xRecord *prec, int nusers)
+{
+    dbEventCtx *ctx = callocMustSucceed(nusers, sizeof(dbEventCtx), "runBench");
+    subPvt *subs = callocMustSucceed(NSUBS, sizeof(subPvt), "runBench");
+    epicsTimeStamp start, stop;
+    double elapsed, timeout;
+    int i, nstale;
+
+    for (i = 0; i < nusers; i++) {
+        ctx[i] = db_init_events();
+        if (!ctx[i] || db_start_events(ctx[i], "bench", NULL, NULL,
+                epicsThreadPriorityCAServerLow))
+            testAbort("Failed to start event user %d", i);
+    }
+    for (i = 0; i < NSUBS; i++) {
+        subs[i].chan = dbChannelCreate("reca.VAL");
+        if (!subs[i].chan || dbChannelOpen(subs[i].chan))
+            testAbort("Failed to open channel %d", i);
+        subs[i].sub = db_add_event(ctx[i % nusers], subs[i].chan,
+            benchMonitor, &subs[i], DBE_VALUE);
+        if (!subs[i].sub)
+            testAbort("Failed to add subscription %d", i);
+        subs[i].last = -1;
+        db_event_enable(subs[i].sub);
+    }
+
+    epicsAtomicSetSizeT(&delivered, 0);
+    epicsTimeGetCurrent(&start);
+    for (i = 0; i < NPOSTS; i++) {
+        dbScanLock((dbCommon *)prec);
+        prec->val = i;
+        db_post_events(prec, &prec->val, DBE_VALUE);
+        dbScanUnlock((dbCommon *)prec);
+    }
+    epicsTimeGetCurrent(&stop);
+    elapsed = epicsTimeDiffInSeconds(&stop, &start);
+
+    /* Wait for the event tasks to deliver the final value */
+    for (timeout = 10.0; timeout > 0.0; timeout -= 0.01) {
+        for (nstale = 0, i = 0; i < NSUBS; i++)
+            nstale += epicsAtomicGetIntT(&subs[i].last) != NPOSTS - 1;
+        if (!nstale)
+            break;
+        epicsThreadSleep(0.01);
+    }
+
+    testOk(nstale == 0, "%d users: all %d subscriptions got the final value",
+        nusers, NSUBS);
+    testDiag("%3d users %d subscriptions: %.2f us per post, "
+        "%.1f ns per subscription, %.1f%% of updates delivered",
+        nusers, NSUBS, elapsed / NPOSTS * 1e6,
+        elapsed / NPOSTS / NSUBS * 1e9,
+        100.0 * epicsAtomicGetSizeT(&delivered) / NPOSTS / NSUBS);
+
+    for (i = 0; i < NSUBS; i++) {
+        db_cancel_event(subs[i].sub);
+        dbChannelDelete(subs[i].chan);
+    }
+    for (i = 0; i < nusers; i++)
+        db_close_events(ctx[i]);
+    free(subs);
+    free(ctx);
+}
+
+MAIN(benchdbEvent)
+{
+    static const int nusers[] = {1, 10, NSUBS};
+    xRecord *prec;
+    unsigned i;
+
+    testPlan(NELEMENTS(nusers));
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbLockTest.db", NULL, NULL);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    prec = (xRecord *)testdbRecordPtr("reca");
+
+    for (i = 0; i < NELEMENTS(nusers); i++)
+        runBench(prec, nusers[i]);
+
+    testIocShutdownOk();
+    testdbCleanup();
+    return testDone();
+}
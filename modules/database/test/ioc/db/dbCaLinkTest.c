@@ -564,6 +564,9 @@ static void testreTargetTypeChange(void)
 
     testdbCleanup();
 
+    epicsEventDestroy(waitEvent);
+    waitEvent = NULL;
+
     /* records don't cleanup after themselves
      * so do here to silence valgrind
      */
@@ -617,7 +620,7 @@ static void testCAC(void)
 
 MAIN(dbCaLinkTest)
 {
-    testPlan(101);
+    testPlan(122);
     testNativeLink();
     testStringLink();
     testCP();
@@ -627,5 +630,14 @@ MAIN(dbCaLinkTest)
     testArrayLink(10,10);
     testreTargetTypeChange();
     testCAC();
+
+    testDiag("Several dbCa worker threads, flushing every request");
+    dbCaLinkThreads = 3;
+    dbCaBatchSize = 1;
+    testCP();
+    testArrayLink(10,10);
+    testreTargetTypeChange();
+    dbCaLinkThreads = 1;
+    dbCaBatchSize = 64;
     return testDone();
 }
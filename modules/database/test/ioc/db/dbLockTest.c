@@ -10,7 +10,10 @@
  */
 
 #include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
 
+#include "dbDefs.h"
 #include "epicsSpin.h"
 #include "epicsMutex.h"
 #include "dbCommon.h"
@@ -23,7 +26,10 @@
 #include "testMain.h"
 
 #include "dbAccess.h"
+#include "dbLink.h"
 #include "errlog.h"
+#include "epicsStdio.h"
+#include "epicsTempFile.h"
 
 void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
 
@@ -147,6 +153,60 @@ static void testSingleLock(void)
     testdbCleanup();
 }
 
+static void testSnapshot(void)
+{
+    dbCommon *prec, *precB, *precC;
+    dbScanSnapshot snap;
+    testDiag("testing dbScanSnapshotBegin()/dbScanSnapshotEnd()");
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbLockTest.db", NULL, NULL);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    prec = testdbRecordPtr("reca");
+    precB = testdbRecordPtr("recb");
+    precC = testdbRecordPtr("recc");
+
+    testOk1(dbScanSnapshotBegin(prec, &snap)==1);
+    testOk1(prec->lset->plockSet->refcount==2);
+    testOk1(dbScanSnapshotEnd(&snap)==1);
+    testOk1(prec->lset->plockSet->refcount==1);
+
+    /* can't begin while locked */
+    dbScanLock(prec);
+    testOk1(dbScanSnapshotBegin(prec, &snap)==0);
+    testOk1(prec->lset->plockSet->refcount==1);
+    dbScanUnlock(prec);
+
+    /* locked in between */
+    testOk1(dbScanSnapshotBegin(prec, &snap)==1);
+    dbScanLock(prec);
+    dbScanUnlock(prec);
+    testOk1(dbScanSnapshotEnd(&snap)==0);
+
+    /* another record in the same lockSet */
+    testOk1(dbScanSnapshotBegin(precB, &snap)==1);
+    dbScanLock(precC);
+    dbScanUnlock(precC);
+    testOk1(dbScanSnapshotEnd(&snap)==0);
+
+    /* lockSet split */
+    testOk1(dbScanSnapshotBegin(precB, &snap)==1);
+    testdbPutFieldOk("recb.SDIS", DBR_STRING, "");
+    testOk1(precB->lset->plockSet!=precC->lset->plockSet);
+    testOk1(dbScanSnapshotEnd(&snap)==0);
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+}
+
 static void testMultiLock(void)
 {
     dbCommon *prec[8];
@@ -413,19 +473,185 @@ static void testLinkNOP(void)
     testdbCleanup();
 }
 
+/* What dblsa() printed */
+typedef struct {
+    unsigned long nrecords, nsets;
+    unsigned long hist[4];  /* sets of 1, 2-3, 4-7 and 8-15 records */
+    int nrows, nlisted;
+    struct {
+        int nrecords, nnpp, nparts, largest;
+    } rows[8];
+} dblsaResult;
+
+static void runDblsa(int nsets, int level, dblsaResult *pres)
+{
+    FILE *stream = epicsTempFile();
+    char line[120];
+    long status;
+
+    memset(pres, 0, sizeof(*pres));
+    if(!stream)
+        testAbort("Can't create a temporary file");
+
+    epicsSetThreadStdout(stream);
+    status = dblsa(nsets, level);
+    epicsSetThreadStdout(0);
+    testOk(status==0, "dblsa(%d, %d) returned %ld", nsets, level, status);
+
+    rewind(stream);
+    while(fgets(line, sizeof(line), stream)) {
+        unsigned long nrec, nset, lo, hi, count, id, nwait;
+        double waitms;
+        int i = pres->nrows;
+
+        if(sscanf(line, "%lu records in %lu lock sets", &nrec, &nset)==2) {
+            pres->nrecords = nrec;
+            pres->nsets = nset;
+            continue;
+        }
+        if(sscanf(line, "%lu - %lu %lu", &lo, &hi, &count)==3) {
+            unsigned bin = 0;
+
+            while(lo>1) {
+                lo >>= 1;
+                bin++;
+            }
+            if(bin<NELEMENTS(pres->hist))
+                pres->hist[bin] = count;
+            continue;
+        }
+        if(i<(int)NELEMENTS(pres->rows) &&
+           sscanf(line, "%lu %d %lu %lf %d %d %d", &id,
+                  &pres->rows[i].nrecords, &nwait, &waitms,
+                  &pres->rows[i].nnpp, &pres->rows[i].nparts,
+                  &pres->rows[i].largest)==7) {
+            pres->nrows++;
+            continue;
+        }
+        if(line[0]=='\t' && strstr(line, " NPP "))
+            pres->nlisted++;
+    }
+    fclose(stream);
+}
+
+static void testAnalysis(void)
+{
+    dblsaResult res;
+
+    testDiag("Test lock set analysis");
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbLockTest.db", NULL, NULL);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    /* Sets {reca}, {recb, recc}, {recd, rece, recf} and {recg},
+     * all of their links are NPP, recc's is to itself
+     */
+    runDblsa(2, 1, &res);
+    testOk(res.nrecords==7 && res.nsets==4,
+           "%lu records in %lu lock sets", res.nrecords, res.nsets);
+    testOk(res.hist[0]==2 && res.hist[1]==2 && res.hist[2]==0,
+           "Set sizes 1: %lu, 2-3: %lu, 4-7: %lu",
+           res.hist[0], res.hist[1], res.hist[2]);
+    testOk(res.nrows==2, "Reported on %d sets", res.nrows);
+    testOk(res.rows[0].nrecords==3 && res.rows[0].nnpp==2 &&
+           res.rows[0].nparts==3 && res.rows[0].largest==1,
+           "Set of %d records with %d NPP links splits into %d of %d",
+           res.rows[0].nrecords, res.rows[0].nnpp,
+           res.rows[0].nparts, res.rows[0].largest);
+    testOk(res.rows[1].nrecords==2 && res.rows[1].nnpp==2 &&
+           res.rows[1].nparts==2 && res.rows[1].largest==1,
+           "Set of %d records with %d NPP links splits into %d of %d",
+           res.rows[1].nrecords, res.rows[1].nnpp,
+           res.rows[1].nparts, res.rows[1].largest);
+    testOk(res.nlisted==4, "Listed %d NPP links", res.nlisted);
+
+    /* A PP link keeps the set together */
+    testdbPutFieldOk("recg.SDIS", DBR_STRING, "reca PP");
+    runDblsa(1, 0, &res);
+    testOk(res.nsets==3 && res.rows[0].nrecords==3,
+           "%lu lock sets, the largest of %d records",
+           res.nsets, res.rows[0].nrecords);
+    testOk(res.nlisted==0, "Level 0 lists no links");
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+}
+
+static void testNppAsCA(void)
+{
+    dbCommon *precA, *precB, *precC, *precD, *precE, *precG;
+    testDiag("Test NPP links as CA links");
+
+    dbLinkNppAsCA = 1;
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbLockTest.db", NULL, NULL);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    precA = testdbRecordPtr("reca");
+    precB = testdbRecordPtr("recb");
+    precC = testdbRecordPtr("recc");
+    precD = testdbRecordPtr("recd");
+    precE = testdbRecordPtr("rece");
+    precG = testdbRecordPtr("recg");
+
+    testOk1(precB->lset->plockSet!=precC->lset->plockSet);
+    testOk1(precD->lset->plockSet!=precE->lset->plockSet);
+
+    /* PP links still merge */
+    testdbPutFieldOk("recg.SDIS", DBR_STRING, "reca PP");
+    testOk1(precA->lset->plockSet==precG->lset->plockSet);
+
+    testdbPutFieldOk("recg.SDIS", DBR_STRING, "recb NPP");
+    testOk1(precA->lset->plockSet!=precG->lset->plockSet);
+    testOk1(precB->lset->plockSet!=precG->lset->plockSet);
+
+    {
+        dblsaResult res;
+
+        runDblsa(0, 1, &res);
+        testOk(res.nrecords==7 && res.nsets==7,
+               "%lu records in %lu lock sets", res.nrecords, res.nsets);
+        testOk(res.nlisted==0, "No NPP links left to list");
+    }
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+
+    dbLinkNppAsCA = 0;
+}
+
 MAIN(dbLockTest)
 {
 #ifdef LOCKSET_DEBUG
-    testPlan(100);
+    testPlan(135);
 #else
-    testPlan(88);
+    testPlan(123);
 #endif
     testSets();
     testSingleLock();
+    testSnapshot();
     testMultiLock();
     testLinkBreak();
     testLinkMake();
     testLinkChange();
     testLinkNOP();
+    testAnalysis();
+    testNppAsCA();
     return testDone();
 }
@@ -12,13 +12,16 @@
 #include <string.h>
 
 #include "dbScan.h"
+#include "epicsAtomic.h"
 #include "epicsEvent.h"
+#include "epicsThread.h"
 
 #include "dbUnitTest.h"
 #include "testMain.h"
 
 #include "dbAccess.h"
 #include "errlog.h"
+#include "xRecord.h"
 
 void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
 
@@ -65,9 +68,145 @@ static void testOnce(void)
     epicsEventDestroy(waiter);
 }
 
+#define NCHAINS 8
+#define NCYCLES 5
+
+static xRecord *pa[NCHAINS], *pb[NCHAINS];
+static epicsThreadId tida[NCHAINS], tidb[NCHAINS];
+static int phasErrors;
+
+static int chainIndex(xRecord *prec)
+{
+    return prec->name[1] - '0';
+}
+
+static void processA(xRecord *prec)
+{
+    tida[chainIndex(prec)] = epicsThreadGetIdSelf();
+    epicsAtomicIncrIntT(&prec->val);
+}
+
+static void processB(xRecord *prec)
+{
+    int cycle = epicsAtomicIncrIntT(&prec->val);
+    int i;
+
+    tidb[chainIndex(prec)] = epicsThreadGetIdSelf();
+    /* every PHAS 0 record must have been processed in this cycle */
+    for (i = 0; i < NCHAINS; i++) {
+        if (epicsAtomicGetIntT(&pa[i]->val) < cycle)
+            epicsAtomicIncrIntT(&phasErrors);
+    }
+}
+
+static void checkStats(void)
+{
+    scanPeriodicStats stats;
+    scanRecordStats rstats;
+    int scan = pa[0]->scan;
+    unsigned long nhist = 0, overruns;
+    int i;
+
+    testDiag("periodic scan statistics");
+
+    testOk1(scanPeriodicStatus(SCAN_PASSIVE, 0, &stats) == -1);
+    testOk1(scanPeriodicStatus(scan, 0, NULL) == -2);
+
+    testOk1(scanPeriodicStatus(scan, 0, &stats) == 0);
+    testOk(stats.period == 0.1, "period %g", stats.period);
+    testOk(stats.cycles >= NCYCLES, "%lu scans", stats.cycles);
+    for (i = 0; i < SCAN_HIST_BINS; i++)
+        nhist += stats.timeHist[i];
+    testOk(nhist == stats.cycles, "%lu scans in time histogram", nhist);
+    testOk(stats.maxTime >= stats.meanTime && stats.meanTime > 0.0,
+        "max %g >= mean %g", stats.maxTime, stats.meanTime);
+
+    testDiag("record times, with scanRecordTiming = 1");
+
+    dbScanLock((dbCommon *)pa[0]);
+    testOk1(scanRecordTimes((dbCommon *)pa[0], &rstats) == 0);
+    dbScanUnlock((dbCommon *)pa[0]);
+    testOk(rstats.samples >= NCYCLES, "%lu samples", rstats.samples);
+    testOk(rstats.maxTime >= rstats.meanTime && rstats.meanTime > 0.0,
+        "max %g >= mean %g", rstats.maxTime, rstats.meanTime);
+
+    overruns = stats.overruns;
+    testOk1(scanPeriodicStatus(scan, 1, &stats) == 0);
+    testOk1(scanPeriodicStatus(scan, 0, &stats) == 0);
+    testOk(stats.cycles <= 1, "reset, now %lu scans", stats.cycles);
+    testOk(stats.overruns >= overruns, "over-runs kept, %lu",
+        stats.overruns);
+
+    dbScanLock((dbCommon *)pa[0]);
+    testOk1(scanRecordTimes((dbCommon *)pa[0], &rstats) == 0);
+    dbScanUnlock((dbCommon *)pa[0]);
+    testOk(rstats.samples <= 1, "record times reset, %lu samples",
+        rstats.samples);
+}
+
+static void testShards(void)
+{
+    int i, sameThread = 1, shared = 1;
+    double timeout = 10.0;
+
+    testDiag("periodic scan list sharded across threads");
+
+    scanPeriodicShards = 4;
+    scanRecordTiming = 1;
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    for (i = 0; i < NCHAINS; i++) {
+        char macros[8], name[4];
+
+        sprintf(macros, "N=%d", i);
+        testdbReadDatabase("dbScanTest.db", NULL, macros);
+
+        sprintf(name, "a%d", i);
+        pa[i] = (xRecord *)testdbRecordPtr(name);
+        pa[i]->clbk = processA;
+        sprintf(name, "b%d", i);
+        pb[i] = (xRecord *)testdbRecordPtr(name);
+        pb[i]->clbk = processB;
+    }
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    while (epicsAtomicGetIntT(&pb[NCHAINS - 1]->val) < NCYCLES &&
+           timeout > 0.0) {
+        epicsThreadSleep(0.1);
+        timeout -= 0.1;
+    }
+    testOk(timeout > 0.0, "Scanned %d times",
+        epicsAtomicGetIntT(&pb[NCHAINS - 1]->val));
+
+    checkStats();
+
+    testIocShutdownOk();
+
+    for (i = 0; i < NCHAINS; i++) {
+        if (tida[i] != tidb[i])
+            sameThread = 0;
+        if (tida[i] != tida[0])
+            shared = 0;
+    }
+    testOk(phasErrors == 0, "PHAS order held across shards (%d errors)",
+        phasErrors);
+    testOk(sameThread, "Each lock set processed by a single thread");
+    testOk(!shared, "Lock sets processed by more than one thread");
+
+    testdbCleanup();
+    scanPeriodicShards = 1;
+    scanRecordTiming = 0;
+}
+
 MAIN(dbScanTest)
 {
-    testPlan(3);
+    testPlan(23);
     testOnce();
+    testShards();
     return testDone();
 }
@@ -9,10 +9,11 @@
  * Lockset stress test.
  *
  * The test stratagy is for N threads to contend for M records.
- * Each thread will perform one of three operations:
+ * Each thread will perform one of four operations:
  * 1) Lock a single record.
  * 2) Lock several records.
  * 3) Retarget the TSEL link of a record
+ * 4) Read a record field from a snapshot, falling back to locking
  *
  *  Author: Michael Davidsaver <mdavidsaver@bnl.gov>
  */
@@ -58,14 +59,20 @@ static unsigned int nrecords;
 
 #define MAXLOCK 20
 
+#define NACT 4
+
 static dbCommon **precords;
 
 typedef struct {
     int id;
-    unsigned long N[3];
-    double X[3];
-    double X2[3];
-    double min[3], max[3];
+    unsigned long N[NACT];
+    double X[NACT];
+    double X2[NACT];
+    double min[NACT], max[NACT];
+
+    /* reads served by a snapshot, and the sum of values read */
+    unsigned long nsnap;
+    epicsInt32 sum;
 
     unsigned int done;
     epicsEventId donevent;
@@ -122,6 +129,29 @@ void doMulti(workerPriv *p)
     dbLockerFree(locker);
 }
 
+static
+void doRead(workerPriv *p)
+{
+    size_t recn = (size_t)(getRand()*(nrecords-1));
+    dbCommon *prec = precords[recn];
+    xRecord *px = (xRecord*)prec;
+    dbScanSnapshot snap;
+    epicsInt32 val;
+
+    if(dbScanSnapshotBegin(prec, &snap)) {
+        val = px->val;
+        if(dbScanSnapshotEnd(&snap)) {
+            p->nsnap++;
+            p->sum += val;
+            return;
+        }
+    }
+
+    dbScanLock(prec);
+    p->sum += px->val;
+    dbScanUnlock(prec);
+}
+
 static
 void doreTarget(workerPriv *p)
 {
@@ -169,15 +199,18 @@ void worker(void *raw)
 
         before = epicsMonotonicGet();
 
-        if(sel<0.33) {
+        if(sel<0.25) {
             doSingle(priv);
             act = 0;
-        } else if(sel<0.66) {
+        } else if(sel<0.5) {
             doMulti(priv);
             act = 1;
-        } else {
+        } else if(sel<0.75) {
             doreTarget(priv);
             act = 2;
+        } else {
+            doRead(priv);
+            act = 3;
         }
 
         after = epicsMonotonicGet();
@@ -217,10 +250,10 @@ MAIN(dbStressTest)
             nworkers = val;
     }
 
-    testPlan(80+nworkers*3);
+    testPlan(120+nworkers*NACT);
 
 #if defined(__rtems__)
-    testSkip(80+nworkers*3, "Test assumes time sliced preempting scheduling");
+    testSkip(120+nworkers*NACT, "Test assumes time sliced preempting scheduling");
     return testDone();
 #endif
 
@@ -322,6 +355,8 @@ MAIN(dbStressTest)
             testOk(ellCount(&ls->lockRecordList)==ls->refcount, "%s only lockRecords hold refs. %d == %d",
                    prec->name,ellCount(&ls->lockRecordList),ls->refcount);
             testOk1(ls->ownerlocker==NULL);
+            testOk(ls->depth==0 && (ls->seq&1)==0, "%s lockSet unlocked. depth=%d seq=%lu",
+                   prec->name, ls->depth, (unsigned long)ls->seq);
         }
 
     }
@@ -329,22 +364,22 @@ MAIN(dbStressTest)
 
     testDiag("Statistics");
     for(i=0; i<nworkers; i++) {
-        double avg[3], std[3];
+        double avg[NACT], std[NACT];
         unsigned j;
         testDiag("Worker %u", i);
-        for(j=0; j<3; j++) {
+        for(j=0; j<NACT; j++) {
             avg[j] = priv[i].X[j]/priv[i].N[j];
             std[j] = sqrt( (priv[i].X2[j]/priv[i].N[j]) - avg[j]*avg[j] );
         }
-        testDiag("N = %lu\t%lu\t%lu", priv[i].N[0], priv[i].N[1], priv[i].N[2]);
-        testDiag("AVG = %g us\t%g us\t%g us", avg[0]*1e6, avg[1]*1e6, avg[2]*1e6);
-        testDiag("STD = %g us\t%g us\t%g us", std[0]*1e6, std[1]*1e6, std[2]*1e6);
-        testDiag("MIN = %g us\t%g us\t%g us", priv[i].min[0]*1e6, priv[i].min[1]*1e6, priv[i].min[2]*1e6);
-        testDiag("MAX = %g us\t%g us\t%g us", priv[i].max[0]*1e6, priv[i].max[1]*1e6, priv[i].max[2]*1e6);
-
-        testOk1(priv[i].N[0]>0);
-        testOk1(priv[i].N[1]>0);
-        testOk1(priv[i].N[2]>0);
+        testDiag("N = %lu\t%lu\t%lu\t%lu", priv[i].N[0], priv[i].N[1], priv[i].N[2], priv[i].N[3]);
+        testDiag("AVG = %g us\t%g us\t%g us\t%g us", avg[0]*1e6, avg[1]*1e6, avg[2]*1e6, avg[3]*1e6);
+        testDiag("STD = %g us\t%g us\t%g us\t%g us", std[0]*1e6, std[1]*1e6, std[2]*1e6, std[3]*1e6);
+        testDiag("MIN = %g us\t%g us\t%g us\t%g us", priv[i].min[0]*1e6, priv[i].min[1]*1e6, priv[i].min[2]*1e6, priv[i].min[3]*1e6);
+        testDiag("MAX = %g us\t%g us\t%g us\t%g us", priv[i].max[0]*1e6, priv[i].max[1]*1e6, priv[i].max[2]*1e6, priv[i].max[3]*1e6);
+        testDiag("Reads without locking %lu of %lu", priv[i].nsnap, priv[i].N[3]);
+
+        for(j=0; j<NACT; j++)
+            testOk(priv[i].N[j]>0, "priv[%u].N[%u]>0", i, j);
     }
 
     testIocShutdownOk();
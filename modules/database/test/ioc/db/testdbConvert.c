@@ -8,6 +8,8 @@
 #include "dbConvert.h"
 #include "dbDefs.h"
 #include "epicsAssert.h"
+#include "epicsMath.h"
+#include "epicsConvert.h"
 
 #include "epicsUnitTest.h"
 #include "testMain.h"
@@ -146,10 +148,96 @@ static void testBasicPut(void)
     free(scratch);
 }
 
+static void testConvertWrap(void)
+{
+    double d_scratch[NELEMENTS(s_input)];
+    short s_scratch[NELEMENTS(s_input)];
+    DBADDR addr;
+    GETCONVERTFUNC getter = dbGetConvertRoutine[DBF_SHORT][DBF_DOUBLE];
+    PUTCONVERTFUNC putter = dbPutConvertRoutine[DBF_DOUBLE][DBF_SHORT];
+    long i;
+    int ok;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.field_type = DBF_SHORT;
+    addr.field_size = sizeof(short);
+    addr.no_elements = s_input_len;
+    addr.pfield = (void*)s_input;
+
+    testDiag("Test converting arrays with offset and wrap");
+
+    getter(&addr, d_scratch, s_input_len, s_input_len, 0);
+    for (ok = 1, i = 0; i < s_input_len; i++)
+        ok &= d_scratch[i] == s_input[i];
+    testOk(ok, "Get SHORT as DOUBLE, entire array");
+
+    getter(&addr, d_scratch, s_input_len, s_input_len, 3);
+    for (ok = 1, i = 0; i < s_input_len; i++)
+        ok &= d_scratch[i] == s_input[(i + 3) % s_input_len];
+    testOk(ok, "Get SHORT as DOUBLE, with wrap");
+
+    for (i = 0; i < s_input_len; i++)
+        d_scratch[i] = s_input[i];
+    addr.pfield = (void*)s_scratch;
+    memset(s_scratch, 0, sizeof(s_scratch));
+    putter(&addr, d_scratch, s_input_len, s_input_len, 5);
+    for (ok = 1, i = 0; i < s_input_len; i++)
+        ok &= s_scratch[(i + 5) % s_input_len] == s_input[i];
+    testOk(ok, "Put DOUBLE to SHORT, with wrap");
+}
+
+static void testDoubleToFloat(void)
+{
+    double d_input[] = {0.0, 1.5, -2.25, 1e300, -1e300, 1e-300, -1e-300,
+                        3.4e38, 1e-40};
+    float f_scratch[NELEMENTS(d_input)];
+    const long n = NELEMENTS(d_input);
+    DBADDR addr;
+    GETCONVERTFUNC getter = dbGetConvertRoutine[DBF_DOUBLE][DBF_FLOAT];
+    PUTCONVERTFUNC putter = dbPutConvertRoutine[DBF_DOUBLE][DBF_FLOAT];
+    long i;
+    int ok;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.field_type = DBF_DOUBLE;
+    addr.field_size = sizeof(double);
+    addr.no_elements = n;
+    addr.pfield = (void*)d_input;
+
+    testDiag("Test DOUBLE to FLOAT range limiting");
+
+    getter(&addr, f_scratch, n, n, 0);
+    for (ok = 1, i = 0; i < n; i++)
+        ok &= f_scratch[i] == epicsConvertDoubleToFloat(d_input[i]);
+    testOk(ok, "Get DOUBLE as FLOAT matches epicsConvertDoubleToFloat()");
+
+    addr.field_type = DBF_FLOAT;
+    addr.field_size = sizeof(float);
+    addr.pfield = (void*)f_scratch;
+    memset(f_scratch, 0, sizeof(f_scratch));
+    putter(&addr, d_input, n, n, 2);
+    for (ok = 1, i = 0; i < n; i++)
+        ok &= f_scratch[(i + 2) % n] == epicsConvertDoubleToFloat(d_input[i]);
+    testOk(ok, "Put DOUBLE to FLOAT matches epicsConvertDoubleToFloat()");
+
+    d_input[0] = epicsINF;
+    d_input[1] = -epicsINF;
+    d_input[2] = epicsNAN;
+    addr.field_type = DBF_DOUBLE;
+    addr.field_size = sizeof(double);
+    addr.pfield = (void*)d_input;
+    getter(&addr, f_scratch, n, n, 0);
+    testOk(isinf(f_scratch[0]) && f_scratch[0] > 0 &&
+           isinf(f_scratch[1]) && f_scratch[1] < 0 &&
+           isnan(f_scratch[2]), "Infinity and NaN are passed through");
+}
+
 MAIN(testdbConvert)
 {
-    testPlan(15);
+    testPlan(21);
     testBasicGet();
     testBasicPut();
+    testConvertWrap();
+    testDoubleToFloat();
     return testDone();
 }
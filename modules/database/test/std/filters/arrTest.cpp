@@ -37,6 +37,7 @@
 #include "iocInit.h"
 #include "iocsh.h"
 #include "dbChannel.h"
+#include "dbEvent.h"
 #include "epicsUnitTest.h"
 #include "dbUnitTest.h"
 #include "testMain.h"
@@ -292,13 +293,99 @@ static void check(short dbr_type) {
     TEST5B(3, -8, -4, "both sides from-end");
 }
 
+static void dummySub(void *, struct dbChannel *, int, db_field_log *) {}
+
+static void checkSnapshot(dbEventCtx evtctx)
+{
+    dbChannel *pch1, *pch2;
+    db_field_log *pshared, *pfl1, *pfl2;
+    dbEventSubscription sub;
+    void *pmem;
+    dbAddr valaddr;
+    epicsInt32 ar[10] = {10,11,12,13,14,15,16,17,18,19};
+    epicsInt32 ar5_0_1[10] = {12,13,14,15,16};
+    epicsInt32 off = 0;
+    dbAddr offaddr;
+
+    testHead("Shared snapshot, increment 1 and 2");
+
+    (void) dbNameToAddr("x.OFF", &offaddr);
+    (void) dbPutField(&offaddr, DBR_LONG, &off, 1);
+    (void) dbNameToAddr("x.VAL", &valaddr);
+    (void) dbPutField(&valaddr, DBR_LONG, ar, 10);
+
+    createAndOpen("x.VAL", "{\"arr\":{\"s\":2,\"e\":6}}", "(2:1:6)", &pch1, 1);
+    createAndOpen("x.VAL", "{\"arr\":{\"s\":2,\"e\":6,\"i\":2}}", "(2:2:6)", &pch2, 1);
+
+    pshared = db_create_read_log(pch1);
+    dbScanLock(dbChannelRecord(pch1));
+    dbChannelMakeArraySnapshot(pshared, pch1);
+    dbScanUnlock(dbChannelRecord(pch1));
+    testOk(dbChannelIsArraySnapshot(pshared), "field log has a snapshot");
+    testOk(pshared->no_elements == 10, "snapshot has %ld elements",
+           pshared->no_elements);
+
+    pfl1 = db_create_read_log(pch1);
+    pfl2 = db_create_read_log(pch2);
+    dbChannelShareArraySnapshot(pfl1, pshared);
+    dbChannelShareArraySnapshot(pfl2, pshared);
+    testOk(pfl1->u.r.field == pshared->u.r.field &&
+           pfl2->u.r.field == pshared->u.r.field, "snapshot data is shared");
+
+    /* Change the record, the snapshot must not change */
+    ar[2] = 99;
+    (void) dbPutField(&valaddr, DBR_LONG, ar, 10);
+
+    pfl1 = dbChannelRunPostChain(pch1, pfl1);
+    testOk(pfl1->u.r.field == (char *) pshared->u.r.field + 2 * pfl1->field_size,
+           "contiguous slice points into the snapshot");
+    testOk(fl_equals_array(DBR_LONG, pfl1, ar5_0_1), "slice data correct");
+
+    pfl2 = dbChannelRunPostChain(pch2, pfl2);
+    testOk(!dbChannelIsArraySnapshot(pfl2), "strided slice is a copy");
+    testOk(pfl2->no_elements == 3 &&
+           ((epicsInt32 *) pfl2->u.r.field)[0] == 12 &&
+           ((epicsInt32 *) pfl2->u.r.field)[2] == 16, "strided data correct");
+
+    pmem = pshared->u.r.pvt;
+    db_delete_field_log(pshared);
+    testOk(fl_equals_array(DBR_LONG, pfl1, ar5_0_1),
+           "slice still valid after the original is deleted");
+    db_delete_field_log(pfl1);
+    db_delete_field_log(pfl2);
+
+    pshared = db_create_read_log(pch1);
+    dbScanLock(dbChannelRecord(pch1));
+    dbChannelMakeArraySnapshot(pshared, pch1);
+    dbScanUnlock(dbChannelRecord(pch1));
+    testOk(pshared->u.r.pvt == pmem, "snapshot memory comes from a free list");
+    db_delete_field_log(pshared);
+
+    /* arr reads its slice from the record, without a snapshot */
+    sub = db_add_event(evtctx, pch1, dummySub, NULL, DBE_VALUE);
+    dbScanLock(dbChannelRecord(pch1));
+    pfl1 = db_create_event_log((struct evSubscrip *) sub);
+    dbScanUnlock(dbChannelRecord(pch1));
+    testOk(pfl1 && pfl1->type == dbfl_type_rec,
+           "event log for a post-queue filter refers to the record");
+    pfl1 = dbChannelRunPostChain(pch1, pfl1);
+    ar5_0_1[0] = 99;
+    testOk(pfl1->no_elements == 5 && fl_equals_array(DBR_LONG, pfl1, ar5_0_1),
+           "slice read from the record");
+    db_delete_field_log(pfl1);
+    db_cancel_event(sub);
+
+    dbChannelDelete(pch1);
+    dbChannelDelete(pch2);
+}
+
 MAIN(arrTest)
 {
     dbEventCtx evtctx;
     const chFilterPlugin *plug;
     char arr[] = "arr";
 
-    testPlan(1402);
+    testPlan(1423);
 
     /* Prepare the IOC */
 
@@ -325,6 +412,7 @@ MAIN(arrTest)
     check(DBR_LONG);
     check(DBR_DOUBLE);
     check(DBR_STRING);
+    checkSnapshot(evtctx);
 
     db_close_events(evtctx);
 
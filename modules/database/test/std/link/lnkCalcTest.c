@@ -154,11 +154,85 @@ static void testCalc()
 }
 
 
+static void testACalc()
+{
+    ioRecord *pio;
+    DBLINK *pinp;
+    long status, nReq;
+    epicsFloat64 f64[8];
+    epicsInt32 i32[8];
+
+    startTestIoc("ioRecord.db");
+
+    pio = (ioRecord *) testdbRecordPtr("io");
+    pinp = &pio->input;
+
+    testDiag("testing lnkACalc input");
+
+    {
+        dbStateId blue = dbStateCreate("blue");
+
+        testPutLongStr("io.INPUT", "{\"acalc\":{"
+            "\"expr\":\"A*B+C\","
+            "\"args\":[{\"const\":[1,2,3,4]},10,{\"state\":\"blue\"}]"
+            "}}");
+        if (testOk1(pinp->type == JSON_LINK))
+            testDiag("Link was set to '%s'", pinp->value.json.string);
+
+        status = dbGetNelements(pinp, &nReq);
+        testOk(!status && nReq == 4, "dbGetNelements returned %ld", nReq);
+
+        dbStateSet(blue);
+        nReq = NELEMENTS(f64);
+        status = dbGetLink(pinp, DBF_DOUBLE, f64, NULL, &nReq);
+        testOk(!status, "dbGetLink succeeded (status = %ld)", status);
+        testOk(nReq == 4, "Got 4 elements (%ld)", nReq);
+        testOk(f64[0] == 11 && f64[1] == 21 && f64[2] == 31 && f64[3] == 41,
+            "Got [%g, %g, %g, %g]", f64[0], f64[1], f64[2], f64[3]);
+
+        dbStateClear(blue);
+        nReq = 2;
+        status = dbGetLink(pinp, DBF_LONG, i32, NULL, &nReq);
+        testOk(!status, "dbGetLink succeeded (status = %ld)", status);
+        testOk(nReq == 2, "Got 2 elements (%ld)", nReq);
+        testOk(i32[0] == 10 && i32[1] == 20, "Got [%d, %d]", i32[0], i32[1]);
+    }
+
+    {
+        testPutLongStr("io.INPUT", "{\"acalc\":{"
+            "\"expr\":\"A-AVG(A)\","
+            "\"args\":[{\"const\":[1,2,3,4]}]"
+            "}}");
+        nReq = NELEMENTS(f64);
+        status = dbGetLink(pinp, DBF_DOUBLE, f64, NULL, &nReq);
+        testOk(!status, "dbGetLink succeeded (status = %ld)", status);
+        testOk(nReq == 4 && f64[0] == -1.5 && f64[1] == -0.5 &&
+            f64[2] == 0.5 && f64[3] == 1.5,
+            "A-AVG(A) = [%g, %g, %g, %g]", f64[0], f64[1], f64[2], f64[3]);
+
+        testPutLongStr("io.INPUT", "{\"acalc\":{"
+            "\"expr\":\"AMAX(A)\","
+            "\"args\":[{\"const\":[1,7,3,4]}]"
+            "}}");
+        nReq = NELEMENTS(f64);
+        status = dbGetLink(pinp, DBF_DOUBLE, f64, NULL, &nReq);
+        testOk(!status, "dbGetLink succeeded (status = %ld)", status);
+        testOk(nReq == 4 && f64[0] == 7 && f64[3] == 7,
+            "AMAX(A) = %g in all %ld elements", f64[0], nReq);
+    }
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+}
+
+
 MAIN(lnkCalcTest)
 {
     testPlan(0);
 
     testCalc();
+    testACalc();
 
     return testDone();
 }
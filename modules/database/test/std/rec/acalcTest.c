@@ -0,0 +1,121 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+#include "dbAccess.h"
+#include "dbUnitTest.h"
+#include "errlog.h"
+#include "alarm.h"
+#include "testMain.h"
+
+void recTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+static void testElementwise(void)
+{
+    const double first[] = {10, 20, 30, 40, 50};
+    const double second[] = {20, 40, 60, 80, 100};
+    const double input[] = {1, 2, 3, 4, 5};
+    const double sum[] = {15, 15, 15, 15, 15};
+
+    testDiag("Array inputs combine with scalars element by element");
+
+    testdbPutFieldOk("ac.PROC", DBF_LONG, 1);
+    testdbGetFieldEqual("ac.NORD", DBF_ULONG, 5);
+    testdbGetFieldEqual("ac.NA", DBF_ULONG, 5);
+    testdbGetFieldEqual("ac.NB", DBF_ULONG, 1);
+    testdbGetArrFieldEqual("ac", DBF_DOUBLE, 8, NELEMENTS(first), first);
+    testdbGetArrFieldEqual("ac.A", DBF_DOUBLE, 8, NELEMENTS(input), input);
+
+    testDiag("VAL is the previous result");
+
+    testdbPutFieldOk("ac.PROC", DBF_LONG, 1);
+    testdbGetArrFieldEqual("ac", DBF_DOUBLE, 8, NELEMENTS(second), second);
+
+    testDiag("Reductions give the same result for every element");
+
+    testdbPutFieldOk("ac.CALC", DBF_STRING, "SUM(A)");
+    testdbPutFieldOk("ac.PROC", DBF_LONG, 1);
+    testdbGetArrFieldEqual("ac", DBF_DOUBLE, 8, NELEMENTS(sum), sum);
+    testdbGetFieldEqual("ac.SEVR", DBF_SHORT, NO_ALARM);
+
+    testDiag("A bad expression leaves the record in alarm");
+
+    eltc(0);
+    testdbPutFieldOk("ac.CALC", DBF_STRING, "A+");
+    eltc(1);
+    testdbPutFieldOk("ac.PROC", DBF_LONG, 1);
+    testdbGetFieldEqual("ac.SEVR", DBF_SHORT, INVALID_ALARM);
+    testdbGetFieldEqual("ac.STAT", DBF_SHORT, CALC_ALARM);
+}
+
+static void testLimits(void)
+{
+    const double centered[] = {-1.5, -0.5, 0.5, 1.5};
+    const double loaded[] = {2, 3, 4};
+    const double put[] = {5, 6};
+    const double putResult[] = {6, 7};
+
+    testDiag("Inputs are limited to NELM elements");
+
+    testdbPutFieldOk("mean.PROC", DBF_LONG, 1);
+    testdbGetFieldEqual("mean.NA", DBF_ULONG, 4);
+    testdbGetArrFieldEqual("mean", DBF_DOUBLE, 4,
+        NELEMENTS(centered), centered);
+
+    testDiag("Constant input links");
+
+    testdbGetFieldEqual("const.NA", DBF_ULONG, 3);
+    testdbPutFieldOk("const.PROC", DBF_LONG, 1);
+    testdbGetArrFieldEqual("const", DBF_DOUBLE, 5, NELEMENTS(loaded), loaded);
+
+    testDiag("Input arrays can be written directly");
+
+    testdbPutArrFieldOk("const.A", DBF_DOUBLE, NELEMENTS(put), put);
+    testdbGetFieldEqual("const.NA", DBF_ULONG, 2);
+    testdbPutFieldOk("const.PROC", DBF_LONG, 1);
+    testdbGetArrFieldEqual("const", DBF_DOUBLE, 5,
+        NELEMENTS(putResult), putResult);
+}
+
+static void testConditional(void)
+{
+    const double all[] = {4, 5, 5, 6, 6, 7};
+    const double mask[] = {1, 0, 1, 0};
+    const double some[] = {4, -1, 5, -1};
+
+    testDiag("Elements may take different branches of ?:");
+
+    testdbPutFieldOk("cond.PROC", DBF_LONG, 1);
+    testdbGetArrFieldEqual("cond", DBF_DOUBLE, 6, NELEMENTS(all), all);
+
+    testDiag("The branches diverge after the input gets shorter");
+
+    testdbPutArrFieldOk("cond.A", DBF_DOUBLE, NELEMENTS(mask), mask);
+    testdbPutFieldOk("cond.PROC", DBF_LONG, 1);
+    testdbGetFieldEqual("cond.NORD", DBF_ULONG, 4);
+    testdbGetArrFieldEqual("cond", DBF_DOUBLE, 6, NELEMENTS(some), some);
+}
+
+MAIN(acalcTest)
+{
+    testPlan(32);
+
+    testdbPrepare();
+    testdbReadDatabase("recTestIoc.dbd", NULL, NULL);
+    recTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("acalcTest.db", NULL, NULL);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    testElementwise();
+    testLimits();
+    testConditional();
+
+    testIocShutdownOk();
+    testdbCleanup();
+
+    return testDone();
+}
@@ -4,14 +4,19 @@
 * in file LICENSE that is included with this distribution.
 \*************************************************************************/
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "dbUnitTest.h"
 #include "testMain.h"
 #include "dbLock.h"
 #include "errlog.h"
 #include "dbAccess.h"
 #include "epicsMath.h"
+#include "epicsTime.h"
 
 #include "aiRecord.h"
+#include "waveformRecord.h"
 #include "compressRecord.h"
 
 #define testDEq(A,B,D) testOk(fabs((A)-(B))<(D), #A " (%f) ~= " #B " (%f)", A, B)
@@ -345,10 +350,252 @@ void testLIFOCirc(void)
     testdbCleanup();
 }
 
+static
+void startIoc(const char *macros)
+{
+    testdbPrepare();
+
+    testdbReadDatabase("recTestIoc.dbd", NULL, NULL);
+
+    recTestIoc_registerRecordDeviceDriver(pdbbase);
+
+    testdbReadDatabase("compressTest.db", NULL, macros);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+}
+
+static
+void stopIoc(void)
+{
+    testIocShutdownOk();
+
+    testdbCleanup();
+}
+
+/* set the waveform and process the compress record reading it */
+static
+void pushArray(const char *pv, const double *vals, epicsUInt32 n)
+{
+    waveformRecord *wrec = (waveformRecord*)testdbRecordPtr("wf");
+    dbCommon *crec = testdbRecordPtr(pv);
+
+    dbScanLock((dbCommon*)wrec);
+    memcpy(wrec->bptr, vals, n * sizeof(double));
+    wrec->nord = n;
+    dbScanUnlock((dbCommon*)wrec);
+
+    dbScanLock(crec);
+    dbProcess(crec);
+    dbScanUnlock(crec);
+}
+
+static
+void pushScalar(double val)
+{
+    aiRecord *vrec = (aiRecord*)testdbRecordPtr("val");
+    dbCommon *crec = testdbRecordPtr("comp");
+
+    dbScanLock(crec);
+    vrec->val = val;
+    dbProcess(crec);
+    dbScanUnlock(crec);
+}
+
+static const double blocks[16] = {
+    9, 1, 5, 3,
+    2, 8, 4, 6,
+    7, 7, 0, 10,
+    -1, -5, -3, -2
+};
+
+static
+void testNto1(const char *alg, epicsUInt32 n,
+    double a, double b, double c, double d)
+{
+    char macros[80];
+    long nexp = 16 / n < 4 ? 16 / n : 4;
+
+    testDiag("Test %s, N=%u", alg, n);
+
+    sprintf(macros, "ALG=%s,BALG=FIFO Buffer,NSAM=4,N=%u", alg, n);
+    startIoc(macros);
+
+    pushArray("compwf", blocks, 16);
+    checkArrD("compwf", nexp, a, b, c, d);
+
+    stopIoc();
+}
+
+static
+void testMoving(void)
+{
+    static const double ramp[5] = {1, 2, 3, 4, 5};
+    static const double step[2] = {10, 20};
+    compressRecord *crec;
+
+    testDiag("Test Moving Average");
+
+    startIoc("ALG=Moving Average,BALG=FIFO Buffer,NSAM=4,N=3");
+
+    pushScalar(3);
+    checkArrD("comp", 1, 3, 0, 0, 0);
+    pushScalar(6);
+    pushScalar(9);
+    pushScalar(30);
+    checkArrD("comp", 4, 3, 4.5, 6, 15);
+    pushScalar(epicsNAN);
+    pushScalar(3);
+    pushScalar(6);
+    pushScalar(9);
+    crec = (compressRecord*)testdbRecordPtr("comp");
+    testOk(isnan(crec->bptr[0]) && isnan(crec->bptr[1]) &&
+        isnan(crec->bptr[2]) && crec->bptr[3] == 6,
+        "Average is NaN while a NaN is in the window");
+
+    testdbPutFieldOk("compwf.N", DBF_LONG, 2);
+    pushArray("compwf", ramp, 5);
+    checkArrD("compwf", 4, 1.5, 2.5, 3.5, 4.5);
+    /* the window carries over to the next array */
+    pushArray("compwf", step, 2);
+    checkArrD("compwf", 4, 3.5, 4.5, 7.5, 15);
+
+    testdbPutFieldOk("compwf.RES", DBF_LONG, 0);
+    crec = (compressRecord*)testdbRecordPtr("compwf");
+    testOk1(crec->mcnt==0);
+    pushArray("compwf", step, 2);
+    checkArrD("compwf", 2, 10, 15, 0, 0);
+
+    stopIoc();
+
+    testDiag("Test Moving Median");
+
+    startIoc("ALG=Moving Median,BALG=FIFO Buffer,NSAM=4,N=3");
+
+    pushScalar(3);
+    pushScalar(9);
+    checkArrD("comp", 2, 3, 9, 0, 0);
+    pushScalar(6);
+    pushScalar(30);
+    pushScalar(1);
+    checkArrD("comp", 4, 9, 6, 9, 6);
+    pushScalar(6);
+    pushScalar(6);
+    checkArrD("comp", 4, 9, 6, 6, 6);
+
+    pushArray("compwf", blocks, 16);
+    checkArrD("compwf", 4, 0, -1, -3, -3);
+
+    stopIoc();
+}
+
+static
+double benchProcess(dbCommon *prec, int niter)
+{
+    epicsTimeStamp start, stop;
+    int i;
+
+    epicsTimeGetCurrent(&start);
+    dbScanLock(prec);
+    for (i = 0; i < niter; i++)
+        dbProcess(prec);
+    dbScanUnlock(prec);
+    epicsTimeGetCurrent(&stop);
+
+    return epicsTimeDiffInSeconds(&stop, &start) / niter * 1e3;
+}
+
+static
+int compareDouble(const void *arg1, const void *arg2)
+{
+    double a = *(const double *)arg1;
+    double b = *(const double *)arg2;
+
+    return a < b ? -1 : a > b ? 1 : 0;
+}
+
+#define BENCH_NELM 1000000
+#define BENCH_N 1001
+#define BENCH_NSAM (BENCH_NELM / BENCH_N)
+
+/* time each algorithm compressing 1M elements */
+static
+void testBenchmark(void)
+{
+    static const char * const algs[] = {
+        "N to 1 Low Value", "N to 1 High Value", "N to 1 Average",
+        "N to 1 Median", "Moving Average", "Moving Median"
+    };
+    char macros[80];
+    waveformRecord *wrec;
+    compressRecord *crec;
+    epicsTimeStamp start, stop;
+    epicsUInt32 seed = 1;
+    double *copy;
+    unsigned i, bad = 0;
+
+    testDiag("Benchmark %u elements, N=%u", BENCH_NELM, BENCH_N);
+
+    sprintf(macros, "ALG=N to 1 Median,BALG=FIFO Buffer,NSAM=%u,N=%u,NELM=%u",
+        BENCH_NSAM, BENCH_N, BENCH_NELM);
+    startIoc(macros);
+
+    wrec = (waveformRecord*)testdbRecordPtr("wf");
+    crec = (compressRecord*)testdbRecordPtr("compwf");
+
+    copy = malloc(BENCH_NELM * sizeof(double));
+    if (!copy)
+        testAbort("No memory");
+
+    dbScanLock((dbCommon*)wrec);
+    for (i = 0; i < BENCH_NELM; i++) {
+        seed = seed * 1664525 + 1013904223;
+        ((double *)wrec->bptr)[i] = copy[i] = seed >> 8;
+    }
+    wrec->nord = BENCH_NELM;
+    dbScanUnlock((dbCommon*)wrec);
+
+    /* the qsort() per block which N to 1 Median used to do */
+    epicsTimeGetCurrent(&start);
+    for (i = 0; i < BENCH_NSAM; i++)
+        qsort(&copy[i * BENCH_N], BENCH_N, sizeof(double), compareDouble);
+    epicsTimeGetCurrent(&stop);
+    testDiag("%-18s %9.3f ms", "qsort() blocks",
+        epicsTimeDiffInSeconds(&stop, &start) * 1e3);
+
+    dbScanLock((dbCommon*)crec);
+    dbProcess((dbCommon*)crec);
+    for (i = 0; i < BENCH_NSAM; i++) {
+        if (crec->bptr[i] != copy[i * BENCH_N + BENCH_N / 2])
+            bad++;
+    }
+    dbScanUnlock((dbCommon*)crec);
+    testOk(bad == 0, "%u of %u medians match qsort()", BENCH_NSAM - bad,
+        BENCH_NSAM);
+
+    for (i = 0; i < NELEMENTS(algs); i++) {
+        testdbPutFieldOk("compwf.ALG", DBF_STRING, algs[i]);
+        testDiag("%-18s %9.3f ms", algs[i],
+            benchProcess((dbCommon*)crec, i < 4 ? 10 : 1));
+    }
+
+    free(copy);
+    stopIoc();
+}
+
 MAIN(compressTest)
 {
-    testPlan(116);
+    testPlan(142);
     testFIFOCirc();
     testLIFOCirc();
+    testNto1("N to 1 Low Value", 4, 1, 2, 0, -5);
+    testNto1("N to 1 High Value", 4, 9, 8, 10, -1);
+    testNto1("N to 1 Average", 4, 4.5, 5, 6, -2.75);
+    testNto1("N to 1 Median", 4, 5, 6, 7, -2);
+    testNto1("N to 1 Median", 5, 3, 7, -1, 0);
+    testNto1("N to 1 Median", 16, 4, 0, 0, 0);
+    testMoving();
+    testBenchmark();
     return testDone();
 }
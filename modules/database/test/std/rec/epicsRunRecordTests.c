@@ -23,6 +23,7 @@ int asyncSoftTest(void);
 int simmTest(void);
 int mbbioDirectTest(void);
 int scanEventTest(void);
+int acalcTest(void);
 
 void epicsRunRecordTests(void)
 {
@@ -50,5 +51,7 @@ void epicsRunRecordTests(void)
 
     runTest(scanEventTest);
 
+    runTest(acalcTest);
+
     epicsExit(0);   /* Trigger test harness */
 }
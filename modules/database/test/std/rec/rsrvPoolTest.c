@@ -0,0 +1,280 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Start the IOC's CA server with a single I/O thread, which serves
+ * several CA clients in this process. One of them stops reading and
+ * then asks for more large arrays than the socket buffers hold, so the
+ * I/O thread's sends to it block. The others must still get their
+ * replies promptly, and the slow client must get everything once it
+ * reads again.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "cadef.h"
+#include "db_access_routines.h"
+#include "dbServer.h"
+#include "dbUnitTest.h"
+#include "envDefs.h"
+#include "epicsEvent.h"
+#include "epicsMutex.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "errlog.h"
+#include "iocsh.h"
+#include "testMain.h"
+
+void recTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+#define NFAST 4
+#define NELEM 100000
+#define NGETS 64
+#define NROUNDS 20
+#define VALUE 42
+
+typedef struct {
+    struct ca_client_context *ctx;
+    chid chan;
+    double maxDelay;
+    unsigned nFailed;
+} fastClient;
+
+static fastClient fast[NFAST];
+static chid bigChan; /* of fast[0] */
+
+static struct {
+    struct ca_client_context *ctx;
+    chid chan;
+    evid subscr;
+    epicsEventId stalled, release;
+    unsigned nUpdates;
+    unsigned nGets;
+    unsigned nBad;
+} slow;
+
+static epicsMutexId lock;
+static epicsInt32 buf[NELEM];
+
+/* a context of its own, so a circuit of its own, for each client */
+static struct ca_client_context * newContext(void)
+{
+    struct ca_client_context *ctx;
+
+    SEVCHK(ca_context_create(ca_enable_preemptive_callback),
+           "ca_context_create");
+    ctx = ca_current_context();
+    ca_detach_context();
+    return ctx;
+}
+
+static void useContext(struct ca_client_context *ctx)
+{
+    if (ca_current_context())
+        ca_detach_context();
+    SEVCHK(ca_attach_context(ctx), "ca_attach_context");
+}
+
+/* holds up the slow client's receive thread until released */
+static void slowUpdate(struct event_handler_args args)
+{
+    int first;
+
+    epicsMutexMustLock(lock);
+    first = !slow.nUpdates++;
+    if (args.status != ECA_NORMAL || args.count != NELEM)
+        slow.nBad++;
+    epicsMutexUnlock(lock);
+
+    if (first) {
+        epicsEventSignal(slow.stalled);
+        epicsEventMustWait(slow.release);
+    }
+}
+
+static void slowGet(struct event_handler_args args)
+{
+    const epicsInt32 *pval = (const epicsInt32 *) args.dbr;
+
+    epicsMutexMustLock(lock);
+    slow.nGets++;
+    if (args.status != ECA_NORMAL || args.count != NELEM ||
+            pval[NELEM - 1] != VALUE)
+        slow.nBad++;
+    epicsMutexUnlock(lock);
+}
+
+static void connectAll(void)
+{
+    unsigned n;
+    int status = ECA_NORMAL;
+
+    useContext(slow.ctx);
+    SEVCHK(ca_create_channel("rsrvPoolTest:big", NULL, NULL, 0, &slow.chan),
+           "ca_create_channel");
+    if (ca_pend_io(10.0) != ECA_NORMAL)
+        status = ECA_TIMEOUT;
+
+    for (n = 0; n < NFAST; n++) {
+        useContext(fast[n].ctx);
+        SEVCHK(ca_create_channel("rsrvPoolTest:cnt", NULL, NULL, 0,
+                   &fast[n].chan),
+               "ca_create_channel");
+        if (!n) {
+            SEVCHK(ca_create_channel("rsrvPoolTest:big", NULL, NULL, 0,
+                       &bigChan),
+                   "ca_create_channel");
+        }
+        if (ca_pend_io(10.0) != ECA_NORMAL)
+            status = ECA_TIMEOUT;
+    }
+    testOk(status == ECA_NORMAL, "%u clients connected", NFAST + 1);
+    if (status != ECA_NORMAL)
+        testAbort("Can't connect to the IOC's own CA server");
+}
+
+/* stop reading, then ask for more than the socket buffers hold */
+static void stallSlowClient(void)
+{
+    unsigned i;
+    epicsInt32 last;
+
+    useContext(fast[0].ctx);
+    for (i = 0; i < NELEM; i++)
+        buf[i] = VALUE;
+    SEVCHK(ca_array_put(DBR_LONG, NELEM, bigChan, buf), "ca_array_put");
+    /* the put is done when this is */
+    SEVCHK(ca_array_get(DBR_LONG, 1, bigChan, &last), "ca_array_get");
+    if (ca_pend_io(10.0) != ECA_NORMAL || last != VALUE)
+        testAbort("Writing the waveform failed");
+
+    useContext(slow.ctx);
+    SEVCHK(ca_create_subscription(DBR_LONG, NELEM, slow.chan, DBE_VALUE,
+               slowUpdate, NULL, &slow.subscr),
+           "ca_create_subscription");
+    ca_flush_io();
+    testOk(epicsEventWaitWithTimeout(slow.stalled, 10.0) == epicsEventWaitOK,
+           "Slow client stopped reading");
+
+    /* the replies are made on the I/O thread */
+    testDiag("Slow client asks for %u arrays of %u bytes",
+             NGETS, (unsigned) sizeof(buf));
+    for (i = 0; i < NGETS; i++) {
+        SEVCHK(ca_array_get_callback(DBR_LONG, NELEM, slow.chan,
+                   slowGet, NULL), "ca_array_get_callback");
+    }
+    ca_flush_io();
+    epicsThreadSleep(0.5);
+}
+
+/* round trips of the other clients while the slow one isn't reading */
+static void pingFastClients(void)
+{
+    unsigned n, round;
+
+    for (round = 0; round < NROUNDS; round++) {
+        for (n = 0; n < NFAST; n++) {
+            fastClient *pfast = &fast[n];
+            epicsTimeStamp begin, end;
+            epicsInt32 val = round * NFAST + n, got = -1;
+            double delay;
+
+            useContext(pfast->ctx);
+            epicsTimeGetCurrent(&begin);
+            SEVCHK(ca_put(DBR_LONG, pfast->chan, &val), "ca_put");
+            SEVCHK(ca_get(DBR_LONG, pfast->chan, &got), "ca_get");
+            if (ca_pend_io(5.0) != ECA_NORMAL || got != val)
+                pfast->nFailed++;
+            epicsTimeGetCurrent(&end);
+            delay = epicsTimeDiffInSeconds(&end, &begin);
+            if (delay > pfast->maxDelay)
+                pfast->maxDelay = delay;
+        }
+    }
+}
+
+MAIN(rsrvPoolTest)
+{
+    unsigned n;
+    double waited;
+
+    testPlan(4 + NFAST);
+
+    /* only talk to this process */
+    epicsEnvSet("EPICS_CA_SERVER_PORT", "35063");
+    epicsEnvSet("EPICS_CAS_INTF_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_BEACON_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_AUTO_BEACON_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CA_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CA_AUTO_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CA_MAX_ARRAY_BYTES", "1000000");
+
+    lock = epicsMutexMustCreate();
+    slow.stalled = epicsEventMustCreate(epicsEventEmpty);
+    slow.release = epicsEventMustCreate(epicsEventEmpty);
+
+    /* Before iocInit, which makes later contexts use the database for
+     * channels to its own records instead of the network
+     */
+    slow.ctx = newContext();
+    for (n = 0; n < NFAST; n++)
+        fast[n].ctx = newContext();
+
+    testdbPrepare();
+    testdbReadDatabase("recTestIoc.dbd", NULL, NULL);
+    recTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("rsrvPoolTest.db", NULL, NULL);
+    iocshCmd("var rsrvIoThreads 1");
+
+    eltc(0);
+    testIocInitOk();
+    dbInitServers();
+    dbRunServers();
+    eltc(1);
+
+    connectAll();
+    stallSlowClient();
+    pingFastClients();
+    for (n = 0; n < NFAST; n++) {
+        testOk(!fast[n].nFailed && fast[n].maxDelay < 1.0,
+               "Client %u: %u failed, longest round trip %.3f sec",
+               n, fast[n].nFailed, fast[n].maxDelay);
+    }
+
+    epicsMutexMustLock(lock);
+    testOk(slow.nGets == 0, "Slow client got %u read replies meanwhile",
+           slow.nGets);
+    epicsMutexUnlock(lock);
+
+    epicsEventSignal(slow.release);
+    for (waited = 0.0; waited < 20.0; waited += 0.1) {
+        unsigned nGets;
+
+        epicsMutexMustLock(lock);
+        nGets = slow.nGets;
+        epicsMutexUnlock(lock);
+        if (nGets == NGETS)
+            break;
+        epicsThreadSleep(0.1);
+    }
+
+    epicsMutexMustLock(lock);
+    testOk(slow.nGets == NGETS && !slow.nBad,
+           "Slow client then got %u read replies and %u updates, %u bad",
+           slow.nGets, slow.nUpdates, slow.nBad);
+    epicsMutexUnlock(lock);
+
+    useContext(slow.ctx);
+    ca_context_destroy();
+    for (n = 0; n < NFAST; n++) {
+        useContext(fast[n].ctx);
+        ca_context_destroy();
+    }
+
+    /* The CA server can't be stopped, so leave the IOC running */
+
+    return testDone();
+}
@@ -0,0 +1,207 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Start the IOC's CA server and subscribe to several waveforms from a CA
+ * client in this process. Each put to the source record copies it into
+ * all of the waveforms, and the burst of updates fills more than one send
+ * buffer, so RSRV queues full buffers and sends them together. Every
+ * update must arrive complete, and those of each channel in the order
+ * they were posted.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "cadef.h"
+#include "db_access_routines.h"
+#include "dbServer.h"
+#include "dbUnitTest.h"
+#include "envDefs.h"
+#include "epicsMutex.h"
+#include "epicsThread.h"
+#include "errlog.h"
+#include "testMain.h"
+
+void recTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+#define NCHANS 8
+#define NELEM 1000
+#define NROUNDS 50
+
+typedef struct {
+    unsigned n;
+    chid chan;
+    evid subscr;
+    unsigned nUpdates;
+    long lastRound;     /* -1 before the first update */
+    unsigned nBad;      /* with wrong data, or out of order */
+    unsigned nOther;    /* other failures */
+} subscriber;
+
+static subscriber subs[NCHANS];
+static chid src;
+static epicsMutexId lock;
+
+/* element i of the value in round r */
+static epicsInt32 value(long r, unsigned i)
+{
+    return r ? r * 100000 + i : 0;
+}
+
+static void update(struct event_handler_args args)
+{
+    subscriber *psub = (subscriber *) args.usr;
+    const epicsInt32 *pval = (const epicsInt32 *) args.dbr;
+    long round;
+    unsigned i;
+
+    epicsMutexMustLock(lock);
+    psub->nUpdates++;
+    if (args.status != ECA_NORMAL || args.count != NELEM) {
+        psub->nOther++;
+        epicsMutexUnlock(lock);
+        return;
+    }
+    round = pval[0] / 100000;
+    for (i = 0; i < NELEM; i++) {
+        if (pval[i] != value(round, i))
+            break;
+    }
+    if (i < NELEM || round <= psub->lastRound)
+        psub->nBad++;
+    else
+        psub->lastRound = round;
+    epicsMutexUnlock(lock);
+}
+
+static void connectAll(void)
+{
+    static epicsInt32 zeros[NELEM];
+    unsigned n;
+    int status;
+
+    for (n = 0; n < NCHANS; n++) {
+        char name[40];
+
+        subs[n].n = n;
+        subs[n].lastRound = -1;
+        sprintf(name, "rsrvSendTest:wf%u", n);
+        SEVCHK(ca_create_channel(name, NULL, NULL, 0, &subs[n].chan),
+               "ca_create_channel");
+    }
+    SEVCHK(ca_create_channel("rsrvSendTest:src", NULL, NULL, 0, &src),
+           "ca_create_channel");
+    status = ca_pend_io(10.0);
+    testOk(status == ECA_NORMAL, "Connected to %u channels: %s",
+           NCHANS + 1, ca_message(status));
+    if (status != ECA_NORMAL)
+        testAbort("Can't connect to the IOC's own CA server");
+
+    /* Fill the arrays, RSRV doesn't clear the first element of an
+     * update from an empty array, which would be round 0's
+     */
+    SEVCHK(ca_array_put(DBR_LONG, NELEM, src, zeros), "ca_array_put");
+    for (n = 0; n < NCHANS; n++) {
+        SEVCHK(ca_create_subscription(DBR_LONG, NELEM, subs[n].chan,
+                   DBE_VALUE, update, &subs[n], &subs[n].subscr),
+               "ca_create_subscription");
+    }
+    ca_flush_io();
+}
+
+/* wait until every subscription has seen the given round */
+static int waitForRound(long round, double timeout)
+{
+    double waited;
+
+    for (waited = 0.0; waited < timeout; waited += 0.05) {
+        unsigned n, ndone = 0;
+
+        epicsMutexMustLock(lock);
+        for (n = 0; n < NCHANS; n++) {
+            if (subs[n].lastRound >= round)
+                ndone++;
+        }
+        epicsMutexUnlock(lock);
+        if (ndone == NCHANS)
+            return 1;
+        epicsThreadSleep(0.05);
+    }
+    return 0;
+}
+
+static void postBursts(void)
+{
+    static epicsInt32 buf[NELEM];
+    long round;
+    unsigned i;
+
+    testDiag("%u rounds of %u updates of %u bytes",
+             NROUNDS, NCHANS, (unsigned) sizeof(buf));
+
+    for (round = 1; round <= NROUNDS; round++) {
+        for (i = 0; i < NELEM; i++)
+            buf[i] = value(round, i);
+        SEVCHK(ca_array_put(DBR_LONG, NELEM, src, buf), "ca_array_put");
+        ca_flush_io();
+    }
+}
+
+MAIN(rsrvSendTest)
+{
+    unsigned n;
+
+    testPlan(2 + NCHANS);
+
+    /* only talk to this process */
+    epicsEnvSet("EPICS_CA_SERVER_PORT", "35062");
+    epicsEnvSet("EPICS_CAS_INTF_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_BEACON_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_AUTO_BEACON_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CA_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CA_AUTO_ADDR_LIST", "NO");
+
+    lock = epicsMutexMustCreate();
+
+    /* Before iocInit, which makes later contexts use the database for
+     * channels to its own records instead of the network
+     */
+    SEVCHK(ca_context_create(ca_enable_preemptive_callback),
+           "ca_context_create");
+
+    testdbPrepare();
+    testdbReadDatabase("recTestIoc.dbd", NULL, NULL);
+    recTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("rsrvSendTest.db", NULL, NULL);
+
+    eltc(0);
+    testIocInitOk();
+    dbInitServers();
+    dbRunServers();
+    eltc(1);
+
+    connectAll();
+    testOk(waitForRound(0, 10.0), "Initial updates arrived");
+
+    postBursts();
+    waitForRound(NROUNDS, 20.0);
+
+    epicsMutexMustLock(lock);
+    for (n = 0; n < NCHANS; n++) {
+        subscriber *psub = &subs[n];
+
+        testOk(psub->lastRound == NROUNDS && !psub->nBad && !psub->nOther,
+               "wf%u: %u updates, %u bad, %u failed, last from round %ld",
+               n, psub->nUpdates, psub->nBad, psub->nOther, psub->lastRound);
+    }
+    epicsMutexUnlock(lock);
+
+    ca_context_destroy();
+
+    /* The CA server can't be stopped, so leave the IOC running */
+
+    return testDone();
+}
@@ -0,0 +1,12 @@
+#!/usr/bin/env perl
+
+use lib '/root/repo/lib/perl';
+
+use Test::More tests => 2;
+
+use DBD::Driver;
+
+my $drv = DBD::Driver->new('test');
+isa_ok $drv, 'DBD::Driver';
+is $drv->name, 'test', 'Driver name';
+
@@ -0,0 +1,7 @@
+#ifndef LIBCOMVERSION_H
+#  error include libComVersion.h, not this header
+#endif
+#define EPICS_LIBCOM_MAJOR_VERSION 3
+#define EPICS_LIBCOM_MINOR_VERSION 17
+#define EPICS_LIBCOM_MAINTENANCE_VERSION 6
+#define EPICS_LIBCOM_DEVELOPMENT_FLAG 1
@@ -154,6 +154,9 @@ typedef struct asBase{
 	ELLLIST	hagList;
 	ELLLIST	asgList;
 	struct gphPvt *phash;
+	struct gphPvt *pcache;	/*rights by ASG, user, host and level*/
+	ELLLIST	cacheList;
+	int	cacheCount;
 } ASBASE;
 
 epicsShareExtern volatile ASBASE *pasbase;
@@ -199,6 +202,7 @@ typedef struct{
 	ELLLIST		uagList; /*List of ASGUAG*/
 	ELLLIST		hagList; /*List of ASGHAG*/
 	int		trapMask;
+	int		active;  /*no calc, or calc is good and TRUE*/
 } ASGRULE;
 typedef struct{
 	ELLNODE		node;
@@ -217,6 +221,7 @@ typedef struct asg{
 	double	*pavalue;	  /*pointer to array of input values*/
 	unsigned long inpBad;	  /*bitmap of which inputs are bad*/
 	unsigned long inpChanged; /*bitmap of inputs that changed*/
+	unsigned rulesGen;	  /*changes when any rule's active changes*/
 } ASG;
 typedef struct asgMember {
 	ELLNODE		node;
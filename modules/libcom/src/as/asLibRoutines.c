@@ -42,6 +42,30 @@ epicsShareDef int   asActive = FALSE;
 
 static void         *freeListPvt = NULL;
 
+/*
+  The rights a client gets are cached by ASG, user, host and level.
+  A user entry is found with the ASG as the gpHash pvtid, and a host entry
+  with the user entry as the pvtid. A level's result is valid while its
+  gen matches the ASG's rulesGen, which changes whenever a rule becomes
+  active or inactive.
+*/
+#define AS_CACHE_TABLE_SIZE 1024
+#define AS_CACHE_MAX 65536
+#define AS_CACHE_LEVELS 2
+
+typedef struct {
+    ELLNODE	node;
+    char	name[1];
+} ASCACHEUSER;
+
+typedef struct {
+    ELLNODE		node;
+    unsigned		gen[AS_CACHE_LEVELS];
+    asAccessRights	access[AS_CACHE_LEVELS];
+    int			trapMask[AS_CACHE_LEVELS];
+    char		name[1];
+} ASCACHEHOST;
+
 
 #define DEFAULT "DEFAULT"
 
@@ -64,6 +88,8 @@ static long asAsgAddRuleOptions(ASGRULE *pasgrule,int trapMask);
 static long asAsgRuleUagAdd(ASGRULE *pasgrule,const char *name);
 static long asAsgRuleHagAdd(ASGRULE *pasgrule,const char *name);
 static long asAsgRuleCalc(ASGRULE *pasgrule,const char *calc);
+static void asCacheFree(ASBASE *pasbase);
+static ASCACHEHOST *asCacheFind(ASG *pasg,const char *user,const char *host);
 
 /*
   asInitialize can be called while access security is already active.
@@ -100,6 +126,7 @@ long epicsShareAPI asInitialize(ASINPUTFUNCPTR inputfunction)
     ellInit(&pasbasenew->uagList);
     ellInit(&pasbasenew->hagList);
     ellInit(&pasbasenew->asgList);
+    ellInit(&pasbasenew->cacheList);
     asAsgAdd(DEFAULT);
     status = myParse(inputfunction);
     if(status) {
@@ -942,12 +969,14 @@ static long asComputeAsgPvt(ASG *pasg)
     ASGRULE	*pasgrule;
     ASGMEMBER	*pasgmember;
     ASGCLIENT	*pasgclient;
+    int		changed = FALSE;
 
     if(!asActive) return(S_asLib_asNotActive);
     pasgrule = (ASGRULE *)ellFirst(&pasg->ruleList);
     while(pasgrule) {
 	double	result = pasgrule->result;  /* set for VAL */
 	long	status;
+	int	active;
 
 	if(pasgrule->calc && (pasg->inpChanged & pasgrule->inpUsed)) {
 	    status = calcPerform(pasg->pavalue,&result,pasgrule->rpcl);
@@ -958,9 +987,18 @@ static long asComputeAsgPvt(ASG *pasg)
 		pasgrule->result = ((result>.99) && (result<1.01)) ? 1 : 0;
 	    }
 	}
+	active = !pasgrule->calc
+	    || (!(pasg->inpBad & pasgrule->inpUsed) && (pasgrule->result==1));
+	if(active != pasgrule->active) {
+	    pasgrule->active = active;
+	    changed = TRUE;
+	}
 	pasgrule = (ASGRULE *)ellNext(&pasgrule->node);
     }
     pasg->inpChanged = FALSE;
+    /*The clients' rights can only change if a rule did*/
+    if(!changed) return(0);
+    if(++pasg->rulesGen == 0) pasg->rulesGen = 1;
     pasgmember = (ASGMEMBER *)ellFirst(&pasg->memberList);
     while(pasgmember) {
 	pasgclient = (ASGCLIENT *)ellFirst(&pasgmember->clientList);
@@ -983,6 +1021,8 @@ static long asComputePvt(ASCLIENTPVT asClientPvt)
     ASGRULE		*pasgrule;
     asAccessRights	oldaccess;
     GPHENTRY		*pgphentry;
+    ASCACHEHOST		*pcache = NULL;
+    int			level;
 
     if(!asActive) return(S_asLib_asNotActive);
     if(!pasgclient) return(S_asLib_badClient);
@@ -991,6 +1031,15 @@ static long asComputePvt(ASCLIENTPVT asClientPvt)
     pasg = pasgMember->pasg;
     if(!pasg) return(S_asLib_badAsg);
     oldaccess=pasgclient->access;
+    level = pasgclient->level;
+    if(pasgclient->user && level>=0 && level<AS_CACHE_LEVELS) {
+	pcache = asCacheFind(pasg,pasgclient->user,pasgclient->host);
+	if(pcache->gen[level] == pasg->rulesGen) {
+	    access = pcache->access[level];
+	    trapMask = pcache->trapMask[level];
+	    goto got_access;
+	}
+    }
     pasgrule = (ASGRULE *)ellFirst(&pasg->ruleList);
     while(pasgrule) {
 	if(access == asWRITE) break;
@@ -1028,14 +1077,19 @@ check_hag:
 	    goto next_rule;
 	}
 check_calc:
-	if(!pasgrule->calc
-	|| (!(pasg->inpBad & pasgrule->inpUsed) && (pasgrule->result==1))) {
+	if(pasgrule->active) {
 	    access = pasgrule->access;
             trapMask = pasgrule->trapMask;
         }
 next_rule:
 	pasgrule = (ASGRULE *)ellNext(&pasgrule->node);
     }
+    if(pcache) {
+	pcache->gen[level] = pasg->rulesGen;
+	pcache->access[level] = access;
+	pcache->trapMask[level] = trapMask;
+    }
+got_access:
     pasgclient->access = access;
     pasgclient->trapMask = trapMask;
     if(pasgclient->pcallback && oldaccess!=access) {
@@ -1123,9 +1177,59 @@ void asFreeAll(ASBASE *pasbase)
 	free(pasg);
 	pasg = pnext;
     }
+    asCacheFree(pasbase);
     gphFreeMem(pasbase->phash);
     free(pasbase);
 }
+
+static void asCacheFree(ASBASE *pasbase)
+{
+    ELLNODE	*pnode;
+
+    while((pnode = ellGet(&pasbase->cacheList))) {
+	free(pnode);
+    }
+    if(pasbase->pcache) gphFreeMem(pasbase->pcache);
+    pasbase->pcache = NULL;
+    pasbase->cacheCount = 0;
+}
+
+static ASCACHEHOST *asCacheFind(ASG *pasg,const char *user,const char *host)
+{
+    ASBASE	*pbase = (ASBASE *)pasbase;
+    GPHENTRY	*pgphentry;
+    ASCACHEUSER	*pcacheuser;
+    ASCACHEHOST	*pcachehost;
+
+    /*user and host names come from the clients, so limit the size*/
+    if(pbase->cacheCount >= AS_CACHE_MAX) asCacheFree(pbase);
+    if(!pbase->pcache) gphInitPvt(&pbase->pcache, AS_CACHE_TABLE_SIZE);
+
+    pgphentry = gphFind(pbase->pcache,user,pasg);
+    if(pgphentry) {
+	pcacheuser = pgphentry->userPvt;
+    } else {
+	pcacheuser = asCalloc(1,sizeof(ASCACHEUSER)+strlen(user));
+	strcpy(pcacheuser->name,user);
+	ellAdd(&pbase->cacheList,&pcacheuser->node);
+	pbase->cacheCount++;
+	pgphentry = gphAdd(pbase->pcache,pcacheuser->name,pasg);
+	pgphentry->userPvt = pcacheuser;
+    }
+
+    pgphentry = gphFind(pbase->pcache,host,pcacheuser);
+    if(pgphentry) {
+	pcachehost = pgphentry->userPvt;
+    } else {
+	pcachehost = asCalloc(1,sizeof(ASCACHEHOST)+strlen(host));
+	strcpy(pcachehost->name,host);
+	ellAdd(&pbase->cacheList,&pcachehost->node);
+	pbase->cacheCount++;
+	pgphentry = gphAdd(pbase->pcache,pcachehost->name,pcacheuser);
+	pgphentry->userPvt = pcachehost;
+    }
+    return(pcachehost);
+}
 
 /*Beginning of routines called by lex code*/
 static UAG *asUagAdd(const char *uagName)
@@ -1274,6 +1378,7 @@ static ASG *asAsgAdd(const char *asgName)
     ellInit(&pasg->memberList);
     pasg->name = (char *)(pasg+1);
     strcpy(pasg->name,asgName);
+    pasg->rulesGen = 1;
     if(pnext==NULL) { /*Add to end of list*/
 	ellAdd(&pasbase->asgList,&pasg->node);
     } else {
@@ -1306,6 +1411,7 @@ static ASGRULE *asAsgAddRule(ASG *pasg,asAccessRights access,int level)
     pasgrule->access = access;
     pasgrule->trapMask = 0;
     pasgrule->level = level;
+    pasgrule->active = TRUE;
     ellInit(&pasgrule->uagList);
     ellInit(&pasgrule->hagList);
     ellAdd(&pasg->ruleList,&pasgrule->node);
@@ -1394,6 +1500,8 @@ static long asAsgRuleCalc(ASGRULE *pasgrule,const char *calc)
 	return status;
     }
     calcArgUsage(pasgrule->rpcl, &pasgrule->inpUsed, &stores);
+    /* result is FALSE until the inputs are read */
+    pasgrule->active = FALSE;
     /* Until someone proves stores are not dangerous, don't allow them */
     if (stores) {
 	free(pasgrule->calc);
@@ -0,0 +1,635 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ * Element-wise evaluation of compiled calc expressions over arrays
+ *
+ * calcArrayPerform() evaluates a program from calcCompile() once for each
+ * element index of its arguments.  An argument with exactly one element is
+ * a scalar and is used for every index.  The number of results is the
+ * smallest element count of the array arguments the expression reads,
+ * limited to the size of the result buffer; if it reads no arrays there is
+ * one result.
+ *
+ * Rather than running the whole program for each element in turn, each
+ * instruction is applied to a block of elements at a time, so the common
+ * operators become simple loops that the compiler can vectorize.  Blocks
+ * are sized to stay in cache, except that an expression containing one of
+ * the reductions SUM(), AVG(), AMAX() or AMIN() is evaluated over the whole
+ * array at once.  A reduction combines the values of its argument for all
+ * elements and gives the same result to each of them.
+ *
+ * Where the condition of a ?: operator differs between elements, those
+ * that take the jump are disabled until execution reaches the jump target,
+ * so every element follows the path it would have in calcPerform().
+ * Assignments only last for one evaluation, they aren't copied back to
+ * the arguments.  VAL reads the previous contents of the result buffer.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#define epicsExportSharedSymbols
+#include "dbDefs.h"
+#include "epicsMath.h"
+#include "epicsTypes.h"
+#include "compilerDependencies.h"
+#include "postfix.h"
+#include "postfixPvt.h"
+
+/* Elements per block, the working set is a few buffers of this size */
+#define CALC_ARRAY_BLOCK 1024
+
+/* A value on the stack or in an argument */
+typedef struct calcVal {
+    const double *p;		/* per-element values, NULL for a scalar */
+    double s;			/* scalar value */
+} calcVal;
+
+#define VAL_AT(v, i) ((v).p ? (v).p[i] : (v).s)
+
+struct calcArrayWork {
+    epicsUInt32 size;		/* capacity of each buffer */
+    epicsUInt32 n;		/* elements in the current block */
+    epicsUInt32 nactive;	/* elements not waiting at a jump target */
+    int depth;
+    int npending;		/* jump targets that have elements waiting */
+    calcVal stack[CALCPERFORM_STACK+1];
+    calcVal var[CALCPERFORM_NARGS];
+    double *buf[CALCPERFORM_STACK+1];	/* one for each stack level */
+    double *vbuf[CALCPERFORM_NARGS];	/* for assigned arguments */
+    double *scratch;
+    epicsUInt8 *active;
+    epicsInt32 *resume;		/* where an inactive element continues */
+    int *pending;		/* stack depth + 1 at waited-for targets */
+};
+
+void calcArrayFreeWork(struct calcArrayWork *pw)
+{
+    int i;
+
+    if (!pw)
+	return;
+    for (i = 0; i <= CALCPERFORM_STACK; i++)
+	free(pw->buf[i]);
+    for (i = 0; i < CALCPERFORM_NARGS; i++)
+	free(pw->vbuf[i]);
+    free(pw->scratch);
+    free(pw->active);
+    free(pw->resume);
+    free(pw->pending);
+    free(pw);
+}
+
+static struct calcArrayWork * getWork(calcCompiled *pcomp, epicsUInt32 size)
+{
+    struct calcArrayWork *pw = pcomp->pwork;
+    size_t nbytes = size * sizeof(double);
+    int ok = 1;
+    int i;
+
+    if (pw && pw->size >= size)
+	return pw;
+
+    calcArrayFreeWork(pw);
+    pcomp->pwork = pw = calloc(1, sizeof(struct calcArrayWork));
+    if (!pw)
+	return NULL;
+
+    pw->size = size;
+    pw->depth = pcomp->depth;
+    for (i = 1; i <= pw->depth; i++)
+	ok &= !!(pw->buf[i] = malloc(nbytes));
+    for (i = 0; i < CALCPERFORM_NARGS; i++) {
+	if (pcomp->stores & (1ul << i))
+	    ok &= !!(pw->vbuf[i] = malloc(nbytes));
+    }
+    ok &= !!(pw->scratch = malloc(nbytes));
+    ok &= !!(pw->active = malloc(size));
+    ok &= !!(pw->resume = malloc(size * sizeof(epicsInt32)));
+    ok &= !!(pw->pending = calloc(pcomp->ninst, sizeof(int)));
+    if (!ok) {
+	calcArrayFreeWork(pw);
+	pcomp->pwork = pw = NULL;
+    }
+    return pw;
+}
+
+
+/* Vector kernels */
+
+#define CALC_BINOP_KERNELS(name, op) \
+static EPICS_SIMD_CLONES void name##_vv(double *o, const double *x, \
+    const double *y, epicsUInt32 n) \
+{ \
+    epicsUInt32 i; \
+    for (i = 0; i < n; i++) \
+	o[i] = x[i] op y[i]; \
+} \
+static EPICS_SIMD_CLONES void name##_vs(double *o, const double *x, \
+    double y, epicsUInt32 n) \
+{ \
+    epicsUInt32 i; \
+    for (i = 0; i < n; i++) \
+	o[i] = x[i] op y; \
+} \
+static EPICS_SIMD_CLONES void name##_sv(double *o, double x, \
+    const double *y, epicsUInt32 n) \
+{ \
+    epicsUInt32 i; \
+    for (i = 0; i < n; i++) \
+	o[i] = x op y[i]; \
+}
+CALC_BINOPS(CALC_BINOP_KERNELS)
+#undef CALC_BINOP_KERNELS
+
+typedef struct binopKernels {
+    int op;
+    void (*vv)(double *o, const double *x, const double *y, epicsUInt32 n);
+    void (*vs)(double *o, const double *x, double y, epicsUInt32 n);
+    void (*sv)(double *o, double x, const double *y, epicsUInt32 n);
+} binopKernels;
+
+/* In the same order as the superinstructions */
+static const binopKernels binops[] = {
+#define CALC_BINOP_ENTRY(name, op) {name, name##_vv, name##_vs, name##_sv},
+    CALC_BINOPS(CALC_BINOP_ENTRY)
+#undef CALC_BINOP_ENTRY
+};
+
+static const binopKernels * findBinop(int op)
+{
+    unsigned i;
+
+    for (i = 0; i < NELEMENTS(binops); i++) {
+	if (binops[i].op == op)
+	    return &binops[i];
+    }
+    return NULL;
+}
+
+static EPICS_SIMD_CLONES void negKernel(double *o, const double *x,
+    epicsUInt32 n)
+{
+    epicsUInt32 i;
+    for (i = 0; i < n; i++)
+	o[i] = - x[i];
+}
+
+static EPICS_SIMD_CLONES void absKernel(double *o, const double *x,
+    epicsUInt32 n)
+{
+    epicsUInt32 i;
+    for (i = 0; i < n; i++)
+	o[i] = fabs(x[i]);
+}
+
+
+/* Stack and argument updates.  While some elements are waiting at a jump
+ * target, only the active elements may be changed, so the new values get
+ * merged into the level's own buffer.
+ */
+
+static double * fill(double *pbuf, calcVal *pv, epicsUInt32 n)
+{
+    epicsUInt32 i;
+
+    if (pv->p != pbuf) {
+	if (pv->p)
+	    memmove(pbuf, pv->p, n * sizeof(double));
+	else
+	    for (i = 0; i < n; i++)
+		pbuf[i] = pv->s;
+	pv->p = pbuf;
+    }
+    return pbuf;
+}
+
+/* Where to compute a vector result for stack level k */
+static double * resultBuf(struct calcArrayWork *pw, int k)
+{
+    return pw->nactive == pw->n ? pw->buf[k] : pw->scratch;
+}
+
+static void setVector(struct calcArrayWork *pw, int k, const double *src)
+{
+    if (pw->nactive == pw->n)
+	pw->stack[k].p = src;
+    else {
+	double *pbuf = fill(pw->buf[k], &pw->stack[k], pw->n);
+	epicsUInt32 i;
+
+	for (i = 0; i < pw->n; i++) {
+	    if (pw->active[i])
+		pbuf[i] = src[i];
+	}
+    }
+}
+
+static void setScalar(struct calcArrayWork *pw, int k, double s)
+{
+    if (pw->nactive == pw->n) {
+	pw->stack[k].p = NULL;
+	pw->stack[k].s = s;
+    }
+    else {
+	double *pbuf = fill(pw->buf[k], &pw->stack[k], pw->n);
+	epicsUInt32 i;
+
+	for (i = 0; i < pw->n; i++) {
+	    if (pw->active[i])
+		pbuf[i] = s;
+	}
+    }
+}
+
+static void setVal(struct calcArrayWork *pw, int k, calcVal v)
+{
+    if (v.p)
+	setVector(pw, k, v.p);
+    else
+	setScalar(pw, k, v.s);
+}
+
+static void store(struct calcArrayWork *pw, int a, int k)
+{
+    calcVal v = pw->stack[k];
+    calcVal *pvar = &pw->var[a];
+    double *pbuf = pw->vbuf[a];
+    epicsUInt32 i;
+    int j;
+
+    /* Values on the stack that came from this argument keep them */
+    for (j = 1; j < k; j++) {
+	if (pw->stack[j].p == pbuf)
+	    fill(pw->buf[j], &pw->stack[j], pw->n);
+    }
+
+    if (pw->nactive == pw->n) {
+	if (!v.p)
+	    *pvar = v;
+	else {
+	    if (v.p != pbuf)
+		memcpy(pbuf, v.p, pw->n * sizeof(double));
+	    pvar->p = pbuf;
+	}
+    }
+    else {
+	fill(pbuf, pvar, pw->n);
+	for (i = 0; i < pw->n; i++) {
+	    if (pw->active[i])
+		pbuf[i] = VAL_AT(v, i);
+	}
+    }
+}
+
+
+/* Operators */
+
+static void binop(struct calcArrayWork *pw, int k, const binopKernels *pk,
+    calcVal x, calcVal y)
+{
+    if (!x.p && !y.p) {
+	double stack[3];
+
+	stack[1] = x.s;
+	stack[2] = y.s;
+	calcStackOp(pk->op, stack + 2, 0);
+	setScalar(pw, k, stack[1]);
+    }
+    else {
+	double *o = resultBuf(pw, k);
+
+	if (x.p && y.p)
+	    pk->vv(o, x.p, y.p, pw->n);
+	else if (x.p)
+	    pk->vs(o, x.p, y.s, pw->n);
+	else
+	    pk->sv(o, x.s, y.p, pw->n);
+	setVector(pw, k, o);
+    }
+}
+
+/* Any other stack operator, its nstack inputs start at level k */
+static void generic(struct calcArrayWork *pw, int k, int op, int nargs,
+    int nstack)
+{
+    double stack[CALCPERFORM_STACK+1];
+    int vector = (op == RANDOM);	/* a new number for each element */
+    double *o;
+    epicsUInt32 i;
+    int j;
+
+    for (j = 0; j < nstack; j++)
+	vector |= pw->stack[k + j].p != NULL;
+
+    if (!vector) {
+	for (j = 0; j < nstack; j++)
+	    stack[j + 1] = pw->stack[k + j].s;
+	calcStackOp(op, stack + nstack, nargs);
+	setScalar(pw, k, stack[1]);
+	return;
+    }
+
+    o = resultBuf(pw, k);
+    if (op == UNARY_NEG)
+	negKernel(o, pw->stack[k].p, pw->n);
+    else if (op == ABS_VAL)
+	absKernel(o, pw->stack[k].p, pw->n);
+    else {
+	for (i = 0; i < pw->n; i++) {
+	    for (j = 0; j < nstack; j++)
+		stack[j + 1] = VAL_AT(pw->stack[k + j], i);
+	    calcStackOp(op, stack + nstack, nargs);
+	    o[i] = stack[1];
+	}
+    }
+    setVector(pw, k, o);
+}
+
+static void reduce(struct calcArrayWork *pw, int k, int op)
+{
+    calcVal x = pw->stack[k];
+    epicsUInt32 i, n = pw->n;
+    int all = pw->nactive == n;
+    double r;
+
+    if (!x.p) {
+	r = op == ARR_SUM ? x.s * pw->nactive : x.s;
+    }
+    else if (op == ARR_SUM || op == ARR_AVG) {
+	double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+
+	if (all) {
+	    for (i = 0; i + 4 <= n; i += 4) {
+		s0 += x.p[i];
+		s1 += x.p[i + 1];
+		s2 += x.p[i + 2];
+		s3 += x.p[i + 3];
+	    }
+	    for (; i < n; i++)
+		s0 += x.p[i];
+	}
+	else {
+	    for (i = 0; i < n; i++) {
+		if (pw->active[i])
+		    s0 += x.p[i];
+	    }
+	}
+	r = (s0 + s1) + (s2 + s3);
+	if (op == ARR_AVG)
+	    r /= pw->nactive;
+    }
+    else {
+	/* Same rules as MAX() and MIN(), a NaN wins */
+	int first = 1;
+
+	r = 0.0;
+	for (i = 0; i < n; i++) {
+	    double v = x.p[i];
+
+	    if (!all && !pw->active[i])
+		continue;
+	    if (first || isnan(v) ||
+		(op == ARR_MAX ? r < v : r > v))
+		r = v;
+	    first = 0;
+	}
+    }
+    setScalar(pw, k, r);
+}
+
+
+/* Jumps */
+
+static void jump(struct calcArrayWork *pw, const calcVal *pcond,
+    int target, int depth)
+{
+    epicsUInt32 i;
+    int taken = 0;
+
+    for (i = 0; i < pw->n; i++) {
+	if (pw->active[i] && (!pcond || VAL_AT(*pcond, i) == 0.0)) {
+	    pw->active[i] = 0;
+	    pw->resume[i] = target;
+	    pw->nactive--;
+	    taken = 1;
+	}
+    }
+    if (taken && !pw->pending[target]) {
+	pw->pending[target] = depth + 1;
+	pw->npending++;
+    }
+}
+
+/* Re-enable the elements waiting at pc, returns the stack depth there */
+static int arrive(struct calcArrayWork *pw, int pc)
+{
+    int depth = pw->pending[pc] - 1;
+    epicsUInt32 i;
+
+    for (i = 0; i < pw->n; i++) {
+	if (!pw->active[i] && pw->resume[i] == pc) {
+	    pw->active[i] = 1;
+	    pw->nactive++;
+	}
+    }
+    pw->pending[pc] = 0;
+    pw->npending--;
+    return depth;
+}
+
+
+static long runBlock(const calcCompiled *pcomp, struct calcArrayWork *pw,
+    double *presult)
+{
+    const calcInst *pinst = pcomp->inst;
+    int top = 0;
+    int pc = 0;
+
+    for (;;) {
+	const calcInst *pi;
+	int op;
+
+	if (pw->npending && pw->pending[pc])
+	    top = arrive(pw, pc);
+	if (!pw->nactive) {
+	    /* Everyone is waiting further on */
+	    while (++pc < pcomp->ninst && !pw->pending[pc]);
+	    if (pc == pcomp->ninst)
+		return -1;
+	    continue;
+	}
+
+	pi = &pinst[pc++];
+	op = pi->op;
+	switch (op) {
+
+	case END_EXPRESSION:
+	    if (top != 1)
+		return -1;
+	    fill(presult, &pw->stack[1], pw->n);
+	    return 0;
+
+	case CALC_CONST:
+	    setScalar(pw, ++top, pi->value);
+	    break;
+
+	case FETCH_VAL:
+	    setVector(pw, ++top, presult);
+	    break;
+
+	case CALC_FETCH:
+	    setVal(pw, ++top, pw->var[pi->a]);
+	    break;
+
+	case CALC_STORE:
+	    store(pw, pi->a, top--);
+	    break;
+
+	case CALC_JUMP_IF_ZERO: {
+		calcVal cond = pw->stack[top--];
+
+		if (pw->nactive == pw->n && !cond.p) {
+		    if (cond.s == 0.0)
+			pc = pi->b;
+		}
+		else
+		    jump(pw, &cond, pi->b, top);
+	    }
+	    break;
+
+	case CALC_JUMP:
+	    if (pw->nactive == pw->n)
+		pc = pi->b;
+	    else
+		jump(pw, NULL, pi->b, top);
+	    break;
+
+	case ARR_SUM:
+	case ARR_AVG:
+	case ARR_MAX:
+	case ARR_MIN:
+	    reduce(pw, top, op);
+	    break;
+
+	default:
+	    if (op >= ADD_F) {
+		const binopKernels *pk = &binops[(op - ADD_F) / 4];
+		calcVal k;
+
+		k.p = NULL;
+		k.s = pi->value;
+		switch ((op - ADD_F) % 4) {
+		case CALC_BINOP_F:
+		    binop(pw, top, pk, pw->stack[top], pw->var[pi->a]);
+		    break;
+		case CALC_BINOP_K:
+		    binop(pw, top, pk, pw->stack[top], k);
+		    break;
+		case CALC_BINOP_FF:
+		    top++;
+		    binop(pw, top, pk, pw->var[pi->a], pw->var[pi->b]);
+		    break;
+		case CALC_BINOP_FK:
+		    top++;
+		    binop(pw, top, pk, pw->var[pi->a], k);
+		    break;
+		}
+	    }
+	    else {
+		const binopKernels *pk = findBinop(op);
+		int nstack;
+
+		if (pk) {
+		    top--;
+		    binop(pw, top, pk, pw->stack[top], pw->stack[top + 1]);
+		    break;
+		}
+		nstack = op == RANDOM ? 0 : calcStackArgs(op, pi->a);
+		if (nstack < 0)
+		    return -1;
+		top -= nstack;
+		generic(pw, top + 1, op, pi->a, nstack);
+		top++;
+	    }
+	}
+    }
+}
+
+/* calcArrayPerform
+ *
+ * Evaluate a compiled expression element-wise.  On entry *pnresult is the
+ * size of the result buffer, on return it's the number of results.  The
+ * buffers used are kept with the compiled expression, so it mustn't be
+ * evaluated by two threads at once.
+ */
+epicsShareFunc long
+    calcArrayPerform(calcCompiled *pcomp, const double * const *parg,
+	const epicsUInt32 *pnelem, double *presult, epicsUInt32 *pnresult)
+{
+    struct calcArrayWork *pw;
+    epicsUInt32 nres = 0, block, off;
+    int vector = 0;
+    int i;
+
+    if (!pcomp || !parg || !pnelem || !presult || !pnresult)
+	return -1;
+
+    for (i = 0; i < CALCPERFORM_NARGS; i++) {
+	if ((pcomp->inputs & (1ul << i)) && parg[i] && pnelem[i] != 1) {
+	    if (!vector || pnelem[i] < nres)
+		nres = pnelem[i];
+	    vector = 1;
+	}
+    }
+    if (!vector)
+	nres = 1;
+    if (nres > *pnresult)
+	nres = *pnresult;
+    *pnresult = 0;
+    if (!nres)
+	return 0;
+
+    block = pcomp->reduces || nres < CALC_ARRAY_BLOCK ?
+	nres : CALC_ARRAY_BLOCK;
+    pw = getWork(pcomp, block);
+    if (!pw)
+	return -1;
+
+    for (off = 0; off < nres; off += block) {
+	pw->n = nres - off < block ? nres - off : block;
+	pw->nactive = pw->n;
+	memset(pw->active, 1, pw->n);
+
+	/* A level first written while some elements are waiting copies its
+	 * old value, which mustn't point into a previous block's arguments */
+	for (i = 0; i <= pw->depth; i++) {
+	    pw->stack[i].p = NULL;
+	    pw->stack[i].s = 0.0;
+	}
+
+	for (i = 0; i < CALCPERFORM_NARGS; i++) {
+	    calcVal *pvar = &pw->var[i];
+
+	    pvar->p = NULL;
+	    pvar->s = 0.0;
+	    if (!parg[i])
+		continue;
+	    if (pnelem[i] == 1)
+		pvar->s = parg[i][0];
+	    else if (pnelem[i] >= off + pw->n)
+		pvar->p = parg[i] + off;
+	}
+
+	if (runBlock(pcomp, pw, presult + off)) {
+	    /* Leave the work area ready for next time */
+	    memset(pw->pending, 0, pcomp->ninst * sizeof(int));
+	    pw->npending = 0;
+	    return -1;
+	}
+    }
+    *pnresult = nres;
+    return 0;
+}
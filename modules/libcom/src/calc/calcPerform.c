@@ -37,6 +37,285 @@ static int cond_search(const char **ppinst, int match);
 #  pragma optimize("g", off)
 #endif
 
+/* stackOp
+ *
+ * Apply an operator that only works on values on the stack.  This is
+ * shared by calcPerform() and calcPerformCompiled(), and is used to fold
+ * constant sub-expressions.  Returns the new stack pointer, or NULL if op
+ * is not such an operator.
+ */
+static EPICS_ALWAYS_INLINE double *
+    stackOp(int op, double *ptop, int nargs)
+{
+    double top;				/* value from top of stack */
+    epicsInt32 itop;			/* integer from top of stack */
+    epicsUInt32 utop;			/* unsigned integer from top of stack */
+
+    switch (op){
+
+    case CONST_PI:
+	*++ptop = PI;
+	break;
+
+    case CONST_D2R:
+	*++ptop = PI/180.;
+	break;
+
+    case CONST_R2D:
+	*++ptop = 180./PI;
+	break;
+
+    case UNARY_NEG:
+	*ptop = - *ptop;
+	break;
+
+    case ADD:
+	top = *ptop--;
+	*ptop += top;
+	break;
+
+    case SUB:
+	top = *ptop--;
+	*ptop -= top;
+	break;
+
+    case MULT:
+	top = *ptop--;
+	*ptop *= top;
+	break;
+
+    case DIV:
+	top = *ptop--;
+	*ptop /= top;
+	break;
+
+    case MODULO:
+	itop = (epicsInt32) *ptop--;
+	if (itop)
+	    *ptop = (epicsInt32) *ptop % itop;
+	else
+	    *ptop = epicsNAN;
+	break;
+
+    case POWER:
+	top = *ptop--;
+	*ptop = pow(*ptop, top);
+	break;
+
+    case ABS_VAL:
+	*ptop = fabs(*ptop);
+	break;
+
+    case EXP:
+	*ptop = exp(*ptop);
+	break;
+
+    case LOG_10:
+	*ptop = log10(*ptop);
+	break;
+
+    case LOG_E:
+	*ptop = log(*ptop);
+	break;
+
+    case MAX:
+	while (--nargs) {
+	    top = *ptop--;
+	    if (*ptop < top || isnan(top))
+		*ptop = top;
+	}
+	break;
+
+    case MIN:
+	while (--nargs) {
+	    top = *ptop--;
+	    if (*ptop > top || isnan(top))
+		*ptop = top;
+	}
+	break;
+
+    case SQU_RT:
+	*ptop = sqrt(*ptop);
+	break;
+
+    case ACOS:
+	*ptop = acos(*ptop);
+	break;
+
+    case ASIN:
+	*ptop = asin(*ptop);
+	break;
+
+    case ATAN:
+	*ptop = atan(*ptop);
+	break;
+
+    case ATAN2:
+	top = *ptop--;
+	*ptop = atan2(top, *ptop);  /* Ouch!: Args backwards! */
+	break;
+
+    case COS:
+	*ptop = cos(*ptop);
+	break;
+
+    case SIN:
+	*ptop = sin(*ptop);
+	break;
+
+    case TAN:
+	*ptop = tan(*ptop);
+	break;
+
+    case COSH:
+	*ptop = cosh(*ptop);
+	break;
+
+    case SINH:
+	*ptop = sinh(*ptop);
+	break;
+
+    case TANH:
+	*ptop = tanh(*ptop);
+	break;
+
+    case CEIL:
+	*ptop = ceil(*ptop);
+	break;
+
+    case FLOOR:
+	*ptop = floor(*ptop);
+	break;
+
+    case FINITE:
+	top = finite(*ptop);
+	while (--nargs) {
+	    --ptop;
+	    top = top && finite(*ptop);
+	}
+	*ptop = top;
+	break;
+
+    case ISINF:
+	*ptop = isinf(*ptop);
+	break;
+
+    case ISNAN:
+	top = isnan(*ptop);
+	while (--nargs) {
+	    --ptop;
+	    top = top || isnan(*ptop);
+	}
+	*ptop = top;
+	break;
+
+    case NINT:
+	top = *ptop;
+	*ptop = (epicsInt32) (top >= 0 ? top + 0.5 : top - 0.5);
+	break;
+
+    case RANDOM:
+	*++ptop = calcRandom();
+	break;
+
+    case REL_OR:
+	top = *ptop--;
+	*ptop = *ptop || top;
+	break;
+
+    case REL_AND:
+	top = *ptop--;
+	*ptop = *ptop && top;
+	break;
+
+    case REL_NOT:
+	*ptop = ! *ptop;
+	break;
+
+    /* For bitwise operations on values with bit 31 set, double values
+     * must first be cast to unsigned to correctly set that bit; the
+     * double value must be negative in that case. The result must be
+     * cast to a signed integer before converting to the double result.
+     */
+
+    case BIT_OR:
+	utop = *ptop--;
+	*ptop = (epicsInt32) ((epicsUInt32) *ptop | utop);
+	break;
+
+    case BIT_AND:
+	utop = *ptop--;
+	*ptop = (epicsInt32) ((epicsUInt32) *ptop & utop);
+	break;
+
+    case BIT_EXCL_OR:
+	utop = *ptop--;
+	*ptop = (epicsInt32) ((epicsUInt32) *ptop ^ utop);
+	break;
+
+    case BIT_NOT:
+	utop = *ptop;
+	*ptop = (epicsInt32) ~utop;
+	break;
+
+    /* The shift operators use signed integers, so a right-shift will
+     * extend the sign bit into the left-hand end of the value. The
+     * double-casting through unsigned here is important, see above.
+     */
+
+    case RIGHT_SHIFT:
+	utop = *ptop--;
+	*ptop = ((epicsInt32) (epicsUInt32) *ptop) >> (utop & 31);
+	break;
+
+    case LEFT_SHIFT:
+	utop = *ptop--;
+	*ptop = ((epicsInt32) (epicsUInt32) *ptop) << (utop & 31);
+	break;
+
+    case NOT_EQ:
+	top = *ptop--;
+	*ptop = *ptop != top;
+	break;
+
+    case LESS_THAN:
+	top = *ptop--;
+	*ptop = *ptop < top;
+	break;
+
+    case LESS_OR_EQ:
+	top = *ptop--;
+	*ptop = *ptop <= top;
+	break;
+
+    case EQUAL:
+	top = *ptop--;
+	*ptop = *ptop == top;
+	break;
+
+    case GR_OR_EQ:
+	top = *ptop--;
+	*ptop = *ptop >= top;
+	break;
+
+    case GR_THAN:
+	top = *ptop--;
+	*ptop = *ptop > top;
+	break;
+
+    /* A scalar is its own sum, average, maximum and minimum */
+    case ARR_SUM:
+    case ARR_AVG:
+    case ARR_MAX:
+    case ARR_MIN:
+	break;
+
+    default:
+	return NULL;
+    }
+    return ptop;
+}
+
 /* calcPerform
  *
  * Evalutate the postfix expression
@@ -46,11 +325,9 @@ epicsShareFunc long
 {
     double stack[CALCPERFORM_STACK+1];	/* zero'th entry not used */
     double *ptop;			/* stack pointer */
-    double top; 			/* value from top of stack */
     epicsInt32 itop;			/* integer from top of stack */
-    epicsUInt32 utop;			/* unsigned integer from top of stack */
     int op;
-    int nargs;
+    int nargs = 0;
 
     /* initialize */
     ptop = stack;
@@ -104,283 +381,502 @@ epicsShareFunc long
 	    parg[op - STORE_A] = *ptop--;
 	    break;
 
-	case CONST_PI:
-	    *++ptop = PI;
-	    break;
-
-	case CONST_D2R:
-	    *++ptop = PI/180.;
-	    break;
-
-	case CONST_R2D:
-	    *++ptop = 180./PI;
-	    break;
-
-	case UNARY_NEG:
-	    *ptop = - *ptop;
-	    break;
-
-	case ADD:
-	    top = *ptop--;
-	    *ptop += top;
-	    break;
-
-	case SUB:
-	    top = *ptop--;
-	    *ptop -= top;
+	case MAX:
+	case MIN:
+	case FINITE:
+	case ISNAN:
+	    nargs = *pinst++;
+	    /* fall through */
+	default:
+	    ptop = stackOp(op, ptop, nargs);
+	    if (!ptop) {
+		errlogPrintf("calcPerform: Bad Opcode %d at %p\n", op, pinst-1);
+		return -1;
+	    }
 	    break;
 
-	case MULT:
-	    top = *ptop--;
-	    *ptop *= top;
+	case COND_IF:
+	    if (*ptop-- == 0.0 &&
+		cond_search(&pinst, COND_ELSE)) return -1;
 	    break;
 
-	case DIV:
-	    top = *ptop--;
-	    *ptop /= top;
+	case COND_ELSE:
+	    if (cond_search(&pinst, COND_END)) return -1;
 	    break;
 
-	case MODULO:
-	    itop = (epicsInt32) *ptop--;
-	    if (itop)
-		*ptop = (epicsInt32) *ptop % itop;
-	    else
-		*ptop = epicsNAN;
+	case COND_END:
 	    break;
+	}
+    }
 
-	case POWER:
-	    top = *ptop--;
-	    *ptop = pow(*ptop, top);
-	    break;
+    /* The stack should now have one item on it, the expression value */
+    if (ptop != stack + 1)
+	return -1;
+    *presult = *ptop;
+    return 0;
+}
 
-	case ABS_VAL:
-	    *ptop = fabs(*ptop);
-	    break;
+/* Compiled expressions
+ *
+ * calcCompile() decodes a postfix buffer once into an array of fixed-size
+ * instructions, so calcPerformCompiled() doesn't have to re-parse literal
+ * values or search for the end of conditionals on every evaluation.
+ * While decoding, constant sub-expressions are folded and the common
+ * sequences "fetch/literal, binary operator" and "fetch, fetch/literal,
+ * binary operator" are replaced by single instructions.  The arithmetic
+ * is the same code used by calcPerform(), so the results are identical.
+ */
 
-	case EXP:
-	    *ptop = exp(*ptop);
-	    break;
+typedef struct calcJump {
+    int inst;			/* index of the jump instruction */
+    const char *target;		/* postfix element it goes to */
+} calcJump;
 
-	case LOG_10:
-	    *ptop = log10(*ptop);
-	    break;
+/* Number of stack values consumed by op, or -1 if op isn't a pure
+ * stack operator (so can't be handed to stackOp() at compile time).
+ */
+int calcStackArgs(int op, int nargs)
+{
+    switch (op) {
+    case CONST_PI:
+    case CONST_D2R:
+    case CONST_R2D:
+	return 0;
+
+    case UNARY_NEG:
+    case ABS_VAL:
+    case EXP:
+    case LOG_10:
+    case LOG_E:
+    case SQU_RT:
+    case ACOS:
+    case ASIN:
+    case ATAN:
+    case COS:
+    case SIN:
+    case TAN:
+    case COSH:
+    case SINH:
+    case TANH:
+    case CEIL:
+    case FLOOR:
+    case ISINF:
+    case NINT:
+    case REL_NOT:
+    case BIT_NOT:
+	return 1;
+
+    case ADD:
+    case SUB:
+    case MULT:
+    case DIV:
+    case MODULO:
+    case POWER:
+    case ATAN2:
+    case REL_OR:
+    case REL_AND:
+    case BIT_OR:
+    case BIT_AND:
+    case BIT_EXCL_OR:
+    case RIGHT_SHIFT:
+    case LEFT_SHIFT:
+    case NOT_EQ:
+    case LESS_THAN:
+    case LESS_OR_EQ:
+    case EQUAL:
+    case GR_OR_EQ:
+    case GR_THAN:
+	return 2;
+
+    case MAX:
+    case MIN:
+    case FINITE:
+    case ISNAN:
+	return nargs;
+
+    default:
+	return -1;
+    }
+}
 
-	case LOG_E:
-	    *ptop = log(*ptop);
-	    break;
+/* Replace the instruction(s) at the end of the program with a
+ * superinstruction for the binary operator op, if possible.
+ * Instructions before barrier are jump targets and must stay.
+ */
+static int fuseBinop(calcInst *pinst, int *pn, int barrier, int op)
+{
+    int base;
+    int n = *pn;
+    calcInst *last, *prev;
+
+    switch (op) {
+#define CALC_BINOP_BASE(name, op) case name: base = name##_F; break;
+    CALC_BINOPS(CALC_BINOP_BASE)
+#undef CALC_BINOP_BASE
+    default:
+	return 0;
+    }
 
-	case MAX:
-	    nargs = *pinst++;
-	    while (--nargs) {
-		top = *ptop--;
-		if (*ptop < top || isnan(top))
-		    *ptop = top;
-	    }
-	    break;
+    if (n - 1 < barrier)
+	return 0;
+    last = &pinst[n-1];
+    prev = n - 2 >= barrier ? &pinst[n-2] : NULL;
+    if (last->op == CALC_CONST) {
+	if (prev && prev->op == CALC_FETCH) {
+	    prev->op = base + CALC_BINOP_FK;
+	    prev->value = last->value;
+	    *pn = n - 1;
+	}
+	else
+	    last->op = base + CALC_BINOP_K;
+	return 1;
+    }
+    if (last->op == CALC_FETCH) {
+	if (prev && prev->op == CALC_FETCH) {
+	    prev->op = base + CALC_BINOP_FF;
+	    prev->b = last->a;
+	    *pn = n - 1;
+	}
+	else
+	    last->op = base + CALC_BINOP_F;
+	return 1;
+    }
+    return 0;
+}
 
-	case MIN:
-	    nargs = *pinst++;
-	    while (--nargs) {
-		top = *ptop--;
-		if (*ptop > top || isnan(top))
-		    *ptop = top;
+/* Upper limit on the stack depth of a compiled program.  Both arms of
+ * each conditional are counted, which can only over-estimate.
+ */
+static int stackDepth(const calcInst *pinst, int ninst)
+{
+    int depth = 0;
+    int max = 0;
+    int i;
+
+    for (i = 0; i < ninst; i++) {
+	int op = pinst[i].op;
+
+	if (op >= ADD_F) {
+	    switch ((op - ADD_F) % 4) {
+	    case CALC_BINOP_FF:
+	    case CALC_BINOP_FK:
+		depth++;
 	    }
+	}
+	else switch (op) {
+	case CALC_CONST:
+	case FETCH_VAL:
+	case CALC_FETCH:
+	case RANDOM:
+	    depth++;
 	    break;
 
-	case SQU_RT:
-	    *ptop = sqrt(*ptop);
-	    break;
-
-	case ACOS:
-	    *ptop = acos(*ptop);
-	    break;
-
-	case ASIN:
-	    *ptop = asin(*ptop);
-	    break;
-
-	case ATAN:
-	    *ptop = atan(*ptop);
-	    break;
-
-	case ATAN2:
-	    top = *ptop--;
-	    *ptop = atan2(top, *ptop);	/* Ouch!: Args backwards! */
-	    break;
-
-	case COS:
-	    *ptop = cos(*ptop);
+	case CALC_STORE:
+	case CALC_JUMP_IF_ZERO:
+	    depth--;
 	    break;
 
-	case SIN:
-	    *ptop = sin(*ptop);
+	case END_EXPRESSION:
+	case CALC_JUMP:
+	case ARR_SUM:
+	case ARR_AVG:
+	case ARR_MAX:
+	case ARR_MIN:
 	    break;
 
-	case TAN:
-	    *ptop = tan(*ptop);
-	    break;
+	default:
+	    depth += 1 - calcStackArgs(op, pinst[i].a);
+	}
+	if (depth > max)
+	    max = depth;
+    }
+    return max < CALCPERFORM_STACK ? max : CALCPERFORM_STACK;
+}
 
-	case COSH:
-	    *ptop = cosh(*ptop);
-	    break;
+epicsShareFunc calcCompiled *
+    calcCompile(const char *pinst)
+{
+    calcCompiled *pcomp;
+    calcInst *pout;
+    const char *pscan = pinst;
+    calcJump pending[CALCPERFORM_STACK];	/* unresolved jumps */
+    int npending = 0;
+    int barrier = 0;			/* latest jump target */
+    int ninst = 1;
+    int n = 0;
+    int op;
 
-	case SINH:
-	    *ptop = sinh(*ptop);
-	    break;
+    if (!pinst)
+	return NULL;
 
-	case TANH:
-	    *ptop = tanh(*ptop);
+    /* Size the program, every postfix element becomes at most one
+     * instruction.
+     */
+    while ((op = *pscan++) != END_EXPRESSION) {
+	switch (op) {
+	case LITERAL_DOUBLE:
+	    pscan += sizeof(double);
 	    break;
-
-	case CEIL:
-	    *ptop = ceil(*ptop);
+	case LITERAL_INT:
+	    pscan += sizeof(epicsInt32);
 	    break;
-
-	case FLOOR:
-	    *ptop = floor(*ptop);
+	case MIN:
+	case MAX:
+	case FINITE:
+	case ISNAN:
+	    pscan++;
 	    break;
+	}
+	ninst++;
+    }
 
-	case FINITE:
-	    nargs = *pinst++;
-	    top = finite(*ptop);
-	    while (--nargs) {
-		--ptop;
-		top = top && finite(*ptop);
+    pcomp = malloc(offsetof(calcCompiled, inst) + ninst * sizeof(calcInst));
+    if (!pcomp)
+	return NULL;
+    pout = pcomp->inst;
+    pcomp->reduces = 0;
+    pcomp->pwork = NULL;
+    calcArgUsage(pinst, &pcomp->inputs, &pcomp->stores);
+
+    for (;;) {
+	calcInst *pi = &pout[n];
+	const char *ptarget;
+	epicsInt32 itop;
+	int nargs = 0;
+	int nstack;
+	int i;
+
+	/* Resolve jumps to here, nothing before this may be merged */
+	for (i = 0; i < npending; ) {
+	    if (pending[i].target == pinst) {
+		pout[pending[i].inst].b = n;
+		pending[i] = pending[--npending];
+		barrier = n;
 	    }
-	    *ptop = top;
-	    break;
+	    else
+		i++;
+	}
 
-	case ISINF:
-	    *ptop = isinf(*ptop);
+	op = *pinst++;
+	if (op == END_EXPRESSION)
 	    break;
 
-	case ISNAN:
-	    nargs = *pinst++;
-	    top = isnan(*ptop);
-	    while (--nargs) {
-		--ptop;
-		top = top || isnan(*ptop);
-	    }
-	    *ptop = top;
-	    break;
+	memset(pi, 0, sizeof(calcInst));
+	switch (op) {
 
-	case NINT:
-	    top = *ptop;
-	    *ptop = (epicsInt32) (top >= 0 ? top + 0.5 : top - 0.5);
-	    break;
+	case LITERAL_DOUBLE:
+	    pi->op = CALC_CONST;
+	    memcpy(&pi->value, pinst, sizeof(double));
+	    pinst += sizeof(double);
+	    n++;
+	    continue;
 
+	case LITERAL_INT:
+	    pi->op = CALC_CONST;
+	    memcpy(&itop, pinst, sizeof(epicsInt32));
+	    pi->value = itop;
+	    pinst += sizeof(epicsInt32);
+	    n++;
+	    continue;
+
+	case ARR_SUM:
+	case ARR_AVG:
+	case ARR_MAX:
+	case ARR_MIN:
+	    pcomp->reduces = 1;
+	    /* fall through */
+	case FETCH_VAL:
 	case RANDOM:
-	    *++ptop = calcRandom();
-	    break;
+	    /* Never folded */
+	    pi->op = op;
+	    n++;
+	    continue;
 
-	case REL_OR:
-	    top = *ptop--;
-	    *ptop = *ptop || top;
-	    break;
+	case FETCH_A:
+	case FETCH_B:
+	case FETCH_C:
+	case FETCH_D:
+	case FETCH_E:
+	case FETCH_F:
+	case FETCH_G:
+	case FETCH_H:
+	case FETCH_I:
+	case FETCH_J:
+	case FETCH_K:
+	case FETCH_L:
+	    pi->op = CALC_FETCH;
+	    pi->a = op - FETCH_A;
+	    n++;
+	    continue;
 
-	case REL_AND:
-	    top = *ptop--;
-	    *ptop = *ptop && top;
-	    break;
+	case STORE_A:
+	case STORE_B:
+	case STORE_C:
+	case STORE_D:
+	case STORE_E:
+	case STORE_F:
+	case STORE_G:
+	case STORE_H:
+	case STORE_I:
+	case STORE_J:
+	case STORE_K:
+	case STORE_L:
+	    pi->op = CALC_STORE;
+	    pi->a = op - STORE_A;
+	    n++;
+	    continue;
 
-	case REL_NOT:
-	    *ptop = ! *ptop;
-	    break;
+	/* Jump to where calcPerform() would continue after searching */
+	case COND_IF:
+	case COND_ELSE:
+	    ptarget = pinst;
+	    if (npending == NELEMENTS(pending) ||
+		cond_search(&ptarget, op == COND_IF ? COND_ELSE : COND_END))
+		goto bad;
+	    pi->op = op == COND_IF ? CALC_JUMP_IF_ZERO : CALC_JUMP;
+	    pending[npending].inst = n++;
+	    pending[npending++].target = ptarget;
+	    continue;
 
-        /* For bitwise operations on values with bit 31 set, double values
-         * must first be cast to unsigned to correctly set that bit; the
-         * double value must be negative in that case. The result must be
-         * cast to a signed integer before converting to the double result.
-         */
+	case COND_END:
+	    continue;
 
-	case BIT_OR:
-	    utop = *ptop--;
-	    *ptop = (epicsInt32) ((epicsUInt32) *ptop | utop);
+	case MAX:
+	case MIN:
+	case FINITE:
+	case ISNAN:
+	    nargs = *pinst++;
 	    break;
+	}
 
-	case BIT_AND:
-	    utop = *ptop--;
-	    *ptop = (epicsInt32) ((epicsUInt32) *ptop & utop);
-	    break;
+	nstack = calcStackArgs(op, nargs);
+	if (nstack < 0)
+	    goto bad;
 
-	case BIT_EXCL_OR:
-	    utop = *ptop--;
-	    *ptop = (epicsInt32) ((epicsUInt32) *ptop ^ utop);
-	    break;
+	/* Fold operators whose inputs are all constants */
+	if (n - nstack >= barrier && nstack < CALCPERFORM_STACK) {
+	    double stack[CALCPERFORM_STACK+1];
 
-	case BIT_NOT:
-	    utop = *ptop;
-	    *ptop = (epicsInt32) ~utop;
-	    break;
+	    for (i = 1; i <= nstack; i++) {
+		if (pout[n - nstack + i - 1].op != CALC_CONST)
+		    break;
+		stack[i] = pout[n - nstack + i - 1].value;
+	    }
+	    if (i > nstack) {
+		stackOp(op, stack + nstack, nargs);
+		n -= nstack;
+		pi = &pout[n];
+		memset(pi, 0, sizeof(calcInst));
+		pi->op = CALC_CONST;
+		pi->value = stack[1];
+		n++;
+		continue;
+	    }
+	}
 
-        /* The shift operators use signed integers, so a right-shift will
-         * extend the sign bit into the left-hand end of the value. The
-         * double-casting through unsigned here is important, see above.
-         */
+	if (!fuseBinop(pout, &n, barrier, op)) {
+	    pi->op = op;
+	    pi->a = nargs;
+	    n++;
+	}
+    }
+    if (npending)
+	goto bad;
+
+    memset(&pout[n], 0, sizeof(calcInst));
+    pout[n++].op = END_EXPRESSION;
+    pcomp->ninst = n;
+    pcomp->depth = stackDepth(pout, n);
+    return pcomp;
+
+bad:
+    free(pcomp);
+    return NULL;
+}
 
-	case RIGHT_SHIFT:
-	    utop = *ptop--;
-	    *ptop = ((epicsInt32) (epicsUInt32) *ptop) >> (utop & 31);
-	    break;
+/* calcPerformCompiled
+ *
+ * Evaluate an expression returned by calcCompile()
+ */
+epicsShareFunc long
+    calcPerformCompiled(const calcCompiled *pcomp, double *parg,
+	double *presult)
+{
+    double stack[CALCPERFORM_STACK+1];	/* zero'th entry not used */
+    double *ptop = stack;		/* stack pointer */
+    const calcInst *pinst = pcomp->inst;
 
-	case LEFT_SHIFT:
-	    utop = *ptop--;
-	    *ptop = ((epicsInt32) (epicsUInt32) *ptop) << (utop & 31);
-	    break;
+    for (;;) {
+	const calcInst *pi = pinst++;
 
-	case NOT_EQ:
-	    top = *ptop--;
-	    *ptop = *ptop != top;
-	    break;
+	switch (pi->op) {
 
-	case LESS_THAN:
-	    top = *ptop--;
-	    *ptop = *ptop < top;
-	    break;
+	case END_EXPRESSION:
+	    /* The stack should now have one item on it */
+	    if (ptop != stack + 1)
+		return -1;
+	    *presult = *ptop;
+	    return 0;
 
-	case LESS_OR_EQ:
-	    top = *ptop--;
-	    *ptop = *ptop <= top;
+	case CALC_CONST:
+	    *++ptop = pi->value;
 	    break;
 
-	case EQUAL:
-	    top = *ptop--;
-	    *ptop = *ptop == top;
+	case FETCH_VAL:
+	    *++ptop = *presult;
 	    break;
 
-	case GR_OR_EQ:
-	    top = *ptop--;
-	    *ptop = *ptop >= top;
+	case CALC_FETCH:
+	    *++ptop = parg[pi->a];
 	    break;
 
-	case GR_THAN:
-	    top = *ptop--;
-	    *ptop = *ptop > top;
+	case CALC_STORE:
+	    parg[pi->a] = *ptop--;
 	    break;
 
-	case COND_IF:
-	    if (*ptop-- == 0.0 &&
-		cond_search(&pinst, COND_ELSE)) return -1;
+	case CALC_JUMP_IF_ZERO:
+	    if (*ptop-- == 0.0)
+		pinst = pcomp->inst + pi->b;
 	    break;
 
-	case COND_ELSE:
-	    if (cond_search(&pinst, COND_END)) return -1;
+	case CALC_JUMP:
+	    pinst = pcomp->inst + pi->b;
 	    break;
 
-	case COND_END:
+#define CALC_BINOP_CASES(name, op) \
+	case name##_F: \
+	    *ptop = *ptop op parg[pi->a]; \
+	    break; \
+	case name##_K: \
+	    *ptop = *ptop op pi->value; \
+	    break; \
+	case name##_FF: \
+	    *++ptop = parg[pi->a] op parg[pi->b]; \
+	    break; \
+	case name##_FK: \
+	    *++ptop = parg[pi->a] op pi->value; \
 	    break;
+	CALC_BINOPS(CALC_BINOP_CASES)
+#undef CALC_BINOP_CASES
 
 	default:
-	    errlogPrintf("calcPerform: Bad Opcode %d at %p\n", op, pinst-1);
-	    return -1;
+	    ptop = stackOp(pi->op, ptop, pi->a);
 	}
     }
+}
 
-    /* The stack should now have one item on it, the expression value */
-    if (ptop != stack + 1)
-	return -1;
-    *presult = *ptop;
-    return 0;
+epicsShareFunc void
+    calcFreeCompiled(calcCompiled *pcomp)
+{
+    if (!pcomp)
+	return;
+    calcArrayFreeWork(pcomp->pwork);
+    free(pcomp);
+}
+
+double * calcStackOp(int op, double *ptop, int nargs)
+{
+    return stackOp(op, ptop, nargs);
 }
 #if defined(_WIN32) && defined(_M_X64) && !defined(_MINGW)
 #  pragma optimize("", on)
@@ -85,9 +85,12 @@ static const ELEMENT operands[] = {
 {"A",		0, 0,	1,	OPERAND,	FETCH_A},
 {"ABS",		7, 8,	0,	UNARY_OPERATOR,	ABS_VAL},
 {"ACOS",	7, 8,	0,	UNARY_OPERATOR,	ACOS},
+{"AMAX",	7, 8,	0,	UNARY_OPERATOR,	ARR_MAX},
+{"AMIN",	7, 8,	0,	UNARY_OPERATOR,	ARR_MIN},
 {"ASIN",	7, 8,	0,	UNARY_OPERATOR,	ASIN},
 {"ATAN",	7, 8,	0,	UNARY_OPERATOR,	ATAN},
 {"ATAN2",	7, 8,	-1,	UNARY_OPERATOR,	ATAN2},
+{"AVG",		7, 8,	0,	UNARY_OPERATOR,	ARR_AVG},
 {"B",		0, 0,	1,	OPERAND,	FETCH_B},
 {"C",		0, 0,	1,	OPERAND,	FETCH_C},
 {"CEIL",	7, 8,	0,	UNARY_OPERATOR,	CEIL},
@@ -124,6 +127,7 @@ static const ELEMENT operands[] = {
 {"SINH",	7, 8,	0,	UNARY_OPERATOR,	SINH},
 {"SQR",		7, 8,	0,	UNARY_OPERATOR,	SQU_RT},
 {"SQRT",	7, 8,	0,	UNARY_OPERATOR,	SQU_RT},
+{"SUM",		7, 8,	0,	UNARY_OPERATOR,	ARR_SUM},
 {"TAN",		7, 8,	0,	UNARY_OPERATOR,	TAN},
 {"TANH",	7, 8,	0,	UNARY_OPERATOR,	TANH},
 {"VAL",		0, 0,	1,	OPERAND,	FETCH_VAL},
@@ -592,6 +596,11 @@ epicsShareFunc void
 	"COND_IF",
 	"COND_ELSE",
 	"COND_END",
+    /* Array reductions */
+	"ARR_SUM",
+	"ARR_AVG",
+	"ARR_MAX",
+	"ARR_MIN",
     /* Misc */
 	"NOT_GENERATED"
     };
@@ -15,6 +15,7 @@
 #define INCpostfixh
 
 #include "shareLib.h"
+#include "epicsTypes.h"
 
 #define CALCPERFORM_NARGS 12
 #define CALCPERFORM_STACK 80
@@ -63,6 +64,9 @@
 /* Changes in the above errors must also be made in calcErrorStr() */
 
 
+/* An expression compiled by calcCompile() */
+typedef struct calcCompiled calcCompiled;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -82,6 +86,19 @@ epicsShareFunc const char *
 epicsShareFunc void
     calcExprDump(const char *pinst);
 
+epicsShareFunc calcCompiled *
+    calcCompile(const char *ppostfix);
+
+epicsShareFunc long
+    calcPerformCompiled(const calcCompiled *pcomp, double *parg, double *presult);
+
+epicsShareFunc void
+    calcFreeCompiled(calcCompiled *pcomp);
+
+epicsShareFunc long
+    calcArrayPerform(calcCompiled *pcomp, const double * const *parg,
+	const epicsUInt32 *pnelem, double *presult, epicsUInt32 *pnresult);
+
 #ifdef __cplusplus
 }
 #endif
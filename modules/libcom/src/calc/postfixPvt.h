@@ -20,11 +20,14 @@
  *     a byte giving the number of arguments to process.
  *  4. You can't use strlen() on an RPN buffer since the literal values
  *     can contain zero bytes.
+ *  5. The array reductions SUM, AVG, AMAX and AMIN only do something in
+ *     calcArrayPerform(), elsewhere they return their argument.
  */
 
 #ifndef INCpostfixPvth
 #define INCpostfixPvth
 
+#include "epicsTypes.h"
 
 /* RPN opcodes */
 typedef enum {
@@ -97,8 +100,73 @@ typedef enum {
 	COND_IF,
 	COND_ELSE,
 	COND_END,
+    /* Array reductions */
+	ARR_SUM,
+	ARR_AVG,
+	ARR_MAX,
+	ARR_MIN,
     /* Misc */
 	NOT_GENERATED
 } rpn_opcode;
 
+
+/* Compiled expressions, see calcCompile() */
+
+/* Binary operators that get superinstructions */
+#define CALC_BINOPS(X) \
+    X(ADD, +) \
+    X(SUB, -) \
+    X(MULT, *) \
+    X(DIV, /) \
+    X(NOT_EQ, !=) \
+    X(LESS_THAN, <) \
+    X(LESS_OR_EQ, <=) \
+    X(EQUAL, ==) \
+    X(GR_OR_EQ, >=) \
+    X(GR_THAN, >)
+
+/* Opcodes only found in compiled expressions.  For a binary operator op
+ * the variants are:
+ *   op_F:  *ptop = *ptop op A		(A is parg[a])
+ *   op_K:  *ptop = *ptop op value
+ *   op_FF: push A op B			(B is parg[b])
+ *   op_FK: push A op value
+ */
+enum {
+    CALC_CONST = NOT_GENERATED + 1,
+    CALC_FETCH,
+    CALC_STORE,
+    CALC_JUMP,
+    CALC_JUMP_IF_ZERO,
+#define CALC_BINOP_CODES(name, op) name##_F, name##_K, name##_FF, name##_FK,
+    CALC_BINOPS(CALC_BINOP_CODES)
+#undef CALC_BINOP_CODES
+    CALC_LAST_OPCODE
+};
+
+/* The variant of a superinstruction is (op - ADD_F) % 4 */
+enum {CALC_BINOP_F, CALC_BINOP_K, CALC_BINOP_FF, CALC_BINOP_FK};
+
+typedef struct calcInst {
+    epicsInt16 op;
+    epicsInt16 a;		/* argument index or nargs */
+    epicsInt32 b;		/* argument index or jump target */
+    double value;		/* constant operand */
+} calcInst;
+
+struct calcCompiled {
+    int ninst;
+    int depth;			/* maximum stack depth */
+    int reduces;		/* uses array reductions */
+    unsigned long inputs;	/* arguments read, from calcArgUsage() */
+    unsigned long stores;	/* arguments assigned to */
+    struct calcArrayWork *pwork;	/* buffers for calcArrayPerform() */
+    calcInst inst[1];
+};
+
+/* Shared by calcPerform.c and calcArray.c */
+int calcStackArgs(int op, int nargs);
+double * calcStackOp(int op, double *ptop, int nargs);
+void calcArrayFreeWork(struct calcArrayWork *pwork);
+
 #endif /* INCpostfixPvth */
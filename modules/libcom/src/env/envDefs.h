@@ -50,10 +50,13 @@ epicsShareExtern const ENV_PARAM EPICS_CA_SERVER_PORT;
 epicsShareExtern const ENV_PARAM EPICS_CA_MAX_ARRAY_BYTES;
 epicsShareExtern const ENV_PARAM EPICS_CA_AUTO_ARRAY_BYTES;
 epicsShareExtern const ENV_PARAM EPICS_CA_MAX_SEARCH_PERIOD;
+epicsShareExtern const ENV_PARAM EPICS_CA_MAX_SEARCH_RATE;
+epicsShareExtern const ENV_PARAM EPICS_CA_SHM_TRANSPORT;
 epicsShareExtern const ENV_PARAM EPICS_CA_NAME_SERVERS;
 epicsShareExtern const ENV_PARAM EPICS_CA_MCAST_TTL;
 epicsShareExtern const ENV_PARAM EPICS_CAS_INTF_ADDR_LIST;
 epicsShareExtern const ENV_PARAM EPICS_CAS_IGNORE_ADDR_LIST;
+epicsShareExtern const ENV_PARAM EPICS_CAS_SHM_TRANSPORT;
 epicsShareExtern const ENV_PARAM EPICS_CAS_AUTO_BEACON_ADDR_LIST;
 epicsShareExtern const ENV_PARAM EPICS_CAS_BEACON_ADDR_LIST;
 epicsShareExtern const ENV_PARAM EPICS_CAS_SERVER_PORT;
@@ -71,6 +74,12 @@ epicsShareExtern const ENV_PARAM EPICS_IOC_LOG_INET;
 epicsShareExtern const ENV_PARAM EPICS_IOC_LOG_FILE_LIMIT;
 epicsShareExtern const ENV_PARAM EPICS_IOC_LOG_FILE_NAME;
 epicsShareExtern const ENV_PARAM EPICS_IOC_LOG_FILE_COMMAND;
+epicsShareExtern const ENV_PARAM EPICS_IOC_LOG_FILE_ROTATE;
+epicsShareExtern const ENV_PARAM EPICS_IOC_LOG_FILE_SYNC;
+epicsShareExtern const ENV_PARAM EPICS_IOC_LOG_FILE_FORMAT;
+epicsShareExtern const ENV_PARAM EPICS_IOC_LOG_FILE_INDEX;
+epicsShareExtern const ENV_PARAM EPICS_IOC_LOG_QUEUE_SIZE;
+epicsShareExtern const ENV_PARAM EPICS_IOC_LOG_QUEUE_FULL;
 epicsShareExtern const ENV_PARAM EPICS_CMD_PROTO_PORT;
 epicsShareExtern const ENV_PARAM EPICS_AR_PORT;
 epicsShareExtern const ENV_PARAM IOCSH_PS1;
@@ -32,11 +32,17 @@
 #include "ellLib.h"
 #include "errlog.h"
 #include "epicsStdio.h"
+#include "epicsString.h"
 #include "epicsExit.h"
+#include "epicsAtomic.h"
+#include "epicsRingMPMC.h"
 
 
 #define BUFFER_SIZE 1280
 #define MAX_MESSAGE_SIZE 256
+#define DEFERRED_MESSAGES 1024
+#define DEFERRED_MAX_ARGS 8
+#define DEFERRED_MAX_SPEC 32
 
 /*Declare storage for errVerbose */
 epicsShareDef int errVerbose = 0;
@@ -45,7 +51,7 @@ static void errlogExitHandler(void *);
 static void errlogThread(void);
 
 static char *msgbufGetFree(int noConsoleMessage);
-static void msgbufSetSize(int size); /* Send 'size' chars plus trailing '\0' */
+static void msgbufSetSize(char *pbuffer, int size); /* Send 'size' chars plus trailing '\0' */
 static char *msgbufGetSend(int *noConsoleMessage);
 static void msgbufFreeSend(void);
 
@@ -63,6 +69,66 @@ typedef struct msgNode {
     int noConsoleMessage;
 } msgNode;
 
+/*
+ * Deferred mode, see errlogInitDeferred()
+ *
+ * A caller takes a message from the free ring, copies the format, its
+ * arguments and any strings it refers to into it and puts it on the
+ * full ring, both lock-free.  errlogThread does the formatting.  A
+ * format with conversions that can't be deferred (%n, %Lf, %ls, %1$d
+ * etc.) is formatted by the caller into the same message.
+ */
+typedef enum {
+    argInt, argUInt, argLong, argULong, argLongLong, argULongLong,
+    argSize, argPtrdiff, argDouble, argPointer, argString
+} deferredArgType;
+
+typedef struct deferredArg {
+    deferredArgType type;
+    union {
+        int i;
+        unsigned u;
+        long l;
+        unsigned long ul;
+        long long ll;
+        unsigned long long ull;
+        size_t z;
+        ptrdiff_t t;
+        double d;
+        const void *p;
+        int offset;     /* of a copied string in text[], -1 for NULL */
+    } val;
+} deferredArg;
+
+typedef struct deferredMsg {
+    int severity;       /* -1 if none */
+    int noConsoleMessage;
+    int nArgs;          /* -1 if text[] holds the formatted message */
+    int truncated;      /* string arguments didn't fit */
+    deferredArg arg[DEFERRED_MAX_ARGS];
+    char text[1];       /* the format and copied strings, maxMsgSize */
+} deferredMsg;
+
+typedef struct deferredSpec {
+    int nStar;          /* width and precision taken from arguments */
+    int precision;      /* -1 if none, -2 if taken from an argument */
+    char length;        /* 0, 'H', 'l', 'L' (long long), 'z' or 't' */
+    char conversion;
+} deferredSpec;
+
+typedef struct deferredRing {
+    epicsRingMPMCId free;
+    epicsRingMPMCId full;
+    char *pmessages;
+    int size;
+    int idle;           /* errlogThread may be waiting for work */
+    size_t dropped;
+    size_t preformatted;
+    size_t formatted;   /* errlogThread only */
+    size_t droppedReported; /* errlogThread only */
+    char *pbuffer;      /* errlogThread only */
+} deferredRing;
+
 static struct {
     epicsEventId waitForWork; /*errlogThread waits for this*/
     epicsMutexId msgQueueLock;
@@ -84,6 +150,7 @@ static struct {
     FILE         *console;
     int          missedMessages;
     char         *pbuffer;
+    deferredRing *pdeferred;
 } pvtData;
 
 
@@ -103,6 +170,318 @@ static int tvsnPrint(char *str, size_t size, const char *format, va_list ap)
     return nchar;
 }
 
+/*
+ * Parse the conversion specification after a '%', returns a pointer
+ * past it or NULL if it can't be deferred
+ */
+static const char * deferredParse(const char *p, deferredSpec *pspec)
+{
+    const char *pstart = p - 1;
+
+    pspec->nStar = 0;
+    pspec->precision = -1;
+    pspec->length = 0;
+
+    p += strspn(p, "-+ #0");
+    if (*p == '*') {
+        pspec->nStar++;
+        p++;
+    }
+    else {
+        p += strspn(p, "0123456789");
+    }
+    if (*p == '.') {
+        p++;
+        if (*p == '*') {
+            pspec->nStar++;
+            pspec->precision = -2;
+            p++;
+        }
+        else {
+            pspec->precision = atoi(p);
+            p += strspn(p, "0123456789");
+        }
+    }
+    switch (*p) {
+    case 'h':
+        pspec->length = 'H';    /* promoted to int */
+        p += p[1] == 'h' ? 2 : 1;
+        break;
+    case 'l':
+        pspec->length = p[1] == 'l' ? 'L' : 'l';
+        p += p[1] == 'l' ? 2 : 1;
+        break;
+    case 'z':
+    case 't':
+        pspec->length = *p++;
+        break;
+    }
+    pspec->conversion = *p++;
+    if (!strchr("diouxXcseEfFgGaAp", pspec->conversion) ||
+        pspec->conversion == '\0' ||
+        p - pstart >= DEFERRED_MAX_SPEC)
+        return NULL;
+    if (strchr("csp", pspec->conversion) && pspec->length)
+        return NULL;            /* wide characters */
+    if (strchr("eEfFgGaA", pspec->conversion) &&
+        pspec->length && pspec->length != 'l')
+        return NULL;
+    return p;
+}
+
+/*
+ * Copy the format and its arguments, returns FALSE without using
+ * the arguments if the format can't be deferred
+ */
+static int deferredCapture(deferredMsg *pm, const char *pFormat,
+    va_list pvar)
+{
+    size_t formatLen = strlen(pFormat);
+    size_t used = formatLen + 1;
+    const char *p = pFormat;
+    deferredSpec spec;
+    int nArgs = 0;
+
+    if (used > pvtData.maxMsgSize)
+        return FALSE;
+
+    while ((p = strchr(p, '%'))) {
+        if (*++p == '%') {
+            p++;
+            continue;
+        }
+        p = deferredParse(p, &spec);
+        if (!p)
+            return FALSE;
+        nArgs += spec.nStar + 1;
+        if (nArgs > DEFERRED_MAX_ARGS)
+            return FALSE;
+    }
+
+    memcpy(pm->text, pFormat, used);
+    pm->truncated = FALSE;
+    pm->nArgs = 0;
+    p = pFormat;
+    while ((p = strchr(p, '%'))) {
+        deferredArg *parg;
+        int precision;
+
+        if (*++p == '%') {
+            p++;
+            continue;
+        }
+        p = deferredParse(p, &spec);
+        precision = spec.precision;
+        while (spec.nStar--) {
+            parg = &pm->arg[pm->nArgs++];
+            parg->type = argInt;
+            parg->val.i = va_arg(pvar, int);
+        }
+        if (precision == -2)
+            precision = pm->arg[pm->nArgs - 1].val.i;
+        parg = &pm->arg[pm->nArgs++];
+        switch (spec.conversion) {
+        case 'd': case 'i': case 'c':
+            switch (spec.length) {
+            case 'l': parg->type = argLong;
+                parg->val.l = va_arg(pvar, long); break;
+            case 'L': parg->type = argLongLong;
+                parg->val.ll = va_arg(pvar, long long); break;
+            case 'z': parg->type = argSize;
+                parg->val.z = va_arg(pvar, size_t); break;
+            case 't': parg->type = argPtrdiff;
+                parg->val.t = va_arg(pvar, ptrdiff_t); break;
+            default: parg->type = argInt;
+                parg->val.i = va_arg(pvar, int); break;
+            }
+            break;
+        case 'o': case 'u': case 'x': case 'X':
+            switch (spec.length) {
+            case 'l': parg->type = argULong;
+                parg->val.ul = va_arg(pvar, unsigned long); break;
+            case 'L': parg->type = argULongLong;
+                parg->val.ull = va_arg(pvar, unsigned long long); break;
+            case 'z': parg->type = argSize;
+                parg->val.z = va_arg(pvar, size_t); break;
+            case 't': parg->type = argPtrdiff;
+                parg->val.t = va_arg(pvar, ptrdiff_t); break;
+            default: parg->type = argUInt;
+                parg->val.u = va_arg(pvar, unsigned); break;
+            }
+            break;
+        case 'p':
+            parg->type = argPointer;
+            parg->val.p = va_arg(pvar, const void *);
+            break;
+        case 's': {
+            const char *pstr = va_arg(pvar, const char *);
+            size_t room = used < pvtData.maxMsgSize ?
+                pvtData.maxMsgSize - used : 0;
+            size_t len;
+
+            parg->type = argString;
+            if (!pstr) {
+                parg->val.offset = -1;
+                break;
+            }
+            if (!room) {
+                /* an empty string, the '\0' ending the format */
+                parg->val.offset = (int) formatLen;
+                pm->truncated = TRUE;
+                break;
+            }
+            len = precision >= 0 ? epicsStrnLen(pstr, precision) :
+                strlen(pstr);
+            if (len >= room) {
+                /* the message would have been truncated anyway */
+                len = room - 1;
+                pm->truncated = TRUE;
+            }
+            memcpy(pm->text + used, pstr, len);
+            pm->text[used + len] = '\0';
+            parg->val.offset = (int) used;
+            used += len + 1;
+            break;
+        }
+        default:
+            parg->type = argDouble;
+            parg->val.d = va_arg(pvar, double);
+            break;
+        }
+    }
+    return TRUE;
+}
+
+#define deferredSnprintf(VALUE) \
+    (nStar == 0 ? epicsSnprintf(pbuf, size, fmt, VALUE) : \
+     nStar == 1 ? epicsSnprintf(pbuf, size, fmt, star[0], VALUE) : \
+        epicsSnprintf(pbuf, size, fmt, star[0], star[1], VALUE))
+
+/*
+ * Format one conversion, returns the chars it needs like snprintf()
+ */
+static int deferredFormatArg(char *pbuf, size_t size, const char *fmt,
+    int nStar, const int *star, const deferredArg *parg, const char *ptext)
+{
+    switch (parg->type) {
+    case argInt:        return deferredSnprintf(parg->val.i);
+    case argUInt:       return deferredSnprintf(parg->val.u);
+    case argLong:       return deferredSnprintf(parg->val.l);
+    case argULong:      return deferredSnprintf(parg->val.ul);
+    case argLongLong:   return deferredSnprintf(parg->val.ll);
+    case argULongLong:  return deferredSnprintf(parg->val.ull);
+    case argSize:       return deferredSnprintf(parg->val.z);
+    case argPtrdiff:    return deferredSnprintf(parg->val.t);
+    case argDouble:     return deferredSnprintf(parg->val.d);
+    case argPointer:    return deferredSnprintf(parg->val.p);
+    case argString:
+        if (parg->val.offset < 0)
+            return deferredSnprintf((const char *) NULL);
+        return deferredSnprintf(ptext + parg->val.offset);
+    }
+    return 0;
+}
+
+/*
+ * Format a deferred message into pbuf, with the same truncation
+ * as tvsnPrint(), returns the number of chars
+ */
+static int deferredFormat(const deferredMsg *pm, char *pbuf, int size)
+{
+    static const char tmsg[] = "<<TRUNCATED>>\n";
+    const char *p = pm->text;
+    const deferredArg *parg = pm->arg;
+    int truncated = FALSE;
+    int len = 0;
+
+    while (*p && !truncated) {
+        char fmt[DEFERRED_MAX_SPEC];
+        deferredSpec spec;
+        const char *pnext = strchr(p, '%');
+        size_t nlit = pnext ? (size_t) (pnext - p) : strlen(p);
+        int star[2] = {0, 0};
+        int i, nchar;
+
+        if (nlit) {
+            if (nlit >= size - len) {
+                nlit = size - len - 1;
+                truncated = TRUE;
+            }
+            memcpy(pbuf + len, p, nlit);
+            len += (int) nlit;
+            p += nlit;
+            continue;
+        }
+        if (p[1] == '%') {
+            if (len >= size - 1) {
+                truncated = TRUE;
+                break;
+            }
+            pbuf[len++] = '%';
+            p += 2;
+            continue;
+        }
+        pnext = deferredParse(p + 1, &spec);
+        memcpy(fmt, p, pnext - p);
+        fmt[pnext - p] = '\0';
+        for (i = 0; i < spec.nStar; i++)
+            star[i] = (parg++)->val.i;
+        nchar = deferredFormatArg(pbuf + len, size - len, fmt,
+            spec.nStar, star, parg++, pm->text);
+        if (nchar < 0)
+            nchar = 0;
+        if (nchar >= size - len) {
+            nchar = size - len - 1;
+            truncated = TRUE;
+        }
+        len += nchar;
+        p = pnext;
+    }
+    pbuf[len] = '\0';
+
+    if (truncated || pm->truncated) {
+        /* a string cut short by deferredCapture() may end early */
+        if (size > sizeof tmsg) {
+            if (len > size - (int) sizeof tmsg)
+                len = size - (int) sizeof tmsg;
+            strcpy(pbuf + len, tmsg);
+            len += (int) sizeof tmsg - 1;
+        }
+        else {
+            len = size - 1;
+        }
+    }
+    return len;
+}
+
+/*
+ * Queue a message in deferred mode, returns FALSE if the caller
+ * must format it instead
+ */
+static int deferredVprintf(int severity, int noConsoleMessage,
+    const char *pFormat, va_list pvar)
+{
+    deferredRing *pd = pvtData.pdeferred;
+    deferredMsg *pm = epicsRingMPMCPop(pd->free);
+
+    if (!pm) {
+        epicsAtomicIncrSizeT(&pd->dropped);
+        return TRUE;
+    }
+    if (!deferredCapture(pm, pFormat ? pFormat : "", pvar)) {
+        epicsRingMPMCPush(pd->free, pm);
+        return FALSE;
+    }
+    pm->severity = severity;
+    pm->noConsoleMessage = noConsoleMessage;
+    epicsRingMPMCPush(pd->full, pm);
+
+    /* full barrier, pairs with the one in deferredIdle() */
+    if (epicsAtomicCmpAndSwapIntT(&pd->idle, 1, 0) == 1)
+        epicsEventSignal(pvtData.waitForWork);
+    return TRUE;
+}
+
 int errlogPrintf(const char *pFormat, ...)
 {
     va_list pvar;
@@ -119,6 +498,17 @@ int errlogPrintf(const char *pFormat, ...)
     errlogInit(0);
     isOkToBlock = epicsThreadIsOkToBlock();
 
+    if (pvtData.pdeferred && !pvtData.atExit) {
+        int queued;
+
+        va_start(pvar, pFormat);
+        queued = deferredVprintf(-1, FALSE, pFormat, pvar);
+        va_end(pvar);
+        if (queued)
+            return 0;
+        isOkToBlock = FALSE;    /* errlogThread writes to the console */
+    }
+
     if (pvtData.atExit || (isOkToBlock && pvtData.toConsole)) {
         FILE *console = pvtData.console ? pvtData.console : stderr;
 
@@ -138,7 +528,7 @@ int errlogPrintf(const char *pFormat, ...)
     va_start(pvar, pFormat);
     nchar = tvsnPrint(pbuffer, pvtData.maxMsgSize, pFormat?pFormat:"", pvar);
     va_end(pvar);
-    msgbufSetSize(nchar);
+    msgbufSetSize(pbuffer, nchar);
     return nchar;
 }
 
@@ -160,6 +550,12 @@ int errlogVprintf(const char *pFormat,va_list pvar)
         return 0;
     isOkToBlock = epicsThreadIsOkToBlock();
 
+    if (pvtData.pdeferred) {
+        if (deferredVprintf(-1, FALSE, pFormat, pvar))
+            return 0;
+        isOkToBlock = FALSE;    /* errlogThread writes to the console */
+    }
+
     pbuffer = msgbufGetFree(isOkToBlock);
     if (!pbuffer) {
         console = pvtData.console ? pvtData.console : stderr;
@@ -174,7 +570,7 @@ int errlogVprintf(const char *pFormat,va_list pvar)
         fprintf(console, "%s", pbuffer);
         fflush(console);
     }
-    msgbufSetSize(nchar);
+    msgbufSetSize(pbuffer, nchar);
     return nchar;
 }
 
@@ -217,12 +613,15 @@ int errlogVprintfNoConsole(const char *pFormat, va_list pvar)
     if (pvtData.atExit)
         return 0;
 
+    if (pvtData.pdeferred && deferredVprintf(-1, TRUE, pFormat, pvar))
+        return 0;
+
     pbuffer = msgbufGetFree(1);
     if (!pbuffer)
         return 0;
 
     nchar = tvsnPrint(pbuffer, pvtData.maxMsgSize, pFormat?pFormat:"", pvar);
-    msgbufSetSize(nchar);
+    msgbufSetSize(pbuffer, nchar);
     return nchar;
 }
 
@@ -244,6 +643,16 @@ int errlogSevPrintf(errlogSevEnum severity, const char *pFormat, ...)
         return 0;
 
     isOkToBlock = epicsThreadIsOkToBlock();
+    if (pvtData.pdeferred && !pvtData.atExit) {
+        int queued;
+
+        va_start(pvar, pFormat);
+        queued = deferredVprintf(severity, FALSE, pFormat, pvar);
+        va_end(pvar);
+        if (queued)
+            return 0;
+        isOkToBlock = FALSE;    /* errlogThread writes to the console */
+    }
     if (pvtData.atExit || (isOkToBlock && pvtData.toConsole)) {
         FILE *console = pvtData.console ? pvtData.console : stderr;
 
@@ -262,6 +671,7 @@ int errlogSevPrintf(errlogSevEnum severity, const char *pFormat, ...)
 
 int errlogSevVprintf(errlogSevEnum severity, const char *pFormat, va_list pvar)
 {
+    char *pbuffer;
     char *pnext;
     int nchar;
     int totalChar = 0;
@@ -278,7 +688,12 @@ int errlogSevVprintf(errlogSevEnum severity, const char *pFormat, va_list pvar)
         return 0;
 
     isOkToBlock = epicsThreadIsOkToBlock();
-    pnext = msgbufGetFree(isOkToBlock);
+    if (pvtData.pdeferred) {
+        if (deferredVprintf(severity, FALSE, pFormat, pvar))
+            return 0;
+        isOkToBlock = FALSE;    /* errlogThread writes to the console */
+    }
+    pbuffer = pnext = msgbufGetFree(isOkToBlock);
     if (!pnext)
         return 0;
 
@@ -290,7 +705,7 @@ int errlogSevVprintf(errlogSevEnum severity, const char *pFormat, va_list pvar)
         strcpy(pnext,"\n");
         totalChar++;
     }
-    msgbufSetSize(totalChar);
+    msgbufSetSize(pbuffer, totalChar);
     return nchar;
 }
 
@@ -385,6 +800,7 @@ void errPrintf(long status, const char *pFileName, int lineno,
     const char *pformat, ...)
 {
     va_list pvar;
+    char    *pbuffer;
     char    *pnext;
     int     nchar;
     int     totalChar=0;
@@ -405,6 +821,9 @@ void errPrintf(long status, const char *pFileName, int lineno,
         errSymLookup(status, name, sizeof(name));
     }
 
+    if (pvtData.pdeferred)
+        isOkToBlock = FALSE;    /* errlogThread writes to the console */
+
     if (pvtData.atExit || (isOkToBlock && pvtData.toConsole)) {
         FILE *console = pvtData.console ? pvtData.console : stderr;
 
@@ -424,7 +843,7 @@ void errPrintf(long status, const char *pFileName, int lineno,
     if (pvtData.atExit)
         return;
 
-    pnext = msgbufGetFree(isOkToBlock);
+    pbuffer = pnext = msgbufGetFree(isOkToBlock);
     if (!pnext)
         return;
 
@@ -447,7 +866,7 @@ void errPrintf(long status, const char *pFileName, int lineno,
     }
     strcpy(pnext, "\n");
     totalChar++ ; /*include the \n */
-    msgbufSetSize(totalChar);
+    msgbufSetSize(pbuffer, totalChar);
 }
 
 
@@ -527,6 +946,94 @@ int errlogInit(int bufsize)
     return errlogInit2(bufsize, MAX_MESSAGE_SIZE);
 }
 
+int errlogInitDeferred(int nMessages)
+{
+    deferredRing *pd;
+    size_t msgSize;
+    int i;
+
+    errlogInit(0);
+    if (pvtData.atExit || pvtData.pdeferred)
+        return 0;
+
+    if (nMessages <= 0)
+        nMessages = DEFERRED_MESSAGES;
+    msgSize = adjustToWorstCaseAlignment(offsetof(deferredMsg, text) +
+        pvtData.maxMsgSize);
+
+    pd = callocMustSucceed(1, sizeof(*pd), "errlogInitDeferred");
+    pd->size = nMessages;
+    pd->idle = TRUE;
+    pd->free = epicsRingMPMCCreate(nMessages);
+    pd->full = epicsRingMPMCCreate(nMessages);
+    pd->pmessages = calloc(nMessages, msgSize);
+    pd->pbuffer = malloc(pvtData.maxMsgSize);
+    if (!pd->free || !pd->full || !pd->pmessages || !pd->pbuffer) {
+        epicsRingMPMCDelete(pd->free);
+        epicsRingMPMCDelete(pd->full);
+        free(pd->pmessages);
+        free(pd->pbuffer);
+        free(pd);
+        return -1;
+    }
+    for (i = 0; i < nMessages; i++)
+        epicsRingMPMCPush(pd->free, pd->pmessages + i * msgSize);
+
+    /*
+     * not while a caller is between msgbufGetFree() and msgbufSetSize(),
+     * msgbufGetFree() checks again once it holds the lock
+     */
+    epicsMutexMustLock(pvtData.msgQueueLock);
+    if (!pvtData.pdeferred) {
+        epicsAtomicWriteMemoryBarrier();
+        pvtData.pdeferred = pd;
+        pd = NULL;
+    }
+    epicsMutexUnlock(pvtData.msgQueueLock);
+    if (pd) {
+        epicsRingMPMCDelete(pd->free);
+        epicsRingMPMCDelete(pd->full);
+        free(pd->pmessages);
+        free(pd->pbuffer);
+        free(pd);
+    }
+    return 0;
+}
+
+int errlogGetDeferredStats(errlogDeferredStats *pstats)
+{
+    deferredRing *pd;
+
+    errlogInit(0);
+    pd = pvtData.pdeferred;
+    if (!pd)
+        return -1;
+
+    pstats->size = pd->size;
+    pstats->used = epicsRingMPMCGetUsed(pd->full);
+    pstats->highWaterMark = epicsRingMPMCGetHighWaterMark(pd->full);
+    pstats->dropped = epicsAtomicGetSizeT(&pd->dropped);
+    pstats->preformatted = epicsAtomicGetSizeT(&pd->preformatted);
+    pstats->formatted = epicsAtomicGetSizeT(&pd->formatted);
+    return 0;
+}
+
+void errlogDeferredShow(int level)
+{
+    errlogDeferredStats stats;
+
+    if (errlogGetDeferredStats(&stats)) {
+        printf("errlog: deferred mode is off\n");
+        return;
+    }
+    printf("errlog: %d of %d deferred messages queued, high water mark %d\n",
+        stats.used, stats.size, stats.highWaterMark);
+    printf("    %lu formatted by errlog, %lu by the caller, %lu dropped\n",
+        (unsigned long) stats.formatted,
+        (unsigned long) stats.preformatted,
+        (unsigned long) stats.dropped);
+}
+
 void errlogFlush(void)
 {
     int count;
@@ -539,7 +1046,7 @@ void errlogFlush(void)
     epicsMutexMustLock(pvtData.msgQueueLock);
     count = ellCount(&pvtData.msgQueue);
     epicsMutexUnlock(pvtData.msgQueueLock);
-    if (count <= 0)
+    if (count <= 0 && !pvtData.pdeferred)
         return;
 
     /*must let errlogThread empty queue*/
@@ -550,33 +1057,97 @@ void errlogFlush(void)
     epicsMutexUnlock(pvtData.flushLock);
 }
 
-static void errlogThread(void)
+static void errlogDispatch(const char *pmessage, int noConsoleMessage)
 {
     listenerNode *plistenerNode;
+
+    epicsMutexMustLock(pvtData.listenerLock);
+    if (pvtData.toConsole && !noConsoleMessage) {
+        FILE *console = pvtData.console ? pvtData.console : stderr;
+
+        fprintf(console, "%s", pmessage);
+        fflush(console);
+    }
+
+    plistenerNode = (listenerNode *)ellFirst(&pvtData.listenerList);
+    while (plistenerNode) {
+        (*plistenerNode->listener)(plistenerNode->pPrivate, pmessage);
+        plistenerNode = (listenerNode *)ellNext(&plistenerNode->node);
+    }
+
+    epicsMutexUnlock(pvtData.listenerLock);
+}
+
+/*
+ * Returns TRUE if errlogThread may wait, a producer which
+ * then queues a message must signal waitForWork
+ */
+static int deferredIdle(deferredRing *pd)
+{
+    /* full barrier, pairs with the one in deferredVprintf() */
+    epicsAtomicCmpAndSwapIntT(&pd->idle, 0, 1);
+    if (epicsRingMPMCIsEmpty(pd->full))
+        return TRUE;
+    epicsAtomicSetIntT(&pd->idle, 0);
+    return FALSE;
+}
+
+static void deferredDrain(deferredRing *pd)
+{
+    deferredMsg *pm;
+
+    while ((pm = epicsRingMPMCPop(pd->full))) {
+        size_t dropped = epicsAtomicGetSizeT(&pd->dropped);
+        const char *pmessage = pm->text;
+
+        if (dropped != pd->droppedReported) {
+            sprintf(pd->pbuffer, "errlog: %lu messages were discarded\n",
+                (unsigned long) (dropped - pd->droppedReported));
+            pd->droppedReported = dropped;
+            errlogDispatch(pd->pbuffer, FALSE);
+        }
+
+        if (pm->nArgs >= 0) {
+            int len = 0;
+            int size = pvtData.maxMsgSize;
+
+            if (pm->severity >= 0) {
+                len = sprintf(pd->pbuffer, "sevr=%s ",
+                    errlogGetSevEnumString(pm->severity));
+                size -= len + 1;    /* room for a \n */
+            }
+            len += deferredFormat(pm, pd->pbuffer + len, size);
+            if (pm->severity >= 0 && pd->pbuffer[len - 1] != '\n')
+                strcpy(pd->pbuffer + len, "\n");
+            pmessage = pd->pbuffer;
+            pd->formatted++;
+        }
+        errlogDispatch(pmessage, pm->noConsoleMessage);
+        epicsRingMPMCPush(pd->free, pm);
+    }
+}
+
+static void errlogThread(void)
+{
     int noConsoleMessage;
     char *pmessage;
 
     epicsAtExit(errlogExitHandler,0);
     while (TRUE) {
-        epicsEventMustWait(pvtData.waitForWork);
-        while ((pmessage = msgbufGetSend(&noConsoleMessage))) {
-            epicsMutexMustLock(pvtData.listenerLock);
-            if (pvtData.toConsole && !noConsoleMessage) {
-                FILE *console = pvtData.console ? pvtData.console : stderr;
-
-                fprintf(console, "%s", pmessage);
-                fflush(console);
-            }
-
-            plistenerNode = (listenerNode *)ellFirst(&pvtData.listenerList);
-            while (plistenerNode) {
-                (*plistenerNode->listener)(plistenerNode->pPrivate, pmessage);
-                plistenerNode = (listenerNode *)ellNext(&plistenerNode->node);
-            }
+        deferredRing *pd = pvtData.pdeferred;
 
-            epicsMutexUnlock(pvtData.listenerLock);
+        if (!pd || deferredIdle(pd)) {
+            epicsEventMustWait(pvtData.waitForWork);
+            pd = pvtData.pdeferred;
+            if (pd)
+                epicsAtomicSetIntT(&pd->idle, 0);
+        }
+        while ((pmessage = msgbufGetSend(&noConsoleMessage))) {
+            errlogDispatch(pmessage, noConsoleMessage);
             msgbufFreeSend();
         }
+        if (pd)
+            deferredDrain(pd);
 
         if (pvtData.atExit)
             break;
@@ -623,13 +1194,42 @@ static msgNode * msgbufGetNode(void)
     return pnextSend;
 }
 
+/* a deferred message which the caller formats */
+static char * msgbufGetDeferred(int noConsoleMessage)
+{
+    deferredRing *pd = pvtData.pdeferred;
+    deferredMsg *pm = epicsRingMPMCPop(pd->free);
+
+    if (!pm) {
+        epicsAtomicIncrSizeT(&pd->dropped);
+        return 0;
+    }
+    epicsAtomicIncrSizeT(&pd->preformatted);
+    pm->severity = -1;
+    pm->noConsoleMessage = noConsoleMessage;
+    pm->nArgs = -1;
+    return pm->text;
+}
+
 static char * msgbufGetFree(int noConsoleMessage)
 {
     msgNode *pnextSend;
 
+    if (pvtData.pdeferred)
+        return msgbufGetDeferred(noConsoleMessage);
+
     if (epicsMutexLock(pvtData.msgQueueLock) != epicsMutexLockOK)
         return 0;
 
+    /*
+     * errlogInitDeferred() may have switched modes meanwhile. While
+     * the lock is held it can't, so msgbufSetSize() sees the same mode.
+     */
+    if (pvtData.pdeferred) {
+        epicsMutexUnlock(pvtData.msgQueueLock);
+        return msgbufGetDeferred(noConsoleMessage);
+    }
+
     if ((ellCount(&pvtData.msgQueue) == 0) && pvtData.missedMessages) {
         int nchar;
 
@@ -653,10 +1253,20 @@ static char * msgbufGetFree(int noConsoleMessage)
     return 0;
 }
 
-static void msgbufSetSize(int size)
+static void msgbufSetSize(char *pbuffer, int size)
 {
     msgNode *pnextSend = pvtData.pnextSend;
 
+    if (pvtData.pdeferred) {
+        deferredRing *pd = pvtData.pdeferred;
+
+        epicsRingMPMCPush(pd->full,
+            pbuffer - offsetof(deferredMsg, text));
+        if (epicsAtomicCmpAndSwapIntT(&pd->idle, 1, 0) == 1)
+            epicsEventSignal(pvtData.waitForWork);
+        return;
+    }
+
     pnextSend->length = size+1;
     ellAdd(&pvtData.msgQueue, &pnextSend->node);
     epicsMutexUnlock(pvtData.msgQueueLock);
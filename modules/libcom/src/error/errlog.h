@@ -75,6 +75,26 @@ epicsShareFunc int errlogInit(int bufsize);
 epicsShareFunc int errlogInit2(int bufsize, int maxMsgSize);
 epicsShareFunc void errlogFlush(void);
 
+/*
+ * Deferred mode, for code which may log at high rates. Callers queue
+ * the format and its arguments on a lock-free ring of nMessages and
+ * the errlog thread formats them, also for the console. Messages are
+ * dropped and counted when the ring is full. The printf routines then
+ * return 0 instead of the message length. Once on it stays on.
+ */
+typedef struct errlogDeferredStats {
+    int size;               /* messages the ring holds */
+    int used;               /* currently queued */
+    int highWaterMark;
+    size_t formatted;       /* by the errlog thread */
+    size_t preformatted;    /* by the caller, a format it can't defer */
+    size_t dropped;         /* the ring was full */
+} errlogDeferredStats;
+
+epicsShareFunc int errlogInitDeferred(int nMessages);
+epicsShareFunc int errlogGetDeferredStats(errlogDeferredStats *pstats);
+epicsShareFunc void errlogDeferredShow(int level);
+
 epicsShareFunc void errPrintf(long status, const char *pFileName, int lineno,
     const char *pformat, ...) EPICS_PRINTF_STYLE(4,5);
 
@@ -20,6 +20,15 @@
 //
 
 #include <algorithm>
+#include <climits>
+#include <cmath>
+
+#if defined ( __linux__ )
+#   include <cerrno>
+#   include <unistd.h>
+#   include <sys/epoll.h>
+#   define FDMGR_HAVE_EPOLL
+#endif
 
 #define instantiateRecourceLib
 #define epicsExportSharedSymbols
@@ -35,6 +44,311 @@ epicsShareDef fdManager fileDescriptorManager;
 const unsigned mSecPerSec = 1000u;
 const unsigned uSecPerSec = 1000u * mSecPerSec;
 
+//
+// fdManager::reactor
+//
+// Waits for activity on the registered file descriptors. The
+// fdManager tells the reactor when an fdReg is installed or removed,
+// and the reactor moves each fdReg with activity from the pending
+// list to the active list with fdManager::activate().
+//
+class fdManager::reactor {
+public:
+    virtual ~reactor () {}
+    virtual const char * name () const = 0;
+    // false if this fd can not be handled by the reactor
+    virtual bool accepts ( const SOCKET fd ) const = 0;
+    virtual void install ( fdReg & reg ) = 0;
+    virtual void remove ( fdReg & reg ) = 0;
+    // returns the number of fdReg activated, or -1 on error
+    virtual int wait ( double delay ) = 0;
+};
+
+//
+// fdManager::selectReactor
+//
+// Rebuilds the fd_sets from the pending list on every wait, so the
+// cost of a wait is proportional to the number of registered fds
+//
+class fdManager::selectReactor : public fdManager::reactor {
+public:
+    selectReactor ( fdManager & );
+    ~selectReactor ();
+    const char * name () const;
+    bool accepts ( const SOCKET fd ) const;
+    void install ( fdReg & reg );
+    void remove ( fdReg & reg );
+    int wait ( double delay );
+private:
+    fdManager & manager;
+    fd_set * fdSetsPtr;
+    SOCKET maxFD;
+    selectReactor ( const selectReactor & );
+    selectReactor & operator = ( const selectReactor & );
+};
+
+fdManager::selectReactor::selectReactor ( fdManager & managerIn ) :
+    manager ( managerIn ), fdSetsPtr ( new fd_set [fdrNEnums] ), maxFD ( 0 )
+{
+    for ( size_t i = 0u; i < fdrNEnums; i++ ) {
+        FD_ZERO ( &fdSetsPtr[i] );
+    }
+}
+
+fdManager::selectReactor::~selectReactor ()
+{
+    delete [] this->fdSetsPtr;
+}
+
+const char * fdManager::selectReactor::name () const
+{
+    return "select";
+}
+
+bool fdManager::selectReactor::accepts ( const SOCKET fd ) const
+{
+    return FD_IN_FDSET ( fd );
+}
+
+void fdManager::selectReactor::install ( fdReg & reg )
+{
+    this->maxFD = max ( this->maxFD, reg.getFD()+1 );
+}
+
+void fdManager::selectReactor::remove ( fdReg & reg )
+{
+    FD_CLR(reg.getFD(), &this->fdSetsPtr[reg.getType()]);
+}
+
+int fdManager::selectReactor::wait ( double delay )
+{
+    tsDLIter < fdReg > iter = this->manager.regList.firstIter ();
+    while ( iter.valid () ) {
+        FD_SET(iter->getFD(), &this->fdSetsPtr[iter->getType()]);
+        ++iter;
+    }
+
+    struct timeval tv;
+    tv.tv_sec = static_cast<time_t> ( delay );
+    tv.tv_usec = static_cast<long> ( (delay-tv.tv_sec) * uSecPerSec );
+
+    fd_set * pReadSet = & this->fdSetsPtr[fdrRead];
+    fd_set * pWriteSet = & this->fdSetsPtr[fdrWrite];
+    fd_set * pExceptSet = & this->fdSetsPtr[fdrException];
+    int status = select (this->maxFD, pReadSet, pWriteSet, pExceptSet, &tv);
+
+    if ( status > 0 ) {
+        int nActive = 0;
+
+        //
+        // Look for activity
+        //
+        iter=this->manager.regList.firstIter ();
+        while ( iter.valid () && status > 0 ) {
+            tsDLIter < fdReg > tmp = iter;
+            tmp++;
+            if (FD_ISSET(iter->getFD(), &this->fdSetsPtr[iter->getType()])) {
+                FD_CLR(iter->getFD(), &this->fdSetsPtr[iter->getType()]);
+                this->manager.activate ( *iter );
+                nActive++;
+                status--;
+            }
+            iter = tmp;
+        }
+        return nActive;
+    }
+    else if ( status < 0 ) {
+        // dont depend on flags being properly set if
+        // an error is retuned from select
+        for ( size_t i = 0u; i < fdrNEnums; i++ ) {
+            FD_ZERO ( &fdSetsPtr[i] );
+        }
+        return -1;
+    }
+    return 0;
+}
+
+#ifdef FDMGR_HAVE_EPOLL
+
+//
+// fdManager::epollReactor
+//
+// Each fd is registered with the kernel once, with the union of the
+// interests of its fdReg objects, so the cost of a wait is proportional
+// to the number of fds with activity. Level triggered, so any activity
+// left unconsumed by a callBack() is reported again on the next wait.
+//
+class fdManager::epollReactor : public fdManager::reactor {
+public:
+    epollReactor ( fdManager &, int epollFD );
+    ~epollReactor ();
+    static epollReactor * create ( fdManager & );
+    const char * name () const;
+    bool accepts ( const SOCKET fd ) const;
+    void install ( fdReg & reg );
+    void remove ( fdReg & reg );
+    int wait ( double delay );
+private:
+    enum { maxEvents = 256 };
+    fdManager & manager;
+    struct epoll_event events [ maxEvents ];
+    int epollFD;
+    unsigned interest ( const SOCKET fd );
+    static unsigned interest ( const fdRegType type );
+    void activate ( const SOCKET fd, const fdRegType type );
+    epollReactor ( const epollReactor & );
+    epollReactor & operator = ( const epollReactor & );
+};
+
+fdManager::epollReactor::epollReactor ( fdManager & managerIn, int epollFDIn ) :
+    manager ( managerIn ), epollFD ( epollFDIn )
+{
+}
+
+fdManager::epollReactor::~epollReactor ()
+{
+    close ( this->epollFD );
+}
+
+fdManager::epollReactor * fdManager::epollReactor::create ( fdManager & mgr )
+{
+    int epollFD = epoll_create1 ( EPOLL_CLOEXEC );
+    if ( epollFD < 0 ) {
+        return 0;
+    }
+    return new epollReactor ( mgr, epollFD );
+}
+
+const char * fdManager::epollReactor::name () const
+{
+    return "epoll";
+}
+
+bool fdManager::epollReactor::accepts ( const SOCKET fd ) const
+{
+    return fd >= 0;
+}
+
+//
+// union of the interests of all fdReg objects for this fd
+//
+unsigned fdManager::epollReactor::interest ( const SOCKET fd )
+{
+    unsigned mask = 0u;
+    if ( this->manager.lookUpFD ( fd, fdrRead ) ) {
+        mask |= EPOLLIN;
+    }
+    if ( this->manager.lookUpFD ( fd, fdrWrite ) ) {
+        mask |= EPOLLOUT;
+    }
+    if ( this->manager.lookUpFD ( fd, fdrException ) ) {
+        mask |= EPOLLPRI;
+    }
+    return mask;
+}
+
+unsigned fdManager::epollReactor::interest ( const fdRegType type )
+{
+    static const unsigned mask[fdrNEnums] = { EPOLLIN, EPOLLOUT, EPOLLPRI };
+    return mask[type];
+}
+
+void fdManager::epollReactor::install ( fdReg & reg )
+{
+    struct epoll_event ev;
+    ev.events = this->interest ( reg.getFD () );
+    ev.data.fd = reg.getFD ();
+
+    //
+    // The kernel silently drops a closed fd, so our idea of what
+    // is registered may be stale; retry with the other operation.
+    //
+    bool first = ( ev.events == interest ( reg.getType () ) );
+    int status = epoll_ctl ( this->epollFD,
+        first ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, reg.getFD (), &ev );
+    if ( status < 0 && ( errno == EEXIST || errno == ENOENT ) ) {
+        status = epoll_ctl ( this->epollFD,
+            first ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, reg.getFD (), &ev );
+    }
+    if ( status < 0 ) {
+        char sockErrBuf[64];
+        epicsSocketConvertErrnoToString (
+            sockErrBuf, sizeof ( sockErrBuf ) );
+        fprintf ( stderr,
+            "fdManager: epoll_ctl failed for fd %d because \"%s\"\n",
+            reg.getFD (), sockErrBuf );
+    }
+}
+
+void fdManager::epollReactor::remove ( fdReg & reg )
+{
+    struct epoll_event ev;
+    ev.events = this->interest ( reg.getFD () );
+    ev.data.fd = reg.getFD ();
+
+    //
+    // errors are expected here if the fd was already closed
+    //
+    if ( ev.events ) {
+        epoll_ctl ( this->epollFD, EPOLL_CTL_MOD, reg.getFD (), &ev );
+    }
+    else {
+        epoll_ctl ( this->epollFD, EPOLL_CTL_DEL, reg.getFD (), &ev );
+    }
+}
+
+void fdManager::epollReactor::activate ( const SOCKET fd, const fdRegType type )
+{
+    fdReg * pReg = this->manager.lookUpFD ( fd, type );
+    if ( pReg && pReg->state == fdReg::pending ) {
+        this->manager.activate ( *pReg );
+    }
+}
+
+int fdManager::epollReactor::wait ( double delay )
+{
+    // round up so that we dont spin before a timer expires
+    double mSec = ceil ( max ( delay, 0.0 ) * mSecPerSec );
+    int timeout = mSec < INT_MAX ? static_cast < int > ( mSec ) : INT_MAX;
+
+    int status = epoll_wait ( this->epollFD, this->events, maxEvents, timeout );
+    if ( status <= 0 ) {
+        return status;
+    }
+
+    for ( int i = 0; i < status; i++ ) {
+        const SOCKET fd = this->events[i].data.fd;
+        const unsigned flags = this->events[i].events;
+
+        // select() reports errors and hangups as readable and writable
+        if ( flags & ( EPOLLIN | EPOLLERR | EPOLLHUP ) ) {
+            this->activate ( fd, fdrRead );
+        }
+        if ( flags & ( EPOLLOUT | EPOLLERR | EPOLLHUP ) ) {
+            this->activate ( fd, fdrWrite );
+        }
+        if ( flags & ( EPOLLPRI | EPOLLERR | EPOLLHUP ) ) {
+            this->activate ( fd, fdrException );
+        }
+
+        //
+        // The kernel always reports errors and hangups, even for an fd
+        // with only exception interest. A read or write callBack()
+        // consumes the condition, but otherwise it would be reported
+        // again by every wait, so stop watching the fd. Installing
+        // another fdReg for it watches it again.
+        //
+        if ( ( flags & ( EPOLLERR | EPOLLHUP ) ) &&
+                ! this->manager.lookUpFD ( fd, fdrRead ) &&
+                ! this->manager.lookUpFD ( fd, fdrWrite ) ) {
+            epoll_ctl ( this->epollFD, EPOLL_CTL_DEL, fd, &this->events[i] );
+        }
+    }
+    return this->manager.activeList.count ();
+}
+
+#endif // FDMGR_HAVE_EPOLL
+
 //
 // fdManager::fdManager()
 //
@@ -43,15 +357,44 @@ const unsigned uSecPerSec = 1000u * mSecPerSec;
 //
 epicsShareFunc fdManager::fdManager () : 
     sleepQuantum ( epicsThreadSleepQuantum () ), 
-        fdSetsPtr ( new fd_set [fdrNEnums] ),
-        pTimerQueue ( 0 ), maxFD ( 0 ), processInProg ( false ), 
+        pReactor ( 0 ), pTimerQueue ( 0 ), processInProg ( false ),
         pCBReg ( 0 )
 {
     int status = osiSockAttach ();
     assert (status);
 
-    for ( size_t i = 0u; i < fdrNEnums; i++ ) {
-        FD_ZERO ( &fdSetsPtr[i] ); 
+    this->createReactor ( fdmrDefault );
+}
+
+epicsShareFunc fdManager::fdManager ( fdReactorType reactorType ) :
+    sleepQuantum ( epicsThreadSleepQuantum () ),
+        pReactor ( 0 ), pTimerQueue ( 0 ), processInProg ( false ),
+        pCBReg ( 0 )
+{
+    int status = osiSockAttach ();
+    assert (status);
+
+    this->createReactor ( reactorType );
+}
+
+//
+// fdManager::createReactor()
+//
+// falls back to select() if the requested reactor is unavailable
+//
+void fdManager::createReactor ( fdReactorType reactorType )
+{
+#ifdef FDMGR_HAVE_EPOLL
+    if ( reactorType == fdmrDefault || reactorType == fdmrEpoll ) {
+        this->pReactor = epollReactor::create ( *this );
+    }
+#endif
+    if ( ! this->pReactor ) {
+        if ( reactorType == fdmrEpoll ) {
+            fprintf ( stderr,
+                "fdManager: epoll unavailable, using select\n" );
+        }
+        this->pReactor = new selectReactor ( *this );
     }
 }
 
@@ -71,7 +414,7 @@ epicsShareFunc fdManager::~fdManager()
         pReg->destroy();
     }
     delete this->pTimerQueue;
-    delete [] this->fdSetsPtr;
+    delete this->pReactor;
     osiSockRelease();
 }
 
@@ -103,45 +446,12 @@ epicsShareFunc void fdManager::process (double delay)
         minDelay = delay;
     }
 
-    bool ioPending = false;
-    tsDLIter < fdReg > iter = this->regList.firstIter ();
-    while ( iter.valid () ) {
-        FD_SET(iter->getFD(), &this->fdSetsPtr[iter->getType()]); 
-        ioPending = true;
-        ++iter;
-    }
-
-    if ( ioPending ) {
-        struct timeval tv;
-        tv.tv_sec = static_cast<time_t> ( minDelay );
-        tv.tv_usec = static_cast<long> ( (minDelay-tv.tv_sec) * uSecPerSec );
-
-        fd_set * pReadSet = & this->fdSetsPtr[fdrRead];
-        fd_set * pWriteSet = & this->fdSetsPtr[fdrWrite];
-        fd_set * pExceptSet = & this->fdSetsPtr[fdrException];
-        int status = select (this->maxFD, pReadSet, pWriteSet, pExceptSet, &tv);
+    if ( this->regList.count () ) {
+        int status = this->pReactor->wait ( minDelay );
 
         this->pTimerQueue->process(epicsTime::getCurrent());
 
         if ( status > 0 ) {
-
-            //
-            // Look for activity
-            //
-            iter=this->regList.firstIter ();
-            while ( iter.valid () && status > 0 ) {
-                tsDLIter < fdReg > tmp = iter;
-                tmp++;
-                if (FD_ISSET(iter->getFD(), &this->fdSetsPtr[iter->getType()])) {
-                    FD_CLR(iter->getFD(), &this->fdSetsPtr[iter->getType()]);
-                    this->regList.remove(*iter);
-                    this->activeList.add(*iter);
-                    iter->state = fdReg::active;
-                    status--;
-                }
-                iter = tmp;
-            }
-
             //
             // I am careful to prevent problems if they access the
             // above list while in a "callBack()" routine
@@ -177,12 +487,6 @@ epicsShareFunc void fdManager::process (double delay)
         }
         else if ( status < 0 ) {
             int errnoCpy = SOCKERRNO;
-            
-            // dont depend on flags being properly set if 
-            // an error is retuned from select
-            for ( size_t i = 0u; i < fdrNEnums; i++ ) {
-                FD_ZERO ( &fdSetsPtr[i] );
-            }
 
             //
             // print a message if its an unexpected error
@@ -192,8 +496,8 @@ epicsShareFunc void fdManager::process (double delay)
                 epicsSocketConvertErrnoToString ( 
                     sockErrBuf, sizeof ( sockErrBuf ) );
                 fprintf ( stderr, 
-                "fdManager: select failed because \"%s\"\n",
-                    sockErrBuf );
+                "fdManager: %s failed because \"%s\"\n",
+                    this->pReactor->name (), sockErrBuf );
             }
         }
     }
@@ -258,7 +562,6 @@ void fdRegId::show ( unsigned level ) const
 //
 void fdManager::installReg (fdReg &reg)
 {
-    this->maxFD = max ( this->maxFD, reg.getFD()+1 );
     // Most applications will find that its important to push here to 
     // the front of the list so that transient writes get executed
     // first allowing incoming read protocol to find that outgoing
@@ -270,6 +573,7 @@ void fdManager::installReg (fdReg &reg)
     if ( status != 0 ) {
         throwWithLocation ( fdInterestSubscriptionAlreadyExits () );
     }
+    this->pReactor->install ( reg );
 }
 
 //
@@ -311,7 +615,18 @@ void fdManager::removeReg (fdReg &regIn)
     }
     regIn.state = fdReg::limbo;
 
-    FD_CLR(regIn.getFD(), &this->fdSetsPtr[regIn.getType()]);
+    this->pReactor->remove ( regIn );
+}
+
+//
+// fdManager::activate ()
+// (called by the reactor when there is activity on a pending fdReg)
+//
+void fdManager::activate (fdReg &reg)
+{
+    this->regList.remove ( reg );
+    this->activeList.add ( reg );
+    reg.state = fdReg::active;
 }
 
 //
@@ -328,6 +643,14 @@ double fdManager::quantum ()
     return this->sleepQuantum;
 }
 
+//
+// fdManager::reactorName ()
+//
+epicsShareFunc const char * fdManager::reactorName () const
+{
+    return this->pReactor->name ();
+}
+
 //
 // lookUpFD()
 //
@@ -348,7 +671,7 @@ fdReg::fdReg (const SOCKET fdIn, const fdRegType typIn,
     fdRegId (fdIn,typIn), state (limbo), 
     onceOnly (onceOnlyIn), manager (managerIn)
 { 
-    if (!FD_IN_FDSET(fdIn)) {
+    if (!this->manager.pReactor->accepts(fdIn)) {
         fprintf (stderr, "%s: fd > FD_SETSIZE ignored\n", 
             __FILE__);
         return;
@@ -28,6 +28,14 @@
 
 enum fdRegType {fdrRead, fdrWrite, fdrException, fdrNEnums};
 
+//
+// fdManager reactor backends
+//
+// fdmrDefault picks the most scalable backend available on the
+// host (epoll on Linux), and falls back to select()
+//
+enum fdReactorType {fdmrDefault, fdmrSelect, fdmrEpoll};
+
 //
 // fdRegId
 //
@@ -78,22 +86,28 @@ public:
     class fdInterestSubscriptionAlreadyExits {};
 
     epicsShareFunc fdManager ();
+    epicsShareFunc fdManager ( fdReactorType reactorType );
     epicsShareFunc virtual ~fdManager ();
     epicsShareFunc void process ( double delay ); // delay parameter is in seconds
 
     // returns NULL if the fd is unknown
     epicsShareFunc class fdReg *lookUpFD (const SOCKET fd, const fdRegType type);
 
+    // name of the reactor backend in use
+    epicsShareFunc const char * reactorName () const;
+
     epicsTimer & createTimer ();
 
 private:
+    class reactor;
+    class selectReactor;
+    class epollReactor;
     tsDLList < fdReg > regList;
     tsDLList < fdReg > activeList;
     resTable < fdReg, fdRegId > fdTbl;
     const double sleepQuantum;
-    fd_set * fdSetsPtr;
+    reactor * pReactor;
     epicsTimerQueuePassive * pTimerQueue;
-    SOCKET maxFD;
     bool processInProg;
     //
     // Set to fdreg when in call back
@@ -104,6 +118,8 @@ private:
     double quantum ();
     void installReg (fdReg &reg);
     void removeReg (fdReg &reg);
+    void activate (fdReg &reg);
+    void createReactor (fdReactorType reactorType);
     void lazyInitTimerQueue ();
     fdManager ( const fdManager & );
     fdManager & operator = ( const fdManager & );
@@ -25,6 +25,11 @@ epicsShareFunc void * epicsShareAPI freeListMalloc(void *pvt);
 epicsShareFunc void epicsShareAPI freeListFree(void *pvt,void*pmem);
 epicsShareFunc void epicsShareAPI freeListCleanup(void *pvt);
 epicsShareFunc size_t epicsShareAPI freeListItemsAvail(void *pvt);
+/* Opt-in per-thread caches of up to 2*cacheSize free items, which are
+ * exchanged with the shared list cacheSize items at a time. Call once,
+ * after freeListInitPvt() and before the list is used. */
+epicsShareFunc void epicsShareAPI freeListSetThreadCache(void *pvt,
+    unsigned cacheSize);
 
 #ifdef __cplusplus
 }
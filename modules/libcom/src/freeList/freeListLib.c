@@ -24,7 +24,10 @@
 
 #define epicsExportSharedSymbols
 #include "cantProceed.h"
+#include "ellLib.h"
+#include "epicsExit.h"
 #include "epicsMutex.h"
+#include "epicsThread.h"
 #include "freeList.h"
 #include "adjustment.h"
 
@@ -32,15 +35,33 @@ typedef struct allocMem {
     struct allocMem	*next;
     void		*memory;
 }allocMem;
-typedef struct {
+typedef struct freeListPvt {
     int		size;
     int		nmalloc;
     void	*head;
     allocMem	*mallochead;
     size_t	nBlocksAvailable;
     epicsMutexId lock;
+    unsigned	cacheSize;	/* 0 if per-thread caches are disabled */
+    ELLLIST	caches;		/* protected by cacheLock */
 }FREELISTPVT;
 
+/* Per-thread magazine of free blocks. Holds up to 2*cacheSize blocks,
+ * and blocks move to and from the shared list cacheSize at a time.
+ * Only the owning thread touches the items, but the count is read by
+ * freeListItemsAvail().
+ */
+typedef struct freeListCache {
+    ELLNODE	node;		/* in pfl->caches */
+    struct freeListCache *pnextInThread;
+    FREELISTPVT	*pfl;		/* NULL once the free list is cleaned up */
+    size_t	count;
+    void	*items[1];
+}freeListCache;
+
+/* Serializes thread cache creation and exit against freeListCleanup() */
+static epicsMutexId cacheLock;
+
 epicsShareFunc void epicsShareAPI 
 	freeListInitPvt(void **ppvt,int size,int nmalloc)
 {
@@ -53,11 +74,169 @@ epicsShareFunc void epicsShareAPI
     pfl->mallochead = NULL;
     pfl->nBlocksAvailable = 0u;
     pfl->lock = epicsMutexMustCreate();
+    pfl->cacheSize = 0u;
+    ellInit(&pfl->caches);
     *ppvt = (void *)pfl;
     VALGRIND_CREATE_MEMPOOL(pfl, REDZONE, 0);
     return;
 }
 
+#ifndef EPICS_FREELIST_DEBUG
+static epicsThreadOnceId cacheLockOnce = EPICS_THREAD_ONCE_INIT;
+
+/* Chain of the calling thread's caches, one per free list */
+static epicsThreadPrivateId threadCaches;
+
+static void cacheLockInit(void *arg)
+{
+    cacheLock = epicsMutexMustCreate();
+    threadCaches = epicsThreadPrivateCreate();
+}
+
+/* Allocate another block of nmalloc items onto the shared list.
+ * Called with pfl->lock held, returns non-zero if out of memory.
+ */
+static int growLocked(FREELISTPVT *pfl)
+{
+    void	*ptemp;
+    void	**ppnext;
+    allocMem	*pallocmem;
+    int		i;
+
+    /* layout of each block. nmalloc+1 REDZONEs for nmallocs.
+     * The first sizeof(void*) bytes are used to store a pointer
+     * to the next free block.
+     *
+     * | RED | size0 ------ | RED | size1 | ... | RED |
+     * |     | next | ----- |
+     */
+    ptemp = (void *)malloc(pfl->nmalloc*(pfl->size+REDZONE)+REDZONE);
+    if(ptemp==0)
+        return -1;
+    pallocmem = (allocMem *)calloc(1,sizeof(allocMem));
+    if(pallocmem==0) {
+        free(ptemp);
+        return -1;
+    }
+    pallocmem->memory = ptemp; /* real allocation */
+    ptemp = REDZONE + (char *) ptemp; /* skip first REDZONE */
+    if(pfl->mallochead)
+        pallocmem->next = pfl->mallochead;
+    pfl->mallochead = pallocmem;
+    for(i=0; i<pfl->nmalloc; i++) {
+        ppnext = ptemp;
+        VALGRIND_MEMPOOL_ALLOC(pfl, ptemp, sizeof(void*));
+        *ppnext = pfl->head;
+        pfl->head = ptemp;
+        ptemp = ((char *)ptemp) + pfl->size+REDZONE;
+    }
+    pfl->nBlocksAvailable += pfl->nmalloc;
+    return 0;
+}
+
+/* Called with pfl->lock held and pfl->head non-NULL */
+static void *popLocked(FREELISTPVT *pfl)
+{
+    void	**ppnext = pfl->head;
+
+    pfl->head = *ppnext;
+    pfl->nBlocksAvailable--;
+    return ppnext;
+}
+
+/* Called with pfl->lock held */
+static void pushLocked(FREELISTPVT *pfl, void *pmem)
+{
+    void	**ppnext = pmem;
+
+    *ppnext = pfl->head;
+    pfl->head = pmem;
+    pfl->nBlocksAvailable++;
+}
+
+static void cacheThreadExit(void *arg)
+{
+    freeListCache *pcache = epicsThreadPrivateGet(threadCaches);
+
+    epicsThreadPrivateSet(threadCaches, NULL);
+    epicsMutexMustLock(cacheLock);
+    while(pcache) {
+        freeListCache *pnext = pcache->pnextInThread;
+        FREELISTPVT *pfl = pcache->pfl;
+
+        if(pfl) {
+            epicsMutexMustLock(pfl->lock);
+            while(pcache->count)
+                pushLocked(pfl, pcache->items[--pcache->count]);
+            epicsMutexUnlock(pfl->lock);
+            ellDelete(&pfl->caches, &pcache->node);
+        }
+        free(pcache);
+        pcache = pnext;
+    }
+    epicsMutexUnlock(cacheLock);
+}
+
+/* Find or create the calling thread's cache, NULL if none can be made */
+static freeListCache *getCache(FREELISTPVT *pfl)
+{
+    freeListCache *phead = epicsThreadPrivateGet(threadCaches);
+    freeListCache *pcache, **ppcache;
+
+    /* pfl of another thread's cache only ever changes to NULL */
+    for(pcache = phead; pcache; pcache = pcache->pnextInThread) {
+        if(pcache->pfl==pfl)
+            return pcache;
+    }
+
+    pcache = calloc(1, sizeof(freeListCache) +
+        (2*pfl->cacheSize - 1)*sizeof(void *));
+    if(!pcache)
+        return NULL;
+    pcache->pfl = pfl;
+    /* Blocks held by threads which aren't EPICS threads are only
+     * recovered by freeListCleanup()
+     */
+    if(!phead && epicsAtThreadExit(cacheThreadExit, NULL)) {
+        free(pcache);
+        return NULL;
+    }
+
+    epicsMutexMustLock(cacheLock);
+    ellAdd(&pfl->caches, &pcache->node);
+    /* drop caches of free lists which have been cleaned up */
+    ppcache = &phead;
+    while(*ppcache) {
+        freeListCache *pstale = *ppcache;
+        if(pstale->pfl) {
+            ppcache = &pstale->pnextInThread;
+        }
+        else {
+            *ppcache = pstale->pnextInThread;
+            free(pstale);
+        }
+    }
+    epicsMutexUnlock(cacheLock);
+    pcache->pnextInThread = phead;
+    epicsThreadPrivateSet(threadCaches, pcache);
+    return pcache;
+}
+#endif /* EPICS_FREELIST_DEBUG */
+
+epicsShareFunc void epicsShareAPI
+	freeListSetThreadCache(void *pvt, unsigned cacheSize)
+{
+#   ifndef EPICS_FREELIST_DEBUG
+    FREELISTPVT *pfl = pvt;
+
+    if(pfl->cacheSize || cacheSize==0)
+        return;
+    epicsThreadOnce(&cacheLockOnce, cacheLockInit, NULL);
+    if(threadCaches)
+        pfl->cacheSize = cacheSize;
+#   endif
+}
+
 epicsShareFunc void * epicsShareAPI freeListCalloc(void *pvt)
 {
     FREELISTPVT *pfl = pvt;
@@ -78,51 +257,32 @@ epicsShareFunc void * epicsShareAPI freeListMalloc(void *pvt)
 #   ifdef EPICS_FREELIST_DEBUG
     return callocMustSucceed(1,pfl->size,"freeList Debug Malloc");
 #   else
+    freeListCache *pcache;
     void	*ptemp;
-    void	**ppnext;
-    allocMem	*pallocmem;
-    int		i;
 
-    epicsMutexMustLock(pfl->lock);
-    ptemp = pfl->head;
-    if(ptemp==0) {
-        /* layout of each block. nmalloc+1 REDZONEs for nmallocs.
-         * The first sizeof(void*) bytes are used to store a pointer
-         * to the next free block.
-         *
-         * | RED | size0 ------ | RED | size1 | ... | RED |
-         * |     | next | ----- |
-         */
-        ptemp = (void *)malloc(pfl->nmalloc*(pfl->size+REDZONE)+REDZONE);
-        if(ptemp==0) {
+    if(pfl->cacheSize && (pcache = getCache(pfl))) {
+        if(pcache->count==0) {
+            epicsMutexMustLock(pfl->lock);
+            while(pcache->count<pfl->cacheSize) {
+                if(pfl->head==0 && growLocked(pfl))
+                    break;
+                pcache->items[pcache->count++] = popLocked(pfl);
+            }
             epicsMutexUnlock(pfl->lock);
-            return(0);
+            if(pcache->count==0)
+                return(0);
         }
-        pallocmem = (allocMem *)calloc(1,sizeof(allocMem));
-        if(pallocmem==0) {
+        ptemp = pcache->items[--pcache->count];
+    }
+    else {
+        epicsMutexMustLock(pfl->lock);
+        if(pfl->head==0 && growLocked(pfl)) {
             epicsMutexUnlock(pfl->lock);
-            free(ptemp);
             return(0);
         }
-        pallocmem->memory = ptemp; /* real allocation */
-        ptemp = REDZONE + (char *) ptemp; /* skip first REDZONE */
-        if(pfl->mallochead)
-            pallocmem->next = pfl->mallochead;
-        pfl->mallochead = pallocmem;
-        for(i=0; i<pfl->nmalloc; i++) {
-            ppnext = ptemp;
-            VALGRIND_MEMPOOL_ALLOC(pfl, ptemp, sizeof(void*));
-            *ppnext = pfl->head;
-            pfl->head = ptemp;
-            ptemp = ((char *)ptemp) + pfl->size+REDZONE;
-        }
-        ptemp = pfl->head;
-        pfl->nBlocksAvailable += pfl->nmalloc;
+        ptemp = popLocked(pfl);
+        epicsMutexUnlock(pfl->lock);
     }
-    ppnext = pfl->head;
-    pfl->head = *ppnext;
-    pfl->nBlocksAvailable--;
-    epicsMutexUnlock(pfl->lock);
     VALGRIND_MEMPOOL_FREE(pfl, ptemp);
     VALGRIND_MEMPOOL_ALLOC(pfl, ptemp, pfl->size);
     return(ptemp);
@@ -136,16 +296,30 @@ epicsShareFunc void epicsShareAPI freeListFree(void *pvt,void*pmem)
     memset ( pmem, 0xdd, pfl->size );
     free(pmem);
 #   else
-    void	**ppnext;
+    freeListCache *pcache;
 
     VALGRIND_MEMPOOL_FREE(pvt, pmem);
     VALGRIND_MEMPOOL_ALLOC(pvt, pmem, sizeof(void*));
 
+    if(pfl->cacheSize && (pcache = getCache(pfl))) {
+        if(pcache->count==2*pfl->cacheSize) {
+            /* return the oldest half to the shared list */
+            unsigned i;
+
+            epicsMutexMustLock(pfl->lock);
+            for(i=0; i<pfl->cacheSize; i++)
+                pushLocked(pfl, pcache->items[i]);
+            epicsMutexUnlock(pfl->lock);
+            memmove(pcache->items, pcache->items + pfl->cacheSize,
+                pfl->cacheSize*sizeof(void *));
+            pcache->count -= pfl->cacheSize;
+        }
+        pcache->items[pcache->count++] = pmem;
+        return;
+    }
+
     epicsMutexMustLock(pfl->lock);
-    ppnext = pmem;
-    *ppnext = pfl->head;
-    pfl->head = pmem;
-    pfl->nBlocksAvailable++;
+    pushLocked(pfl, pmem);
     epicsMutexUnlock(pfl->lock);
 #   endif
 }
@@ -158,6 +332,18 @@ epicsShareFunc void epicsShareAPI freeListCleanup(void *pvt)
 
     VALGRIND_DESTROY_MEMPOOL(pvt);
 
+    if(pfl->cacheSize) {
+        /* The caches themselves are freed by their threads, the
+         * blocks in them are released below.
+         */
+        ELLNODE *pnode;
+
+        epicsMutexMustLock(cacheLock);
+        while((pnode = ellGet(&pfl->caches)))
+            ((freeListCache *)pnode)->pfl = NULL;
+        epicsMutexUnlock(cacheLock);
+    }
+
     phead = pfl->mallochead;
     while(phead) {
         pnext = phead->next;
@@ -173,9 +359,19 @@ epicsShareFunc size_t epicsShareAPI freeListItemsAvail(void *pvt)
 {
     FREELISTPVT *pfl = pvt;
     size_t nBlocksAvailable;
+    ELLNODE *pnode;
+
+    if(pfl->cacheSize)
+        epicsMutexMustLock(cacheLock);
     epicsMutexMustLock(pfl->lock);
     nBlocksAvailable = pfl->nBlocksAvailable;
     epicsMutexUnlock(pfl->lock);
+    if(pfl->cacheSize) {
+        /* other threads' counts may be changing under us */
+        for(pnode = ellFirst(&pfl->caches); pnode; pnode = ellNext(pnode))
+            nBlocksAvailable += ((freeListCache *)pnode)->count;
+        epicsMutexUnlock(cacheLock);
+    }
     return nBlocksAvailable;
 }
 
@@ -225,6 +225,28 @@ static void errlogInit2CallFunc(const iocshArgBuf *args)
     errlogInit2(args[0].ival, args[1].ival);
 }
 
+/* errlogInitDeferred */
+static const iocshArg errlogInitDeferredArg0 = { "nMessages",iocshArgInt};
+static const iocshArg * const errlogInitDeferredArgs[] =
+    {&errlogInitDeferredArg0};
+static const iocshFuncDef errlogInitDeferredFuncDef =
+    {"errlogInitDeferred", 1, errlogInitDeferredArgs};
+static void errlogInitDeferredCallFunc(const iocshArgBuf *args)
+{
+    errlogInitDeferred(args[0].ival);
+}
+
+/* errlogDeferredShow */
+static const iocshArg errlogDeferredShowArg0 = { "level",iocshArgInt};
+static const iocshArg * const errlogDeferredShowArgs[] =
+    {&errlogDeferredShowArg0};
+static const iocshFuncDef errlogDeferredShowFuncDef =
+    {"errlogDeferredShow", 1, errlogDeferredShowArgs};
+static void errlogDeferredShowCallFunc(const iocshArgBuf *args)
+{
+    errlogDeferredShow(args[0].ival);
+}
+
 /* errlog */
 IOCSH_STATIC_FUNC void errlog(const char *message)
 {
@@ -416,6 +438,8 @@ void epicsShareAPI libComRegister(void)
     iocshRegister(&eltcFuncDef, eltcCallFunc);
     iocshRegister(&errlogInitFuncDef,errlogInitCallFunc);
     iocshRegister(&errlogInit2FuncDef,errlogInit2CallFunc);
+    iocshRegister(&errlogInitDeferredFuncDef,errlogInitDeferredCallFunc);
+    iocshRegister(&errlogDeferredShowFuncDef,errlogDeferredShowCallFunc);
     iocshRegister(&errlogFuncDef, errlogCallFunc);
     iocshRegister(&iocLogPrefixFuncDef, iocLogPrefixCallFunc);
 
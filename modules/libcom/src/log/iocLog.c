@@ -128,6 +128,14 @@ void epicsShareAPI iocLogShow (unsigned level)
     }
 }
 
+/*
+ *  iocLogGetStats ()
+ */
+int epicsShareAPI iocLogGetStats (logClientStats *pStats)
+{
+    return logClientGetStats (iocLogClient, pStats);
+}
+
 /*
  *  logClientInit(); deprecated
  */
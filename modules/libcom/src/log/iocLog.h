@@ -30,6 +30,9 @@ epicsShareExtern int iocLogDisable;
 epicsShareFunc int epicsShareAPI iocLogInit (void);
 epicsShareFunc void epicsShareAPI iocLogShow (unsigned level);
 epicsShareFunc void epicsShareAPI iocLogFlush (void);
+/* returns -1 if the log client was not started, cf. logClient.h */
+struct logClientStats;
+epicsShareFunc int epicsShareAPI iocLogGetStats (struct logClientStats *pStats);
 
 #ifdef __cplusplus
 }
@@ -16,6 +16,20 @@
  *      Date:       080791 
  */
 
+/*
+ * Lines are not written as they arrive. Each pass of the fdmgr event
+ * loop queues the complete lines from every client that had data in
+ * one batch, which is written with a single writev() at the end of the
+ * pass. A text line is queued in place, as its client's prefix and the
+ * bytes in the client's receive buffer, so clients must not move the
+ * data in their buffers until the batch is written (releaseClients()).
+ *
+ * With EPICS_IOC_LOG_FILE_LIMIT > 0 and no EPICS_IOC_LOG_FILE_ROTATE
+ * the log is one circular file as before. Otherwise lines are appended,
+ * to a new file every EPICS_IOC_LOG_FILE_ROTATE seconds, and may be
+ * written as JSON lines and indexed by IOC and time.
+ */
+
 #include	<stdlib.h>
 #include	<string.h>
 #include	<errno.h>
@@ -26,37 +40,83 @@
 #ifdef UNIX
 #include 	<unistd.h>
 #include	<signal.h>
+#include	<sys/uio.h>
 #endif
 
 #include        "dbDefs.h"
 #include	"epicsAssert.h"
+#include	"ellLib.h"
 #include 	"fdmgr.h"
 #include 	"envDefs.h"
 #include 	"osiSock.h"
 #include	"epicsStdio.h"
+#include	"epicsString.h"
+
+#ifndef UNIX
+struct iovec {
+	void *iov_base;
+	size_t iov_len;
+};
+#endif
 
 static unsigned short ioc_log_port;
 static long ioc_log_file_limit;
+static long ioc_log_file_rotate;
+static double ioc_log_file_sync;
+static int ioc_log_file_jsonl;
+static int ioc_log_file_index;
 static char ioc_log_file_name[512];
 static char ioc_log_file_command[256];
 
+/* iovecs and bytes of formatted output in one batch */
+#define LOG_BATCH_IOV 1024
+#define LOG_ARENA_SIZE 0x40000
+/* an index entry covers at most this many seconds of one IOC's lines */
+#define LOG_INDEX_PERIOD 10
+/* connections accepted per pass of the event loop */
+#define LOG_ACCEPT_BURST 64
 
 struct iocLogClient {
+	ELLNODE node;
 	int insock;
 	struct ioc_log_server *pserver;
 	size_t nChar;
-	char recvbuf[1024];
+	size_t nQueued;		/* bytes at the front of recvbuf in the batch */
+	struct iocLogClient *pnextPending;
+	int pending;
+	long indexOffset;
+	long indexLength;
+	time_t indexTime;
+	char recvbuf[16384];
 	char name[32];
+	char host[32];
 	char ascii_time[32];
+	char prefix[68];
+	size_t prefixLen;
 };
 
 struct ioc_log_server {
-	char outfile[256];
+	char outfile[512];
+	char currentfile[560];
 	long filePos;
 	FILE *poutfile;
+	FILE *pindexfile;
 	void *pfdctx;
 	SOCKET sock;
 	long max_file_size;
+	time_t periodStart;
+	time_t lastSync;
+	int unsynced;
+	time_t now;
+	time_t serviced;
+	char ascii_time[32];
+	ELLLIST clients;
+	struct iocLogClient *ppending;
+	int iovMax;
+	int nIov;
+	struct iovec iov[LOG_BATCH_IOV];
+	size_t arenaUsed;
+	char arena[LOG_ARENA_SIZE];
 };
 
 #define IOCLS_ERROR (-1)
@@ -71,6 +131,10 @@ static void handleLogFileError(void);
 static void envFailureNotify(const ENV_PARAM *pparam);
 static void freeLogClient(struct iocLogClient *pclient);
 static void writeMessagesToLog (struct iocLogClient *pclient);
+static void writeBatch (struct ioc_log_server *pserver);
+static void releaseClients (struct ioc_log_server *pserver);
+static void serviceLogFile (struct ioc_log_server *pserver);
+static void indexEmit (struct iocLogClient *pclient);
 
 #ifdef UNIX
 static int setupSIGHUP(struct ioc_log_server *);
@@ -109,6 +173,16 @@ int main(void)
         fprintf(stderr, "iocLogServer: %s\n", strerror(errno));
         return IOCLS_ERROR;
     }
+    ellInit(&pserver->clients);
+    pserver->iovMax = 16;
+#   if defined(UNIX) && defined(_SC_IOV_MAX)
+    {
+        long iovMax = sysconf(_SC_IOV_MAX);
+        if (iovMax > 0)
+            pserver->iovMax = iovMax < LOG_BATCH_IOV ?
+                (int) iovMax : LOG_BATCH_IOV;
+    }
+#   endif
 
     pserver->pfdctx = (void *) fdmgr_init();
     if (!pserver->pfdctx) {
@@ -150,8 +224,11 @@ int main(void)
         return IOCLS_ERROR;
     }
 
-    /* listen and accept new connections */
-    status = listen(pserver->sock, 10);
+    /*
+     * listen and accept new connections, with room for many
+     * IOCs reconnecting at once
+     */
+    status = listen(pserver->sock, SOMAXCONN);
     if (status < 0) {
         char sockErrBuf[64];
         epicsSocketConvertErrnoToString ( sockErrBuf, sizeof ( sockErrBuf ) );
@@ -182,6 +259,8 @@ int main(void)
         }
 #   endif
 
+    pserver->now = time(NULL);
+    pserver->lastSync = pserver->now;
     status = openLogFile(pserver);
     if (status < 0) {
         fprintf(stderr,
@@ -205,10 +284,220 @@ int main(void)
 
 
     while (TRUE) {
-        timeout.tv_sec = 60; /* 1 min */
+        /* wake up each second to rotate, sync and index on time */
+        if (ioc_log_file_rotate || ioc_log_file_sync > 0 ||
+                pserver->pindexfile) {
+            timeout.tv_sec = 1;
+        }
+        else {
+            timeout.tv_sec = 60; /* 1 min */
+        }
         timeout.tv_usec = 0;
         fdmgr_pend_event(pserver->pfdctx, &timeout);
-        fflush(pserver->poutfile);
+        serviceLogFile(pserver);
+    }
+}
+
+/*
+ * writeLogFile ()
+ * write all of iov[0..nIov-1], on UNIX straight to the file descriptor
+ */
+static void writeLogFile (struct ioc_log_server *pserver,
+    struct iovec *piov, int nIov)
+{
+#ifdef UNIX
+    int fd = fileno(pserver->poutfile);
+
+    while (nIov > 0) {
+        ssize_t n = writev(fd, piov,
+            nIov < pserver->iovMax ? nIov : pserver->iovMax);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            handleLogFileError();
+        }
+        /* skip what was written, which may end part way into an iovec */
+        while (nIov > 0 && (size_t) n >= piov->iov_len) {
+            n -= piov->iov_len;
+            piov++;
+            nIov--;
+        }
+        if (n > 0) {
+            piov->iov_base = (char *) piov->iov_base + n;
+            piov->iov_len -= n;
+        }
+    }
+#else
+    while (nIov > 0) {
+        if (fwrite(piov->iov_base, 1, piov->iov_len,
+                pserver->poutfile) != piov->iov_len) {
+            handleLogFileError();
+        }
+        piov++;
+        nIov--;
+    }
+    fflush(pserver->poutfile);
+#endif
+}
+
+/*
+ * syncLogFile ()
+ */
+static void syncLogFile (struct ioc_log_server *pserver)
+{
+#ifdef UNIX
+    if (fsync(fileno(pserver->poutfile)) < 0 && errno != EINVAL) {
+        handleLogFileError();
+    }
+    if (pserver->pindexfile) {
+        fflush(pserver->pindexfile);
+        fsync(fileno(pserver->pindexfile));
+    }
+#endif
+    pserver->lastSync = pserver->now;
+    pserver->unsynced = FALSE;
+}
+
+/*
+ * writeBatch ()
+ * write the lines queued so far, clients keep their buffers
+ * unchanged until releaseClients()
+ */
+static void writeBatch (struct ioc_log_server *pserver)
+{
+    if (pserver->nIov) {
+        writeLogFile(pserver, pserver->iov, pserver->nIov);
+        pserver->nIov = 0;
+        if (ioc_log_file_sync == 0.0) {
+            syncLogFile(pserver);
+        }
+        else if (ioc_log_file_sync > 0.0) {
+            pserver->unsynced = TRUE;
+        }
+    }
+    pserver->arenaUsed = 0u;
+}
+
+/*
+ * ensureBatchRoom ()
+ * make room for nIov iovecs and nArena formatted bytes
+ */
+static void ensureBatchRoom (struct ioc_log_server *pserver,
+    int nIov, size_t nArena)
+{
+    if (pserver->nIov + nIov > LOG_BATCH_IOV ||
+            pserver->arenaUsed + nArena > sizeof(pserver->arena)) {
+        writeBatch(pserver);
+    }
+}
+
+/*
+ * queueOutput ()
+ * the caller has made room with ensureBatchRoom()
+ */
+static void queueOutput (struct ioc_log_server *pserver,
+    const char *pbuf, size_t len)
+{
+    struct iovec *piov;
+
+    if (len == 0u) {
+        return;
+    }
+    if (pserver->nIov) {
+        piov = &pserver->iov[pserver->nIov - 1];
+        if ((const char *) piov->iov_base + piov->iov_len == pbuf) {
+            piov->iov_len += len;
+            return;
+        }
+    }
+    assert(pserver->nIov < LOG_BATCH_IOV);
+    piov = &pserver->iov[pserver->nIov++];
+    piov->iov_base = (void *) pbuf;
+    piov->iov_len = len;
+}
+
+/*
+ * releaseClients ()
+ * once the batch is written clients may move their partial lines
+ * to the front of their buffers
+ */
+static void releaseClients (struct ioc_log_server *pserver)
+{
+    struct iocLogClient *pclient = pserver->ppending;
+
+    assert(pserver->nIov == 0);
+    while (pclient) {
+        struct iocLogClient *pnext = pclient->pnextPending;
+
+        if (pclient->nQueued < pclient->nChar) {
+            memmove(pclient->recvbuf, &pclient->recvbuf[pclient->nQueued],
+                pclient->nChar - pclient->nQueued);
+        }
+        pclient->nChar -= pclient->nQueued;
+        pclient->nQueued = 0u;
+        pclient->pending = FALSE;
+        pclient->pnextPending = NULL;
+        pclient = pnext;
+    }
+    pserver->ppending = NULL;
+}
+
+/*
+ * indexExpire ()
+ * write the index entries which have covered their period
+ */
+static void indexExpire (struct ioc_log_server *pserver)
+{
+    ELLNODE *pnode;
+
+    for (pnode = ellFirst(&pserver->clients); pnode; pnode = ellNext(pnode)) {
+        struct iocLogClient *pclient = (struct iocLogClient *) pnode;
+
+        if (pclient->indexLength &&
+                difftime(pserver->now, pclient->indexTime) >= LOG_INDEX_PERIOD) {
+            indexEmit(pclient);
+        }
+    }
+}
+
+/*
+ * serviceLogFile ()
+ * called after each pass of the event loop
+ */
+static void serviceLogFile (struct ioc_log_server *pserver)
+{
+    time_t now;
+
+    writeBatch(pserver);
+    releaseClients(pserver);
+
+    now = time(NULL);
+    if (now == pserver->serviced) {
+        return;
+    }
+    pserver->now = now;
+    pserver->serviced = now;
+
+    if (ioc_log_file_rotate &&
+            difftime(now, pserver->periodStart) >= ioc_log_file_rotate) {
+        if (openLogFile(pserver) < 0) {
+            fprintf(stderr,
+                "iocLogServer: can't start a new log file because `%s',"
+                " still logging to `%s'\n",
+                strerror(errno),
+                pserver->currentfile);
+            /* try again next period */
+            pserver->periodStart = now - now % ioc_log_file_rotate;
+        }
+    }
+    if (pserver->pindexfile) {
+        indexExpire(pserver);
+        fflush(pserver->pindexfile);
+    }
+    if (pserver->unsynced &&
+            difftime(now, pserver->lastSync) >= ioc_log_file_sync) {
+        syncLogFile(pserver);
     }
 }
 
@@ -326,6 +615,18 @@ static int seekLatestLine (struct ioc_log_server *pserver)
 
     pserver->filePos = ftell (pserver->poutfile);
 
+#   ifdef UNIX
+        /*
+         * from here on the file is written with writev(), which the
+         * stdio read position need not match
+         */
+        if (lseek (fileno (pserver->poutfile), pserver->filePos, SEEK_SET) < 0) {
+		    fclose (pserver->poutfile);
+		    pserver->poutfile = stderr;
+		    return IOCLS_ERROR;
+        }
+#   endif
+
     if (theLatestTime==invalidTime) {
         if (pserver->filePos!=0) {
             fprintf (stderr, "iocLogServer: **** Warning ****\n");
@@ -339,6 +640,77 @@ static int seekLatestLine (struct ioc_log_server *pserver)
 }
 
 
+/*
+ *	openAppendLogFile()
+ *
+ *	append to ioc_log_file_name, or with EPICS_IOC_LOG_FILE_ROTATE to
+ *	a file for the current period, which is named after its start time
+ *	in UTC. The old file stays open if the new one can't be opened.
+ */
+static int openAppendLogFile (struct ioc_log_server *pserver)
+{
+	char name[sizeof pserver->currentfile];
+	char indexName[sizeof name + 4];
+	FILE *poutfile;
+	FILE *pindexfile = NULL;
+	time_t periodStart = 0;
+	ELLNODE *pnode;
+
+	if (ioc_log_file_rotate) {
+		char stamp[32];
+
+		periodStart = pserver->now - pserver->now % ioc_log_file_rotate;
+		strftime (stamp, sizeof(stamp), "%Y%m%dT%H%M%SZ",
+			gmtime (&periodStart));
+		epicsSnprintf (name, sizeof(name), "%s.%s",
+			ioc_log_file_name, stamp);
+	}
+	else {
+		strcpy (name, ioc_log_file_name);
+	}
+
+	poutfile = fopen (name, "a");
+	if (!poutfile) {
+		return IOCLS_ERROR;
+	}
+	if (ioc_log_file_index) {
+		sprintf (indexName, "%s.idx", name);
+		pindexfile = fopen (indexName, "a");
+		if (!pindexfile) {
+			fclose (poutfile);
+			return IOCLS_ERROR;
+		}
+	}
+
+	if (pserver->poutfile) {
+		/*
+		 * finish the old file, the index entries refer to it
+		 */
+		writeBatch (pserver);
+		for (pnode = ellFirst(&pserver->clients); pnode; pnode = ellNext(pnode)) {
+			indexEmit ((struct iocLogClient *) pnode);
+		}
+		if (pserver->poutfile != stderr) {
+			fclose (pserver->poutfile);
+		}
+		if (pserver->pindexfile) {
+			fclose (pserver->pindexfile);
+		}
+	}
+
+	pserver->poutfile = poutfile;
+	pserver->pindexfile = pindexfile;
+	pserver->periodStart = periodStart;
+	fseek (poutfile, 0L, SEEK_END);
+	pserver->filePos = ftell (poutfile);
+	strcpy (pserver->currentfile, name);
+	strcpy (pserver->outfile, ioc_log_file_name);
+	pserver->max_file_size = 0;
+
+	return IOCLS_OK;
+}
+
+
 /*
  *	openLogFile()
  *
@@ -347,11 +719,17 @@ static int openLogFile (struct ioc_log_server *pserver)
 {
 	enum TF_RETURN ret;
 
+	if (ioc_log_file_rotate || ioc_log_file_limit == 0) {
+		return openAppendLogFile (pserver);
+	}
+
 	if (pserver->poutfile && pserver->poutfile != stderr){
+		writeBatch (pserver);
 		fclose (pserver->poutfile);
 		pserver->poutfile = NULL;
 	}
 
+	strcpy (pserver->currentfile, ioc_log_file_name);
 	pserver->poutfile = fopen(ioc_log_file_name, "r+");
 	if (pserver->poutfile) {
 		fclose (pserver->poutfile);
@@ -392,21 +770,22 @@ static void handleLogFileError(void)
 
 
 /*
- *	acceptNewClient()
+ *	acceptOneClient()
  *
+ *	returns TRUE if another connection may be waiting
  */
-static void acceptNewClient ( void *pParam )
+static int acceptOneClient ( struct ioc_log_server *pserver )
 {
-	struct ioc_log_server *pserver = (struct ioc_log_server *) pParam;
 	struct iocLogClient	*pclient;
+	char *pcolon;
 	osiSocklen_t addrSize;
 	struct sockaddr_in addr;
 	int status;
 	osiSockIoctl_t optval;
 
-	pclient = ( struct iocLogClient * ) malloc ( sizeof ( *pclient ) );
+	pclient = ( struct iocLogClient * ) calloc ( 1, sizeof ( *pclient ) );
 	if ( ! pclient ) {
-		return;
+		return FALSE;
 	}
 
 	addrSize = sizeof ( addr );
@@ -418,7 +797,7 @@ static void acceptNewClient ( void *pParam )
 
 		free ( pclient );
 		if ( SOCKERRNO == SOCK_EWOULDBLOCK || SOCKERRNO == SOCK_EINTR ) {
-            return;
+            return FALSE;
 		}
 
         thisErrno = SOCKERRNO;
@@ -428,7 +807,7 @@ static void acceptNewClient ( void *pParam )
         acceptErrCount++;
         lastErrno = thisErrno;
 
-		return;
+		return FALSE;
 	}
 
 	/*
@@ -447,13 +826,18 @@ static void acceptNewClient ( void *pParam )
 			__FILE__, __LINE__, sockErrBuf);
 		epicsSocketDestroy ( pclient->insock );
 		free(pclient);
-		return;
+		return TRUE;
 	}
 
 	pclient->pserver = pserver;
 	pclient->nChar = 0u;
 
 	ipAddrToA (&addr, pclient->name, sizeof(pclient->name));
+	strcpy (pclient->host, pclient->name);
+	pcolon = strrchr (pclient->host, ':');
+	if (pcolon) {
+		*pcolon = '\0';
+	}
 
 	logTime(pclient);
 	
@@ -495,7 +879,7 @@ static void acceptNewClient ( void *pParam )
         epicsSocketDestroy ( pclient->insock );
 		free(pclient);
 
-		return;
+		return TRUE;
 	}
 
 	status = fdmgr_add_callback(
@@ -509,7 +893,26 @@ static void acceptNewClient ( void *pParam )
 		free(pclient);
 		fprintf(stderr, "%s:%d client fdmgr_add_callback() failed\n", 
 			__FILE__, __LINE__);
-		return;
+		return TRUE;
+	}
+
+	ellAdd (&pserver->clients, &pclient->node);
+	return TRUE;
+}
+
+/*
+ *	acceptNewClient()
+ *
+ */
+static void acceptNewClient ( void *pParam )
+{
+	struct ioc_log_server *pserver = (struct ioc_log_server *) pParam;
+	int i;
+
+	for (i = 0; i < LOG_ACCEPT_BURST; i++) {
+		if (!acceptOneClient (pserver)) {
+			break;
+		}
 	}
 }
 
@@ -527,6 +930,15 @@ static void readFromClient(void *pParam)
 	int             	recvLength;
 	int			size;
 
+	/*
+	 * the batch may still point into the buffer if this client
+	 * was called twice in one pass
+	 */
+	if (pclient->pending) {
+		writeBatch (pclient->pserver);
+		releaseClients (pclient->pserver);
+	}
+
 	logTime(pclient);
 
 	size = (int) (sizeof(pclient->recvbuf) - pclient->nChar);
@@ -565,22 +977,235 @@ static void readFromClient(void *pParam)
 	writeMessagesToLog (pclient);
 }
 
+/*
+ * utf8Length()
+ * length of the valid UTF-8 sequence starting a multibyte character at
+ * psrc, or 0 if it isn't one (RFC 3629: no overlong forms, surrogates or
+ * code points above U+10FFFF)
+ */
+static size_t utf8Length (const unsigned char *psrc, size_t len)
+{
+	unsigned long code;
+	unsigned long min;
+	size_t n, i;
+
+	if (psrc[0] < 0xc2) {
+		return 0u;
+	}
+	else if (psrc[0] < 0xe0) {
+		n = 2u;
+		code = psrc[0] & 0x1f;
+		min = 0x80;
+	}
+	else if (psrc[0] < 0xf0) {
+		n = 3u;
+		code = psrc[0] & 0x0f;
+		min = 0x800;
+	}
+	else if (psrc[0] < 0xf5) {
+		n = 4u;
+		code = psrc[0] & 0x07;
+		min = 0x10000;
+	}
+	else {
+		return 0u;
+	}
+	if (len < n) {
+		return 0u;
+	}
+	for (i = 1u; i < n; i++) {
+		if ((psrc[i] & 0xc0) != 0x80) {
+			return 0u;
+		}
+		code = (code << 6) | (psrc[i] & 0x3f);
+	}
+	if (code < min || code > 0x10ffff ||
+		(code >= 0xd800 && code <= 0xdfff)) {
+		return 0u;
+	}
+	return n;
+}
+
+/*
+ * jsonEscape()
+ * needs up to 6 bytes of pdest for each byte of psrc. Bytes which are
+ * not valid UTF-8 are each replaced with U+FFFD, so the output is
+ * always valid JSON.
+ */
+static size_t jsonEscape (char *pdest, const char *psrc, size_t len)
+{
+	static const char hex[] = "0123456789abcdef";
+	char *p = pdest;
+
+	while (len--) {
+		unsigned char c = (unsigned char) *psrc++;
+
+		if (c == '"' || c == '\\') {
+			*p++ = '\\';
+			*p++ = (char) c;
+		}
+		else if (c == '\t') {
+			*p++ = '\\';
+			*p++ = 't';
+		}
+		else if (c < 0x20 || c == 0x7f) {
+			*p++ = '\\';
+			*p++ = 'u';
+			*p++ = '0';
+			*p++ = '0';
+			*p++ = hex[c >> 4];
+			*p++ = hex[c & 0xf];
+		}
+		else if (c >= 0x80) {
+			size_t n = utf8Length ((const unsigned char *) psrc - 1,
+				len + 1u);
+
+			if (n) {
+				memcpy (p, psrc - 1, n);
+				p += n;
+				psrc += n - 1u;
+				len -= n - 1u;
+			}
+			else {
+				memcpy (p, "\\ufffd", 6u);
+				p += 6;
+			}
+		}
+		else {
+			*p++ = (char) c;
+		}
+	}
+	return (size_t) (p - pdest);
+}
+
+/*
+ * indexEmit()
+ * write the client's open index entry, which covers the part of the
+ * file holding all of its lines since indexTime, and some of others
+ */
+static void indexEmit (struct iocLogClient *pclient)
+{
+	struct ioc_log_server *pserver = pclient->pserver;
+
+	if (pclient->indexLength && pserver->pindexfile) {
+		fprintf (pserver->pindexfile,
+			"{\"time\":%ld,\"ioc\":\"%s\",\"offset\":%ld,\"length\":%ld}\n",
+			(long) pclient->indexTime, pclient->host,
+			pclient->indexOffset, pclient->indexLength);
+	}
+	pclient->indexLength = 0;
+}
+
+/*
+ * indexLine()
+ */
+static void indexLine (struct iocLogClient *pclient, long offset, long len)
+{
+	struct ioc_log_server *pserver = pclient->pserver;
+
+	if (!pserver->pindexfile) {
+		return;
+	}
+	if (pclient->indexLength &&
+			difftime (pserver->now, pclient->indexTime) < LOG_INDEX_PERIOD) {
+		pclient->indexLength = offset + len - pclient->indexOffset;
+		return;
+	}
+	indexEmit (pclient);
+	pclient->indexOffset = offset;
+	pclient->indexLength = len;
+	pclient->indexTime = pserver->now;
+}
+
+/*
+ * queueLine()
+ * queue one line, which is followed by a new line in the
+ * receive buffer if newLine is true
+ */
+static void queueLine (struct iocLogClient *pclient,
+	const char *pline, size_t nchar, int newLine)
+{
+	static const char newLineChar[] = "\n";
+	struct ioc_log_server *pserver = pclient->pserver;
+	long offset;
+	size_t nTotChar;
+
+	if (ioc_log_file_jsonl) {
+		char *pbuf;
+
+		ensureBatchRoom (pserver, 1, 6u * nchar + sizeof(pclient->host) + 48u);
+		pbuf = &pserver->arena[pserver->arenaUsed];
+		nTotChar = sprintf (pbuf, "{\"time\":%ld,\"ioc\":\"%s\",\"msg\":\"",
+			(long) pserver->now, pclient->host);
+		nTotChar += jsonEscape (&pbuf[nTotChar], pline, nchar);
+		strcpy (&pbuf[nTotChar], "\"}\n");
+		nTotChar += 3u;
+		pserver->arenaUsed += nTotChar;
+		offset = pserver->filePos;
+		queueOutput (pserver, pbuf, nTotChar);
+	}
+	else {
+		nTotChar = pclient->prefixLen + nchar + 1u;
+		assert (nTotChar <= INT_MAX);
+		ensureBatchRoom (pserver, 3, nTotChar);
+
+		/*
+		 * reset the file pointer if we hit the end of the file
+		 */
+		if ( pserver->max_file_size && pserver->filePos + (long) nTotChar >= pserver->max_file_size ) {
+			if ( pserver->max_file_size >= pserver->filePos ) {
+				size_t nPadChar;
+				/*
+				 * this gets rid of leftover junk at the end of the file
+				 */
+				nPadChar = pserver->max_file_size - pserver->filePos;
+				memset (&pserver->arena[pserver->arenaUsed], ' ', nPadChar);
+				queueOutput (pserver, &pserver->arena[pserver->arenaUsed], nPadChar);
+				pserver->arenaUsed += nPadChar;
+			}
+
+#			ifdef DEBUG
+				fprintf ( stderr,
+					"ioc log server: resetting the file pointer\n" );
+#			endif
+			writeBatch (pserver);
+#			ifdef UNIX
+				if (lseek (fileno (pserver->poutfile), 0, SEEK_SET) < 0) {
+					handleLogFileError();
+				}
+#			else
+				rewind ( pserver->poutfile );
+#			endif
+			pserver->filePos = 0;
+		}
+
+		offset = pserver->filePos;
+		queueOutput (pserver, pclient->prefix, pclient->prefixLen);
+		if (newLine) {
+			queueOutput (pserver, pline, nchar + 1u);
+		}
+		else {
+			queueOutput (pserver, pline, nchar);
+			queueOutput (pserver, newLineChar, 1u);
+		}
+	}
+	pserver->filePos += (long) nTotChar;
+	indexLine (pclient, offset, (long) nTotChar);
+}
+
 /*
  * writeMessagesToLog()
  */
 static void writeMessagesToLog (struct iocLogClient *pclient)
 {
-	int status;
-    size_t lineIndex = 0;
+    size_t lineIndex = pclient->nQueued;
 	
 	while (TRUE) {
 		size_t nchar;
-		size_t nTotChar;
         size_t crIndex;
-		int ntci;
 
 		if ( lineIndex >= pclient->nChar ) {
-			pclient->nChar = 0u;
+			lineIndex = pclient->nChar;
 			break;
 		}
 
@@ -588,13 +1213,13 @@ static void writeMessagesToLog (struct iocLogClient *pclient)
 		 * find the first carrage return and create
 		 * an entry in the log for the message associated
 		 * with it. If a carrage return does not exist and 
-		 * the buffer isnt full then move the partial message 
-		 * to the front of the buffer and wait for a carrage 
-		 * return to arrive. If the buffer is full and there
-		 * is no carrage return then force the message out and 
-		 * insert an artificial carrage return.
+		 * the buffer isnt full then leave the partial message
+		 * for releaseClients() to move to the front of the
+		 * buffer and wait for a carrage return to arrive. If
+		 * the buffer is full and there is no carrage return
+		 * then force the message out and insert an artificial
+		 * carrage return.
 		 */
-		nchar = pclient->nChar - lineIndex;
         for ( crIndex = lineIndex; crIndex < pclient->nChar; crIndex++ ) {
             if ( pclient->recvbuf[crIndex] == '\n' ) {
                 break;
@@ -602,81 +1227,33 @@ static void writeMessagesToLog (struct iocLogClient *pclient)
         }
 		if ( crIndex < pclient->nChar ) {
 			nchar = crIndex - lineIndex;
+			queueLine (pclient, &pclient->recvbuf[lineIndex], nchar, TRUE);
         }
         else {
 		    nchar = pclient->nChar - lineIndex;
 			if ( nchar < sizeof ( pclient->recvbuf ) ) {
-				if ( lineIndex != 0 ) {
-					pclient->nChar = nchar;
-					memmove ( pclient->recvbuf, 
-                        & pclient->recvbuf[lineIndex], nchar);
-				}
 				break;
 			}
+			queueLine (pclient, &pclient->recvbuf[lineIndex], nchar, FALSE);
 		}
-
-		/*
-		 * reset the file pointer if we hit the end of the file
-		 */
-		nTotChar = strlen(pclient->name) +
-				strlen(pclient->ascii_time) + nchar + 3u;
-		assert (nTotChar <= INT_MAX);
-		ntci = (int) nTotChar;
-		if ( pclient->pserver->max_file_size && pclient->pserver->filePos+ntci >= pclient->pserver->max_file_size ) {
-			if ( pclient->pserver->max_file_size >= pclient->pserver->filePos ) {
-				unsigned nPadChar;
-				/*
-				 * this gets rid of leftover junk at the end of the file
-				 */
-				nPadChar = pclient->pserver->max_file_size - pclient->pserver->filePos;
-				while (nPadChar--) {
-					status = putc ( ' ', pclient->pserver->poutfile );
-					if ( status == EOF ) {
-						handleLogFileError();
-					}
-				}
-			}
-
-#			ifdef DEBUG
-				fprintf ( stderr,
-					"ioc log server: resetting the file pointer\n" );
-#			endif
-			fflush ( pclient->pserver->poutfile );
-			rewind ( pclient->pserver->poutfile );
-			pclient->pserver->filePos = ftell ( pclient->pserver->poutfile );
-		}
-	
-		/*
-		 * NOTE: !! change format string here then must
-		 * change nTotChar calc above !!
-		 */
-		assert (nchar<INT_MAX);
-		status = fprintf(
-			pclient->pserver->poutfile,
-			"%s %s %.*s\n",
-			pclient->name,
-			pclient->ascii_time,
-			(int) nchar,
-			&pclient->recvbuf[lineIndex]);
-		if (status<0) {
-			handleLogFileError();
-		}
-        else {
-		    if (status != ntci) {
-			    fprintf(stderr, "iocLogServer: didnt calculate number of characters correctly?\n");
-		    }
-		    pclient->pserver->filePos += status;
-        }
 		lineIndex += nchar+1u;
 	}
+
+	pclient->nQueued = lineIndex;
+	if ( pclient->nQueued && ! pclient->pending ) {
+		pclient->pending = TRUE;
+		pclient->pnextPending = pclient->pserver->ppending;
+		pclient->pserver->ppending = pclient;
+	}
 }
 
-
+
 /*
  * freeLogClient ()
  */
 static void freeLogClient(struct iocLogClient     *pclient)
 {
+	struct ioc_log_server *pserver = pclient->pserver;
 	int		status;
 
 #	ifdef	DEBUG
@@ -688,18 +1265,20 @@ static void freeLogClient(struct iocLogClient     *pclient)
 	/*
 	 * flush any left overs
 	 */
-	if (pclient->nChar) {
-		/*
-		 * this forces a flush
-		 */
-		if (pclient->nChar<sizeof(pclient->recvbuf)) {
-			pclient->recvbuf[pclient->nChar] = '\n';
-		}
-		writeMessagesToLog (pclient);
+	if (pclient->nChar > pclient->nQueued) {
+		queueLine (pclient, &pclient->recvbuf[pclient->nQueued],
+			pclient->nChar - pclient->nQueued, FALSE);
 	}
 
+	/*
+	 * the batch may point into the buffer
+	 */
+	writeBatch (pserver);
+	releaseClients (pserver);
+	indexEmit (pclient);
+
 	status = fdmgr_clear_callback(
-		       pclient->pserver->pfdctx,
+		       pserver->pfdctx,
 		       pclient->insock,
 		       fdi_read);
 	if (status!=IOCLS_OK) {
@@ -709,12 +1288,13 @@ static void freeLogClient(struct iocLogClient     *pclient)
 
 	epicsSocketDestroy ( pclient->insock );
 
+	ellDelete (&pserver->clients, &pclient->node);
 	free (pclient);
 
 	return;
 }
 
-
+
 /*
  *
  *	logTime()
@@ -722,23 +1302,38 @@ static void freeLogClient(struct iocLogClient     *pclient)
  */
 static void logTime(struct iocLogClient *pclient)
 {
+	struct ioc_log_server *pserver = pclient->pserver;
 	time_t		sec;
 	char		*pcr;
 	char		*pTimeString;
 
+	/*
+	 * format the time once a second, not once per read
+	 */
 	sec = time (NULL);
-	pTimeString = ctime (&sec);
-	strncpy (pclient->ascii_time, 
-		pTimeString, 
-		sizeof (pclient->ascii_time) );
-	pclient->ascii_time[sizeof(pclient->ascii_time)-1] = '\0';
-	pcr = strchr(pclient->ascii_time, '\n');
-	if (pcr) {
-		*pcr = '\0';
+	if (sec != pserver->now || pserver->ascii_time[0] == '\0') {
+		pserver->now = sec;
+		pTimeString = ctime (&sec);
+		strncpy (pserver->ascii_time,
+			pTimeString,
+			sizeof (pserver->ascii_time) );
+		pserver->ascii_time[sizeof(pserver->ascii_time)-1] = '\0';
+		pcr = strchr(pserver->ascii_time, '\n');
+		if (pcr) {
+			*pcr = '\0';
+		}
+	}
+	if (strcmp (pclient->ascii_time, pserver->ascii_time) != 0) {
+		strcpy (pclient->ascii_time, pserver->ascii_time);
+		/*
+		 * NOTE: !! queueLine() relies on the length of this prefix !!
+		 */
+		pclient->prefixLen = (size_t) sprintf (pclient->prefix, "%s %s ",
+			pclient->name, pclient->ascii_time);
 	}
 }
 
-
+
 /*
  *
  *	getConfig()
@@ -751,6 +1346,7 @@ static int getConfig(void)
 	int	status;
 	char	*pstring;
 	long	param;
+	char	format[16];
 
 	status = envGetLongConfigParam(
 			&EPICS_IOC_LOG_PORT, 
@@ -791,6 +1387,65 @@ static int getConfig(void)
 			&EPICS_IOC_LOG_FILE_COMMAND, 
 			sizeof ioc_log_file_command,
 			ioc_log_file_command);
+
+	status = envGetLongConfigParam(
+			&EPICS_IOC_LOG_FILE_ROTATE,
+			&ioc_log_file_rotate);
+	if(status>=0){
+		if (ioc_log_file_rotate < 0) {
+			envFailureNotify (&EPICS_IOC_LOG_FILE_ROTATE);
+			return IOCLS_ERROR;
+		}
+	}
+	else {
+		ioc_log_file_rotate = 0;
+	}
+
+	/*
+	 * never sync unless asked to
+	 */
+	status = envGetDoubleConfigParam(
+			&EPICS_IOC_LOG_FILE_SYNC,
+			&ioc_log_file_sync);
+	if(status<0){
+		ioc_log_file_sync = -1.0;
+	}
+
+	pstring = envGetConfigParam(
+			&EPICS_IOC_LOG_FILE_FORMAT,
+			sizeof format,
+			format);
+	if (pstring == NULL || format[0] == '\0' ||
+			epicsStrCaseCmp(format, "TEXT") == 0) {
+		ioc_log_file_jsonl = FALSE;
+	}
+	else if (epicsStrCaseCmp(format, "JSONL") == 0) {
+		ioc_log_file_jsonl = TRUE;
+	}
+	else {
+		fprintf(stderr,
+			"iocLogServer: EPICS_IOC_LOG_FILE_FORMAT must be TEXT or JSONL\n");
+		return IOCLS_ERROR;
+	}
+
+	status = envGetBoolConfigParam(
+			&EPICS_IOC_LOG_FILE_INDEX,
+			&ioc_log_file_index);
+	if(status<0){
+		ioc_log_file_index = FALSE;
+	}
+
+	/*
+	 * the circular file is overwritten in place, and found
+	 * again at startup by the dates in the text format
+	 */
+	if ((ioc_log_file_jsonl || ioc_log_file_index) &&
+			ioc_log_file_limit && !ioc_log_file_rotate) {
+		fprintf(stderr,
+			"iocLogServer: JSONL and indexed log files need "
+			"EPICS_IOC_LOG_FILE_ROTATE or EPICS_IOC_LOG_FILE_LIMIT=0\n");
+		return IOCLS_ERROR;
+	}
 	return IOCLS_OK;
 }
 
@@ -13,6 +13,16 @@
  *      Date:           080791 
  */
 
+/*
+ * Messages are not sent by the thread calling logClientSend(). They are
+ * copied into a bounded queue, and a sender thread takes as many whole
+ * messages as fit in its send buffer and writes them with one send().
+ * Messages queued while the server is unreachable are kept, and the
+ * message the connection was lost in is sent again from its start once
+ * a new connection is up. EPICS_IOC_LOG_QUEUE_FULL selects what happens
+ * when the queue has no room for a new message.
+ */
+
 /*
  * ANSI C
  */
@@ -23,7 +33,9 @@
 
 #define epicsExportSharedSymbols
 #include "dbDefs.h"
+#include "envDefs.h"
 #include "epicsEvent.h"
+#include "epicsString.h"
 #include "iocLog.h"
 #include "errlog.h"
 #include "epicsMutex.h"
@@ -36,25 +48,66 @@
 
 #include "logClient.h"
 
+/* messages longer than the send buffer are queued in pieces */
+#define LOG_SEND_BUF_SIZE 0x4000
+#define LOG_SEND_MSG_MAX 1024
+#define LOG_QUEUE_SIZE_MIN LOG_SEND_BUF_SIZE
+#define LOG_QUEUE_SIZE_DEFAULT 0x40000
+
+/* each queued message is preceded by its length */
+typedef unsigned logMsgHdr;
+
+typedef enum {
+    logQueueDropNewest,
+    logQueueDropOldest,
+    logQueueBlock
+} logQueuePolicy;
+
+static const char * const logQueuePolicyNames[] = {
+    "DROP_NEWEST", "DROP_OLDEST", "BLOCK"
+};
+
 typedef struct {
-    char                msgBuf[0x4000];
+    char                sendBuf[LOG_SEND_BUF_SIZE];
+    unsigned            sendMsgEnd[LOG_SEND_MSG_MAX];
+    unsigned            sendBytes;      /* whole messages in sendBuf */
+    unsigned            sentBytes;      /* of those, accepted by send() */
+    unsigned            nSendMsg;
+    unsigned            nSentMsg;
+    char                *queue;
+    size_t              queueSize;
+    size_t              queueHead;      /* free running byte counts */
+    size_t              queueTail;
+    unsigned            queueMsgs;
+    logQueuePolicy      policy;
     struct sockaddr_in  addr;
     char                name[64];
     epicsMutexId        mutex;
     SOCKET              sock;
     epicsThreadId       restartThreadId;
     epicsEventId        stateChangeNotify;
+    epicsEventId        sendNotify;     /* wakes the sender thread */
+    epicsEventId        drainNotify;    /* the sender took from the queue */
+    unsigned            senderWaiting;
+    unsigned            senderCoalescing;
+    unsigned            drainWaiters;
     unsigned            connectCount;
-    unsigned            nextMsgIndex;
     unsigned            connected;
     unsigned            shutdown;
     unsigned            shutdownConfirm;
     int                 connFailStatus;
+    unsigned long       nQueued;
+    unsigned long       nSent;
+    unsigned long       nDropped;
+    unsigned long       nReconnect;
 } logClient;
 
 static const double      LOG_RESTART_DELAY = 5.0; /* sec */
 static const double      LOG_SERVER_CREATE_CONNECT_SYNC_TIMEOUT = 5.0; /* sec */
 static const double      LOG_SERVER_SHUTDOWN_TIMEOUT = 30.0; /* sec */
+static const double      LOG_SERVER_FLUSH_TIMEOUT = 5.0; /* sec */
+static const double      LOG_DRAIN_POLL = 0.1; /* sec */
+static const double      LOG_COALESCE_DELAY = 0.05; /* sec */
 
 /*
  * If set using iocLogPrefix() this string is prepended to all log messages:
@@ -84,8 +137,6 @@ static void logClientClose ( logClient *pClient )
         pClient->sock = INVALID_SOCKET;
     }
 
-    pClient->nextMsgIndex = 0u;
-    memset ( pClient->msgBuf, '\0', sizeof ( pClient->msgBuf ) );
     pClient->connected = 0u;
 
     /*
@@ -98,6 +149,169 @@ static void logClientClose ( logClient *pClient )
 #   endif
 }
 
+/*
+ * The queue copies below require the pClient->mutex be owned already.
+ */
+static void queuePut ( logClient * pClient, const void * pSrc, size_t nBytes )
+{
+    size_t index = pClient->queueHead % pClient->queueSize;
+    size_t first = pClient->queueSize - index;
+
+    if ( first > nBytes ) {
+        first = nBytes;
+    }
+    memcpy ( & pClient->queue[index], pSrc, first );
+    memcpy ( pClient->queue, ( const char * ) pSrc + first, nBytes - first );
+    pClient->queueHead += nBytes;
+}
+
+static void queueGet ( logClient * pClient, void * pDest, size_t nBytes )
+{
+    size_t index = pClient->queueTail % pClient->queueSize;
+    size_t first = pClient->queueSize - index;
+
+    if ( first > nBytes ) {
+        first = nBytes;
+    }
+    memcpy ( pDest, & pClient->queue[index], first );
+    memcpy ( ( char * ) pDest + first, pClient->queue, nBytes - first );
+    pClient->queueTail += nBytes;
+}
+
+static void queueDropOldest ( logClient * pClient )
+{
+    logMsgHdr len;
+
+    queueGet ( pClient, & len, sizeof ( len ) );
+    pClient->queueTail += len;
+    pClient->queueMsgs--;
+    pClient->nDropped++;
+}
+
+/*
+ * Make room for nBytes in the queue according to the policy, returns
+ * false if the message must be dropped. Requires the mutex.
+ */
+static int queueMakeRoom ( logClient * pClient, size_t nBytes )
+{
+    if ( nBytes > pClient->queueSize ) {
+        return FALSE;
+    }
+    while ( pClient->queueSize - ( pClient->queueHead - pClient->queueTail )
+            < nBytes ) {
+        switch ( pClient->policy ) {
+        case logQueueDropOldest:
+            queueDropOldest ( pClient );
+            break;
+        case logQueueBlock:
+            /* never wait for a server which is not there */
+            if ( ! pClient->connected || pClient->shutdown ) {
+                return FALSE;
+            }
+            pClient->drainWaiters++;
+            epicsMutexUnlock ( pClient->mutex );
+            epicsEventWaitWithTimeout ( pClient->drainNotify,
+                LOG_DRAIN_POLL );
+            epicsMutexMustLock ( pClient->mutex );
+            pClient->drainWaiters--;
+            break;
+        default:
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/*
+ * Queue one message, prefixed with the first part if any, into room
+ * already made for it. This method requires the pClient->mutex be owned
+ * already.
+ */
+static void queueMessage ( logClient * pClient,
+    const char * pPrefix, size_t prefixLen,
+    const char * message, size_t msgLen )
+{
+    logMsgHdr len = ( logMsgHdr ) ( prefixLen + msgLen );
+
+    queuePut ( pClient, & len, sizeof ( len ) );
+    if ( prefixLen ) {
+        queuePut ( pClient, pPrefix, prefixLen );
+    }
+    queuePut ( pClient, message, msgLen );
+    pClient->queueMsgs++;
+    pClient->nQueued++;
+
+    if ( pClient->senderWaiting ) {
+        pClient->senderWaiting = 0u;
+        epicsEventSignal ( pClient->sendNotify );
+    }
+    else if ( pClient->senderCoalescing && pClient->queueHead -
+            pClient->queueTail >= sizeof ( pClient->sendBuf ) ) {
+        pClient->senderCoalescing = 0u;
+        epicsEventSignal ( pClient->sendNotify );
+    }
+}
+
+/*
+ * Move whole messages from the queue into the send buffer.
+ * This method requires the pClient->mutex be owned already.
+ */
+static void fillSendBuf ( logClient * pClient )
+{
+    unsigned taken = 0u;
+
+    while ( pClient->queueMsgs && pClient->nSendMsg < LOG_SEND_MSG_MAX ) {
+        logMsgHdr len;
+        size_t index = pClient->queueTail % pClient->queueSize;
+        size_t first = pClient->queueSize - index;
+
+        if ( first >= sizeof ( len ) ) {
+            memcpy ( & len, & pClient->queue[index], sizeof ( len ) );
+        }
+        else {
+            memcpy ( & len, & pClient->queue[index], first );
+            memcpy ( ( char * ) & len + first, pClient->queue,
+                sizeof ( len ) - first );
+        }
+        if ( len > sizeof ( pClient->sendBuf ) - pClient->sendBytes ) {
+            break;
+        }
+        pClient->queueTail += sizeof ( len );
+        queueGet ( pClient, & pClient->sendBuf[pClient->sendBytes], len );
+        pClient->sendBytes += len;
+        pClient->sendMsgEnd[pClient->nSendMsg++] = pClient->sendBytes;
+        pClient->queueMsgs--;
+        taken++;
+    }
+
+    if ( taken && pClient->drainWaiters ) {
+        epicsEventSignal ( pClient->drainNotify );
+    }
+}
+
+/*
+ * Forget the messages the server received whole, the rest are sent again
+ * from the start of the first. This method requires the pClient->mutex
+ * be owned already.
+ */
+static void rewindSendBuf ( logClient * pClient )
+{
+    unsigned start = pClient->nSentMsg ?
+        pClient->sendMsgEnd[pClient->nSentMsg - 1u] : 0u;
+    unsigned i;
+
+    memmove ( pClient->sendBuf, & pClient->sendBuf[start],
+        pClient->sendBytes - start );
+    for ( i = pClient->nSentMsg; i < pClient->nSendMsg; i++ ) {
+        pClient->sendMsgEnd[i - pClient->nSentMsg] =
+            pClient->sendMsgEnd[i] - start;
+    }
+    pClient->nSendMsg -= pClient->nSentMsg;
+    pClient->nSentMsg = 0u;
+    pClient->sendBytes -= start;
+    pClient->sentBytes = 0u;
+}
+
 /*
  * logClientDestroy
  */
@@ -108,11 +322,16 @@ static void logClientDestroy (logClientId id)
     epicsTimeStamp begin, current;
     double diff;
 
+    /* give the sender a chance to deliver what is queued */
+    logClientFlush ( id );
+
     /* command log client thread to shutdown - taking mutex here */
     /* forces cache flush on SMP machines */
     epicsMutexMustLock ( pClient->mutex );
     pClient->shutdown = 1u;
     epicsMutexUnlock ( pClient->mutex );
+    epicsEventSignal ( pClient->sendNotify );
+    epicsEventSignal ( pClient->drainNotify );
 
     /* unblock log client thread blocking in send() or connect() */
     interruptInfo =
@@ -161,93 +380,62 @@ static void logClientDestroy (logClientId id)
     epicsMutexDestroy ( pClient->mutex );
    
     epicsEventDestroy ( pClient->stateChangeNotify );
+    epicsEventDestroy ( pClient->sendNotify );
+    epicsEventDestroy ( pClient->drainNotify );
 
+    free ( pClient->queue );
     free ( pClient );
 }
 
-/*
- * This method requires the pClient->mutex be owned already.
- */
-static void sendMessageChunk(logClient * pClient, const char * message) {
-    unsigned strSize;
-
-    strSize = strlen ( message );
-    while ( strSize ) {
-        unsigned msgBufBytesLeft = 
-            sizeof ( pClient->msgBuf ) - pClient->nextMsgIndex;
-
-        if ( strSize > msgBufBytesLeft ) {
-            int status;
-
-            if ( ! pClient->connected ) {
-                break;
-            }
-
-            if ( msgBufBytesLeft > 0u ) {
-                memcpy ( & pClient->msgBuf[pClient->nextMsgIndex],
-                    message, msgBufBytesLeft );
-                pClient->nextMsgIndex += msgBufBytesLeft;
-                strSize -= msgBufBytesLeft;
-                message += msgBufBytesLeft;
-            }
-
-            status = send ( pClient->sock, pClient->msgBuf, 
-                pClient->nextMsgIndex, 0 );
-            if ( status > 0 ) {
-                unsigned nSent = (unsigned) status;
-                if ( nSent < pClient->nextMsgIndex ) {
-                    unsigned newNextMsgIndex = pClient->nextMsgIndex - nSent;
-                    memmove ( pClient->msgBuf, & pClient->msgBuf[nSent], 
-                        newNextMsgIndex );
-                    pClient->nextMsgIndex = newNextMsgIndex;
-                }
-                else {
-                    pClient->nextMsgIndex = 0u;
-                }
-            }
-            else {
-                if ( ! pClient->shutdown ) {
-                    char sockErrBuf[64];
-                    if ( status ) {
-                        epicsSocketConvertErrnoToString ( sockErrBuf, sizeof ( sockErrBuf ) );
-                    }
-                    else {
-                        strcpy ( sockErrBuf, "server initiated disconnect" );
-                    }
-                    fprintf ( stderr, "log client: lost contact with log server at \"%s\" because \"%s\"\n", 
-                        pClient->name, sockErrBuf );
-                }
-                logClientClose ( pClient );
-                break;
-            }
-        }
-        else {
-            memcpy ( & pClient->msgBuf[pClient->nextMsgIndex],
-                message, strSize );
-            pClient->nextMsgIndex += strSize;
-            break;
-        }
-    }
-}
-
-
 /* 
  * logClientSend ()
  */
 void epicsShareAPI logClientSend ( logClientId id, const char * message )
 {
     logClient * pClient = ( logClient * ) id;
+    size_t prefixLen, msgLen, nPieces;
 
     if ( ! pClient || ! message ) {
         return;
     }
 
+    prefixLen = logClientPrefix ? strlen ( logClientPrefix ) : 0u;
+    if ( prefixLen > sizeof ( pClient->sendBuf ) / 2u ) {
+        prefixLen = sizeof ( pClient->sendBuf ) / 2u;
+    }
+    msgLen = strlen ( message );
+    if ( ! msgLen ) {
+        return;
+    }
+
+    /*
+     * Make room for all of the pieces before queueing any of them, as
+     * queueMakeRoom() may release the mutex and another thread's
+     * message must not land between them. A message longer than the
+     * queue is dropped.
+     */
+    nPieces = ( prefixLen + msgLen - 1u ) / sizeof ( pClient->sendBuf ) + 1u;
+
     epicsMutexMustLock ( pClient->mutex );
 
-    if (logClientPrefix) {
-        sendMessageChunk(pClient, logClientPrefix);
+    if ( ! queueMakeRoom ( pClient,
+            nPieces * sizeof ( logMsgHdr ) + prefixLen + msgLen ) ) {
+        pClient->nDropped += nPieces;
+        epicsMutexUnlock ( pClient->mutex );
+        return;
     }
-    sendMessageChunk(pClient, message);
+
+    do {
+        size_t len = msgLen;
+
+        if ( len > sizeof ( pClient->sendBuf ) - prefixLen ) {
+            len = sizeof ( pClient->sendBuf ) - prefixLen;
+        }
+        queueMessage ( pClient, logClientPrefix, prefixLen, message, len );
+        message += len;
+        msgLen -= len;
+        prefixLen = 0u;
+    } while ( msgLen );
 
     epicsMutexUnlock (pClient->mutex);
 }
@@ -256,41 +444,30 @@ void epicsShareAPI logClientSend ( logClientId id, const char * message )
 void epicsShareAPI logClientFlush ( logClientId id )
 {
     logClient * pClient = ( logClient * ) id;
+    epicsTimeStamp begin, current;
 
     if ( ! pClient ) {
         return;
     }
 
+    epicsTimeGetCurrent ( & begin );
     epicsMutexMustLock ( pClient->mutex );
 
-    while ( pClient->nextMsgIndex && pClient->connected ) {
-        int status = send ( pClient->sock, pClient->msgBuf, 
-            pClient->nextMsgIndex, 0 );
-        if ( status > 0 ) {
-            unsigned nSent = (unsigned) status;
-            if ( nSent < pClient->nextMsgIndex ) {
-                unsigned newNextMsgIndex = pClient->nextMsgIndex - nSent;
-                memmove ( pClient->msgBuf, & pClient->msgBuf[nSent], 
-                    newNextMsgIndex );
-                pClient->nextMsgIndex = newNextMsgIndex;
-            }
-            else {
-                pClient->nextMsgIndex = 0u;
-            }
+    while ( pClient->connected && ! pClient->shutdown &&
+            ( pClient->queueMsgs || pClient->sendBytes ) ) {
+        if ( pClient->senderWaiting || pClient->senderCoalescing ) {
+            pClient->senderWaiting = 0u;
+            pClient->senderCoalescing = 0u;
+            epicsEventSignal ( pClient->sendNotify );
         }
-        else {
-            if ( ! pClient->shutdown ) {
-                char sockErrBuf[64];
-                if ( status ) {
-                    epicsSocketConvertErrnoToString ( sockErrBuf, sizeof ( sockErrBuf ) );
-                }
-                else {
-                    strcpy ( sockErrBuf, "server initiated disconnect" );
-                }
-                fprintf ( stderr, "log client: lost contact with log server at \"%s\" because \"%s\"\n", 
-                    pClient->name, sockErrBuf );
-            }
-            logClientClose ( pClient );
+        pClient->drainWaiters++;
+        epicsMutexUnlock ( pClient->mutex );
+        epicsEventWaitWithTimeout ( pClient->drainNotify, LOG_DRAIN_POLL );
+        epicsTimeGetCurrent ( & current );
+        epicsMutexMustLock ( pClient->mutex );
+        pClient->drainWaiters--;
+        if ( epicsTimeDiffInSeconds ( & current, & begin ) >
+                LOG_SERVER_FLUSH_TIMEOUT ) {
             break;
         }
     }
@@ -432,7 +609,9 @@ static void logClientConnect (logClient *pClient)
         }
     }
     
-    pClient->connectCount++;
+    if ( pClient->connectCount++ ) {
+        pClient->nReconnect++;
+    }
 
     epicsMutexUnlock ( pClient->mutex );
     
@@ -443,6 +622,8 @@ static void logClientConnect (logClient *pClient)
 
 /*
  * logClientRestart ()
+ *
+ * The sender thread, which also reconnects
  */
 static void logClientRestart ( logClientId id )
 {
@@ -451,22 +632,84 @@ static void logClientRestart ( logClientId id )
     /* SMP safe state inspection */
     epicsMutexMustLock ( pClient->mutex );
     while ( ! pClient->shutdown ) {
-        unsigned isConn;
+        int status;
+
+        if ( ! pClient->connected ) {
+            epicsMutexUnlock ( pClient->mutex );
+            logClientConnect ( pClient );
+            epicsMutexMustLock ( pClient->mutex );
+            if ( ! pClient->connected && ! pClient->shutdown ) {
+                epicsMutexUnlock ( pClient->mutex );
+                epicsEventWaitWithTimeout ( pClient->sendNotify,
+                    LOG_RESTART_DELAY );
+                epicsMutexMustLock ( pClient->mutex );
+            }
+            continue;
+        }
 
-        isConn = pClient->connected;
+        fillSendBuf ( pClient );
+        if ( pClient->sentBytes >= pClient->sendBytes ) {
+            if ( pClient->drainWaiters ) {
+                epicsEventSignal ( pClient->drainNotify );
+            }
+            pClient->senderWaiting = 1u;
+            epicsMutexUnlock ( pClient->mutex );
+            epicsEventWait ( pClient->sendNotify );
+            epicsMutexMustLock ( pClient->mutex );
+            pClient->senderWaiting = 0u;
+            /* let a burst of messages gather for one send() */
+            if ( ! pClient->shutdown && ! pClient->drainWaiters ) {
+                pClient->senderCoalescing = 1u;
+                epicsMutexUnlock ( pClient->mutex );
+                epicsEventWaitWithTimeout ( pClient->sendNotify,
+                    LOG_COALESCE_DELAY );
+                epicsMutexMustLock ( pClient->mutex );
+                pClient->senderCoalescing = 0u;
+            }
+            continue;
+        }
 
         epicsMutexUnlock ( pClient->mutex );
+        status = send ( pClient->sock, & pClient->sendBuf[pClient->sentBytes],
+            pClient->sendBytes - pClient->sentBytes, 0 );
+        epicsMutexMustLock ( pClient->mutex );
 
-        if ( isConn ) {
-            logClientFlush ( pClient );
+        if ( status > 0 ) {
+            pClient->sentBytes += (unsigned) status;
+            while ( pClient->nSentMsg < pClient->nSendMsg &&
+                    pClient->sendMsgEnd[pClient->nSentMsg] <= pClient->sentBytes ) {
+                pClient->nSentMsg++;
+                pClient->nSent++;
+            }
+            if ( pClient->sentBytes == pClient->sendBytes ) {
+                pClient->sendBytes = 0u;
+                pClient->sentBytes = 0u;
+                pClient->nSendMsg = 0u;
+                pClient->nSentMsg = 0u;
+            }
         }
         else {
-            logClientConnect ( pClient );
+            if ( ! pClient->shutdown ) {
+                char sockErrBuf[64];
+                if ( status ) {
+                    epicsSocketConvertErrnoToString ( sockErrBuf, sizeof ( sockErrBuf ) );
+                }
+                else {
+                    strcpy ( sockErrBuf, "server initiated disconnect" );
+                }
+                fprintf ( stderr, "log client: lost contact with log server at \"%s\" because \"%s\"\n", 
+                    pClient->name, sockErrBuf );
+            }
+            logClientClose ( pClient );
+            rewindSendBuf ( pClient );
+            /* don't spin on a server which drops each connection */
+            if ( ! pClient->shutdown ) {
+                epicsMutexUnlock ( pClient->mutex );
+                epicsEventWaitWithTimeout ( pClient->sendNotify,
+                    LOG_RESTART_DELAY );
+                epicsMutexMustLock ( pClient->mutex );
+            }
         }
-        
-        epicsThreadSleep ( LOG_RESTART_DELAY );
-
-        epicsMutexMustLock ( pClient->mutex );
     }
     epicsMutexUnlock ( pClient->mutex );
 
@@ -474,6 +717,43 @@ static void logClientRestart ( logClientId id )
     epicsEventSignal ( pClient->stateChangeNotify );
 }
 
+/*
+ *  logClientQueueConfig()
+ *  Get the queue size and what to do when it is full
+ */
+static void logClientQueueConfig ( logClient *pClient )
+{
+    char policy[32];
+    long size;
+    unsigned i;
+
+    pClient->queueSize = LOG_QUEUE_SIZE_DEFAULT;
+    if ( envGetLongConfigParam ( &EPICS_IOC_LOG_QUEUE_SIZE, &size ) == 0 ) {
+        if ( size >= LOG_QUEUE_SIZE_MIN ) {
+            pClient->queueSize = (size_t) size;
+        }
+        else {
+            fprintf ( stderr, "log client: %s must be at least %u\n",
+                EPICS_IOC_LOG_QUEUE_SIZE.name, LOG_QUEUE_SIZE_MIN );
+        }
+    }
+
+    pClient->policy = logQueueDropNewest;
+    if ( envGetConfigParam ( &EPICS_IOC_LOG_QUEUE_FULL,
+            sizeof ( policy ), policy ) && policy[0] ) {
+        for ( i = 0; i < NELEMENTS ( logQueuePolicyNames ); i++ ) {
+            if ( epicsStrCaseCmp ( policy, logQueuePolicyNames[i] ) == 0 ) {
+                pClient->policy = (logQueuePolicy) i;
+                break;
+            }
+        }
+        if ( i == NELEMENTS ( logQueuePolicyNames ) ) {
+            fprintf ( stderr, "log client: unknown %s \"%s\"\n",
+                EPICS_IOC_LOG_QUEUE_FULL.name, policy );
+        }
+    }
+}
+
 /*
  *  logClientCreate()
  */
@@ -494,8 +774,16 @@ logClientId epicsShareAPI logClientCreate (
     pClient->addr.sin_port = htons(server_port);
     ipAddrToDottedIP (&pClient->addr, pClient->name, sizeof(pClient->name));
 
+    logClientQueueConfig ( pClient );
+    pClient->queue = malloc ( pClient->queueSize );
+    if ( ! pClient->queue ) {
+        free ( pClient );
+        return NULL;
+    }
+
     pClient->mutex = epicsMutexCreate ();
     if ( ! pClient->mutex ) {
+        free ( pClient->queue );
         free ( pClient );
         return NULL;
     }
@@ -509,8 +797,18 @@ logClientId epicsShareAPI logClientCreate (
     epicsAtExit (logClientDestroy, (void*) pClient);
     
     pClient->stateChangeNotify = epicsEventCreate (epicsEventEmpty);
-    if ( ! pClient->stateChangeNotify ) {
+    pClient->sendNotify = epicsEventCreate (epicsEventEmpty);
+    pClient->drainNotify = epicsEventCreate (epicsEventEmpty);
+    if ( ! pClient->stateChangeNotify || ! pClient->sendNotify ||
+            ! pClient->drainNotify ) {
+        if ( pClient->stateChangeNotify )
+            epicsEventDestroy ( pClient->stateChangeNotify );
+        if ( pClient->sendNotify )
+            epicsEventDestroy ( pClient->sendNotify );
+        if ( pClient->drainNotify )
+            epicsEventDestroy ( pClient->drainNotify );
         epicsMutexDestroy ( pClient->mutex );
+        free ( pClient->queue );
         free ( pClient );
         return NULL;
     }
@@ -522,6 +820,9 @@ logClientId epicsShareAPI logClientCreate (
     if ( pClient->restartThreadId == NULL ) {
         epicsMutexDestroy ( pClient->mutex );
         epicsEventDestroy ( pClient->stateChangeNotify );
+        epicsEventDestroy ( pClient->sendNotify );
+        epicsEventDestroy ( pClient->drainNotify );
+        free ( pClient->queue );
         free (pClient);
         fprintf(stderr, "log client: unable to start log client connection watch dog thread\n");
         return NULL;
@@ -554,24 +855,62 @@ logClientId epicsShareAPI logClientCreate (
     return (void *) pClient;
 }
 
+/*
+ * logClientGetStats ()
+ */
+int epicsShareAPI logClientGetStats (logClientId id, logClientStats *pStats)
+{
+    logClient *pClient = (logClient *) id;
+
+    if ( ! pClient || ! pStats ) {
+        return -1;
+    }
+
+    epicsMutexMustLock ( pClient->mutex );
+    pStats->connected = pClient->connected;
+    pStats->queued = pClient->nQueued;
+    pStats->sent = pClient->nSent;
+    pStats->dropped = pClient->nDropped;
+    pStats->reconnects = pClient->nReconnect;
+    pStats->pending = pClient->queueMsgs +
+        pClient->nSendMsg - pClient->nSentMsg;
+    pStats->queueBytes = pClient->queueHead - pClient->queueTail;
+    pStats->queueSize = pClient->queueSize;
+    epicsMutexUnlock ( pClient->mutex );
+    return 0;
+}
+
 /*
  * logClientShow ()
  */
 void epicsShareAPI logClientShow (logClientId id, unsigned level)
 {
     logClient *pClient = (logClient *) id;
+    logClientStats stats;
 
-    if ( pClient->connected ) {
+    logClientGetStats ( id, & stats );
+
+    if ( stats.connected ) {
         printf ("log client: connected to log server at \"%s\"\n", pClient->name);
     }
     else {
         printf ("log client: disconnected from log server at \"%s\"\n", pClient->name);
     }
 
+    if (level>0) {
+        printf ("log client: %lu queued, %lu sent, %lu dropped, %lu reconnects,"
+            " %lu waiting\n", stats.queued, stats.sent, stats.dropped,
+            stats.reconnects, stats.pending);
+    }
+
     if (level>1) {
         printf ("log client: sock=%s, connect cycles = %u\n",
             pClient->sock==INVALID_SOCKET?"INVALID":"OK",
             pClient->connectCount);
+        printf ("log client: queue %lu of %lu bytes used, %s when full\n",
+            (unsigned long) stats.queueBytes,
+            (unsigned long) stats.queueSize,
+            logQueuePolicyNames[pClient->policy]);
     }
 
     if (logClientPrefix) {
@@ -17,6 +17,7 @@
 
 #ifndef INClogClienth
 #define INClogClienth 1
+#include <stddef.h>
 #include "shareLib.h"
 #include "osiSock.h" /* for 'struct in_addr' */
 
@@ -28,11 +29,25 @@ extern "C" {
 #endif
 
 typedef void *logClientId;
+
+typedef struct logClientStats {
+    int connected;
+    unsigned long queued;       /* messages accepted by logClientSend() */
+    unsigned long sent;         /* messages handed to the TCP stack */
+    unsigned long dropped;      /* messages discarded with the queue full */
+    unsigned long reconnects;
+    unsigned long pending;      /* messages queued but not yet sent */
+    size_t queueBytes;
+    size_t queueSize;
+} logClientStats;
+
 epicsShareFunc logClientId epicsShareAPI logClientCreate (
     struct in_addr server_addr, unsigned short server_port);
 epicsShareFunc void epicsShareAPI logClientSend (logClientId id, const char *message);
 epicsShareFunc void epicsShareAPI logClientShow (logClientId id, unsigned level);
 epicsShareFunc void epicsShareAPI logClientFlush (logClientId id);
+epicsShareFunc int epicsShareAPI logClientGetStats (logClientId id,
+    logClientStats *pStats);
 epicsShareFunc void epicsShareAPI iocLogPrefix(const char* prefix);
 
 /* deprecated interface; retained for backward compatibility */
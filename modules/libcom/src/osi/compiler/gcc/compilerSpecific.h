@@ -74,4 +74,12 @@
  */
 #define EPICS_UNUSED __attribute__((unused))
 
+/*
+ * Compile a function for more than one instruction set, choosing one
+ * when the program is loaded.  This relies on the ifunc support in glibc.
+ */
+#if __GNUC__ >= 6 && defined(__x86_64__) && defined(__GLIBC__)
+#   define EPICS_SIMD_CLONES __attribute__((target_clones("avx2","default")))
+#endif
+
 #endif  /* ifndef compilerSpecific_h */
@@ -62,6 +62,13 @@
 #   define EPICS_UNUSED
 #endif
 
+#ifndef EPICS_SIMD_CLONES
+/*
+ * Single instruction set only
+ */
+#   define EPICS_SIMD_CLONES
+#endif
+
 #ifndef EPICS_FUNCTION
 #if (defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901)) || (defined(__cplusplus) && __cplusplus>=201103L)
 #  define EPICS_FUNCTION __func__
@@ -0,0 +1,48 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Operating System Independent Interface to named shared memory segments
+ *
+ * A segment is created by one process under a name, opened by name from
+ * another process on the same host, and unlinked once both sides have it
+ * mapped. Segments are only accessible to the user that created them.
+ * Targets without support return NULL from both create and open.
+ */
+
+#ifndef epicsSharedMemoryh
+#define epicsSharedMemoryh
+
+#include <stddef.h>
+
+#include "shareLib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct epicsSharedMemory *epicsSharedMemoryId;
+
+/* names are of the form "/xyz" and no longer than this, including the nil */
+#define EPICS_SHARED_MEMORY_NAME_SIZE 64
+
+/* create a new zero filled segment, fails if the name is already in use */
+epicsShareFunc epicsSharedMemoryId epicsSharedMemoryCreate(
+    const char *name, size_t size);
+/* map an existing segment created by another process */
+epicsShareFunc epicsSharedMemoryId epicsSharedMemoryOpen(const char *name);
+/* remove the name, mappings stay valid until destroyed */
+epicsShareFunc void epicsSharedMemoryUnlink(epicsSharedMemoryId);
+/* unmap, also unlinks the name if this process created it */
+epicsShareFunc void epicsSharedMemoryDestroy(epicsSharedMemoryId);
+
+epicsShareFunc void * epicsSharedMemoryAddress(epicsSharedMemoryId);
+epicsShareFunc size_t epicsSharedMemorySize(epicsSharedMemoryId);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* epicsSharedMemoryh */
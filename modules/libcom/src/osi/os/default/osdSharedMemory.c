@@ -0,0 +1,42 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Default implementation of epicsSharedMemory.h for targets without
+ * named shared memory; callers fall back to their non-shared path.
+ */
+
+#include <stddef.h>
+
+#define epicsExportSharedSymbols
+#include "epicsSharedMemory.h"
+
+epicsSharedMemoryId epicsSharedMemoryCreate(const char *name, size_t size)
+{
+    return NULL;
+}
+
+epicsSharedMemoryId epicsSharedMemoryOpen(const char *name)
+{
+    return NULL;
+}
+
+void epicsSharedMemoryUnlink(epicsSharedMemoryId pshm)
+{
+}
+
+void epicsSharedMemoryDestroy(epicsSharedMemoryId pshm)
+{
+}
+
+void * epicsSharedMemoryAddress(epicsSharedMemoryId pshm)
+{
+    return NULL;
+}
+
+size_t epicsSharedMemorySize(epicsSharedMemoryId pshm)
+{
+    return 0;
+}
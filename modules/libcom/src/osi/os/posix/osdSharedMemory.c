@@ -0,0 +1,160 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * POSIX implementation of epicsSharedMemory.h using shm_open() and mmap()
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define epicsExportSharedSymbols
+#include "epicsSharedMemory.h"
+
+#if defined(_POSIX_SHARED_MEMORY_OBJECTS) && _POSIX_SHARED_MEMORY_OBJECTS > 0 \
+    && !defined(__rtems__)
+
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+typedef struct epicsSharedMemory {
+    void *addr;
+    size_t size;
+    int owner;
+    int linked;
+    char name[EPICS_SHARED_MEMORY_NAME_SIZE];
+} epicsSharedMemory;
+
+static epicsSharedMemory * shmMap(const char *name, int fd,
+    size_t size, int owner)
+{
+    epicsSharedMemory *pshm = calloc(1, sizeof(*pshm));
+    void *addr;
+
+    if (!pshm)
+        return NULL;
+    addr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+        free(pshm);
+        return NULL;
+    }
+    pshm->addr = addr;
+    pshm->size = size;
+    pshm->owner = owner;
+    pshm->linked = owner;
+    strcpy(pshm->name, name);
+    return pshm;
+}
+
+epicsSharedMemoryId epicsSharedMemoryCreate(const char *name, size_t size)
+{
+    epicsSharedMemory *pshm;
+    int fd;
+
+    if (strlen(name) >= EPICS_SHARED_MEMORY_NAME_SIZE || size == 0)
+        return NULL;
+
+    fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if (fd < 0)
+        return NULL;
+    if (ftruncate(fd, (off_t) size) < 0) {
+        close(fd);
+        shm_unlink(name);
+        return NULL;
+    }
+#if defined(_POSIX_ADVISORY_INFO) && _POSIX_ADVISORY_INFO > 0
+    /* fail here, rather than with SIGBUS later, when the
+     * file system holding the segments is too small */
+    if (posix_fallocate(fd, 0, (off_t) size) != 0) {
+        close(fd);
+        shm_unlink(name);
+        return NULL;
+    }
+#endif
+    pshm = shmMap(name, fd, size, 1);
+    close(fd);
+    if (!pshm)
+        shm_unlink(name);
+    return pshm;
+}
+
+epicsSharedMemoryId epicsSharedMemoryOpen(const char *name)
+{
+    epicsSharedMemory *pshm;
+    struct stat st;
+    int fd;
+
+    if (strlen(name) >= EPICS_SHARED_MEMORY_NAME_SIZE)
+        return NULL;
+
+    fd = shm_open(name, O_RDWR, 0);
+    if (fd < 0)
+        return NULL;
+    if (fstat(fd, &st) < 0 || st.st_size <= 0 || st.st_uid != geteuid()) {
+        close(fd);
+        return NULL;
+    }
+    pshm = shmMap(name, fd, (size_t) st.st_size, 0);
+    close(fd);
+    return pshm;
+}
+
+void epicsSharedMemoryUnlink(epicsSharedMemoryId pshm)
+{
+    if (pshm && pshm->linked) {
+        shm_unlink(pshm->name);
+        pshm->linked = 0;
+    }
+}
+
+void epicsSharedMemoryDestroy(epicsSharedMemoryId pshm)
+{
+    if (!pshm)
+        return;
+    if (pshm->owner)
+        epicsSharedMemoryUnlink(pshm);
+    munmap(pshm->addr, pshm->size);
+    free(pshm);
+}
+
+void * epicsSharedMemoryAddress(epicsSharedMemoryId pshm)
+{
+    return pshm->addr;
+}
+
+size_t epicsSharedMemorySize(epicsSharedMemoryId pshm)
+{
+    return pshm->size;
+}
+
+#else /* _POSIX_SHARED_MEMORY_OBJECTS */
+
+epicsSharedMemoryId epicsSharedMemoryCreate(const char *name, size_t size)
+{
+    return NULL;
+}
+
+epicsSharedMemoryId epicsSharedMemoryOpen(const char *name)
+{
+    return NULL;
+}
+
+void epicsSharedMemoryUnlink(epicsSharedMemoryId pshm) {}
+void epicsSharedMemoryDestroy(epicsSharedMemoryId pshm) {}
+
+void * epicsSharedMemoryAddress(epicsSharedMemoryId pshm)
+{
+    return NULL;
+}
+
+size_t epicsSharedMemorySize(epicsSharedMemoryId pshm)
+{
+    return 0;
+}
+
+#endif /* _POSIX_SHARED_MEMORY_OBJECTS */
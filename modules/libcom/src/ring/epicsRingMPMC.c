@@ -0,0 +1,193 @@
+/*************************************************************************\
+* Copyright (c) 2019 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Lock-free multi-producer/multi-consumer ring of pointers.
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#define epicsExportSharedSymbols
+#include "epicsAtomic.h"
+#include "epicsRingMPMC.h"
+
+/* Keep the producer and consumer indices on separate cache lines */
+#define CACHELINE 64
+
+typedef struct mpmcSlot {
+    size_t seq;
+    void *ptr;
+} mpmcSlot;
+
+struct epicsRingMPMC {
+    size_t nextPush;
+    char pad1[CACHELINE - sizeof(size_t)];
+    size_t nextPop;
+    char pad2[CACHELINE - sizeof(size_t)];
+    int highWaterMark;
+    int size;
+    mpmcSlot *slots;
+};
+
+/* Algorithm note
+ *  Slot (i % size) initially holds sequence number i.  A producer which
+ *  has claimed index pos may fill the slot when its sequence equals pos,
+ *  and then publishes it by storing pos+1.  A consumer which has claimed
+ *  index pos may empty the slot when its sequence equals pos+1, and then
+ *  releases it for the next lap by storing pos+size.
+ *  Indices are free-running size_t counters, so the difference between
+ *  a sequence and an index is taken as a signed value.
+ */
+
+epicsShareFunc epicsRingMPMCId epicsRingMPMCCreate(int size)
+{
+    epicsRingMPMCId ring;
+    int i;
+
+    if (size <= 0)
+        return NULL;
+
+    ring = calloc(1, sizeof(*ring));
+    if (!ring)
+        return NULL;
+
+    ring->slots = calloc(size, sizeof(mpmcSlot));
+    if (!ring->slots) {
+        free(ring);
+        return NULL;
+    }
+    ring->size = size;
+    for (i = 0; i < size; i++)
+        ring->slots[i].seq = i;
+    epicsAtomicWriteMemoryBarrier();
+    return ring;
+}
+
+epicsShareFunc void epicsRingMPMCDelete(epicsRingMPMCId ring)
+{
+    if (!ring)
+        return;
+    free(ring->slots);
+    free(ring);
+}
+
+static int usedCount(epicsRingMPMCIdConst ring)
+{
+    size_t pop = epicsAtomicGetSizeT(&ring->nextPop);
+    size_t push = epicsAtomicGetSizeT(&ring->nextPush);
+    ptrdiff_t n = (ptrdiff_t)(push - pop);
+
+    if (n < 0) return 0;
+    if (n > ring->size) return ring->size;
+    return (int)n;
+}
+
+epicsShareFunc int epicsRingMPMCPush(epicsRingMPMCId ring, void *p)
+{
+    size_t pos = epicsAtomicGetSizeT(&ring->nextPush);
+    mpmcSlot *slot;
+    int used, hwm;
+
+    for (;;) {
+        ptrdiff_t diff;
+        size_t seq;
+
+        slot = &ring->slots[pos % ring->size];
+        seq = epicsAtomicGetSizeT(&slot->seq);
+        diff = (ptrdiff_t)(seq - pos);
+
+        if (diff == 0) {
+            size_t prev = epicsAtomicCmpAndSwapSizeT(&ring->nextPush,
+                pos, pos + 1);
+            if (prev == pos)
+                break;
+            pos = prev;
+        }
+        else if (diff < 0) {
+            return 0;   /* full */
+        }
+        else {
+            pos = epicsAtomicGetSizeT(&ring->nextPush);
+        }
+    }
+
+    slot->ptr = p;
+    /* Publish the pointer before the sequence number */
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetSizeT(&slot->seq, pos + 1);
+
+    used = usedCount(ring);
+    while (used > (hwm = epicsAtomicGetIntT(&ring->highWaterMark))) {
+        if (epicsAtomicCmpAndSwapIntT(&ring->highWaterMark, hwm, used) == hwm)
+            break;
+    }
+    return 1;
+}
+
+epicsShareFunc void* epicsRingMPMCPop(epicsRingMPMCId ring)
+{
+    size_t pos = epicsAtomicGetSizeT(&ring->nextPop);
+    mpmcSlot *slot;
+    void *p;
+
+    for (;;) {
+        ptrdiff_t diff;
+        size_t seq;
+
+        slot = &ring->slots[pos % ring->size];
+        seq = epicsAtomicGetSizeT(&slot->seq);
+        diff = (ptrdiff_t)(seq - (pos + 1));
+
+        if (diff == 0) {
+            size_t prev = epicsAtomicCmpAndSwapSizeT(&ring->nextPop,
+                pos, pos + 1);
+            if (prev == pos)
+                break;
+            pos = prev;
+        }
+        else if (diff < 0) {
+            return NULL;    /* empty */
+        }
+        else {
+            pos = epicsAtomicGetSizeT(&ring->nextPop);
+        }
+    }
+
+    /* The sequence load above must complete before reading the slot */
+    epicsAtomicReadMemoryBarrier();
+    p = slot->ptr;
+    /* and the slot must be read before it is handed back to producers */
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetSizeT(&slot->seq, pos + ring->size);
+    return p;
+}
+
+epicsShareFunc int epicsRingMPMCGetUsed(epicsRingMPMCIdConst ring)
+{
+    return usedCount(ring);
+}
+
+epicsShareFunc int epicsRingMPMCGetSize(epicsRingMPMCIdConst ring)
+{
+    return ring->size;
+}
+
+epicsShareFunc int epicsRingMPMCIsEmpty(epicsRingMPMCIdConst ring)
+{
+    return usedCount(ring) == 0;
+}
+
+epicsShareFunc int epicsRingMPMCGetHighWaterMark(epicsRingMPMCIdConst ring)
+{
+    return epicsAtomicGetIntT(&ring->highWaterMark);
+}
+
+epicsShareFunc void epicsRingMPMCResetHighWaterMark(epicsRingMPMCId ring)
+{
+    epicsAtomicSetIntT(&ring->highWaterMark, usedCount(ring));
+}
@@ -0,0 +1,53 @@
+/*************************************************************************\
+* Copyright (c) 2019 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Lock-free multi-producer/multi-consumer ring of pointers.
+ */
+
+#ifndef INCepicsRingMPMCh
+#define INCepicsRingMPMCh
+
+#include "shareLib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct epicsRingMPMC *epicsRingMPMCId;
+typedef const struct epicsRingMPMC *epicsRingMPMCIdConst;
+
+epicsShareFunc epicsRingMPMCId epicsRingMPMCCreate(int size);
+epicsShareFunc void epicsRingMPMCDelete(epicsRingMPMCId id);
+/* Returns (0,1) if p (was not, was) put on ring. p must not be NULL */
+epicsShareFunc int  epicsRingMPMCPush(epicsRingMPMCId id, void *p);
+/* Returns 0 if ring is empty */
+epicsShareFunc void* epicsRingMPMCPop(epicsRingMPMCId id);
+epicsShareFunc int  epicsRingMPMCGetUsed(epicsRingMPMCIdConst id);
+epicsShareFunc int  epicsRingMPMCGetSize(epicsRingMPMCIdConst id);
+epicsShareFunc int  epicsRingMPMCIsEmpty(epicsRingMPMCIdConst id);
+epicsShareFunc int  epicsRingMPMCGetHighWaterMark(epicsRingMPMCIdConst id);
+epicsShareFunc void epicsRingMPMCResetHighWaterMark(epicsRingMPMCId id);
+
+#ifdef __cplusplus
+}
+#endif
+
+/* NOTES
+ *   Any number of threads may push and pop concurrently without a lock.
+ *   Push and pop may also be called from interrupt context.
+ *
+ *   Each slot carries a sequence number which tells a producer or
+ *   consumer whether the slot is free for the lap it is working on
+ *   (D. Vyukov's bounded MPMC queue).  Producers and consumers only
+ *   contend on a compare-and-swap of their own index.
+ *
+ *   GetUsed() and IsEmpty() are snapshots which may already be stale
+ *   when they return if other threads are active.
+ */
+
+#endif /* INCepicsRingMPMCh */
@@ -36,7 +36,8 @@ template class tsFreeList < timer, 0x20 >;
 #endif
 
 timer::timer ( timerQueue & queueIn ) :
-    queue ( queueIn ), curState ( stateLimbo ), pNotify ( 0 ) 
+    queue ( queueIn ), curState ( stateLimbo ), pNotify ( 0 ),
+    seq ( 0u ), heapIndex ( 0u )
 {
 }
 
@@ -75,45 +76,19 @@ void timer::privateStart ( epicsTimerNotify & notify, const epicsTime & expire )
         return;
     }
     else if ( this->curState == statePending ) {
-        this->queue.timerList.remove ( *this );
-        if ( this->queue.timerList.first() == this && 
-                this->queue.timerList.count() > 0 ) {
+        this->queue.heap.remove ( *this );
+        if ( this->queue.heap.first() == this && 
+                this->queue.heap.count() > 0 ) {
             reschedualNeeded = true;
         }
     }
 
-#   ifdef DEBUG
-        unsigned preemptCount=0u;
-#   endif
-
     //
     // insert into the pending queue
     //
-    // Finds proper time sorted location using a linear search.
-    //
-    // **** this should use a binary tree ????
-    //
-    tsDLIter < timer > pTmr = this->queue.timerList.lastIter ();
-    while ( true ) {
-        if ( ! pTmr.valid () ) {
-            //
-            // add to the beginning of the list
-            //
-            this->queue.timerList.push ( *this );
-            reschedualNeeded = true;
-            break;
-        }
-        if ( pTmr->exp <= this->exp ) {
-            //
-            // add after the item found that expires earlier
-            //
-            this->queue.timerList.insertAfter ( *this, *pTmr );
-            break;
-        }
-#       ifdef DEBUG
-            preemptCount++;
-#       endif
-        --pTmr;
+    this->queue.heap.insert ( *this );
+    if ( this->queue.heap.first () == this ) {
+        reschedualNeeded = true;
     }
 
     this->curState = timer::statePending;
@@ -127,10 +102,10 @@ void timer::privateStart ( epicsTimerNotify & notify, const epicsTime & expire )
         this->queue.show ( 10u );
 #   endif
 
-    debugPrintf ( ("Start of \"%s\" with delay %f at %p preempting %u\n", 
+    debugPrintf ( ("Start of \"%s\" with delay %f at %p\n", 
         typeid ( this->notify ).name (), 
         expire - epicsTime::getCurrent (), 
-        this, preemptCount ) );
+        this ) );
 }
 
 void timer::cancel ()
@@ -141,10 +116,10 @@ void timer::cancel ()
         epicsGuard < epicsMutex > locker ( this->queue.mutex );
         this->pNotify = 0;
         if ( this->curState == statePending ) {
-            this->queue.timerList.remove ( *this );
+            this->queue.heap.remove ( *this );
             this->curState = stateLimbo;
-            if ( this->queue.timerList.first() == this && 
-                    this->queue.timerList.count() > 0 ) {
+            if ( this->queue.heap.first() == this && 
+                    this->queue.heap.count() > 0 ) {
                 reschedual = true;
             }
         }
@@ -0,0 +1,122 @@
+/*************************************************************************\
+* Copyright (c) 2019 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Pending timer store for timerQueue
+ *
+ * A binary min-heap so that starting, canceling, and expiring
+ * a timer is O(log n) in the number of pending timers.
+ */
+
+#include <string.h>
+
+#define epicsExportSharedSymbols
+#include "timerPrivate.h"
+
+timerHeap::timerHeap () :
+    pHeap ( 0 ), nItems ( 0u ), capacity ( 0u ), nextSeq ( 0u )
+{
+}
+
+timerHeap::~timerHeap ()
+{
+    delete [] this->pHeap;
+}
+
+inline bool timerHeap::before ( const timer & a, const timer & b )
+{
+    if ( a.exp < b.exp ) {
+        return true;
+    }
+    if ( b.exp < a.exp ) {
+        return false;
+    }
+    return a.seq < b.seq;
+}
+
+inline void timerHeap::place ( timer & tmr, unsigned index )
+{
+    this->pHeap[index] = & tmr;
+    tmr.heapIndex = index;
+}
+
+void timerHeap::siftUp ( unsigned index )
+{
+    timer & tmr = * this->pHeap[index];
+    while ( index > 0u ) {
+        unsigned parent = ( index - 1u ) / 2u;
+        if ( ! before ( tmr, * this->pHeap[parent] ) ) {
+            break;
+        }
+        this->place ( * this->pHeap[parent], index );
+        index = parent;
+    }
+    this->place ( tmr, index );
+}
+
+void timerHeap::siftDown ( unsigned index )
+{
+    timer & tmr = * this->pHeap[index];
+    while ( true ) {
+        unsigned child = 2u * index + 1u;
+        if ( child >= this->nItems ) {
+            break;
+        }
+        if ( child + 1u < this->nItems &&
+                before ( * this->pHeap[child + 1u], * this->pHeap[child] ) ) {
+            child++;
+        }
+        if ( ! before ( * this->pHeap[child], tmr ) ) {
+            break;
+        }
+        this->place ( * this->pHeap[child], index );
+        index = child;
+    }
+    this->place ( tmr, index );
+}
+
+void timerHeap::insert ( timer & tmr )
+{
+    if ( this->nItems >= this->capacity ) {
+        unsigned newCapacity = this->capacity ? 2u * this->capacity : 64u;
+        timer ** pNewHeap = new timer * [newCapacity];
+        if ( this->nItems ) {
+            memcpy ( pNewHeap, this->pHeap, this->nItems * sizeof ( *pNewHeap ) );
+        }
+        delete [] this->pHeap;
+        this->pHeap = pNewHeap;
+        this->capacity = newCapacity;
+    }
+    tmr.seq = this->nextSeq++;
+    this->place ( tmr, this->nItems++ );
+    this->siftUp ( tmr.heapIndex );
+}
+
+void timerHeap::remove ( timer & tmr )
+{
+    unsigned index = tmr.heapIndex;
+    timer & last = * this->pHeap[--this->nItems];
+    if ( & last == & tmr ) {
+        return;
+    }
+    this->place ( last, index );
+    if ( index > 0u && before ( last, * this->pHeap[( index - 1u ) / 2u] ) ) {
+        this->siftUp ( index );
+    }
+    else {
+        this->siftDown ( index );
+    }
+}
+
+timer * timerHeap::get ()
+{
+    timer * pTmr = this->first ();
+    if ( pTmr ) {
+        this->remove ( *pTmr );
+    }
+    return pTmr;
+}
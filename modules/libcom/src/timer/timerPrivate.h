@@ -21,6 +21,7 @@
 #include "epicsSingleton.h"
 #include "tsDLList.h"
 #include "epicsTimer.h"
+#include "epicsTypes.h"
 #include "compilerDependencies.h"
 
 #ifdef DEBUG
@@ -31,7 +32,7 @@
 
 template < class T > class epicsGuard;
 
-class timer : public epicsTimer, public tsDLNode < timer > {
+class timer : public epicsTimer {
 public:
     void destroy ();
     void start ( class epicsTimerNotify &, const epicsTime & );
@@ -50,6 +51,8 @@ private:
     epicsTime exp; // experation time 
     state curState; // current state 
     epicsTimerNotify * pNotify; // callback
+    epicsUInt64 seq; // insertion order, breaks ties between equal exp
+    unsigned heapIndex; // position in timerHeap while pending
     void privateStart ( epicsTimerNotify & notify, const epicsTime & );
     timer & operator = ( const timer & );
     // Visual C++ .net appears to require operator delete if
@@ -59,6 +62,7 @@ private:
     // no undefined symbols.
     void operator delete ( void * ); 
     friend class timerQueue;
+    friend class timerHeap;
 };
 
 struct epicsTimerForC : public epicsTimerNotify, public timer {
@@ -85,6 +89,34 @@ private:
 
 using std :: type_info;
 
+//
+// Binary min-heap of pending timers ordered by expiration time.
+// Timers with equal expiration times are ordered by insertion, so
+// they expire in the order that they were started.
+//
+class timerHeap {
+public:
+    timerHeap ();
+    ~timerHeap ();
+    unsigned count () const;
+    timer * first () const;
+    timer * get ();
+    void insert ( timer & );
+    void remove ( timer & );
+    timer & operator [] ( unsigned index ) const;
+private:
+    timer ** pHeap;
+    unsigned nItems;
+    unsigned capacity;
+    epicsUInt64 nextSeq;
+    static bool before ( const timer &, const timer & );
+    void place ( timer &, unsigned index );
+    void siftUp ( unsigned index );
+    void siftDown ( unsigned index );
+    timerHeap ( const timerHeap & );
+    timerHeap & operator = ( const timerHeap & );
+};
+
 class timerQueue : public epicsTimerQueue {
 public:
     timerQueue ( epicsTimerQueueNotify &notify );
@@ -98,7 +130,7 @@ private:
     tsFreeList < epicsTimerForC, 0x20 > timerForCFreeList;
     mutable epicsMutex mutex;
     epicsEvent cancelBlockingEvent;
-    tsDLList < timer > timerList;
+    timerHeap heap;
     epicsTimerQueueNotify & notify;
     timer * pExpireTmr;
     epicsThreadId processThread;
@@ -235,6 +267,21 @@ inline unsigned timerQueueActive::threadPriority () const
     return thread.getPriority ();
 }
 
+inline unsigned timerHeap::count () const
+{
+    return this->nItems;
+}
+
+inline timer * timerHeap::first () const
+{
+    return this->nItems ? this->pHeap[0] : 0;
+}
+
+inline timer & timerHeap::operator [] ( unsigned index ) const
+{
+    return * this->pHeap[index];
+}
+
 inline void * timer::operator new ( size_t size, 
                      tsFreeList < timer, 0x20 > & freeList ) 
 {
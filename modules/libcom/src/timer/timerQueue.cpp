@@ -38,7 +38,7 @@ timerQueue::timerQueue ( epicsTimerQueueNotify & notifyIn ) :
 timerQueue::~timerQueue ()
 {
     timer *pTmr;
-    while ( ( pTmr = this->timerList.get () ) ) {    
+    while ( ( pTmr = this->heap.get () ) ) {    
         pTmr->curState = timer::stateLimbo;
     }
 }
@@ -83,7 +83,7 @@ double timerQueue::process ( const epicsTime & currentTime )
     if ( this->pExpireTmr ) {
         // if some other thread is processing the queue
         // (or if this is a recursive call)
-        timer * pTmr = this->timerList.first ();
+        timer * pTmr = this->heap.first ();
         if ( pTmr ) {
             double delay = pTmr->exp - currentTime;
             if ( delay < 0.0 ) {
@@ -100,10 +100,10 @@ double timerQueue::process ( const epicsTime & currentTime )
     // Tag current epired tmr so that we can detect if call back
     // is in progress when canceling the timer.
     //
-    if ( this->timerList.first () ) {
-        if ( currentTime >= this->timerList.first ()->exp ) {
-            this->pExpireTmr = this->timerList.first ();
-            this->timerList.remove ( *this->pExpireTmr ); 
+    if ( this->heap.first () ) {
+        if ( currentTime >= this->heap.first ()->exp ) {
+            this->pExpireTmr = this->heap.first ();
+            this->heap.remove ( *this->pExpireTmr ); 
             this->pExpireTmr->curState = timer::stateActive;
             this->processThread = epicsThreadGetIdSelf ();
 #           ifdef DEBUG
@@ -111,7 +111,7 @@ double timerQueue::process ( const epicsTime & currentTime )
 #           endif 
         }
         else {
-            double delay = this->timerList.first ()->exp - currentTime;
+            double delay = this->heap.first ()->exp - currentTime;
             debugPrintf ( ( "no activity process %f to next\n", delay ) );
             return delay;
         }
@@ -178,17 +178,17 @@ double timerQueue::process ( const epicsTime & currentTime )
         }
         this->pExpireTmr = 0;
 
-        if ( this->timerList.first () ) {
-            if ( currentTime >= this->timerList.first ()->exp ) {
-                this->pExpireTmr = this->timerList.first ();
-                this->timerList.remove ( *this->pExpireTmr ); 
+        if ( this->heap.first () ) {
+            if ( currentTime >= this->heap.first ()->exp ) {
+                this->pExpireTmr = this->heap.first ();
+                this->heap.remove ( *this->pExpireTmr ); 
                 this->pExpireTmr->curState = timer::stateActive;
 #               ifdef DEBUG
                     this->pExpireTmr->show ( 0u );
 #               endif 
             }
             else {
-                delay = this->timerList.first ()->exp - currentTime;
+                delay = this->heap.first ()->exp - currentTime;
                 this->processThread = 0;
                 break;
             }
@@ -215,12 +215,11 @@ epicsTimerForC & timerQueue::createTimerForC ( epicsTimerCallback pCallback, voi
 void timerQueue::show ( unsigned level ) const
 {
     epicsGuard < epicsMutex > locker ( this->mutex );
-    printf ( "epicsTimerQueue with %u items pending\n", this->timerList.count () );
+    printf ( "epicsTimerQueue with %u items pending\n", this->heap.count () );
     if ( level >= 1u ) {
-        tsDLIterConst < timer > iter = this->timerList.firstIter ();
-        while ( iter.valid () ) {   
-            iter->show ( level - 1u );
-            ++iter;
+        // heap order, not expiration order
+        for ( unsigned i = 0u; i < this->heap.count (); i++ ) {
+            this->heap[i].show ( level - 1u );
         }
     }
 }
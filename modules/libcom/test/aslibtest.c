@@ -143,12 +143,98 @@ static void testUseIP(void)
     testAccess("rw", 0);
 }
 
+static const char cache_config[] = ""
+        "UAG(ops) {alice, bob}\n"
+        "ASG(DEFAULT) {RULE(1, READ)}\n"
+        "ASG(lvl) {RULE(0, WRITE) {UAG(ops)} RULE(1, READ)}\n"
+        "ASG(calc) {INPA(\"x\") RULE(1, READ)"
+        " RULE(1, WRITE) {UAG(ops) CALC(\"A=1\")}}\n"
+        ;
+
+static int nCallbacks;
+
+static void countCallback(ASCLIENTPVT client, asClientStatus status)
+{
+    nCallbacks++;
+}
+
+static unsigned clientAccess(ASCLIENTPVT client)
+{
+    return (asCheckGet(client) ? 1 : 0) | (asCheckPut(client) ? 2 : 0);
+}
+
+static void testCache(void)
+{
+    ASMEMBERPVT asp = 0;
+    ASCLIENTPVT client = 0;
+    ASG *pasg;
+    int n;
+
+    testDiag("testCache()");
+    asCheckClientIP = 0;
+
+    testOk1(asInitMem(cache_config, NULL)==0);
+
+    setUser("alice");
+    setHost("localhost");
+
+    /* the same client twice, the second from the cache */
+    asAsl = 0;
+    testAccess("lvl", 3);
+    testAccess("lvl", 3);
+    asAsl = 1;
+    testAccess("lvl", 1);
+    asAsl = 0;
+    testAccess("lvl", 3);
+    setUser("carol");
+    testAccess("lvl", 1);
+    setUser("alice");
+
+    testOk1(asAddMember(&asp, "calc")==0);
+    testOk1(asAddClient(&client, asp, 1, asUser, asHost)==0);
+    testOk1(asRegisterClientCallback(client, countCallback)==0);
+    pasg = client->pasgMember->pasg;
+    testOk(clientAccess(client)==1, "READ until the input is read");
+    testAccess("calc", 1);
+
+    /* what asCa does when INPA changes */
+    n = nCallbacks;
+    pasg->pavalue[0] = 1.0;
+    pasg->inpChanged |= 1;
+    asComputeAsg(pasg);
+    testOk(clientAccess(client)==3, "WRITE once A=1");
+    testOk(nCallbacks==n+1, "Client was told");
+    testAccess("calc", 3);
+
+    n = nCallbacks;
+    pasg->inpChanged |= 1;
+    asComputeAsg(pasg);
+    testOk(nCallbacks==n, "No callback when no rule changed");
+
+    pasg->inpBad |= 1;
+    asComputeAsg(pasg);
+    testOk(clientAccess(client)==1, "READ once A is bad");
+    testOk(nCallbacks==n+1, "Client was told");
+    testAccess("calc", 1);
+
+    /* a new configuration starts without the input */
+    pasg->inpBad = 0;
+    asComputeAsg(pasg);
+    testOk1(clientAccess(client)==3);
+    testOk1(asInitMem(cache_config, NULL)==0);
+    testOk(clientAccess(client)==1, "READ after reloading");
+
+    asRemoveClient(&client);
+    asRemoveMember(&asp);
+}
+
 MAIN(aslibtest)
 {
-    testPlan(27);
+    testPlan(48);
     testSyntaxErrors();
     testHostNames();
     testUseIP();
+    testCache();
     errlogFlush();
     return testDone();
 }
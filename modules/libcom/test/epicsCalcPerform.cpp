@@ -0,0 +1,124 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ * Time the calc engines. Not run by "make runtests".
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "epicsUnitTest.h"
+#include "epicsTypes.h"
+#include "epicsTime.h"
+#include "postfix.h"
+#include "testMain.h"
+
+/* Time calcPerform() against calcPerformCompiled() */
+
+static void benchCalc(const char *expr) {
+    const int nloops = 100000;
+    double args[CALCPERFORM_NARGS] = {
+        1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0
+    };
+    char *rpn = (char*)malloc(INFIX_TO_POSTFIX_SIZE(strlen(expr)+1));
+    calcCompiled *pcomp;
+    epicsTimeStamp start, mid, stop;
+    double result = 0.0;
+    short err;
+    int n;
+
+    if (!rpn || postfix(expr, rpn, &err) || !(pcomp = calcCompile(rpn))) {
+        testDiag("benchCalc: can't compile '%s'", expr);
+        free(rpn);
+        return;
+    }
+
+    epicsTimeGetCurrent(&start);
+    for (n = 0; n < nloops; n++)
+        calcPerform(args, &result, rpn);
+    epicsTimeGetCurrent(&mid);
+    for (n = 0; n < nloops; n++)
+        calcPerformCompiled(pcomp, args, &result);
+    epicsTimeGetCurrent(&stop);
+
+    testDiag("%-28s %7.1f ns calcPerform, %7.1f ns compiled", expr,
+             epicsTimeDiffInSeconds(&mid, &start) * 1e9 / nloops,
+             epicsTimeDiffInSeconds(&stop, &mid) * 1e9 / nloops);
+    calcFreeCompiled(pcomp);
+    free(rpn);
+}
+
+/* Time calcArrayPerform() against calcPerformCompiled() per element */
+
+static void benchArrayCalc(const char *expr) {
+    const int nloops = 20;
+    const epicsUInt32 nelem = 100000;
+    double *a = (double*)calloc(nelem, sizeof(double));
+    double *b = (double*)calloc(nelem, sizeof(double));
+    double *result = (double*)calloc(nelem, sizeof(double));
+    const double *parg[CALCPERFORM_NARGS] = {a, b};
+    epicsUInt32 pnelem[CALCPERFORM_NARGS] = {nelem, nelem};
+    char *rpn = (char*)malloc(INFIX_TO_POSTFIX_SIZE(strlen(expr)+1));
+    calcCompiled *pcomp;
+    epicsTimeStamp start, mid, stop;
+    short err;
+    int n;
+
+    if (!a || !b || !result || !rpn || postfix(expr, rpn, &err) ||
+        !(pcomp = calcCompile(rpn))) {
+        testDiag("benchArrayCalc: can't compile '%s'", expr);
+        goto done;
+    }
+    for (epicsUInt32 i = 0; i < nelem; i++) {
+        a[i] = i;
+        b[i] = i % 13;
+    }
+
+    epicsTimeGetCurrent(&start);
+    for (n = 0; n < nloops; n++) {
+        for (epicsUInt32 i = 0; i < nelem; i++) {
+            double args[CALCPERFORM_NARGS] = {a[i], b[i]};
+            calcPerformCompiled(pcomp, args, &result[i]);
+        }
+    }
+    epicsTimeGetCurrent(&mid);
+    for (n = 0; n < nloops; n++) {
+        epicsUInt32 nres = nelem;
+        calcArrayPerform(pcomp, parg, pnelem, result, &nres);
+    }
+    epicsTimeGetCurrent(&stop);
+
+    testDiag("%-28s %7.2f ns/element scalar, %7.2f ns/element array", expr,
+             epicsTimeDiffInSeconds(&mid, &start) * 1e9 / nloops / nelem,
+             epicsTimeDiffInSeconds(&stop, &mid) * 1e9 / nloops / nelem);
+    calcFreeCompiled(pcomp);
+done:
+    free(rpn);
+    free(result);
+    free(b);
+    free(a);
+}
+
+MAIN(epicsCalcPerform)
+{
+    testPlan(0);
+
+    benchCalc("A+B");
+    benchCalc("(A+B)/2");
+    benchCalc("A*B+C*D-E");
+    benchCalc("A>B?C:D");
+    benchCalc("ABS(A-B)<0.5?1:0");
+    benchCalc("SQRT(A*A+B*B)");
+    benchCalc("(A+1)*2*PI/360");
+    benchCalc("MAX(A,B,C)+MIN(D,E)");
+    benchCalc("C:=A+B;C>5?C*2:C/2");
+
+    benchArrayCalc("A+B");
+    benchArrayCalc("A*B+A/2");
+    benchArrayCalc("A>B?A-B:B-A");
+    benchArrayCalc("SQRT(A*A+B*B)");
+
+    return testDone();
+}
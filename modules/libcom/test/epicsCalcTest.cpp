@@ -43,6 +43,38 @@ double doCalc(const char *expr) {
     return result;
 }
 
+bool compiledMatches(const char *expr, const char *rpn, long status,
+    double result) {
+    /* Evaluate compiled form, check it gives an identical result */
+    double args[CALCPERFORM_NARGS] = {
+        1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0
+    };
+    calcCompiled *pcomp = calcCompile(rpn);
+    double cresult = 0.0;
+    long cstatus;
+    bool same;
+    cresult /= cresult;  /* Start as NaN */
+
+    if (!pcomp) {
+        testDiag("calcCompile: failed to compile '%s'", expr);
+        return false;
+    }
+    cstatus = calcPerformCompiled(pcomp, args, &cresult);
+    calcFreeCompiled(pcomp);
+
+    if (isnan(result))
+        same = (bool) isnan(cresult);
+    else
+        same = memcmp(&result, &cresult, sizeof(double)) == 0;
+    if (!same || (status != 0) != (cstatus != 0)) {
+        testDiag("calcPerformCompiled: '%s' gave %.17g (status %ld), "
+                 "calcPerform gave %.17g (status %ld)",
+                 expr, cresult, cstatus, result, status);
+        return false;
+    }
+    return true;
+}
+
 void testCalc(const char *expr, double expected) {
     /* Evaluate expression, test against expected result */
     bool pass = false;
@@ -51,6 +83,8 @@ void testCalc(const char *expr, double expected) {
     };
     char *rpn = (char*)malloc(INFIX_TO_POSTFIX_SIZE(strlen(expr)+1));
     short err;
+    long status;
+    bool compiled = false;
     double result = 0.0;
     result /= result;  /* Start as NaN */
 
@@ -61,10 +95,13 @@ void testCalc(const char *expr, double expected) {
 
     if (postfix(expr, rpn, &err)) {
         testDiag("postfix: %s in expression '%s'", calcErrorStr(err), expr);
-    } else
-        if (calcPerform(args, &result, rpn) && finite(result)) {
+    } else {
+        status = calcPerform(args, &result, rpn);
+        if (status && finite(result)) {
             testDiag("calcPerform: error evaluating '%s'", expr);
         }
+        compiled = compiledMatches(expr, rpn, status, result);
+    }
 
     if (finite(expected) && finite(result)) {
         pass = fabs(expected - result) < 1e-8;
@@ -73,7 +110,7 @@ void testCalc(const char *expr, double expected) {
     } else {
         pass = (result == expected);
     }
-    if (!testOk(pass, "%s", expr)) {
+    if (!testOk(pass && compiled, "%s", expr)) {
         testDiag("Expected result is %g, actually got %g", expected, result);
         calcExprDump(rpn);
     }
@@ -88,6 +125,8 @@ void testUInt32Calc(const char *expr, epicsUInt32 expected) {
     };
     char *rpn = (char*)malloc(INFIX_TO_POSTFIX_SIZE(strlen(expr)+1));
     short err;
+    long status;
+    bool compiled = false;
     epicsUInt32 uresult;
     double result = 0.0;
     result /= result;  /* Start as NaN */
@@ -99,14 +138,17 @@ void testUInt32Calc(const char *expr, epicsUInt32 expected) {
 
     if (postfix(expr, rpn, &err)) {
         testDiag("postfix: %s in expression '%s'", calcErrorStr(err), expr);
-    } else
-        if (calcPerform(args, &result, rpn) && finite(result)) {
+    } else {
+        status = calcPerform(args, &result, rpn);
+        if (status && finite(result)) {
             testDiag("calcPerform: error evaluating '%s'", expr);
         }
+        compiled = compiledMatches(expr, rpn, status, result);
+    }
 
     uresult = (epicsUInt32) result;
     pass = (uresult == expected);
-    if (!testOk(pass, "%s", expr)) {
+    if (!testOk(pass && compiled, "%s", expr)) {
         testDiag("Expected result is 0x%x (%u), actually got 0x%x (%u)",
                  expected, expected, uresult, uresult);
         calcExprDump(rpn);
@@ -157,6 +199,92 @@ void testBadExpr(const char *expr, short expected_err) {
     free(rpn);
 }
 
+/* Array arguments: A counts up from 1, B is the scalar 2, C counts down
+ * to 1 and D is shorter than the others.
+ */
+#define ARRAY_NELEM 5000
+
+static double arrA[ARRAY_NELEM], arrB[1], arrC[ARRAY_NELEM], arrD[ARRAY_NELEM];
+static const double * const arrArgs[CALCPERFORM_NARGS] = {
+    arrA, arrB, arrC, arrD
+};
+static const epicsUInt32 arrNelem[CALCPERFORM_NARGS] = {
+    ARRAY_NELEM, 1, ARRAY_NELEM, ARRAY_NELEM - 10
+};
+
+void initArrayArgs(void) {
+    for (int i = 0; i < ARRAY_NELEM; i++) {
+        arrA[i] = i + 1;
+        arrC[i] = ARRAY_NELEM - i;
+        arrD[i] = i % 7 - 3;
+    }
+    arrB[0] = 2.0;
+}
+
+double *arrayCalc(const char *expr, epicsUInt32 *pnres, char *rpn) {
+    /* Evaluate expression over the array arguments */
+    static double result[ARRAY_NELEM];
+    calcCompiled *pcomp;
+    short err;
+
+    *pnres = ARRAY_NELEM;
+    if (postfix(expr, rpn, &err)) {
+        testDiag("postfix: %s in expression '%s'", calcErrorStr(err), expr);
+        return NULL;
+    }
+    pcomp = calcCompile(rpn);
+    memset(result, 0, sizeof(result));
+    if (!pcomp || calcArrayPerform(pcomp, arrArgs, arrNelem, result, pnres)) {
+        testDiag("calcArrayPerform: error evaluating '%s'", expr);
+        calcFreeCompiled(pcomp);
+        return NULL;
+    }
+    calcFreeCompiled(pcomp);
+    return result;
+}
+
+void testArrayCalc(const char *expr, epicsUInt32 nexpected) {
+    /* Evaluate expression, compare each element with calcPerform() */
+    char *rpn = (char*)malloc(INFIX_TO_POSTFIX_SIZE(strlen(expr)+1));
+    epicsUInt32 nres, i;
+    double *result = arrayCalc(expr, &nres, rpn);
+    bool pass = result && nres == nexpected;
+
+    for (i = 0; pass && i < nres; i++) {
+        double args[CALCPERFORM_NARGS] = {0};
+        double expected = 0.0;
+
+        for (int j = 0; j < CALCPERFORM_NARGS; j++) {
+            if (arrArgs[j])
+                args[j] = arrNelem[j] == 1 ? arrArgs[j][0] : arrArgs[j][i];
+        }
+        calcPerform(args, &expected, rpn);
+        pass = isnan(expected) ? isnan(result[i]) : result[i] == expected;
+        if (!pass)
+            testDiag("Element %u is %g, calcPerform gives %g",
+                     i, result[i], expected);
+    }
+    if (!testOk(pass, "Array %s", expr) && result && nres != nexpected)
+        testDiag("Expected %u results, got %u", nexpected, nres);
+    free(rpn);
+}
+
+void testArrayReduce(const char *expr, double expected) {
+    /* Evaluate expression with a reduction, every element should match */
+    char *rpn = (char*)malloc(INFIX_TO_POSTFIX_SIZE(strlen(expr)+1));
+    epicsUInt32 nres, i;
+    double *result = arrayCalc(expr, &nres, rpn);
+    bool pass = result && nres > 0;
+
+    for (i = 0; pass && i < nres; i++)
+        pass = isnan(expected) ? isnan(result[i]) :
+            fabs(result[i] - expected) < 1e-8;
+    if (!testOk(pass, "Array %s", expr) && result && nres)
+        testDiag("Expected %g, element %u is %g", expected, i - 1,
+                 result[i - 1]);
+    free(rpn);
+}
+
 /* Test an expression that is also valid C code */
 #define testExpr(expr) testCalc(#expr, expr);
 
@@ -297,7 +425,7 @@ MAIN(epicsCalcTest)
     const double a=1.0, b=2.0, c=3.0, d=4.0, e=5.0, f=6.0,
 		 g=7.0, h=8.0, i=9.0, j=10.0, k=11.0, l=12.0;
     
-    testPlan(613);
+    testPlan(643);
 
     /* LITERAL_OPERAND elements */
     testExpr(0);
@@ -810,6 +938,13 @@ MAIN(epicsCalcTest)
     testExpr(0 ? 2 : 1 ? 3 : 4);
     testExpr(1 ? 2 : 0 ? 3 : 4);
     testExpr(1 ? 2 : 1 ? 3 : 4);
+    testExpr(a < b ? c + 1 : d * 2);
+    testExpr(a > b ? c + 1 : d * 2);
+    testExpr(b ? c ? a + b : d : e);
+    testExpr((a > b ? c : d) - e / f);
+    testExpr(-(a + 2 * PI) + b);
+    testCalc("c:=a>b?a-b:b-a; c*c", 1);
+    testCalc("a:=b+1; a*a+a", 12);
     
     /* STORE_OPERATOR and EXPR_TERM elements*/
     testCalc("a := 0; a", 0);
@@ -987,6 +1122,32 @@ MAIN(epicsCalcTest)
     testUInt32Calc("-1431655766.1 << 0.1", 0xaaaaaaaau);
     testUInt32Calc("2863311530.1 << 0.1", 0xaaaaaaaau);
 
+    /* Array expressions */
+    initArrayArgs();
+    testArrayCalc("A", ARRAY_NELEM);
+    testArrayCalc("B", 1);
+    testArrayCalc("B*3+PI", 1);
+    testArrayCalc("A*B+1", ARRAY_NELEM);
+    testArrayCalc("A-C", ARRAY_NELEM);
+    testArrayCalc("A+D", ARRAY_NELEM - 10);
+    testArrayCalc("-A/C+ABS(D)", ARRAY_NELEM - 10);
+    testArrayCalc("SQRT(A)*SIN(C)", ARRAY_NELEM);
+    testArrayCalc("MAX(A,C,2500)", ARRAY_NELEM);
+    testArrayCalc("A>C?A:C", ARRAY_NELEM);
+    testArrayCalc("A>C?D<0?1:D:B", ARRAY_NELEM - 10);
+    testArrayCalc("D?A%7?A:-A:C", ARRAY_NELEM - 10);
+    testArrayCalc("E:=A*B;F:=E>100?E:0;E+F+VAL", ARRAY_NELEM);
+    testArrayCalc("A AND 0xff | D << 2", ARRAY_NELEM - 10);
+    testArrayReduce("SUM(A)", ARRAY_NELEM * (ARRAY_NELEM + 1) / 2.0);
+    testArrayReduce("AVG(A)", (ARRAY_NELEM + 1) / 2.0);
+    testArrayReduce("AMAX(C-A)", ARRAY_NELEM - 1);
+    testArrayReduce("AMIN(D)", -3);
+    testArrayReduce("SUM(B)", 2);
+    testArrayReduce("SUM(A*0+B)", 2 * ARRAY_NELEM);
+    testArrayReduce("SUM(A-AVG(A))", 0);
+    testArrayReduce("AMAX(A>10?NaN:A)", epicsNAN);
+    testArrayReduce("SUM(A>C?1:0)", ARRAY_NELEM / 2);
+
     return testDone();
 }
 
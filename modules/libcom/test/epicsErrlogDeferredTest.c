@@ -0,0 +1,313 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ * Tests for errlog's deferred mode
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+#include "epicsThread.h"
+#include "epicsEvent.h"
+#include "epicsMutex.h"
+#include "epicsStdio.h"
+#include "errlog.h"
+#include "asLib.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NMESSAGES 16
+#define NTHREADS 4
+#define NPERTHREAD 2000
+
+typedef struct {
+    epicsMutexId lock;
+    epicsEventId jammer;
+    int jam;
+    unsigned count;
+    char last[256];
+    /* the stress test */
+    int check;
+    int next[NTHREADS];
+    unsigned outOfOrder;
+    unsigned reports;
+    unsigned discarded;
+} listenerPvt;
+
+static listenerPvt pvt;
+
+static void listener(void *raw, const char *msg)
+{
+    listenerPvt *ppvt = raw;
+    int thread, seq;
+    unsigned long n;
+
+    if (ppvt->jam) {
+        ppvt->jam = 0;
+        epicsEventMustWait(ppvt->jammer);
+    }
+
+    epicsMutexMustLock(ppvt->lock);
+    ppvt->count++;
+    strncpy(ppvt->last, msg, sizeof(ppvt->last) - 1);
+    if (ppvt->check) {
+        if (sscanf(msg, "thread %d message %d", &thread, &seq) == 2 &&
+            thread >= 0 && thread < NTHREADS) {
+            if (seq < ppvt->next[thread])
+                ppvt->outOfOrder++;
+            ppvt->next[thread] = seq + 1;
+        }
+        else if (sscanf(msg, "errlog: %lu messages were discarded", &n) == 1) {
+            ppvt->reports++;
+            ppvt->discarded += n;
+        }
+    }
+    epicsMutexUnlock(ppvt->lock);
+}
+
+static void checkMessage(const char *expect, const char *what)
+{
+    errlogFlush();
+    epicsMutexMustLock(pvt.lock);
+    if (!testOk(strcmp(pvt.last, expect) == 0, "%s", what)) {
+        testDiag("Expected \"%s\"", expect);
+        testDiag("Received \"%s\"", pvt.last);
+    }
+    epicsMutexUnlock(pvt.lock);
+}
+
+/* log through errlog, and format locally for the expected message */
+static void checkFormat(const char *pformat, ...)
+{
+    char expect[256];
+    va_list pvar;
+
+    va_start(pvar, pformat);
+    epicsVsnprintf(expect, sizeof(expect), pformat, pvar);
+    va_end(pvar);
+
+    va_start(pvar, pformat);
+    errlogVprintfNoConsole(pformat, pvar);
+    va_end(pvar);
+
+    checkMessage(expect, pformat);
+}
+
+static void testFormats(void)
+{
+    errlogDeferredStats before, after;
+    int x = 1;
+
+    testDiag("Check deferred formatting");
+
+    errlogGetDeferredStats(&before);
+
+    checkFormat("Plain text");
+    checkFormat("%d %i %u %x %X %o|%5d|%-5d", -1, 42, 7u, 255u,
+        255u, 8u, 3, 4);
+    checkFormat("%hd %hhu %c%c", (short) -3, (unsigned char) 250, 'o', 'k');
+    checkFormat("%ld %lu %lld %llu %zu %td", -100000L, 100000UL,
+        -10000000000LL, 10000000000ULL, sizeof(x), (ptrdiff_t) -2);
+    checkFormat("%f %5.2f|%-10.3e|%g %G %lf", 1.5, 3.14159, 12345.678,
+        0.0001, 1e20, 2.5);
+    checkFormat("%s and %.3s and %10s|%-10s|", "first", "second",
+        "third", "fourth");
+    checkFormat("%*d|%-*.*f|%.*s|", 6, 42, 9, 2, 2.71828, 4, "truncated");
+    checkFormat("%p", (void *) &x);
+    checkFormat("100%% of %d%%", 50);
+    checkFormat("%s", "");
+
+    errlogGetDeferredStats(&after);
+    testOk(after.formatted - before.formatted == 10,
+        "10 messages formatted by errlog (%lu)",
+        (unsigned long) (after.formatted - before.formatted));
+    testOk(after.preformatted == before.preformatted,
+        "None formatted by the caller");
+}
+
+static void testFallback(void)
+{
+    errlogDeferredStats before, after;
+    long double value = 1.25;
+    char expect[256];
+
+    testDiag("Check formats which the caller formats");
+
+    errlogGetDeferredStats(&before);
+
+    checkFormat("%Lf", value);
+    checkFormat("%2$d %1$d", 1, 2);
+
+    errPrintf(S_asLib_badConfig, NULL, 0, "errPrintf %d", 3);
+    errSymLookup(S_asLib_badConfig, expect, sizeof(expect));
+    strcat(expect, " errPrintf 3\n");
+    checkMessage(expect, "errPrintf()");
+
+    errlogGetDeferredStats(&after);
+    testOk(after.preformatted - before.preformatted == 3,
+        "3 messages formatted by the caller (%lu)",
+        (unsigned long) (after.preformatted - before.preformatted));
+}
+
+static void testSeverity(void)
+{
+    testDiag("Check severity messages");
+
+    errlogSevPrintf(errlogMinor, "value %d", 5);
+    checkMessage("sevr=minor value 5\n", "errlogSevPrintf() adds a newline");
+
+    errlogSevPrintf(errlogMajor, "%s\n", "done");
+    checkMessage("sevr=major done\n", "errlogSevPrintf() with a newline");
+}
+
+static void testTruncation(void)
+{
+    static const char tmsg[] = "<<TRUNCATED>>\n";
+    char longmsg[400];
+    char expect[256];
+
+    testDiag("Check truncation");
+
+    memset(longmsg, 'x', sizeof(longmsg) - 1);
+    longmsg[sizeof(longmsg) - 1] = '\0';
+
+    memset(expect, 'x', 255 - strlen(tmsg));
+    strcpy(expect + 255 - strlen(tmsg), tmsg);
+
+    errlogPrintfNoConsole("%s", longmsg);
+    checkMessage(expect, "Long string argument");
+
+    longmsg[300] = '\0';
+    errlogPrintfNoConsole("%d%s", 1, longmsg);
+    expect[0] = '1';
+    checkMessage(expect, "Long formatted message");
+
+    /* no room is left for the later strings */
+    expect[0] = 'x';
+    errlogPrintfNoConsole("%.250s|%s\n", longmsg, "tail");
+    checkMessage(expect, "Second string after a long one");
+
+    errlogPrintfNoConsole("%s%s%s", longmsg, "a", "b");
+    checkMessage(expect, "Further strings after a long one");
+}
+
+static void testDrops(void)
+{
+    errlogDeferredStats before, after;
+    char expect[64];
+    int i;
+
+    testDiag("Check that a full ring drops messages");
+
+    errlogGetDeferredStats(&before);
+    pvt.count = 0;
+
+    /* stall errlogThread in the listener while it holds one message */
+    pvt.jam = 1;
+    errlogPrintfNoConsole("jam");
+    epicsThreadSleep(0.5);
+
+    for (i = 0; i < NMESSAGES + 4; i++)
+        errlogPrintfNoConsole("message %d", i);
+
+    errlogGetDeferredStats(&after);
+    testOk(after.used == NMESSAGES - 1, "%d messages queued", after.used);
+    testOk(after.dropped - before.dropped == 5, "5 messages dropped (%lu)",
+        (unsigned long) (after.dropped - before.dropped));
+    testOk(after.highWaterMark >= NMESSAGES - 1, "High water mark %d",
+        after.highWaterMark);
+
+    epicsEventSignal(pvt.jammer);
+    errlogFlush();
+    testOk(pvt.count == NMESSAGES + 1, "Received %u messages", pvt.count);
+
+    sprintf(expect, "message %d", NMESSAGES - 2);
+    checkMessage(expect, "Last queued message received last");
+}
+
+static void logThread(void *arg)
+{
+    int thread = (int) (size_t) arg;
+    int i;
+
+    for (i = 0; i < NPERTHREAD; i++) {
+        errlogPrintfNoConsole("thread %d message %d", thread, i);
+        if (i % 100 == 0)
+            epicsThreadSleep(0.001);
+    }
+}
+
+static void testStress(void)
+{
+    epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    errlogDeferredStats before, after;
+    epicsThreadId tid[NTHREADS];
+    unsigned long dropped;
+    int i;
+
+    testDiag("Log from %d threads at once", NTHREADS);
+
+    errlogGetDeferredStats(&before);
+    pvt.count = 0;
+    pvt.check = 1;
+
+    opts.joinable = 1;
+    for (i = 0; i < NTHREADS; i++)
+        tid[i] = epicsThreadCreateOpt("logger", logThread,
+            (void *) (size_t) i, &opts);
+    for (i = 0; i < NTHREADS; i++)
+        epicsThreadMustJoin(tid[i]);
+
+    /* a final message to report the last drops */
+    errlogPrintfNoConsole("done");
+    errlogFlush();
+
+    errlogGetDeferredStats(&after);
+    dropped = (unsigned long) (after.dropped - before.dropped);
+    testDiag("%u received, %lu dropped", pvt.count, dropped);
+
+    epicsMutexMustLock(pvt.lock);
+    testOk(pvt.outOfOrder == 0, "Each thread's messages are in order");
+    /* less the drop reports and the final message */
+    testOk(pvt.count - pvt.reports - 1 + dropped == NTHREADS * NPERTHREAD,
+        "Received and dropped messages add up");
+    testOk(pvt.discarded == dropped, "Drops were reported (%u)",
+        pvt.discarded);
+    pvt.check = 0;
+    epicsMutexUnlock(pvt.lock);
+}
+
+MAIN(epicsErrlogDeferredTest)
+{
+    errlogDeferredStats stats;
+
+    testPlan(33);
+
+    pvt.lock = epicsMutexMustCreate();
+    pvt.jammer = epicsEventMustCreate(epicsEventEmpty);
+
+    errlogInit2(2048, 256);
+    eltc(0);
+    errlogAddListener(listener, &pvt);
+
+    testOk(errlogGetDeferredStats(&stats) == -1, "Deferred mode is off");
+    testOk(errlogInitDeferred(NMESSAGES) == 0, "errlogInitDeferred()");
+    errlogGetDeferredStats(&stats);
+    testOk(stats.size == NMESSAGES, "Ring holds %d messages", stats.size);
+
+    testFormats();
+    testFallback();
+    testSeverity();
+    testTruncation();
+    testDrops();
+    testStress();
+
+    errlogRemoveListeners(listener, &pvt);
+    eltc(1);
+
+    return testDone();
+}
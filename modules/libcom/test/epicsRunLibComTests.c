@@ -24,6 +24,7 @@ int epicsCalcTest(void);
 int epicsEllTest(void);
 int epicsEnvTest(void);
 int epicsErrlogTest(void);
+int epicsErrlogDeferredTest(void);
 int epicsEventTest(void);
 int epicsExitTest(void);
 int epicsMathTest(void);
@@ -32,6 +33,7 @@ int epicsMMIOTest(void);
 int epicsMutexTest(void);
 int epicsSockResolveTest(void);
 int epicsSpinTest(void);
+int epicsSharedMemoryTest(void);
 int epicsStackTraceTest(void);
 int epicsStdioTest(void);
 int epicsStdlibTest(void);
@@ -53,8 +55,11 @@ int ipAddrToAsciiTest(void);
 int macDefExpandTest(void);
 int macLibTest(void);
 int osiSockTest(void);
+int fdManagerTest(void);
 int ringBytesTest(void);
+int freeListTest(void);
 int ringPointerTest(void);
+int ringMPMCTest(void);
 int taskwdTest(void);
 
 void epicsRunLibComTests(void)
@@ -82,6 +87,7 @@ void epicsRunLibComTests(void)
     runTest(epicsEllTest);
     runTest(epicsEnvTest);
     runTest(epicsErrlogTest);
+    runTest(epicsErrlogDeferredTest);
     runTest(epicsEventTest);
     runTest(epicsInlineTest);
     runTest(epicsMathTest);
@@ -90,6 +96,7 @@ void epicsRunLibComTests(void)
     runTest(epicsMutexTest);
     runTest(epicsSockResolveTest);
     runTest(epicsSpinTest);
+    runTest(epicsSharedMemoryTest);
     runTest(epicsStackTraceTest);
     runTest(epicsStdioTest);
     runTest(epicsStdlibTest);
@@ -108,8 +115,11 @@ void epicsRunLibComTests(void)
     runTest(macDefExpandTest);
     runTest(macLibTest);
     runTest(osiSockTest);
+    runTest(fdManagerTest);
     runTest(ringBytesTest);
+    runTest(freeListTest);
     runTest(ringPointerTest);
+    runTest(ringMPMCTest);
     runTest(taskwdTest);
 
     /*
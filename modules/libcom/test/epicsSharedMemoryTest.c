@@ -0,0 +1,63 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/* epicsSharedMemoryTest.c */
+
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "epicsSharedMemory.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define SEGSIZE 65536
+
+MAIN(epicsSharedMemoryTest)
+{
+    char name[EPICS_SHARED_MEMORY_NAME_SIZE];
+    epicsSharedMemoryId creator, opener;
+    char *pc, *po;
+
+    testPlan(9);
+
+    sprintf(name, "/epicsShmTest.%p", (void *) &creator);
+
+    creator = epicsSharedMemoryCreate(name, SEGSIZE);
+    if (!creator) {
+        testSkip(9, "Named shared memory not supported");
+        return testDone();
+    }
+    testOk1(epicsSharedMemorySize(creator) == SEGSIZE);
+    pc = epicsSharedMemoryAddress(creator);
+    testOk(pc[0] == 0 && pc[SEGSIZE - 1] == 0, "New segment is zero filled");
+
+    testOk(epicsSharedMemoryCreate(name, SEGSIZE) == NULL,
+        "Creating an existing name fails");
+
+    opener = epicsSharedMemoryOpen(name);
+    testOk(opener != NULL, "Opened segment by name");
+    if (!opener) {
+        testSkip(5, "Open failed");
+        epicsSharedMemoryDestroy(creator);
+        return testDone();
+    }
+    testOk1(epicsSharedMemorySize(opener) == SEGSIZE);
+    po = epicsSharedMemoryAddress(opener);
+
+    strcpy(pc, "creator");
+    strcpy(po + SEGSIZE / 2, "opener");
+    testOk(strcmp(po, "creator") == 0, "Opener sees creator's writes");
+    testOk(strcmp(pc + SEGSIZE / 2, "opener") == 0,
+        "Creator sees opener's writes");
+
+    epicsSharedMemoryUnlink(creator);
+    testOk(epicsSharedMemoryOpen(name) == NULL,
+        "Unlinked name can't be opened");
+    testOk(strcmp(po, "creator") == 0, "Mappings survive unlink");
+
+    epicsSharedMemoryDestroy(opener);
+    epicsSharedMemoryDestroy(creator);
+    return testDone();
+}
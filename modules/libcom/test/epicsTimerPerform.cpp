@@ -0,0 +1,136 @@
+/*************************************************************************\
+* Copyright (c) 2019 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+//
+// Cost of timer start, cancel, and expire with many pending timers
+//
+// Uses a passive queue so that expiration is driven from this thread,
+// and checks that the timers expire in time order, with timers having
+// the same expiration time expiring in the order they were started.
+//
+
+#include <stdio.h>
+#include <float.h>
+
+#include "epicsTimer.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NTIMERS 100000u
+
+class perfNotify : public epicsTimerNotify {
+public:
+    perfNotify () : pTimer ( 0 ), index ( 0u ) {}
+    expireStatus expire ( const epicsTime & currentTime );
+    epicsTimer * pTimer;
+    epicsTime exp;
+    unsigned index;
+};
+
+class perfQueueNotify : public epicsTimerQueueNotify {
+public:
+    void reschedule () {}
+    double quantum () { return 0.0; }
+};
+
+static perfNotify * expired[NTIMERS];
+static unsigned nExpired;
+
+epicsTimerNotify::expireStatus perfNotify::expire ( const epicsTime & )
+{
+    if ( nExpired < NTIMERS ) {
+        expired[nExpired] = this;
+    }
+    nExpired++;
+    return expireStatus ( noRestart );
+}
+
+static unsigned lcg ( unsigned & state )
+{
+    state = state * 1103515245u + 12345u;
+    return state >> 8u;
+}
+
+static void report ( const char * pOp, const epicsTime & start )
+{
+    double elapsed = epicsTime::getCurrent () - start;
+    testDiag ( "%-8s %u timers: %8.3f ms, %8.1f ns per timer",
+        pOp, NTIMERS, elapsed * 1e3, elapsed / NTIMERS * 1e9 );
+}
+
+MAIN(epicsTimerPerform)
+{
+    perfQueueNotify queueNotify;
+    epicsTimerQueuePassive & queue = epicsTimerQueuePassive::create ( queueNotify );
+    perfNotify * notify = new perfNotify [NTIMERS];
+    unsigned * order = new unsigned [NTIMERS];
+    epicsTime base = epicsTime::getCurrent ();
+    epicsTime start;
+    unsigned seed = 1u;
+    unsigned i;
+
+    testPlan ( 3 );
+
+    for ( i = 0u; i < NTIMERS; i++ ) {
+        notify[i].pTimer = & queue.createTimer ();
+        // few distinct expiration times so that many timers tie
+        notify[i].exp = base + 1.0 + ( lcg ( seed ) % 1000u ) * 1e-3;
+        order[i] = i;
+    }
+    // random order for cancel
+    for ( i = NTIMERS - 1u; i > 0u; i-- ) {
+        unsigned j = lcg ( seed ) % ( i + 1u );
+        unsigned tmp = order[i];
+        order[i] = order[j];
+        order[j] = tmp;
+    }
+
+    start = epicsTime::getCurrent ();
+    for ( i = 0u; i < NTIMERS; i++ ) {
+        notify[i].pTimer->start ( notify[i], notify[i].exp );
+    }
+    report ( "start", start );
+
+    start = epicsTime::getCurrent ();
+    for ( i = 0u; i < NTIMERS; i++ ) {
+        notify[order[i]].pTimer->cancel ();
+    }
+    report ( "cancel", start );
+
+    for ( i = 0u; i < NTIMERS; i++ ) {
+        notify[order[i]].index = i;
+        notify[order[i]].pTimer->start ( notify[order[i]], notify[order[i]].exp );
+    }
+
+    nExpired = 0u;
+    start = epicsTime::getCurrent ();
+    double delay = queue.process ( base + 10.0 );
+    report ( "expire", start );
+
+    testOk ( nExpired == NTIMERS, "%u of %u timers expired", nExpired, NTIMERS );
+    testOk1 ( delay == DBL_MAX );
+
+    bool inOrder = nExpired == NTIMERS;
+    for ( i = 1u; inOrder && i < NTIMERS; i++ ) {
+        const perfNotify & prev = * expired[i - 1u];
+        const perfNotify & cur = * expired[i];
+        if ( cur.exp < prev.exp ||
+                ( cur.exp == prev.exp && cur.index < prev.index ) ) {
+            testDiag ( "timer %u expired out of order", i );
+            inOrder = false;
+        }
+    }
+    testOk ( inOrder, "expired in time order, ties in start order" );
+
+    for ( i = 0u; i < NTIMERS; i++ ) {
+        notify[i].pTimer->destroy ();
+    }
+    delete [] order;
+    delete [] notify;
+    delete & queue;
+    return testDone ();
+}
@@ -0,0 +1,140 @@
+/*************************************************************************\
+* Copyright (c) 2019 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+//
+// Wakeup latency of fdManager::process() with many registered fds
+//
+// One UDP socket out of N registered for read receives a datagram,
+// and we measure the time for process() to dispatch its callBack()
+// with each reactor backend.
+//
+
+#include <cstdio>
+#include <cstring>
+
+#include "fdManager.h"
+#include "epicsTime.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+class benchReg : public fdReg {
+public:
+    benchReg ( const SOCKET fd, fdManager & mgr ) :
+        fdReg ( fd, fdrRead, false, mgr ), nCallBacks ( 0u ) {}
+    unsigned nCallBacks;
+private:
+    void callBack ();
+};
+
+void benchReg::callBack ()
+{
+    char buf[16];
+    recv ( this->getFD (), buf, sizeof ( buf ), 0 );
+    this->nCallBacks++;
+}
+
+static SOCKET createBoundSocket ( osiSockAddr & addr )
+{
+    SOCKET sock = epicsSocketCreate ( AF_INET, SOCK_DGRAM, 0 );
+    if ( sock == INVALID_SOCKET ) {
+        return sock;
+    }
+    memset ( &addr, 0, sizeof ( addr ) );
+    addr.ia.sin_family = AF_INET;
+    addr.ia.sin_addr.s_addr = htonl ( INADDR_LOOPBACK );
+    addr.ia.sin_port = 0;
+    osiSocklen_t len = sizeof ( addr.ia );
+    if ( bind ( sock, &addr.sa, sizeof ( addr.ia ) ) ||
+            getsockname ( sock, &addr.sa, &len ) ) {
+        epicsSocketDestroy ( sock );
+        return INVALID_SOCKET;
+    }
+    return sock;
+}
+
+static void runBench ( fdReactorType type, unsigned nfds, unsigned niter )
+{
+    fdManager mgr ( type );
+    SOCKET * socks = new SOCKET [nfds];
+    benchReg ** regs = new benchReg * [nfds];
+    osiSockAddr target;
+    unsigned nOpen = 0u, nRegs = 0u;
+    SOCKET sender = INVALID_SOCKET;
+
+    for ( ; nOpen < nfds; nOpen++ ) {
+        socks[nOpen] = createBoundSocket ( target );
+        if ( socks[nOpen] == INVALID_SOCKET ) {
+            break;
+        }
+    }
+    if ( nOpen < nfds ) {
+        testSkip ( 1, "unable to open enough sockets" );
+        goto done;
+    }
+    if ( type == fdmrSelect && ! FD_IN_FDSET ( socks[nfds-1] ) ) {
+        testSkip ( 1, "fd > FD_SETSIZE with select" );
+        goto done;
+    }
+
+    for ( ; nRegs < nfds; nRegs++ ) {
+        regs[nRegs] = new benchReg ( socks[nRegs], mgr );
+    }
+
+    sender = epicsSocketCreate ( AF_INET, SOCK_DGRAM, 0 );
+    if ( sender == INVALID_SOCKET ) {
+        testAbort ( "unable to create sender socket" );
+    }
+
+    {
+        // last socket has the highest fd, the worst case for select()
+        benchReg & active = *regs[nfds-1];
+        epicsTime start = epicsTime::getCurrent ();
+
+        for ( unsigned i = 0u; i < niter; i++ ) {
+            unsigned expect = active.nCallBacks + 1u;
+            char msg = 'x';
+            sendto ( sender, &msg, 1, 0, &target.sa, sizeof ( target.ia ) );
+            while ( active.nCallBacks < expect ) {
+                mgr.process ( 1.0 );
+            }
+        }
+
+        double elapsed = epicsTime::getCurrent () - start;
+        testOk ( active.nCallBacks == niter, "%s: %u wakeups", mgr.reactorName (),
+            active.nCallBacks );
+        testDiag ( "%-6s %6u fds: %8.2f us per wakeup",
+            mgr.reactorName (), nfds, elapsed / niter * 1e6 );
+    }
+
+done:
+    for ( unsigned i = 0u; i < nRegs; i++ ) {
+        delete regs[i];
+    }
+    for ( unsigned i = 0u; i < nOpen; i++ ) {
+        epicsSocketDestroy ( socks[i] );
+    }
+    if ( sender != INVALID_SOCKET ) {
+        epicsSocketDestroy ( sender );
+    }
+    delete [] regs;
+    delete [] socks;
+}
+
+MAIN(fdManagerPerform)
+{
+    static const unsigned nfds[] = { 10u, 1000u, 10000u };
+    static const fdReactorType types[] = { fdmrSelect, fdmrDefault };
+    const unsigned niter = 10000u;
+
+    testPlan ( 0 );
+    for ( unsigned i = 0u; i < sizeof ( nfds ) / sizeof ( nfds[0] ); i++ ) {
+        for ( unsigned j = 0u; j < sizeof ( types ) / sizeof ( types[0] ); j++ ) {
+            runBench ( types[j], nfds[i], niter );
+        }
+    }
+    return testDone ();
+}
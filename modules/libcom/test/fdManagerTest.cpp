@@ -0,0 +1,149 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+//
+// Run fdManager with each reactor backend and check which callBack()
+// methods are called for activity on a few sockets
+//
+
+#include <cstdio>
+#include <cstring>
+
+#include "fdManager.h"
+#include "epicsTime.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+class testReg : public fdReg {
+public:
+    testReg ( const SOCKET fd, const fdRegType type, fdManager & mgr ) :
+        fdReg ( fd, type, false, mgr ), nCallBacks ( 0u ) {}
+    unsigned nCallBacks;
+private:
+    void callBack ();
+};
+
+void testReg::callBack ()
+{
+    if ( this->getType () == fdrRead ) {
+        char buf[16];
+        recv ( this->getFD (), buf, sizeof ( buf ), 0 );
+    }
+    this->nCallBacks++;
+}
+
+static SOCKET createBoundSocket ( osiSockAddr & addr )
+{
+    SOCKET sock = epicsSocketCreate ( AF_INET, SOCK_DGRAM, 0 );
+    if ( sock == INVALID_SOCKET ) {
+        testAbort ( "Can't create a UDP socket" );
+    }
+    memset ( &addr, 0, sizeof ( addr ) );
+    addr.ia.sin_family = AF_INET;
+    addr.ia.sin_addr.s_addr = htonl ( INADDR_LOOPBACK );
+    addr.ia.sin_port = 0;
+    osiSocklen_t len = sizeof ( addr.ia );
+    if ( bind ( sock, &addr.sa, sizeof ( addr.ia ) ) ||
+            getsockname ( sock, &addr.sa, &len ) ) {
+        testAbort ( "Can't bind a UDP socket" );
+    }
+    return sock;
+}
+
+// how long process() waited, it returns early on fd activity
+static double timedProcess ( fdManager & mgr, double delay )
+{
+    epicsTime begin = epicsTime::getCurrent ();
+    mgr.process ( delay );
+    return epicsTime::getCurrent () - begin;
+}
+
+static void testReactor ( fdReactorType type, const char * name )
+{
+    fdManager mgr ( type );
+    osiSockAddr addr, peerAddr;
+    SOCKET sock = createBoundSocket ( addr );
+    SOCKET peer = createBoundSocket ( peerAddr );
+
+    testDiag ( "%s reactor", name );
+    testOk ( strcmp ( mgr.reactorName (), name ) == 0,
+        "fdManager uses the %s reactor", mgr.reactorName () );
+
+    testReg * pRead = new testReg ( sock, fdrRead, mgr );
+    testOk ( timedProcess ( mgr, 0.2 ) >= 0.15 && pRead->nCallBacks == 0u,
+        "An idle fd waits for the delay" );
+
+    sendto ( peer, "x", 1, 0, &addr.sa, sizeof ( addr.ia ) );
+    mgr.process ( 1.0 );
+    testOk ( pRead->nCallBacks == 1u,
+        "A datagram calls the read callBack (%u)", pRead->nCallBacks );
+    mgr.process ( 0.1 );
+    testOk ( pRead->nCallBacks == 1u,
+        "Once it is read there is no more activity" );
+
+    testReg * pWrite = new testReg ( sock, fdrWrite, mgr );
+    mgr.process ( 1.0 );
+    testOk ( pWrite->nCallBacks == 1u && pRead->nCallBacks == 1u,
+        "A writable fd calls only the write callBack" );
+
+    delete pWrite;
+    sendto ( peer, "y", 1, 0, &addr.sa, sizeof ( addr.ia ) );
+    mgr.process ( 1.0 );
+    testOk ( pRead->nCallBacks == 2u,
+        "The read interest is kept when the write interest is removed" );
+    testOk ( timedProcess ( mgr, 0.2 ) >= 0.15,
+        "There is no write activity after the write interest is removed" );
+
+    delete pRead;
+    epicsSocketDestroy ( peer );
+    epicsSocketDestroy ( sock );
+}
+
+//
+// A TCP socket which isn't connected reports a hangup
+//
+static void testHangup ( fdReactorType type, const char * name )
+{
+    fdManager mgr ( type );
+    SOCKET sock = epicsSocketCreate ( AF_INET, SOCK_STREAM, 0 );
+
+    if ( sock == INVALID_SOCKET ) {
+        testAbort ( "Can't create a TCP socket" );
+    }
+
+    testDiag ( "%s reactor with a hung up fd", name );
+
+    testReg * pExcept = new testReg ( sock, fdrException, mgr );
+    mgr.process ( 0.1 );
+    unsigned nCallBacks = pExcept->nCallBacks;
+    testOk ( nCallBacks <= 1u,
+        "Exception callBack called %u times", nCallBacks );
+
+    double waited = timedProcess ( mgr, 0.2 );
+    testOk ( waited >= 0.15 && pExcept->nCallBacks == nCallBacks,
+        "process() then waits for %.3f sec", waited );
+
+    delete pExcept;
+    epicsSocketDestroy ( sock );
+}
+
+MAIN(fdManagerTest)
+{
+    testPlan ( 18 );
+    osiSockAttach ();
+
+    testReactor ( fdmrSelect, "select" );
+    testHangup ( fdmrSelect, "select" );
+
+#if defined ( __linux__ )
+    testReactor ( fdmrEpoll, "epoll" );
+    testHangup ( fdmrEpoll, "epoll" );
+#else
+    testSkip ( 9, "epoll is only available on Linux" );
+#endif
+
+    osiSockRelease ();
+    return testDone ();
+}
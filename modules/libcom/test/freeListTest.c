@@ -0,0 +1,166 @@
+/*************************************************************************\
+* Copyright (c) 2019 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/* freeListTest.c */
+
+#include <string.h>
+
+#include "freeList.h"
+#include "epicsEvent.h"
+#include "epicsExit.h"
+#include "epicsThread.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define ITEMSIZE 24
+#define NMALLOC 16
+#define CACHESIZE 4
+
+static void testUncached(void)
+{
+    void *pvt;
+    void *items[NMALLOC];
+    int i;
+
+    testDiag("Without thread caches");
+
+    freeListInitPvt(&pvt, ITEMSIZE, NMALLOC);
+    testOk1(freeListItemsAvail(pvt)==0);
+
+    items[0] = freeListCalloc(pvt);
+    testOk1(items[0]!=NULL);
+    testOk1(freeListItemsAvail(pvt)==NMALLOC-1);
+
+    for(i=1; i<NMALLOC; i++)
+        items[i] = freeListMalloc(pvt);
+    testOk1(freeListItemsAvail(pvt)==0);
+
+    for(i=0; i<NMALLOC; i++)
+        freeListFree(pvt, items[i]);
+    testOk1(freeListItemsAvail(pvt)==NMALLOC);
+
+    freeListCleanup(pvt);
+}
+
+static void testCached(void)
+{
+    void *pvt;
+    void *items[NMALLOC];
+    int i;
+
+    testDiag("With thread caches");
+
+    freeListInitPvt(&pvt, ITEMSIZE, NMALLOC);
+    freeListSetThreadCache(pvt, CACHESIZE);
+
+    items[0] = freeListCalloc(pvt);
+    testOk1(items[0]!=NULL);
+    /* cached items are still available */
+    testOk1(freeListItemsAvail(pvt)==NMALLOC-1);
+
+    for(i=1; i<NMALLOC; i++)
+        items[i] = freeListMalloc(pvt);
+    testOk1(freeListItemsAvail(pvt)==0);
+    for(i=0; i<NMALLOC; i++) {
+        memset(items[i], i, ITEMSIZE);
+    }
+
+    testDiag("Free more than the cache holds");
+    for(i=0; i<NMALLOC; i++)
+        freeListFree(pvt, items[i]);
+    testOk1(freeListItemsAvail(pvt)==NMALLOC);
+
+    testDiag("Reallocate without growing the list");
+    for(i=0; i<NMALLOC; i++)
+        items[i] = freeListMalloc(pvt);
+    testOk1(freeListItemsAvail(pvt)==0);
+    for(i=0; i<NMALLOC; i++)
+        freeListFree(pvt, items[i]);
+    testOk1(freeListItemsAvail(pvt)==NMALLOC);
+
+    freeListCleanup(pvt);
+}
+
+typedef struct {
+    void *pvt;
+    void *items[NMALLOC];
+    int nalloc;
+    int nfree;
+    epicsEventId exited;
+} threadPvt;
+
+static void threadExited(void *raw)
+{
+    threadPvt *ptp = raw;
+
+    epicsEventMustTrigger(ptp->exited);
+}
+
+static void allocFree(void *raw)
+{
+    threadPvt *ptp = raw;
+    int i;
+
+    /* at thread exit routines run in reverse order, so this one
+     * runs after the thread's caches have been flushed */
+    epicsAtThreadExit(threadExited, ptp);
+
+    for(i=0; i<ptp->nalloc; i++)
+        ptp->items[i] = freeListMalloc(ptp->pvt);
+    for(i=0; i<ptp->nfree; i++)
+        freeListFree(ptp->pvt, ptp->items[i]);
+}
+
+static void runThread(threadPvt *ptp)
+{
+    epicsThreadMustCreate("freeList", epicsThreadPriorityMedium,
+        epicsThreadGetStackSize(epicsThreadStackSmall), allocFree, ptp);
+    epicsEventMustWait(ptp->exited);
+}
+
+static void testThreads(void)
+{
+    threadPvt tp;
+    int i;
+
+    testDiag("Thread exit returns cached items");
+
+    freeListInitPvt(&tp.pvt, ITEMSIZE, NMALLOC);
+    freeListSetThreadCache(tp.pvt, CACHESIZE);
+    tp.exited = epicsEventMustCreate(epicsEventEmpty);
+
+    tp.nalloc = tp.nfree = 3;
+    runThread(&tp);
+    testOk1(freeListItemsAvail(tp.pvt)==NMALLOC);
+
+    /* all of them must be on the shared list now */
+    for(i=0; i<NMALLOC; i++)
+        tp.items[i] = freeListMalloc(tp.pvt);
+    testOk1(freeListItemsAvail(tp.pvt)==0);
+
+    for(i=0; i<NMALLOC; i++)
+        freeListFree(tp.pvt, tp.items[i]);
+
+    testDiag("Items freed by another thread");
+    tp.nalloc = 3;
+    tp.nfree = 0;
+    runThread(&tp);
+    for(i=0; i<tp.nalloc; i++)
+        freeListFree(tp.pvt, tp.items[i]);
+    testOk1(freeListItemsAvail(tp.pvt)==NMALLOC);
+
+    epicsEventDestroy(tp.exited);
+    freeListCleanup(tp.pvt);
+}
+
+MAIN(freeListTest)
+{
+    testPlan(14);
+    testUncached();
+    testCached();
+    testThreads();
+    return testDone();
+}
@@ -0,0 +1,86 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Load an iocLogServer with many logClient connections
+ *
+ * Start an iocLogServer, point EPICS_IOC_LOG_INET and EPICS_IOC_LOG_PORT
+ * at it and run this. Each round opens more clients, which each send
+ * their share of the round's messages as fast as the server takes them.
+ * Count the lines in the server's log file to see that none were lost.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "envDefs.h"
+#include "logClient.h"
+#include "osiSock.h"
+#include "epicsTime.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define MAX_CLIENTS 400
+#define MESSAGES_PER_ROUND 200000
+
+static logClientId clients[MAX_CLIENTS];
+static unsigned nClients;
+
+static void runRound(struct in_addr addr, unsigned short port,
+    unsigned nWanted)
+{
+    epicsTimeStamp start, end;
+    unsigned nMessages, i, j;
+    double elapsed;
+    char msg[128];
+
+    while (nClients < nWanted) {
+        clients[nClients] = logClientCreate(addr, port);
+        if (!clients[nClients]) {
+            testAbort("logClientCreate() failed");
+        }
+        nClients++;
+    }
+
+    nMessages = MESSAGES_PER_ROUND / nClients;
+    epicsTimeGetCurrent(&start);
+    for (i = 0; i < nMessages; i++) {
+        for (j = 0; j < nClients; j++) {
+            sprintf(msg, "iocLogServerPerform: client %u of %u message %u"
+                " of %u\n", j, nClients, i, nMessages);
+            logClientSend(clients[j], msg);
+        }
+    }
+    for (j = 0; j < nClients; j++) {
+        logClientFlush(clients[j]);
+    }
+    epicsTimeGetCurrent(&end);
+
+    elapsed = epicsTimeDiffInSeconds(&end, &start);
+    testDiag("%3u clients: %u messages in %.3f sec, %.0f messages/sec",
+        nClients, nMessages * nClients, elapsed,
+        nMessages * nClients / elapsed);
+}
+
+MAIN(iocLogServerPerform)
+{
+    static const unsigned rounds[] = {1, 10, 100, MAX_CLIENTS};
+    struct in_addr addr;
+    long port;
+    unsigned i;
+
+    testPlan(0);
+
+    if (envGetInetAddrConfigParam(&EPICS_IOC_LOG_INET, &addr) < 0 ||
+            envGetLongConfigParam(&EPICS_IOC_LOG_PORT, &port) < 0) {
+        testSkip(1, "EPICS_IOC_LOG_INET and EPICS_IOC_LOG_PORT not set");
+        return testDone();
+    }
+
+    for (i = 0; i < sizeof(rounds) / sizeof(rounds[0]); i++) {
+        runRound(addr, (unsigned short) port, rounds[i]);
+    }
+    return testDone();
+}
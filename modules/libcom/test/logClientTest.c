@@ -0,0 +1,330 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ * Tests for the log client's queue, using a local socket as the server
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "envDefs.h"
+#include "epicsEvent.h"
+#include "epicsThread.h"
+#include "logClient.h"
+#include "osiSock.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NFLOOD 1000000
+#define NLONG 200
+#define LONG_LEN 32000
+
+static SOCKET listener;
+static struct sockaddr_in serverAddr;
+
+/* lines received by the server */
+static char buf[0x10000];
+static unsigned bufLen;
+static unsigned nLines;
+static char lastLine[128];
+/* lines which aren't one repeated character, when checking */
+static int checkUniform;
+static unsigned nMixed;
+
+static void startServer(void)
+{
+    osiSocklen_t len = sizeof(serverAddr);
+    int rcvbuf = 4096;
+
+    listener = epicsSocketCreate(AF_INET, SOCK_STREAM, 0);
+    if (listener == INVALID_SOCKET)
+        testAbort("No socket");
+    /* accepted sockets inherit this, so the kernel holds less */
+    setsockopt(listener, SOL_SOCKET, SO_RCVBUF, (char *) &rcvbuf,
+        sizeof(rcvbuf));
+
+    memset(&serverAddr, 0, sizeof(serverAddr));
+    serverAddr.sin_family = AF_INET;
+    serverAddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(listener, (struct sockaddr *) &serverAddr, sizeof(serverAddr)) ||
+        getsockname(listener, (struct sockaddr *) &serverAddr, &len) ||
+        listen(listener, 4))
+        testAbort("Can't listen on a local port");
+}
+
+static SOCKET acceptClient(double timeout)
+{
+    struct timeval tv;
+    fd_set fds;
+
+    FD_ZERO(&fds);
+    FD_SET(listener, &fds);
+    tv.tv_sec = (long) timeout;
+    tv.tv_usec = 0;
+    if (select((int) listener + 1, &fds, NULL, NULL, &tv) != 1)
+        return INVALID_SOCKET;
+    return epicsSocketAccept(listener, NULL, NULL);
+}
+
+static void resetLines(void)
+{
+    bufLen = 0;
+    nLines = 0;
+    lastLine[0] = '\0';
+}
+
+/* read from the client until it has sent nWanted lines in total */
+static int readLines(SOCKET sock, unsigned nWanted)
+{
+    while (nLines < nWanted) {
+        struct timeval tv;
+        fd_set fds;
+        char *pline, *pnl;
+        int status;
+
+        FD_ZERO(&fds);
+        FD_SET(sock, &fds);
+        tv.tv_sec = 10;
+        tv.tv_usec = 0;
+        if (select((int) sock + 1, &fds, NULL, NULL, &tv) != 1)
+            return -1;
+        status = recv(sock, &buf[bufLen], sizeof(buf) - bufLen - 1, 0);
+        if (status <= 0)
+            return -1;
+        bufLen += status;
+        buf[bufLen] = '\0';
+
+        pline = buf;
+        while ((pnl = strchr(pline, '\n'))) {
+            size_t len = pnl - pline;
+
+            if (checkUniform) {
+                size_t j = 1;
+
+                while (j < len && pline[j] == pline[0])
+                    j++;
+                if (j != len)
+                    nMixed++;
+            }
+            if (len >= sizeof(lastLine))
+                len = sizeof(lastLine) - 1;
+            memcpy(lastLine, pline, len);
+            lastLine[len] = '\0';
+            nLines++;
+            pline = pnl + 1;
+        }
+        bufLen -= pline - buf;
+        memmove(buf, pline, bufLen);
+    }
+    return 0;
+}
+
+static void testSend(logClientId id, SOCKET sock)
+{
+    logClientStats stats;
+    char msg[64];
+    int i;
+
+    testDiag("Send and flush");
+
+    resetLines();
+    for (i = 0; i < 100; i++) {
+        sprintf(msg, "message %d\n", i);
+        logClientSend(id, msg);
+    }
+    logClientFlush(id);
+
+    i = readLines(sock, 100);
+    testOk(i == 0, "Server received %u lines", nLines);
+    testOk(strcmp(lastLine, "message 99") == 0, "Last line \"%s\"", lastLine);
+
+    logClientGetStats(id, &stats);
+    testOk(stats.connected, "Connected");
+    testOk(stats.queued == 100, "%lu messages queued", stats.queued);
+    testOk(stats.sent == 100, "%lu messages sent", stats.sent);
+    testOk(stats.dropped == 0, "%lu messages dropped", stats.dropped);
+    testOk(stats.pending == 0, "%lu messages pending", stats.pending);
+}
+
+/* queue more than the server takes, then let it read everything */
+static void testFlood(const char *policy, int dropOldest)
+{
+    logClientStats stats;
+    logClientId id;
+    SOCKET sock;
+    char msg[64];
+    int i;
+
+    testDiag("Flood a server which does not read, %s", policy);
+
+    epicsEnvSet("EPICS_IOC_LOG_QUEUE_FULL", policy);
+    id = logClientCreate(serverAddr.sin_addr, ntohs(serverAddr.sin_port));
+    sock = acceptClient(5.0);
+    if (!id || sock == INVALID_SOCKET)
+        testAbort("No connection from the log client");
+
+    /* the old client blocked here until the server read */
+    for (i = 0; i < NFLOOD; i++) {
+        sprintf(msg, "flood message %d\n", i);
+        logClientSend(id, msg);
+    }
+
+    logClientGetStats(id, &stats);
+    testOk(stats.dropped > 0, "%lu messages dropped", stats.dropped);
+    testOk(stats.queued + (dropOldest ? 0 : stats.dropped) == NFLOOD,
+        "%lu messages queued", stats.queued);
+
+    resetLines();
+    i = readLines(sock, NFLOOD - stats.dropped);
+    testOk(i == 0, "Server received %u lines", nLines);
+
+    sprintf(msg, "flood message %d", NFLOOD - 1);
+    testOk((strcmp(lastLine, msg) == 0) == dropOldest,
+        "Last line \"%s\"", lastLine);
+
+    logClientGetStats(id, &stats);
+    testOk(stats.sent == NFLOOD - stats.dropped, "%lu messages sent",
+        stats.sent);
+
+    epicsSocketDestroy(sock);
+}
+
+static logClientId longId;
+static epicsEventId longDone[2];
+
+/* arg is LONG_LEN copies of 'a' or 'b' and a newline */
+static void sendLong(void *arg)
+{
+    const char *msg = arg;
+    int i;
+
+    for (i = 0; i < NLONG; i++)
+        logClientSend(longId, msg);
+    epicsEventMustTrigger(longDone[msg[0] - 'a']);
+}
+
+/* messages longer than the send buffer are queued in pieces */
+static void testBlock(void)
+{
+    static char msgs[2][LONG_LEN + 2];
+    logClientStats stats;
+    SOCKET sock;
+    int i;
+
+    testDiag("Long messages from two threads, BLOCK");
+
+    epicsEnvSet("EPICS_IOC_LOG_QUEUE_FULL", "BLOCK");
+    epicsEnvSet("EPICS_IOC_LOG_QUEUE_SIZE", "40000");
+    longId = logClientCreate(serverAddr.sin_addr, ntohs(serverAddr.sin_port));
+    sock = acceptClient(5.0);
+    if (!longId || sock == INVALID_SOCKET)
+        testAbort("No connection from the log client");
+
+    for (i = 0; i < 2; i++) {
+        longDone[i] = epicsEventMustCreate(epicsEventEmpty);
+        memset(msgs[i], 'a' + i, LONG_LEN);
+        msgs[i][LONG_LEN] = '\n';
+        epicsThreadMustCreate("sendLong", epicsThreadPriorityLow,
+            epicsThreadGetStackSize(epicsThreadStackSmall), sendLong,
+            msgs[i]);
+    }
+
+    /* let the socket buffers and the queue fill, so both threads wait
+     * for room */
+    epicsThreadSleep(1.0);
+
+    resetLines();
+    checkUniform = 1;
+    nMixed = 0;
+    i = readLines(sock, 2 * NLONG);
+    checkUniform = 0;
+    testOk(i == 0, "Server received %u lines", nLines);
+    testOk(nMixed == 0, "%u lines had pieces of another message", nMixed);
+
+    for (i = 0; i < 2; i++) {
+        epicsEventMustWait(longDone[i]);
+        epicsEventDestroy(longDone[i]);
+    }
+    logClientGetStats(longId, &stats);
+    testOk(stats.dropped == 0, "%lu messages dropped", stats.dropped);
+
+    epicsSocketDestroy(sock);
+    epicsEnvSet("EPICS_IOC_LOG_QUEUE_SIZE", "16384");
+}
+
+static void testReconnect(logClientId id, SOCKET sock)
+{
+    logClientStats stats;
+    char msg[64];
+    int i;
+
+    testDiag("Server closes the connection");
+
+    epicsSocketDestroy(sock);
+
+    /* the client notices when a send fails */
+    for (i = 0; i < 100; i++) {
+        logClientSend(id, "lost message\n");
+        epicsThreadSleep(0.02);
+        logClientGetStats(id, &stats);
+        if (!stats.connected)
+            break;
+    }
+    testOk(!stats.connected, "Client disconnected");
+
+    for (i = 0; i < 10; i++) {
+        sprintf(msg, "queued message %d\n", i);
+        logClientSend(id, msg);
+    }
+    logClientGetStats(id, &stats);
+    testOk(stats.pending >= 10, "%lu messages pending", stats.pending);
+
+    sock = acceptClient(15.0);
+    if (sock == INVALID_SOCKET) {
+        testFail("No reconnection");
+        return;
+    }
+
+    /* those sent before the failure can't be known, wait for the last */
+    resetLines();
+    while (strcmp(lastLine, "queued message 9") &&
+        readLines(sock, nLines + 1) == 0);
+    testOk(strcmp(lastLine, "queued message 9") == 0,
+        "Queued messages sent after reconnecting");
+
+    logClientGetStats(id, &stats);
+    testOk(stats.reconnects == 1, "%lu reconnects", stats.reconnects);
+    testOk(stats.pending == 0, "%lu messages pending", stats.pending);
+
+    epicsSocketDestroy(sock);
+}
+
+MAIN(logClientTest)
+{
+    logClientId id;
+    SOCKET sock;
+
+    testPlan(25);
+
+    osiSockAttach();
+    startServer();
+
+    epicsEnvSet("EPICS_IOC_LOG_QUEUE_SIZE", "16384");
+
+    id = logClientCreate(serverAddr.sin_addr, ntohs(serverAddr.sin_port));
+    sock = acceptClient(5.0);
+    if (!id || sock == INVALID_SOCKET)
+        testAbort("No connection from the log client");
+
+    testSend(id, sock);
+    testReconnect(id, sock);
+    testFlood("DROP_NEWEST", 0);
+    testFlood("DROP_OLDEST", 1);
+    testBlock();
+
+    epicsSocketDestroy(listener);
+    return testDone();
+}
@@ -0,0 +1,196 @@
+/*************************************************************************\
+* Copyright (c) 2019 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/* ringMPMCTest.c */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "epicsThread.h"
+#include "epicsRingMPMC.h"
+#include "epicsAtomic.h"
+#include "epicsEvent.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NTHREADS 4
+#define NPERPRODUCER 20000
+
+static
+void *int2ptr(size_t i)
+{
+    char *zero = 0;
+    return zero+i;
+}
+
+static
+size_t ptr2int(void *p)
+{
+    char *zero = 0, *p2 = p;
+    return p2-zero;
+}
+
+static void testSingle(void)
+{
+    int i;
+    const int rsize = 100;
+    epicsRingMPMCId ring = epicsRingMPMCCreate(rsize);
+
+    testDiag("Testing operations w/o threading");
+
+    testOk1(ring!=NULL);
+    testOk1(epicsRingMPMCIsEmpty(ring));
+    testOk1(epicsRingMPMCGetSize(ring)==rsize);
+    testOk1(epicsRingMPMCGetUsed(ring)==0);
+    testOk1(epicsRingMPMCGetHighWaterMark(ring)==0);
+    testOk1(epicsRingMPMCPop(ring)==NULL);
+
+    testOk1(epicsRingMPMCPush(ring, int2ptr(1))==1);
+    testOk1(!epicsRingMPMCIsEmpty(ring));
+    testOk1(epicsRingMPMCGetUsed(ring)==1);
+    testOk1(epicsRingMPMCGetHighWaterMark(ring)==1);
+
+    testDiag("Fill it up");
+    for(i=2; i<2*rsize; i++) {
+        if(!epicsRingMPMCPush(ring, int2ptr(i)))
+            break;
+    }
+    testOk(i==rsize+1, "%d == %d", i, rsize+1);
+    testOk1(epicsRingMPMCGetUsed(ring)==rsize);
+    testOk1(epicsRingMPMCGetHighWaterMark(ring)==rsize);
+
+    testDiag("Drain it out");
+    for(i=1; i<2*rsize; i++) {
+        void *addr = epicsRingMPMCPop(ring);
+        if(addr==NULL || ptr2int(addr)!=i)
+            break;
+    }
+    testOk(i==rsize+1, "%d == %d", i, rsize+1);
+    testOk1(epicsRingMPMCIsEmpty(ring));
+    testOk1(epicsRingMPMCGetHighWaterMark(ring)==rsize);
+
+    epicsRingMPMCResetHighWaterMark(ring);
+    testOk1(epicsRingMPMCGetHighWaterMark(ring)==0);
+
+    testDiag("Wrap around several laps");
+    for(i=1; i<5*rsize; i++) {
+        void *addr;
+        if(!epicsRingMPMCPush(ring, int2ptr(i)))
+            break;
+        addr = epicsRingMPMCPop(ring);
+        if(addr==NULL || ptr2int(addr)!=i)
+            break;
+    }
+    testOk(i==5*rsize, "%d == %d", i, 5*rsize);
+    testOk1(epicsRingMPMCGetHighWaterMark(ring)==1);
+
+    epicsRingMPMCDelete(ring);
+}
+
+typedef struct {
+    epicsRingMPMCId ring;
+    epicsEventId done;
+    int id;
+    size_t sum;
+    size_t count;
+} multiPvt;
+
+static multiPvt producers[NTHREADS], consumers[NTHREADS];
+static size_t totalPopped;
+
+static void producer(void *raw)
+{
+    multiPvt *pvt = raw;
+    size_t i;
+
+    for(i=1; i<=NPERPRODUCER; i++) {
+        void *addr = int2ptr(pvt->id*NPERPRODUCER + i);
+        if(!epicsRingMPMCPush(pvt->ring, addr)) {
+            testDiag("producer %d push %lu failed", pvt->id, (unsigned long)i);
+            break;
+        }
+    }
+    epicsEventMustTrigger(pvt->done);
+}
+
+static void consumer(void *raw)
+{
+    multiPvt *pvt = raw;
+    const size_t n = (size_t)NTHREADS*NPERPRODUCER;
+
+    while(epicsAtomicGetSizeT(&totalPopped) < n) {
+        void *addr = epicsRingMPMCPop(pvt->ring);
+        if(addr) {
+            pvt->sum += ptr2int(addr);
+            pvt->count++;
+            epicsAtomicIncrSizeT(&totalPopped);
+        }
+        else {
+            epicsThreadSleep(0.0);
+        }
+    }
+    epicsEventMustTrigger(pvt->done);
+}
+
+/* The ring can hold everything, so the producers never have to wait for
+ * the consumers.  The consumers spin until every item has been popped, so
+ * they run at a lower priority than the producers to avoid starving them
+ * on a single CPU.
+ */
+static void testMulti(void)
+{
+    size_t n = (size_t)NTHREADS*NPERPRODUCER;
+    epicsRingMPMCId ring = epicsRingMPMCCreate((int)n);
+    size_t sum = 0, count = 0;
+    int i;
+
+    testDiag("%d producers, %d consumers", NTHREADS, NTHREADS);
+
+    totalPopped = 0;
+    for(i=0; i<NTHREADS; i++) {
+        consumers[i].ring = producers[i].ring = ring;
+        consumers[i].done = epicsEventMustCreate(epicsEventEmpty);
+        producers[i].done = epicsEventMustCreate(epicsEventEmpty);
+        producers[i].id = i;
+        epicsThreadMustCreate("producer", epicsThreadPriorityMedium,
+            epicsThreadGetStackSize(epicsThreadStackSmall),
+            producer, &producers[i]);
+    }
+    for(i=0; i<NTHREADS; i++) {
+        epicsThreadMustCreate("consumer", epicsThreadPriorityLow,
+            epicsThreadGetStackSize(epicsThreadStackSmall),
+            consumer, &consumers[i]);
+    }
+
+    for(i=0; i<NTHREADS; i++) {
+        epicsEventMustWait(producers[i].done);
+        epicsEventMustWait(consumers[i].done);
+        sum += consumers[i].sum;
+        count += consumers[i].count;
+        testDiag("consumer %d popped %lu", i, (unsigned long)consumers[i].count);
+        epicsEventDestroy(producers[i].done);
+        epicsEventDestroy(consumers[i].done);
+    }
+
+    testOk(count==n, "Popped %lu of %lu", (unsigned long)count, (unsigned long)n);
+    /* sum of 1..n */
+    testOk(sum==n*(n+1)/2, "Checksum %lu == %lu",
+           (unsigned long)sum, (unsigned long)(n*(n+1)/2));
+    testOk1(epicsRingMPMCIsEmpty(ring));
+    testOk1(epicsRingMPMCGetHighWaterMark(ring)<=(int)n);
+
+    epicsRingMPMCDelete(ring);
+}
+
+MAIN(ringMPMCTest)
+{
+    testPlan(23);
+    testSingle();
+    testMulti();
+    return testDone();
+}